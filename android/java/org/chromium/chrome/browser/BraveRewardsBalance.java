@@ -31,11 +31,14 @@ class BraveRewardsBalance {
     Map <String, Double> mWallets;
 
     BraveRewardsBalance (String json_balance) throws JSONException {
+        fromJson (new JSONObject(json_balance));
+    }
+
+    BraveRewardsBalance (JSONObject json_balance) throws JSONException {
         fromJson (json_balance);
     }
 
-    private void fromJson(String json_balance) throws JSONException {
-        JSONObject jsonroot = new JSONObject(json_balance);
+    private void fromJson(JSONObject jsonroot) throws JSONException {
         mTotal = jsonroot.getDouble(JSON_TOTAL);
 
         mRates = new HashMap <>();
@@ -263,6 +263,20 @@ public class BraveRewardsNativeWorker {
         }
     }
 
+    @Nullable
+    public BraveRewardsSnapshot GetPublisherSnapshot(int tabId) {
+        synchronized(lock) {
+            String json = nativeGetPublisherSnapshot(mNativeBraveRewardsNativeWorker, tabId);
+            BraveRewardsSnapshot snapshot = null;
+            try {
+                snapshot = new BraveRewardsSnapshot(json);
+            } catch (JSONException e) {
+                snapshot = null;
+            }
+            return snapshot;
+        }
+    }
+
     public void IncludeInAutoContribution(int tabId, boolean exclude) {
         synchronized(lock) {
             nativeIncludeInAutoContribution(mNativeBraveRewardsNativeWorker, tabId, exclude);
@@ -654,6 +668,7 @@ public class BraveRewardsNativeWorker {
     private native int nativeGetPublisherPercent(long nativeBraveRewardsNativeWorker, int tabId);
     private native boolean nativeGetPublisherExcluded(long nativeBraveRewardsNativeWorker, int tabId);
     private native int nativeGetPublisherStatus(long nativeBraveRewardsNativeWorker, int tabId);
+    private native String nativeGetPublisherSnapshot(long nativeBraveRewardsNativeWorker, int tabId);
     private native void nativeIncludeInAutoContribution(long nativeBraveRewardsNativeWorker, int tabId,
       boolean exclude);
     private native void nativeRemovePublisherFromMap(long nativeBraveRewardsNativeWorker, int tabId);
@@ -1239,7 +1239,13 @@ public class BraveRewardsPanelPopup implements BraveRewardsObserver, BraveReward
             btRewardsSummary.setClickable(true);
         }
 
-        String publisherFavIconURL = mBraveRewardsNativeWorker.GetPublisherFavIconURL(currentTabId);
+        BraveRewardsSnapshot snapshot =
+                mBraveRewardsNativeWorker.GetPublisherSnapshot(currentTabId);
+        if (snapshot == null || !snapshot.mHasPublisher) {
+            return;
+        }
+
+        String publisherFavIconURL = snapshot.mPublisherFavIconURL;
         Tab currentActiveTab = BraveRewardsHelper.currentActiveTab();
         String url = currentActiveTab.getUrlString();
         final String favicon_url = (publisherFavIconURL.isEmpty()) ? url : publisherFavIconURL;
@@ -1251,8 +1257,8 @@ public class BraveRewardsPanelPopup implements BraveRewardsObserver, BraveReward
         LinearLayout ll = (LinearLayout)this.root.findViewById(R.id.br_central_layout);
         ll.setBackgroundColor(Color.WHITE);
 
-        String pubName = thisObject.mBraveRewardsNativeWorker.GetPublisherName(currentTabId);
-        String pubId = thisObject.mBraveRewardsNativeWorker.GetPublisherId(currentTabId);
+        String pubName = snapshot.mPublisherName;
+        String pubId = snapshot.mPublisherId;
         String pubSuffix = "";
         if (pubId.startsWith(YOUTUBE_TYPE)) {
             pubSuffix = thisObject.root.getResources().getString(R.string.brave_ui_on_youtube);
@@ -1263,19 +1269,18 @@ public class BraveRewardsPanelPopup implements BraveRewardsObserver, BraveReward
         TextView tv = (TextView)thisObject.root.findViewById(R.id.publisher_name);
         tv.setText(Html.fromHtml(pubName));
         tv = (TextView)thisObject.root.findViewById(R.id.publisher_attention);
-        String percent = Integer.toString(thisObject.mBraveRewardsNativeWorker.GetPublisherPercent(currentTabId)) + "%";
+        String percent = Integer.toString(snapshot.mPublisherPercent) + "%";
         tv.setText(percent);
         if (btAutoContribute != null) {
             btAutoContribute.setOnCheckedChangeListener(null);
-            btAutoContribute.setChecked(!thisObject.mBraveRewardsNativeWorker.GetPublisherExcluded(currentTabId));
+            btAutoContribute.setChecked(!snapshot.mPublisherExcluded);
             btAutoContribute.setOnCheckedChangeListener(autoContributeSwitchListener);
         }
 
         // set publisher verified/unverified status
         String verified_text = "";
         TextView tvVerified = (TextView)root.findViewById(R.id.publisher_verified);
-        @PublisherStatus int pubStatus =
-                thisObject.mBraveRewardsNativeWorker.GetPublisherStatus(currentTabId);
+        @PublisherStatus int pubStatus = snapshot.mPublisherStatus;
         if (pubStatus == BraveRewardsPublisher.CONNECTED ||
                 pubStatus == BraveRewardsPublisher.VERIFIED) {
             verified_text = root.getResources().getString(R.string.brave_ui_verified_publisher);
@@ -1291,7 +1296,7 @@ public class BraveRewardsPanelPopup implements BraveRewardsObserver, BraveReward
         // blinded wallets)
         String verified_description = "";
         if (pubStatus == BraveRewardsPublisher.CONNECTED) {
-            BraveRewardsBalance balance_obj = mBraveRewardsNativeWorker.GetWalletBalance();
+            BraveRewardsBalance balance_obj = snapshot.mBalance;
             if (balance_obj != null) {
                 double braveFunds = balance_obj.mWallets.get(BraveRewardsBalance.WALLET_ANONYMOUS) +
                         balance_obj.mWallets.get(BraveRewardsBalance.WALLET_BLINDED);
@@ -0,0 +1,77 @@
+/** Copyright (c) 2020 The Brave Authors. All rights reserved.
+  * This Source Code Form is subject to the terms of the Mozilla Public
+  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+  * You can obtain one at http://mozilla.org/MPL/2.0/.
+  */
+package org.chromium.chrome.browser;
+
+import androidx.annotation.Nullable;
+import androidx.annotation.VisibleForTesting;
+
+import org.json.JSONException;
+import org.json.JSONObject;
+
+import org.chromium.chrome.browser.BraveRewardsPublisher.PublisherStatus;
+
+/**
+ * Publisher of a tab and the wallet balance, read from native in one call.
+ * Matches BraveRewardsNativeWorker::GetPublisherSnapshot in
+ * src/brave/browser/brave_rewards/android/brave_rewards_native_worker.cc
+ */
+class BraveRewardsSnapshot {
+    public static final String JSON_PUBLISHER = "publisher";
+    public static final String JSON_BALANCE = "balance";
+    public static final String JSON_ID = "id";
+    public static final String JSON_NAME = "name";
+    public static final String JSON_URL = "url";
+    public static final String JSON_FAVICON_URL = "favicon_url";
+    public static final String JSON_PERCENT = "percent";
+    public static final String JSON_EXCLUDED = "excluded";
+    public static final String JSON_STATUS = "status";
+
+    boolean mHasPublisher;
+    String mPublisherId = "";
+    String mPublisherName = "";
+    String mPublisherURL = "";
+    String mPublisherFavIconURL = "";
+    int mPublisherPercent;
+    boolean mPublisherExcluded;
+    @PublisherStatus int mPublisherStatus = BraveRewardsPublisher.NOT_VERIFIED;
+    @Nullable BraveRewardsBalance mBalance;
+
+    BraveRewardsSnapshot (String json_snapshot) throws JSONException {
+        fromJson (json_snapshot);
+    }
+
+    private void fromJson(String json_snapshot) throws JSONException {
+        JSONObject jsonroot = new JSONObject(json_snapshot);
+
+        JSONObject json_publisher = jsonroot.optJSONObject(JSON_PUBLISHER);
+        mHasPublisher = json_publisher != null;
+        if (mHasPublisher) {
+            mPublisherId = json_publisher.getString(JSON_ID);
+            mPublisherName = json_publisher.getString(JSON_NAME);
+            mPublisherURL = json_publisher.getString(JSON_URL);
+            mPublisherFavIconURL = json_publisher.getString(JSON_FAVICON_URL);
+            mPublisherPercent = json_publisher.getInt(JSON_PERCENT);
+            mPublisherExcluded = json_publisher.getBoolean(JSON_EXCLUDED);
+            mPublisherStatus = json_publisher.getInt(JSON_STATUS);
+        }
+
+        JSONObject json_balance = jsonroot.optJSONObject(JSON_BALANCE);
+        mBalance = json_balance != null ? new BraveRewardsBalance(json_balance) : null;
+    }
+
+    @VisibleForTesting
+    @Override
+    public String toString() {
+        return "BraveRewardsSnapshot{" +
+                "mHasPublisher=" + mHasPublisher +
+                ", mPublisherId='" + mPublisherId + '\'' +
+                ", mPublisherName='" + mPublisherName + '\'' +
+                ", mPublisherPercent=" + mPublisherPercent +
+                ", mPublisherExcluded=" + mPublisherExcluded +
+                ", mPublisherStatus=" + mPublisherStatus +
+                ", mBalance=" + mBalance + '}';
+    }
+}
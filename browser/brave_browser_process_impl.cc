@@ -11,6 +11,7 @@
 #include "base/path_service.h"
 #include "base/task/post_task.h"
 #include "base/threading/sequenced_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/brave_stats_updater.h"
 #include "brave/browser/component_updater/brave_component_updater_configurator.h"
 #include "brave/browser/component_updater/brave_component_updater_delegate.h"
@@ -34,6 +35,7 @@
 #include "brave/components/p3a/brave_histogram_rewrite.h"
 #include "brave/components/p3a/brave_p3a_service.h"
 #include "brave/services/network/public/cpp/system_request_handler.h"
+#include "chrome/browser/after_startup_task_utils.h"
 #include "chrome/browser/component_updater/component_updater_utils.h"
 #include "chrome/browser/net/system_network_context_manager.h"
 #include "chrome/browser/ui/browser_list.h"
@@ -69,6 +71,7 @@
 
 #if BUILDFLAG(ENABLE_TOR)
 #include "brave/browser/extensions/brave_tor_client_updater.h"
+#include "brave/browser/tor/tor_pre_launcher.h"
 #include "brave/common/tor/pref_names.h"
 #endif
 
@@ -111,23 +114,30 @@ BraveBrowserProcessImpl::BraveBrowserProcessImpl(StartupData* startup_data)
   g_brave_browser_process = this;
 
 #if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
-  brave_referrals_service_ = brave::BraveReferralsServiceFactory(local_state());
-  base::SequencedTaskRunnerHandle::Get()->PostDelayedTask(
-      FROM_HERE,
+  {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::CreateReferralsService");
+    brave_referrals_service_ =
+        brave::BraveReferralsServiceFactory(local_state());
+  }
+  // Referral and usage pings read files and hit the network, so they wait
+  // until startup is complete (first paint or a timeout) instead of
+  // competing with session restore.
+  AfterStartupTaskUtils::PostTask(
+      FROM_HERE, base::SequencedTaskRunnerHandle::Get(),
       base::BindOnce(
           [](brave::BraveReferralsService* referrals_service) {
             referrals_service->Start();
           },
-          base::Unretained(brave_referrals_service_.get())),
-      base::TimeDelta::FromSeconds(3));
+          base::Unretained(brave_referrals_service_.get())));
 #endif
 
-  base::SequencedTaskRunnerHandle::Get()->PostTask(
-      FROM_HERE, base::BindOnce(
-                     [](brave::BraveStatsUpdater* stats_updater) {
-                       stats_updater->Start();
-                     },
-                     base::Unretained(brave_stats_updater())));
+  AfterStartupTaskUtils::PostTask(
+      FROM_HERE, base::SequencedTaskRunnerHandle::Get(),
+      base::BindOnce(
+          [](brave::BraveStatsUpdater* stats_updater) {
+            stats_updater->Start();
+          },
+          base::Unretained(brave_stats_updater())));
   // Disabled on mobile platforms, see for instance issues/6176
 #if BUILDFLAG(BRAVE_P3A_ENABLED)
   // Create P3A Service early to catch more histograms. The full initialization
@@ -154,6 +164,11 @@ void BraveBrowserProcessImpl::Init() {
       tor::prefs::kTorDisabled,
       base::Bind(&BraveBrowserProcessImpl::OnTorEnabledChanged,
                  base::Unretained(this)));
+  if (local_state()->GetBoolean(tor::prefs::kTorPreLaunch) &&
+      !local_state()->GetBoolean(tor::prefs::kTorDisabled)) {
+    tor_pre_launcher_ = std::make_unique<tor::TorPreLauncher>(
+        tor_client_updater(), local_state());
+  }
 #endif
 
   InitSystemRequestHandlerCallback();
@@ -177,6 +192,7 @@ ProfileManager* BraveBrowserProcessImpl::profile_manager() {
 
 void BraveBrowserProcessImpl::StartBraveServices() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::StartBraveServices");
 
   ad_block_service()->Start();
   ad_block_custom_filters_service()->Start();
@@ -195,6 +211,7 @@ void BraveBrowserProcessImpl::StartBraveServices() {
   speedreader_whitelist();
 #endif
   // Now start the local data files service, which calls all observers.
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::StartLocalDataFiles");
   local_data_files_service()->Start();
 }
 
@@ -202,6 +219,7 @@ brave_shields::AdBlockService* BraveBrowserProcessImpl::ad_block_service() {
   if (ad_block_service_)
     return ad_block_service_.get();
 
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::CreateAdBlockService");
   ad_block_service_ =
       brave_shields::AdBlockServiceFactory(brave_component_updater_delegate());
   return ad_block_service_.get();
@@ -209,19 +227,25 @@ brave_shields::AdBlockService* BraveBrowserProcessImpl::ad_block_service() {
 
 brave_shields::AdBlockCustomFiltersService*
 BraveBrowserProcessImpl::ad_block_custom_filters_service() {
-  if (!ad_block_custom_filters_service_)
+  if (!ad_block_custom_filters_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateAdBlockCustomFiltersService");
     ad_block_custom_filters_service_ =
         brave_shields::AdBlockCustomFiltersServiceFactory(
             brave_component_updater_delegate());
+  }
   return ad_block_custom_filters_service_.get();
 }
 
 brave_shields::AdBlockRegionalServiceManager*
 BraveBrowserProcessImpl::ad_block_regional_service_manager() {
-  if (!ad_block_regional_service_manager_)
+  if (!ad_block_regional_service_manager_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateAdBlockRegionalService");
     ad_block_regional_service_manager_ =
         brave_shields::AdBlockRegionalServiceManagerFactory(
             brave_component_updater_delegate());
+  }
   return ad_block_regional_service_manager_.get();
 }
 
@@ -231,6 +255,8 @@ BraveBrowserProcessImpl::ntp_background_images_service() {
     return nullptr;
 
   if (!ntp_background_images_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateNTPBackgroundImagesService");
     base::FilePath user_data_dir;
     base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir);
     ntp_background_images_service_ =
@@ -248,6 +274,8 @@ BraveBrowserProcessImpl::ntp_background_images_service() {
 brave_component_updater::ExtensionWhitelistService*
 BraveBrowserProcessImpl::extension_whitelist_service() {
   if (!extension_whitelist_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateExtensionWhitelistService");
     extension_whitelist_service_ =
         brave_component_updater::ExtensionWhitelistServiceFactory(
             local_data_files_service(), kVettedExtensions);
@@ -259,6 +287,8 @@ BraveBrowserProcessImpl::extension_whitelist_service() {
 brave_shields::ReferrerWhitelistService*
 BraveBrowserProcessImpl::referrer_whitelist_service() {
   if (!referrer_whitelist_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateReferrerWhitelistService");
     referrer_whitelist_service_ =
         brave_shields::ReferrerWhitelistServiceFactory(
             local_data_files_service());
@@ -270,6 +300,8 @@ BraveBrowserProcessImpl::referrer_whitelist_service() {
 greaselion::GreaselionDownloadService*
 BraveBrowserProcessImpl::greaselion_download_service() {
   if (!greaselion_download_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateGreaselionDownloadService");
     greaselion_download_service_ = greaselion::GreaselionDownloadServiceFactory(
         local_data_files_service());
   }
@@ -280,6 +312,8 @@ BraveBrowserProcessImpl::greaselion_download_service() {
 brave_shields::TrackingProtectionService*
 BraveBrowserProcessImpl::tracking_protection_service() {
   if (!tracking_protection_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateTrackingProtectionService");
     tracking_protection_service_ =
         brave_shields::TrackingProtectionServiceFactory(
             local_data_files_service());
@@ -289,9 +323,12 @@ BraveBrowserProcessImpl::tracking_protection_service() {
 
 brave_shields::HTTPSEverywhereService*
 BraveBrowserProcessImpl::https_everywhere_service() {
-  if (!https_everywhere_service_)
+  if (!https_everywhere_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateHTTPSEverywhereService");
     https_everywhere_service_ = brave_shields::HTTPSEverywhereServiceFactory(
         brave_component_updater_delegate());
+  }
   return https_everywhere_service_.get();
 }
 
@@ -320,6 +357,7 @@ BraveBrowserProcessImpl::tor_client_updater() {
   if (tor_client_updater_)
     return tor_client_updater_.get();
 
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::CreateTorClientUpdater");
   tor_client_updater_ = extensions::BraveTorClientUpdaterFactory(
       brave_component_updater_delegate());
   return tor_client_updater_.get();
@@ -338,6 +376,7 @@ brave::BraveP3AService* BraveBrowserProcessImpl::brave_p3a_service() {
   if (brave_p3a_service_) {
     return brave_p3a_service_.get();
   }
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::CreateP3AService");
   brave_p3a_service_ = new brave::BraveP3AService(local_state());
   brave_p3a_service()->InitCallbacks();
   return brave_p3a_service_.get();
@@ -353,8 +392,10 @@ BraveBrowserProcessImpl::brave_widevine_bundle_manager() {
 #endif
 
 brave::BraveStatsUpdater* BraveBrowserProcessImpl::brave_stats_updater() {
-  if (!brave_stats_updater_)
+  if (!brave_stats_updater_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::CreateStatsUpdater");
     brave_stats_updater_ = brave::BraveStatsUpdaterFactory(local_state());
+  }
   return brave_stats_updater_.get();
 }
 
@@ -396,6 +437,8 @@ void BraveBrowserProcessImpl::CreateNotificationPlatformBridge() {
 speedreader::SpeedreaderWhitelist*
 BraveBrowserProcessImpl::speedreader_whitelist() {
   if (!speedreader_whitelist_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::CreateSpeedreaderWhitelist");
     speedreader_whitelist_.reset(new speedreader::SpeedreaderWhitelist(
         brave_component_updater_delegate()));
   }
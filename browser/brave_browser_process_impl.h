@@ -62,6 +62,10 @@ namespace speedreader {
 class SpeedreaderWhitelist;
 }
 
+namespace tor {
+class TorPreLauncher;
+}
+
 class BraveBrowserProcessImpl : public BrowserProcessImpl {
  public:
   explicit BraveBrowserProcessImpl(StartupData* startup_data);
@@ -150,6 +154,7 @@ class BraveBrowserProcessImpl : public BrowserProcessImpl {
 #endif
 #if BUILDFLAG(ENABLE_TOR)
   std::unique_ptr<extensions::BraveTorClientUpdater> tor_client_updater_;
+  std::unique_ptr<tor::TorPreLauncher> tor_pre_launcher_;
 #endif
 #if BUILDFLAG(BUNDLE_WIDEVINE_CDM)
   std::unique_ptr<BraveWidevineBundleManager> brave_widevine_bundle_manager_;
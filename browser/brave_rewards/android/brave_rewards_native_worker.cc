@@ -15,6 +15,7 @@
 #include "base/android/jni_string.h"
 #include "base/android/jni_array.h"
 #include "base/json/json_writer.h"
+#include "base/values.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
@@ -201,6 +202,44 @@ int BraveRewardsNativeWorker::GetPublisherStatus(JNIEnv* env,
   return res;
 }
 
+base::android::ScopedJavaLocalRef<jstring>
+    BraveRewardsNativeWorker::GetPublisherSnapshot(JNIEnv* env,
+        const base::android::JavaParamRef<jobject>& obj, uint64_t tabId) {
+  base::DictionaryValue snapshot;
+
+  PublishersInfoMap::const_iterator iter(map_publishers_info_.find(tabId));
+  if (iter != map_publishers_info_.end()) {
+    base::DictionaryValue publisher;
+    publisher.SetStringKey("id", iter->second->id);
+    publisher.SetStringKey("name", iter->second->name);
+    publisher.SetStringKey("url", iter->second->url);
+    publisher.SetStringKey("favicon_url", iter->second->favicon_url);
+    publisher.SetIntKey("percent", iter->second->percent);
+    publisher.SetBoolKey("excluded",
+        iter->second->excluded == ledger::PublisherExclude::EXCLUDED);
+    publisher.SetIntKey("status", static_cast<int>(iter->second->status));
+    snapshot.SetKey("publisher", std::move(publisher));
+  }
+
+  base::DictionaryValue balance;
+  balance.SetDoubleKey(brave_rewards::Balance::kJsonTotal, balance_.total);
+  base::DictionaryValue rates;
+  for (const auto& item : balance_.rates) {
+    rates.SetDoubleKey(item.first, item.second);
+  }
+  balance.SetKey(brave_rewards::Balance::kJsonRates, std::move(rates));
+  base::DictionaryValue wallets;
+  for (const auto& item : balance_.wallets) {
+    wallets.SetDoubleKey(item.first, item.second);
+  }
+  balance.SetKey(brave_rewards::Balance::kJsonWallets, std::move(wallets));
+  snapshot.SetKey("balance", std::move(balance));
+
+  std::string json;
+  base::JSONWriter::Write(snapshot, &json);
+  return base::android::ConvertUTF8ToJavaString(env, json);
+}
+
 void BraveRewardsNativeWorker::IncludeInAutoContribution(JNIEnv* env,
         const base::android::JavaParamRef<jobject>& obj, uint64_t tabId,
         bool exclude) {
@@ -90,6 +90,12 @@ class BraveRewardsNativeWorker : public brave_rewards::RewardsServiceObserver,
     int GetPublisherStatus(JNIEnv* env,
         const base::android::JavaParamRef<jobject>& obj, uint64_t tabId);
 
+    // Publisher of |tabId| and the wallet balance as one JSON object, so the
+    // rewards panel can be filled with a single call
+    base::android::ScopedJavaLocalRef<jstring> GetPublisherSnapshot(
+        JNIEnv* env, const base::android::JavaParamRef<jobject>& obj,
+        uint64_t tabId);
+
     void GetCurrentBalanceReport(JNIEnv* env,
         const base::android::JavaParamRef<jobject>& obj);
 
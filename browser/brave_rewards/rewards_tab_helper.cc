@@ -5,6 +5,7 @@
 
 #include "brave/browser/brave_rewards/rewards_tab_helper.h"
 
+#include "brave/components/brave_rewards/browser/background_job_scheduler.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -44,6 +45,7 @@ RewardsTabHelper::RewardsTabHelper(content::WebContents* web_contents)
 }
 
 RewardsTabHelper::~RewardsTabHelper() {
+  DidStopLoading();
   if (rewards_service_)
     rewards_service_->RemoveObserver(this);
 #if !defined(OS_ANDROID)
@@ -51,6 +53,22 @@ RewardsTabHelper::~RewardsTabHelper() {
 #endif
 }
 
+void RewardsTabHelper::DidStartLoading() {
+  if (is_loading_)
+    return;
+
+  is_loading_ = true;
+  BackgroundJobScheduler::GetInstance()->OnLoadingStarted();
+}
+
+void RewardsTabHelper::DidStopLoading() {
+  if (!is_loading_)
+    return;
+
+  is_loading_ = false;
+  BackgroundJobScheduler::GetInstance()->OnLoadingStopped();
+}
+
 void RewardsTabHelper::DidFinishLoad(
     content::RenderFrameHost* render_frame_host,
     const GURL& validated_url) {
@@ -114,6 +132,8 @@ void RewardsTabHelper::OnVisibilityChanged(content::Visibility visibility) {
 }
 
 void RewardsTabHelper::WebContentsDestroyed() {
+  DidStopLoading();
+
   if (rewards_service_)
     rewards_service_->OnUnload(tab_id_);
 }
@@ -34,6 +34,8 @@ class RewardsTabHelper : public RewardsServiceObserver,
   friend class content::WebContentsUserData<RewardsTabHelper>;
 
   // content::WebContentsObserver overrides.
+  void DidStartLoading() override;
+  void DidStopLoading() override;
   void DidFinishLoad(content::RenderFrameHost* render_frame_host,
                      const GURL& validated_url) override;
   void DidFinishNavigation(
@@ -54,6 +56,7 @@ class RewardsTabHelper : public RewardsServiceObserver,
 
   SessionID tab_id_;
   RewardsService* rewards_service_;  // NOT OWNED
+  bool is_loading_ = false;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
   DISALLOW_COPY_AND_ASSIGN(RewardsTabHelper);
@@ -5,12 +5,15 @@
 
 #include "brave/browser/brave_tab_helpers.h"
 
+#include "base/feature_list.h"
 #include "brave/browser/ui/bookmark/brave_bookmark_tab_helper.h"
 #include "brave/components/brave_ads/browser/ads_tab_helper.h"
 #include "brave/components/brave_perf_predictor/browser/buildflags.h"
 #include "brave/components/brave_rewards/browser/buildflags/buildflags.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/browser/buildflags/buildflags.h"  // For STP
+#include "brave/components/brave_shields/browser/cosmetic_filters_tab_helper.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/components/brave_wayback_machine/buildflags.h"
 #include "brave/components/greaselion/browser/buildflags/buildflags.h"
 #include "brave/components/speedreader/buildflags.h"
@@ -59,6 +62,11 @@ void AttachTabHelpers(content::WebContents* web_contents) {
 #endif
   brave_shields::BraveShieldsWebContentsObserver::CreateForWebContents(
       web_contents);
+  if (base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveAdblockNativeCosmeticFiltering)) {
+    brave_shields::CosmeticFiltersTabHelper::CreateForWebContents(
+        web_contents);
+  }
 
 #if defined(OS_ANDROID)
   DesktopModeTabHelper::CreateForWebContents(web_contents);
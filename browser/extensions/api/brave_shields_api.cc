@@ -8,8 +8,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "base/bind.h"
+#include "base/feature_list.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/post_task.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/extensions/api/brave_action_api.h"
 #include "brave/browser/webcompat_reporter/webcompat_reporter_dialog.h"
@@ -24,6 +28,7 @@
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/extensions/api/tabs/tabs_constants.h"
 #include "chrome/browser/extensions/chrome_extension_function_details.h"
@@ -45,6 +50,65 @@ namespace {
 const char kInvalidUrlError[] = "Invalid URL.";
 const char kInvalidControlTypeError[] = "Invalid ControlType.";
 
+base::Optional<base::Value> GetExtensionCosmeticResources(
+    ::brave_shields::AdBlockService* ad_block_service,
+    ::brave_shields::AdBlockRegionalServiceManager* regional_service_manager,
+    ::brave_shields::AdBlockCustomFiltersService* custom_filters_service,
+    const std::string& hostname) {
+  base::Optional<base::Value> resources =
+      ::brave_shields::GetHostnameCosmeticResources(
+          ad_block_service, regional_service_manager, custom_filters_service,
+          hostname);
+
+  // The renderer already injects these, see BraveCosmeticFiltersAgent.
+  if (resources && base::FeatureList::IsEnabled(
+          ::brave_shields::features::kBraveAdblockNativeCosmeticFiltering)) {
+    resources->SetKey("force_hide_selectors",
+                      base::Value(base::Value::Type::LIST));
+    resources->SetKey("style_selectors",
+                      base::Value(base::Value::Type::DICTIONARY));
+  }
+
+  return resources;
+}
+
+std::unique_ptr<base::ListValue> GetHiddenClassIdSelectors(
+    ::brave_shields::AdBlockService* ad_block_service,
+    ::brave_shields::AdBlockRegionalServiceManager* regional_service_manager,
+    ::brave_shields::AdBlockCustomFiltersService* custom_filters_service,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    const std::vector<std::string>& exceptions) {
+  base::Optional<base::Value> hide_selectors =
+      ad_block_service->HiddenClassIdSelectors(classes, ids, exceptions);
+
+  base::Optional<base::Value> regional_selectors =
+      regional_service_manager->HiddenClassIdSelectors(classes, ids,
+                                                       exceptions);
+
+  if (hide_selectors && hide_selectors->is_list()) {
+    if (regional_selectors && regional_selectors->is_list()) {
+      for (auto i = regional_selectors->GetList().begin();
+              i < regional_selectors->GetList().end();
+              i++) {
+        hide_selectors->Append(std::move(*i));
+      }
+    }
+  } else {
+    hide_selectors = std::move(regional_selectors);
+  }
+
+  base::Optional<base::Value> custom_selectors =
+      custom_filters_service->HiddenClassIdSelectors(classes, ids, exceptions);
+
+  auto result_list = std::make_unique<base::ListValue>();
+
+  result_list->Append(std::move(*hide_selectors));
+  result_list->Append(std::move(*custom_selectors));
+
+  return result_list;
+}
+
 }  // namespace
 
 
@@ -54,41 +118,39 @@ BraveShieldsHostnameCosmeticResourcesFunction::Run() {
       brave_shields::HostnameCosmeticResources::Params::Create(*args_));
   EXTENSION_FUNCTION_VALIDATE(params.get());
 
-  base::Optional<base::Value> resources = g_brave_browser_process->
-      ad_block_service()->HostnameCosmeticResources(params->hostname);
+  // The engines are looked up under their own locks, so the lookups and the
+  // merging don't have to keep the UI thread busy. The page is waiting for
+  // the result.
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&GetExtensionCosmeticResources,
+                     g_brave_browser_process->ad_block_service(),
+                     g_brave_browser_process->
+                         ad_block_regional_service_manager(),
+                     g_brave_browser_process->
+                         ad_block_custom_filters_service(),
+                     params->hostname),
+      base::BindOnce(
+          &BraveShieldsHostnameCosmeticResourcesFunction::OnResourcesReady,
+          this));
+  return RespondLater();
+}
 
-  if (!resources || !resources->is_dict()) {
-    return RespondNow(Error(
+void BraveShieldsHostnameCosmeticResourcesFunction::OnResourcesReady(
+    base::Optional<base::Value> resources) {
+  if (!resources) {
+    Respond(Error(
         "Hostname-specific cosmetic resources could not be returned"));
-  }
-
-  base::Optional<base::Value> regional_resources = g_brave_browser_process->
-      ad_block_regional_service_manager()->
-          HostnameCosmeticResources(params->hostname);
-
-  if (regional_resources && regional_resources->is_dict()) {
-    ::brave_shields::MergeResourcesInto(
-            &*resources,
-            &*regional_resources,
-            false);
-  }
-
-  base::Optional<base::Value> custom_resources = g_brave_browser_process->
-      ad_block_custom_filters_service()->
-          HostnameCosmeticResources(params->hostname);
-
-  if (custom_resources && custom_resources->is_dict()) {
-    ::brave_shields::MergeResourcesInto(
-            &*resources,
-            &*custom_resources,
-            true);
+    return;
   }
 
   auto result_list = std::make_unique<base::ListValue>();
 
   result_list->Append(std::move(*resources));
 
-  return RespondNow(ArgumentList(std::move(result_list)));
+  Respond(ArgumentList(std::move(result_list)));
 }
 
 ExtensionFunction::ResponseAction
@@ -97,41 +159,27 @@ BraveShieldsHiddenClassIdSelectorsFunction::Run() {
       brave_shields::HiddenClassIdSelectors::Params::Create(*args_));
   EXTENSION_FUNCTION_VALIDATE(params.get());
 
-  base::Optional<base::Value> hide_selectors = g_brave_browser_process->
-      ad_block_service()->HiddenClassIdSelectors(params->classes,
-                                                 params->ids,
-                                                 params->exceptions);
-
-  base::Optional<base::Value> regional_selectors = g_brave_browser_process->
-      ad_block_regional_service_manager()->
-        HiddenClassIdSelectors(params->classes,
-                               params->ids,
-                               params->exceptions);
-
-  if (hide_selectors && hide_selectors->is_list()) {
-    if (regional_selectors && regional_selectors->is_list()) {
-      for (auto i = regional_selectors->GetList().begin();
-              i < regional_selectors->GetList().end();
-              i++) {
-        hide_selectors->Append(std::move(*i));
-      }
-    }
-  } else {
-    hide_selectors = std::move(regional_selectors);
-  }
-
-  base::Optional<base::Value> custom_selectors = g_brave_browser_process->
-      ad_block_custom_filters_service()->
-          HiddenClassIdSelectors(params->classes,
-                                 params->ids,
-                                 params->exceptions);
-
-  auto result_list = std::make_unique<base::ListValue>();
-
-  result_list->Append(std::move(*hide_selectors));
-  result_list->Append(std::move(*custom_selectors));
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&GetHiddenClassIdSelectors,
+                     g_brave_browser_process->ad_block_service(),
+                     g_brave_browser_process->
+                         ad_block_regional_service_manager(),
+                     g_brave_browser_process->
+                         ad_block_custom_filters_service(),
+                     std::move(params->classes), std::move(params->ids),
+                     std::move(params->exceptions)),
+      base::BindOnce(
+          &BraveShieldsHiddenClassIdSelectorsFunction::OnSelectorsReady,
+          this));
+  return RespondLater();
+}
 
-  return RespondNow(ArgumentList(std::move(result_list)));
+void BraveShieldsHiddenClassIdSelectorsFunction::OnSelectorsReady(
+    std::unique_ptr<base::ListValue> result_list) {
+  Respond(ArgumentList(std::move(result_list)));
 }
 
 
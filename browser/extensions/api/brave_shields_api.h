@@ -6,6 +6,10 @@
 #ifndef BRAVE_BROWSER_EXTENSIONS_API_BRAVE_SHIELDS_API_H_
 #define BRAVE_BROWSER_EXTENSIONS_API_BRAVE_SHIELDS_API_H_
 
+#include <memory>
+
+#include "base/optional.h"
+#include "base/values.h"
 #include "extensions/browser/extension_function.h"
 
 namespace extensions {
@@ -19,6 +23,9 @@ class BraveShieldsHostnameCosmeticResourcesFunction : public ExtensionFunction {
   ~BraveShieldsHostnameCosmeticResourcesFunction() override {}
 
   ResponseAction Run() override;
+
+ private:
+  void OnResourcesReady(base::Optional<base::Value> resources);
 };
 
 class BraveShieldsHiddenClassIdSelectorsFunction : public ExtensionFunction {
@@ -29,6 +36,9 @@ class BraveShieldsHiddenClassIdSelectorsFunction : public ExtensionFunction {
   ~BraveShieldsHiddenClassIdSelectorsFunction() override {}
 
   ResponseAction Run() override;
+
+ private:
+  void OnSelectorsReady(std::unique_ptr<base::ListValue> result_list);
 };
 
 class BraveShieldsAllowScriptsOnceFunction : public ExtensionFunction {
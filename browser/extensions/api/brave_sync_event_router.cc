@@ -57,7 +57,9 @@ void BraveSyncEventRouter::FetchSyncRecords(
   event_router_->BroadcastEvent(std::move(event));
 }
 
-void BraveSyncEventRouter::ResolveSyncRecords(
+// static
+std::unique_ptr<base::ListValue>
+BraveSyncEventRouter::CreateResolveSyncRecordsArgs(
     const std::string& category_name,
     const std::vector<RecordAndExistingObject>& records_and_existing_objects) {
   for (const auto & entry : records_and_existing_objects) {
@@ -69,10 +71,23 @@ void BraveSyncEventRouter::ResolveSyncRecords(
         entry.local_record->object_data == "siteSetting"));
   }
 
-  std::unique_ptr<base::ListValue> args(
-     extensions::api::brave_sync::OnResolveSyncRecords::Create(
-          category_name,
-          records_and_existing_objects).release());
+  return extensions::api::brave_sync::OnResolveSyncRecords::Create(
+      category_name,
+      records_and_existing_objects);
+}
+
+// static
+std::unique_ptr<base::ListValue>
+BraveSyncEventRouter::CreateSendSyncRecordsArgs(
+    const std::string& category_name,
+    const std::vector<api::brave_sync::SyncRecord>& records) {
+  return extensions::api::brave_sync::OnSendSyncRecords::Create(
+      category_name,
+      records);
+}
+
+void BraveSyncEventRouter::ResolveSyncRecords(
+    std::unique_ptr<base::ListValue> args) {
   std::unique_ptr<Event> event(
      new Event(extensions::events::FOR_TEST,
        extensions::api::brave_sync::OnResolveSyncRecords::kEventName,
@@ -82,12 +97,7 @@ void BraveSyncEventRouter::ResolveSyncRecords(
 }
 
 void BraveSyncEventRouter::SendSyncRecords(
-    const std::string& category_name,
-    const std::vector<api::brave_sync::SyncRecord>& records) {
-  std::unique_ptr<base::ListValue> args(
-     extensions::api::brave_sync::OnSendSyncRecords::Create(
-          category_name,
-          records).release());
+    std::unique_ptr<base::ListValue> args) {
   std::unique_ptr<Event> event(
      new Event(extensions::events::FOR_TEST,
        extensions::api::brave_sync::OnSendSyncRecords::kEventName,
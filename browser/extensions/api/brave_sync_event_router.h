@@ -6,10 +6,15 @@
 #ifndef BRAVE_BROWSER_EXTENSIONS_API_BRAVE_SYNC_EVENT_ROUTER_H_
 #define BRAVE_BROWSER_EXTENSIONS_API_BRAVE_SYNC_EVENT_ROUTER_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "extensions/browser/event_router.h"
 
+namespace base {
+class ListValue;
+}
+
 class Profile;
 
 namespace extensions {
@@ -45,11 +50,19 @@ class BraveSyncEventRouter {
     const base::Time& startAt,
     const int max_records);
 
-  void ResolveSyncRecords(const std::string &category_name,
-    const std::vector<RecordAndExistingObject>& records_and_existing_objects);
+  // Event arguments for records are built off the UI thread with these and
+  // dispatched with the methods taking |args|
+  static std::unique_ptr<base::ListValue> CreateResolveSyncRecordsArgs(
+      const std::string& category_name,
+      const std::vector<RecordAndExistingObject>& records_and_existing_objects);
+
+  static std::unique_ptr<base::ListValue> CreateSendSyncRecordsArgs(
+      const std::string& category_name,
+      const std::vector<api::brave_sync::SyncRecord>& records);
+
+  void ResolveSyncRecords(std::unique_ptr<base::ListValue> args);
 
-  void SendSyncRecords(const std::string& category_name,
-                       const std::vector<api::brave_sync::SyncRecord>& records);
+  void SendSyncRecords(std::unique_ptr<base::ListValue> args);
 
   void SendGetBookmarksBaseOrder(const std::string& device_id,
                                  const std::string& platform);
@@ -17,6 +17,7 @@
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_test_utils.h"
+#include "content/public/test/test_utils.h"
 #include "net/dns/mock_host_resolver.h"
 
 using brave_component_updater::LocalDataFilesObserver;
@@ -69,6 +70,9 @@ void BaseLocalDataFilesBrowserTest::WaitForService() {
   scoped_refptr<base::ThreadTestHelper> tr_helper(new base::ThreadTestHelper(
       g_brave_browser_process->local_data_files_service()->GetTaskRunner()));
   ASSERT_TRUE(tr_helper->Run());
+  // Some services load their data on the thread pool rather than on the
+  // local data files task runner.
+  content::RunAllTasksUntilIdle();
   scoped_refptr<base::ThreadTestHelper> io_helper(new base::ThreadTestHelper(
       base::CreateSingleThreadTaskRunner({BrowserThread::IO}).get()));
   ASSERT_TRUE(io_helper->Run());
@@ -9,6 +9,7 @@
 
 #include "base/bind.h"
 #include "base/command_line.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/component_updater/brave_component_installer.h"
 #include "brave/common/brave_switches.h"
@@ -22,6 +23,7 @@
 #include "brave/components/brave_rewards/resources/extension/grit/brave_rewards_extension_resources.h"
 #include "brave/components/brave_webtorrent/grit/brave_webtorrent_resources.h"
 #include "brave/browser/extensions/brave_wallet_util.h"
+#include "chrome/browser/after_startup_task_utils.h"
 #include "chrome/browser/extensions/extension_service.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/common/pref_names.h"
@@ -101,6 +103,16 @@ void BraveComponentLoader::AddDefaultComponentExtensions(
     Add(IDR_BRAVE_EXTENSION, brave_extension_path);
   }
 
+  // Background pages of the optional extensions would compete with session
+  // restore. WebTorrent, the wallet and the rewards extension of a profile
+  // that hasn't opted in are loaded on first use instead.
+  AfterStartupTaskUtils::PostTask(
+      FROM_HERE, base::SequencedTaskRunnerHandle::Get(),
+      base::BindOnce(&BraveComponentLoader::AddDeferredComponentExtensions,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void BraveComponentLoader::AddDeferredComponentExtensions() {
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
   // Enable rewards extension if already opted-in
   HandleRewardsEnabledStatus();
@@ -110,7 +122,8 @@ void BraveComponentLoader::AddDefaultComponentExtensions(
   // Only load if the eagerly load Crypto Wallets setting is on and there is a
   // project id configured in the build.
   if (HasInfuraProjectID() &&
-      profile_prefs_->GetBoolean(kLoadCryptoWalletsOnStartup)) {
+      profile_prefs_->GetBoolean(kLoadCryptoWalletsOnStartup) &&
+      !Exists(ethereum_remote_client_extension_id)) {
     AddEthereumRemoteClientExtension();
   }
 #endif
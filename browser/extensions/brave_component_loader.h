@@ -9,6 +9,7 @@
 #include <string>
 
 #include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_rewards/browser/buildflags/buildflags.h"
 #include "brave/components/brave_wallet/browser/buildflags/buildflags.h"
 #include "chrome/browser/extensions/component_loader.h"
@@ -60,6 +61,10 @@ class BraveComponentLoader : public ComponentLoader {
   void AddHangoutServicesExtension() override;
 #endif  // BUILDFLAG(ENABLE_HANGOUT_SERVICES_EXTENSION)
 
+  // Loads the optional extensions that the profile already opted in to once
+  // startup is complete, everything else is loaded on first use
+  void AddDeferredComponentExtensions();
+
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
   void HandleRewardsEnabledStatus();
 #endif
@@ -69,6 +74,7 @@ class BraveComponentLoader : public ComponentLoader {
   PrefChangeRegistrar pref_change_registrar_;
   std::string ethereum_remote_client_manifest_;
   base::FilePath ethereum_remote_client_install_dir_;
+  base::WeakPtrFactory<BraveComponentLoader> weak_ptr_factory_{this};
 
   DISALLOW_COPY_AND_ASSIGN(BraveComponentLoader);
 };
@@ -10,12 +10,12 @@
 
 #include "base/base64url.h"
 #include "base/strings/string_util.h"
+#include "base/task/post_task.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/shield_exceptions.h"
-#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
-#include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
+#include "brave/components/brave_shields/browser/ad_block_request_matcher.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
@@ -28,28 +28,19 @@
 namespace brave {
 
 void ShouldBlockAdOnTaskRunner(std::shared_ptr<BraveRequestInfo> ctx) {
-  bool did_match_exception = false;
-  std::string tab_host = ctx->tab_origin.host();
-  if (!g_brave_browser_process->ad_block_service()->ShouldStartRequest(
-          ctx->request_url, ctx->resource_type, tab_host,
-          &did_match_exception, &ctx->cancel_request_explicitly,
-          &ctx->mock_data_url)) {
-    ctx->blocked_by = kAdBlocked;
-  } else if (!did_match_exception &&
-             !g_brave_browser_process->ad_block_regional_service_manager()
-                  ->ShouldStartRequest(ctx->request_url, ctx->resource_type,
-                                       tab_host, &did_match_exception,
-                                       &ctx->cancel_request_explicitly,
-                                       &ctx->mock_data_url)) {
-    ctx->blocked_by = kAdBlocked;
-  } else if (!did_match_exception &&
-             !g_brave_browser_process->ad_block_custom_filters_service()
-                  ->ShouldStartRequest(ctx->request_url, ctx->resource_type,
-                                       tab_host, &did_match_exception,
-                                       &ctx->cancel_request_explicitly,
-                                       &ctx->mock_data_url)) {
+  brave_shields::AdBlockRequestMatcher matcher(
+      g_brave_browser_process->ad_block_service(),
+      g_brave_browser_process->ad_block_regional_service_manager(),
+      g_brave_browser_process->ad_block_custom_filters_service());
+  brave_shields::AdBlockMatchResult result =
+      matcher.Match(brave_shields::AdBlockRequest(
+          ctx->request_url, ctx->resource_type, ctx->tab_origin.host()));
+  if (result.should_block) {
     ctx->blocked_by = kAdBlocked;
   }
+  ctx->cancel_request_explicitly = result.cancel_request_explicitly;
+  ctx->mock_data_url = result.mock_data_url;
+  ctx->ad_block_decision_cache_hit = result.decision_cache_hit;
 }
 
 void OnShouldBlockAdResult(const ResponseCallback& next_callback,
@@ -76,11 +67,22 @@ void OnBeforeURLRequestAdBlockTP(
   }
   DCHECK_NE(ctx->request_identifier, 0UL);
 
-  g_brave_browser_process->ad_block_service()->GetTaskRunner()
-      ->PostTaskAndReply(FROM_HERE,
-                         base::BindOnce(&ShouldBlockAdOnTaskRunner, ctx),
-                         base::BindOnce(&OnShouldBlockAdResult, next_callback,
-                                        ctx));
+  brave_shields::AdBlockService* ad_block_service =
+      g_brave_browser_process->ad_block_service();
+  if (ad_block_service->IsParallelMatchingEnabled()) {
+    // Engines are immutable snapshots in this mode, so any worker can match.
+    base::PostTaskAndReply(
+        FROM_HERE,
+        {base::ThreadPool(), base::TaskPriority::USER_BLOCKING,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+        base::BindOnce(&ShouldBlockAdOnTaskRunner, ctx),
+        base::BindOnce(&OnShouldBlockAdResult, next_callback, ctx));
+    return;
+  }
+
+  ad_block_service->GetTaskRunner()->PostTaskAndReply(
+      FROM_HERE, base::BindOnce(&ShouldBlockAdOnTaskRunner, ctx),
+      base::BindOnce(&OnShouldBlockAdResult, next_callback, ctx));
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(
@@ -11,6 +11,7 @@
 
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/common/brave_features.h"
 #include "brave/common/brave_switches.h"
 #include "brave/common/network_constants.h"
@@ -24,25 +25,55 @@
 
 namespace brave {
 
+namespace {
+
+// Common static redirect rules, in order of priority.
+enum CommonStaticRedirectRule {
+  kUpdaterJSONDefaultRule,
+  kUpdaterJSONFallbackRule,
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+  kWebstoreUpdateRule,
+#endif
+  kChromeCastRule,
+  kClients4Rule,
+  kCommonStaticRedirectRuleCount,
+};
+
+URLPatternHostIndex* CreateCommonStaticRedirectRules() {
+  const int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+  auto* rules = new URLPatternHostIndex();
+  rules->Add(URLPattern(
+      URLPattern::SCHEME_HTTPS,
+      std::string(component_updater::kUpdaterJSONDefaultUrl) + "*"));
+  rules->Add(URLPattern(
+      URLPattern::SCHEME_HTTP,
+      std::string(component_updater::kUpdaterJSONFallbackUrl) + "*"));
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+  rules->Add(URLPattern(
+      URLPattern::SCHEME_HTTPS,
+      std::string(extension_urls::kChromeWebstoreUpdateURL) + "*"));
+#endif
+  rules->Add(URLPattern(kHttpOrHttps, kChromeCastPrefix));
+  rules->Add(URLPattern(kHttpOrHttps, kClients4Prefix),
+             true /* match_host_only */);
+  DCHECK_EQ(static_cast<size_t>(kCommonStaticRedirectRuleCount),
+            rules->size());
+  return rules;
+}
+
+const URLPatternHostIndex& GetCommonStaticRedirectRules() {
+  static const URLPatternHostIndex* rules = CreateCommonStaticRedirectRules();
+  return *rules;
+}
+
+}  // namespace
+
 // Update server checks happen from the profile context for admin policy
 // installed extensions. Update server checks happen from the system context for
 // normal update operations.
 bool IsUpdaterURL(const GURL& gurl) {
-  static std::vector<URLPattern> updater_patterns(
-      {URLPattern(URLPattern::SCHEME_HTTPS,
-                  std::string(component_updater::kUpdaterJSONDefaultUrl) + "*"),
-       URLPattern(
-           URLPattern::SCHEME_HTTP,
-           std::string(component_updater::kUpdaterJSONFallbackUrl) + "*"),
-#if BUILDFLAG(ENABLE_EXTENSIONS)
-       URLPattern(
-           URLPattern::SCHEME_HTTPS,
-           std::string(extension_urls::kChromeWebstoreUpdateURL) + "*")
-#endif
-  });
-  return std::any_of(
-      updater_patterns.begin(), updater_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+  const int rule = GetCommonStaticRedirectRules().Match(gurl);
+  return rule != URLPatternHostIndex::kNoMatch && rule < kChromeCastRule;
 }
 
 int OnBeforeURLRequest_CommonStaticRedirectWork(
@@ -63,42 +94,41 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
   DCHECK(new_url);
 
   GURL::Replacements replacements;
-  static URLPattern chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static URLPattern clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-
-  if (IsUpdaterURL(request_url)) {
-    replacements.SetQueryStr(request_url.query_piece());
-    const base::CommandLine& command_line =
-        *base::CommandLine::ForCurrentProcess();
-    if (!command_line.HasSwitch(switches::kUseGoUpdateDev) &&
-        !base::FeatureList::IsEnabled(features::kUseDevUpdaterUrl)) {
-      *new_url = GURL(kBraveUpdatesExtensionsProdEndpoint)
-                            .ReplaceComponents(replacements);
-    } else {
-      *new_url = GURL(kBraveUpdatesExtensionsDevEndpoint)
-                            .ReplaceComponents(replacements);
+  switch (GetCommonStaticRedirectRules().Match(request_url)) {
+    case kUpdaterJSONDefaultRule:
+    case kUpdaterJSONFallbackRule:
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+    case kWebstoreUpdateRule:
+#endif
+    {
+      replacements.SetQueryStr(request_url.query_piece());
+      const base::CommandLine& command_line =
+          *base::CommandLine::ForCurrentProcess();
+      if (!command_line.HasSwitch(switches::kUseGoUpdateDev) &&
+          !base::FeatureList::IsEnabled(features::kUseDevUpdaterUrl)) {
+        *new_url = GURL(kBraveUpdatesExtensionsProdEndpoint)
+                              .ReplaceComponents(replacements);
+      } else {
+        *new_url = GURL(kBraveUpdatesExtensionsDevEndpoint)
+                              .ReplaceComponents(replacements);
+      }
+      break;
     }
-    return net::OK;
-  }
-
-  if (chromecast_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (clients4_pattern.MatchesHost(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveClients4Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
+    case kChromeCastRule:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveRedirectorProxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kClients4Rule:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveClients4Proxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    default:
+      break;
   }
 
   return net::OK;
 }
 
-
 }  // namespace brave
@@ -21,13 +21,26 @@ using content::BrowserThread;
 
 namespace brave {
 
+namespace {
+
+// Stop upgrading long before the network service gives up on the redirects.
+constexpr int kMaxHTTPSERedirectsCount = 5;
+
+bool ShouldHTTPSERedirect(const BraveRequestInfo& ctx) {
+  return ctx.httpse_redirect_count < kMaxHTTPSERedirectsCount - 1;
+}
+
+}  // namespace
+
 void OnBeforeURLRequest_HttpseFileWork(
     std::shared_ptr<BraveRequestInfo> ctx) {
   base::ScopedBlockingCall scoped_blocking_call(FROM_HERE,
                                                 base::BlockingType::WILL_BLOCK);
   DCHECK_NE(ctx->request_identifier, 0U);
-  g_brave_browser_process->https_everywhere_service()->
-    GetHTTPSURL(&ctx->request_url, ctx->request_identifier, &ctx->new_url_spec);
+  if (g_brave_browser_process->https_everywhere_service()->GetHTTPSURL(
+          &ctx->request_url, &ctx->new_url_spec)) {
+    ctx->httpse_redirect_count++;
+  }
 }
 
 void OnBeforeURLRequest_HttpsePostFileWork(
@@ -56,7 +69,7 @@ int OnBeforeURLRequest_HttpsePreFileWork(
   }
 
   if (ctx->tab_origin.is_empty() || ctx->allow_http_upgradable_resource ||
-      !ctx->allow_brave_shields) {
+      !ctx->allow_brave_shields || !ShouldHTTPSERedirect(*ctx)) {
     return net::OK;
   }
 
@@ -72,9 +85,7 @@ int OnBeforeURLRequest_HttpsePreFileWork(
 
   if (is_valid_url) {
     if (!g_brave_browser_process->https_everywhere_service()->
-        GetHTTPSURLFromCacheOnly(&ctx->request_url,
-                                 ctx->request_identifier,
-                                 &ctx->new_url_spec)) {
+        GetHTTPSURLFromCacheOnly(&ctx->request_url, &ctx->new_url_spec)) {
       g_brave_browser_process->https_everywhere_service()->
         GetTaskRunner()->PostTaskAndReply(FROM_HERE,
           base::Bind(OnBeforeURLRequest_HttpseFileWork, ctx),
@@ -83,6 +94,7 @@ int OnBeforeURLRequest_HttpsePreFileWork(
               next_callback, ctx));
       return net::ERR_IO_PENDING;
     } else {
+      ctx->httpse_redirect_count++;
       if (!ctx->new_url_spec.empty()) {
         brave_shields::DispatchBlockedEvent(ctx->request_url,
             ctx->render_frame_id, ctx->render_process_id,
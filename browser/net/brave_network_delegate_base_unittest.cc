@@ -61,9 +61,11 @@ TEST_F(BraveNetworkDelegateBaseTest, RemoveTrackableSecurityHeaders) {
   scoped_refptr<HttpResponseHeaders> headers(
       new HttpResponseHeaders(net::HttpUtil::AssembleRawHeaders(kRawHeaders)));
 
+  brave::ResponseHeadersOverlay overlay;
   RemoveTrackableSecurityHeadersForThirdParty(request_url,
                                               url::Origin::Create(tab_url),
-                                              nullptr, &headers);
+                                              headers.get(), &overlay);
+  overlay.ApplyTo(nullptr, &headers);
   for (auto header : *TrackableSecurityHeaders()) {
     EXPECT_FALSE(headers->HasHeader(header.as_string()));
   }
@@ -79,9 +81,11 @@ TEST_F(BraveNetworkDelegateBaseTest, RemoveTrackableSecurityHeadersMixedCase) {
   scoped_refptr<HttpResponseHeaders> headers(
       new HttpResponseHeaders(net::HttpUtil::AssembleRawHeaders(kRawHeaders)));
 
+  brave::ResponseHeadersOverlay overlay;
   RemoveTrackableSecurityHeadersForThirdParty(request_url,
                                               url::Origin::Create(tab_url),
-                                              nullptr, &headers);
+                                              headers.get(), &overlay);
+  overlay.ApplyTo(nullptr, &headers);
   for (auto header : *TrackableSecurityHeaders()) {
     EXPECT_FALSE(headers->HasHeader(header.as_string()));
   }
@@ -97,9 +101,11 @@ TEST_F(BraveNetworkDelegateBaseTest, RetainTrackableSecurityHeaders) {
   scoped_refptr<HttpResponseHeaders> headers(
       new HttpResponseHeaders(net::HttpUtil::AssembleRawHeaders(kRawHeaders)));
 
+  brave::ResponseHeadersOverlay overlay;
   RemoveTrackableSecurityHeadersForThirdParty(request_url,
                                               url::Origin::Create(tab_url),
-                                              nullptr, &headers);
+                                              headers.get(), &overlay);
+  overlay.ApplyTo(nullptr, &headers);
   for (auto header : *TrackableSecurityHeaders()) {
     EXPECT_TRUE(headers->HasHeader(header.as_string()));
   }
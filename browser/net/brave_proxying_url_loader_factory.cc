@@ -118,6 +118,7 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::RestartInternal() {
   brave::BraveRequestInfo::FillCTX(request_, render_process_id_,
                                    frame_tree_node_id_, request_id_,
                                    browser_context_, ctx_);
+  ctx_->httpse_redirect_count = httpse_redirect_count_;
   int result = factory_->request_handler_->OnBeforeURLRequest(
       ctx_, continuation, &redirect_url_);
 
@@ -314,6 +315,10 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::
 
 void BraveProxyingURLLoaderFactory::InProgressRequest::
     ContinueToBeforeSendHeaders(int error_code) {
+  if (ctx_) {
+    httpse_redirect_count_ = ctx_->httpse_redirect_count;
+  }
+
   if (error_code != net::OK) {
     OnRequestError(network::URLLoaderCompletionStatus(error_code));
     return;
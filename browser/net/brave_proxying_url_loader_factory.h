@@ -146,6 +146,8 @@ class BraveProxyingURLLoaderFactory
     network::mojom::URLResponseHeadPtr current_response_;
     scoped_refptr<net::HttpResponseHeaders> override_headers_;
     GURL redirect_url_;
+    // Copied into each new |ctx_| for the redirect hops of this request.
+    int httpse_redirect_count_ = 0;
 
     bool request_completed_ = false;
 
@@ -11,6 +11,7 @@
 #include "base/json/json_reader.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
+#include "brave/components/brave_referrals/browser/referral_headers_matcher.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 #include "url/url_constants.h"
@@ -60,10 +61,11 @@ TEST(BraveReferralsNetworkDelegateHelperTest, ReplaceHeadersForMatchingDomain) {
 
   const base::ListValue* referral_headers_list = nullptr;
   referral_headers->GetAsList(&referral_headers_list);
+  const brave::ReferralHeadersMatcher matcher(*referral_headers_list);
 
   net::HttpRequestHeaders headers;
   auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
-  request_info->referral_headers_list = referral_headers_list;
+  request_info->referral_headers_matcher = &matcher;
 
   int rc = brave::OnBeforeStartTransaction_ReferralsWork(
       &headers, brave::ResponseCallback(), request_info);
@@ -89,13 +91,60 @@ TEST(BraveReferralsNetworkDelegateHelperTest,
 
   const base::ListValue* referral_headers_list = nullptr;
   referral_headers->GetAsList(&referral_headers_list);
+  const brave::ReferralHeadersMatcher matcher(*referral_headers_list);
 
   net::HttpRequestHeaders headers;
   auto request_info = std::make_shared<brave::BraveRequestInfo>(GURL());
-  request_info->referral_headers_list = referral_headers_list;
+  request_info->referral_headers_matcher = &matcher;
   int rc = brave::OnBeforeStartTransaction_ReferralsWork(
       &headers, brave::ResponseCallback(), request_info);
 
   EXPECT_FALSE(headers.HasHeader("X-Brave-Partner"));
   EXPECT_EQ(rc, net::OK);
 }
+
+TEST(BraveReferralsNetworkDelegateHelperTest, MatcherMatchesSubdomains) {
+  base::Optional<base::Value> referral_headers =
+      base::JSONReader().ReadToValue(kTestReferralHeaders);
+  ASSERT_TRUE(referral_headers);
+  const base::ListValue* referral_headers_list = nullptr;
+  ASSERT_TRUE(referral_headers->GetAsList(&referral_headers_list));
+  const brave::ReferralHeadersMatcher matcher(*referral_headers_list);
+
+  const base::DictionaryValue* headers =
+      matcher.GetMatchingHeaders(GURL("http://a.b.xxlmag.com/path"));
+  ASSERT_TRUE(headers);
+  const std::string* partner = headers->FindStringKey("X-Brave-Partner");
+  ASSERT_TRUE(partner);
+  EXPECT_EQ(*partner, "townsquare");
+
+  EXPECT_TRUE(matcher.GetMatchingHeaders(GURL("https://barrons.com")));
+  EXPECT_FALSE(matcher.GetMatchingHeaders(GURL("https://notbarrons.com")));
+  EXPECT_FALSE(matcher.GetMatchingHeaders(GURL("https://barrons.com.evil")));
+  EXPECT_FALSE(matcher.GetMatchingHeaders(GURL("ftp://barrons.com")));
+}
+
+TEST(BraveReferralsNetworkDelegateHelperTest, MatcherPrefersEarlierEntries) {
+  base::Optional<base::Value> referral_headers =
+      base::JSONReader().ReadToValue(R"([
+        {"domains": ["example.com"], "headers": {"X-Brave-Partner": "first"}},
+        {"domains": ["www.example.com", "Example.org"],
+         "headers": {"X-Brave-Partner": "second"}},
+        {"domains": ["missing.com"]}
+      ])");
+  ASSERT_TRUE(referral_headers);
+  const base::ListValue* referral_headers_list = nullptr;
+  ASSERT_TRUE(referral_headers->GetAsList(&referral_headers_list));
+  const brave::ReferralHeadersMatcher matcher(*referral_headers_list);
+
+  const base::DictionaryValue* headers =
+      matcher.GetMatchingHeaders(GURL("https://www.example.com"));
+  ASSERT_TRUE(headers);
+  EXPECT_EQ(*headers->FindStringKey("X-Brave-Partner"), "first");
+
+  headers = matcher.GetMatchingHeaders(GURL("https://www.example.org"));
+  ASSERT_TRUE(headers);
+  EXPECT_EQ(*headers->FindStringKey("X-Brave-Partner"), "second");
+
+  EXPECT_FALSE(matcher.GetMatchingHeaders(GURL("https://missing.com")));
+}
@@ -6,9 +6,13 @@
 #include "brave/browser/net/brave_request_handler.h"
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 
+#include "base/command_line.h"
+#include "base/hash/hash.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
 #include "base/task/post_task.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
@@ -16,9 +20,11 @@
 #include "brave/browser/net/brave_site_hacks_network_delegate_helper.h"
 #include "brave/browser/net/brave_stp_util.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
+#include "brave/common/brave_switches.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
 #include "brave/components/brave_rewards/browser/buildflags/buildflags.h"
+#include "brave/components/brave_shields/browser/shields_trace.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "chrome/browser/browser_process.h"
 #include "components/prefs/pref_change_registrar.h"
@@ -30,6 +36,7 @@
 
 #if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
 #include "brave/browser/net/brave_referrals_network_delegate_helper.h"
+#include "brave/components/brave_referrals/browser/referral_headers_matcher.h"
 #endif
 
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
@@ -44,13 +51,43 @@
 #include "brave/browser/net/brave_translate_redirect_network_delegate_helper.h"
 #endif
 
+namespace {
+
+// 32MB of records
+const size_t kShieldsTraceCapacity = 1 << 20;
+
+// The trace file is shared by all the profiles, so the writer is never
+// destroyed. It writes records at least every second, which bounds what is
+// lost at exit.
+brave_shields::ShieldsTraceWriter* GetShieldsTraceWriter() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<std::unique_ptr<brave_shields::ShieldsTraceWriter>>
+      trace_writer([] {
+        const base::FilePath path =
+            base::CommandLine::ForCurrentProcess()->GetSwitchValuePath(
+                switches::kBraveShieldsTrace);
+        if (path.empty()) {
+          return std::unique_ptr<brave_shields::ShieldsTraceWriter>();
+        }
+        return std::make_unique<brave_shields::ShieldsTraceWriter>(
+            path, kShieldsTraceCapacity);
+      }());
+  return trace_writer->get();
+}
+
+}  // namespace
+
 static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK(ctx);
   return ctx->request_url.SchemeIs(extensions::kExtensionScheme) ||
          ctx->request_url.SchemeIs(content::kChromeUIScheme);
 }
 
-BraveRequestHandler::BraveRequestHandler() {
+BraveRequestHandler::BraveRequestHandler()
+    : before_url_request_latency_("OnBeforeURLRequest"),
+      before_start_transaction_latency_("OnBeforeStartTransaction"),
+      headers_received_latency_("OnHeadersReceived"),
+      trace_writer_(GetShieldsTraceWriter()) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   SetupCallbacks();
   // Initialize the preference change registrar.
@@ -63,41 +100,58 @@ void BraveRequestHandler::SetupCallbacks() {
   brave::OnBeforeURLRequestCallback callback =
       base::Bind(brave::OnBeforeURLRequest_SiteHacksWork);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("SiteHacks");
+  before_url_request_websocket_.push_back(true);
 
   callback = base::Bind(brave::OnBeforeURLRequest_AdBlockTPPreWork);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("AdBlockTP");
+  before_url_request_websocket_.push_back(true);
 
   callback = base::Bind(brave::OnBeforeURLRequest_HttpsePreFileWork);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("HTTPSE");
+  before_url_request_websocket_.push_back(false);
 
   callback = base::Bind(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("CommonStaticRedirect");
+  before_url_request_websocket_.push_back(false);
 
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
   callback = base::Bind(brave_rewards::OnBeforeURLRequest);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("Rewards");
+  before_url_request_websocket_.push_back(false);
 #endif
 
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
   callback =
       base::BindRepeating(brave::OnBeforeURLRequest_TranslateRedirectWork);
   before_url_request_callbacks_.push_back(callback);
+  before_url_request_latency_.AddCallback("TranslateRedirect");
+  before_url_request_websocket_.push_back(false);
 #endif
 
   brave::OnBeforeStartTransactionCallback start_transaction_callback =
       base::Bind(brave::OnBeforeStartTransaction_SiteHacksWork);
   before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_latency_.AddCallback("SiteHacks");
+  before_start_transaction_websocket_.push_back(true);
 
 #if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
   start_transaction_callback =
       base::Bind(brave::OnBeforeStartTransaction_ReferralsWork);
   before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_latency_.AddCallback("Referrals");
+  before_start_transaction_websocket_.push_back(false);
 #endif
 
 #if BUILDFLAG(ENABLE_BRAVE_WEBTORRENT)
   brave::OnHeadersReceivedCallback headers_received_callback =
       base::Bind(webtorrent::OnHeadersReceived_TorrentRedirectWork);
   headers_received_callbacks_.push_back(headers_received_callback);
+  headers_received_latency_.AddCallback("TorrentRedirect");
 #endif
 }
 
@@ -120,7 +174,8 @@ void BraveRequestHandler::OnReferralHeadersChanged() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   if (const base::ListValue* referral_headers =
           g_browser_process->local_state()->GetList(kReferralHeaders)) {
-    referral_headers_list_.reset(referral_headers->DeepCopy());
+    referral_headers_matcher_ =
+        std::make_unique<brave::ReferralHeadersMatcher>(*referral_headers);
   }
 }
 
@@ -136,12 +191,21 @@ int BraveRequestHandler::OnBeforeURLRequest(
   if (before_url_request_callbacks_.empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
+  if (ctx->request_url.SchemeIsWSOrWSS() &&
+      websocket_decisions_.Lookup(ctx.get())) {
+    if (!ctx->new_url_spec.empty() &&
+        ctx->new_url_spec != ctx->request_url.spec()) {
+      *new_url = GURL(ctx->new_url_spec);
+    }
+    return net::OK;
+  }
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.OnBeforeURLRequest_Handler");
+  if (trace_writer_) {
+    ctx->trace_record = std::make_unique<brave_shields::ShieldsTraceRecord>();
+  }
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
-  callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 int BraveRequestHandler::OnBeforeStartTransaction(
@@ -153,10 +217,8 @@ int BraveRequestHandler::OnBeforeStartTransaction(
   }
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
-  ctx->referral_headers_list = referral_headers_list_.get();
-  callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  ctx->referral_headers_matcher = referral_headers_matcher_.get();
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 int BraveRequestHandler::OnHeadersReceived(
@@ -168,45 +230,66 @@ int BraveRequestHandler::OnHeadersReceived(
   if (!ctx->tab_origin.is_empty()) {
     brave::RemoveTrackableSecurityHeadersForThirdParty(
         ctx->request_url, url::Origin::Create(ctx->tab_origin),
-        original_response_headers, override_response_headers);
+        original_response_headers, &ctx->response_headers_overlay);
   }
 
   if (headers_received_callbacks_.empty() &&
       !ctx->request_url.SchemeIs(content::kChromeUIScheme)) {
     // Extension scheme not excluded since brave_webtorrent needs it.
+    ctx->response_headers_overlay.ApplyTo(original_response_headers,
+                                          override_response_headers);
     return net::OK;
   }
 
-  callbacks_[ctx->request_identifier] = std::move(callback);
   ctx->event_type = brave::kOnHeadersReceived;
   ctx->original_response_headers = original_response_headers;
   ctx->override_response_headers = override_response_headers;
   ctx->allowed_unsafe_redirect_url = allowed_unsafe_redirect_url;
 
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 void BraveRequestHandler::OnURLRequestDestroyed(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
-  if (base::Contains(callbacks_, ctx->request_identifier)) {
-    callbacks_.erase(ctx->request_identifier);
-  }
+  callbacks_.erase(ctx->request_identifier);
 }
 
 void BraveRequestHandler::RunCallbackForRequestIdentifier(
     uint64_t request_identifier,
     int rv) {
-  std::map<uint64_t, net::CompletionOnceCallback>::iterator it =
-      callbacks_.find(request_identifier);
+  auto it = callbacks_.find(request_identifier);
   // We intentionally do the async call to maintain the proper flow
   // of URLLoader callbacks.
   base::PostTask(FROM_HERE, {content::BrowserThread::UI},
                  base::BindOnce(std::move(it->second), rv));
 }
 
-// TODO(iefremov): Merge all callback containers into one and run only one loop
-// instead of many (issues/5574).
+int BraveRequestHandler::StartCallbacks(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    net::CompletionOnceCallback callback) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  ctx->event_start = base::TimeTicks::Now();
+  // The callback has to be registered up front, callbacks that go pending
+  // continue through RunNextCallback() which looks it up.
+  callbacks_[ctx->request_identifier] = std::move(callback);
+  int rv = RunCallbacks(ctx);
+  if (rv == net::ERR_IO_PENDING) {
+    return net::ERR_IO_PENDING;
+  }
+
+  rv = FinishCallbacks(ctx, rv);
+  if (rv == net::OK) {
+    // Nothing had to wait, which is the common case for requests none of the
+    // callbacks care about, so skip the extra hop through the UI thread.
+    callbacks_.erase(ctx->request_identifier);
+    return net::OK;
+  }
+  // Errors other than cancellation are only expected asynchronously by
+  // callers.
+  RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+  return net::ERR_IO_PENDING;
+}
+
 void BraveRequestHandler::RunNextCallback(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -215,22 +298,45 @@ void BraveRequestHandler::RunNextCallback(
     return;
   }
 
+  if (!ctx->pending_start.is_null()) {
+    GetLatencyHistograms(ctx->event_type)
+        ->RecordWait(ctx->next_url_request_index - 1,
+                     base::TimeTicks::Now() - ctx->pending_start);
+    ctx->pending_start = base::TimeTicks();
+  }
+
+  int rv = RunCallbacks(ctx);
+  if (rv == net::ERR_IO_PENDING) {
+    return;
+  }
+  RunCallbackForRequestIdentifier(ctx->request_identifier,
+                                  FinishCallbacks(ctx, rv));
+}
+
+// TODO(iefremov): Merge all callback containers into one and run only one loop
+// instead of many (issues/5574).
+int BraveRequestHandler::RunCallbacks(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
   // Continue processing callbacks until we hit one that returns PENDING
   int rv = net::OK;
+  // Shared by all the callbacks below, only the one that goes pending uses
+  // it.
+  brave::ResponseCallback next_callback = base::Bind(
+      &BraveRequestHandler::RunNextCallback, weak_factory_.GetWeakPtr(), ctx);
+  const bool is_websocket = ctx->request_url.SchemeIsWSOrWSS();
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback = base::Bind(
-          &BraveRequestHandler::RunNextCallback,
-          weak_factory_.GetWeakPtr(),
-          ctx);
-      rv = callback.Run(next_callback, ctx);
-      if (rv == net::ERR_IO_PENDING) {
-        return;
+      const size_t index = ctx->next_url_request_index++;
+      if (is_websocket && !before_url_request_websocket_[index]) {
+        continue;
       }
+      const brave::OnBeforeURLRequestCallback& callback =
+          before_url_request_callbacks_[index];
+      const base::TimeTicks start = base::TimeTicks::Now();
+      rv = callback.Run(next_callback, ctx);
+      RecordCallback(ctx.get(), index, start, rv);
       if (rv != net::OK) {
         break;
       }
@@ -238,43 +344,49 @@ void BraveRequestHandler::RunNextCallback(
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeStartTransactionCallback callback =
-          before_start_transaction_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback = base::Bind(
-          &BraveRequestHandler::RunNextCallback,
-          weak_factory_.GetWeakPtr(),
-          ctx);
-      rv = callback.Run(ctx->headers, next_callback, ctx);
-      if (rv == net::ERR_IO_PENDING) {
-        return;
+      const size_t index = ctx->next_url_request_index++;
+      if (is_websocket && !before_start_transaction_websocket_[index]) {
+        continue;
       }
+      const brave::OnBeforeStartTransactionCallback& callback =
+          before_start_transaction_callbacks_[index];
+      const base::TimeTicks start = base::TimeTicks::Now();
+      rv = callback.Run(ctx->headers, next_callback, ctx);
+      RecordCallback(ctx.get(), index, start, rv);
       if (rv != net::OK) {
         break;
       }
     }
   } else if (ctx->event_type == brave::kOnHeadersReceived) {
     while (headers_received_callbacks_.size() != ctx->next_url_request_index) {
-      brave::OnHeadersReceivedCallback callback =
-          headers_received_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback = base::Bind(
-          &BraveRequestHandler::RunNextCallback,
-          weak_factory_.GetWeakPtr(),
-          ctx);
+      const size_t index = ctx->next_url_request_index++;
+      const brave::OnHeadersReceivedCallback& callback =
+          headers_received_callbacks_[index];
+      const base::TimeTicks start = base::TimeTicks::Now();
       rv = callback.Run(ctx->original_response_headers,
                         ctx->override_response_headers,
                         ctx->allowed_unsafe_redirect_url, next_callback, ctx);
-      if (rv == net::ERR_IO_PENDING) {
-        return;
-      }
+      RecordCallback(ctx.get(), index, start, rv);
       if (rv != net::OK) {
         break;
       }
     }
   }
 
+  return rv;
+}
+
+int BraveRequestHandler::FinishCallbacks(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    int rv) {
+  GetLatencyHistograms(ctx->event_type)
+      ->RecordEvent(base::TimeTicks::Now() - ctx->event_start);
+  if (ctx->trace_record && ctx->event_type == brave::kOnBeforeRequest) {
+    FinishTrace(ctx.get(), rv);
+  }
+
   if (rv != net::OK) {
-    RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
-    return;
+    return rv;
   }
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
@@ -285,11 +397,85 @@ void BraveRequestHandler::RunNextCallback(
     }
     if (ctx->blocked_by == brave::kAdBlocked) {
       if (ctx->cancel_request_explicitly) {
-        RunCallbackForRequestIdentifier(ctx->request_identifier,
-                                        net::ERR_ABORTED);
-        return;
+        rv = net::ERR_ABORTED;
       }
     }
+    // Only decisions the handshake can be continued with right away are
+    // remembered, errors are expected asynchronously.
+    if (rv == net::OK && ctx->request_url.SchemeIsWSOrWSS()) {
+      websocket_decisions_.Store(*ctx);
+    }
+  } else if (ctx->event_type == brave::kOnHeadersReceived) {
+    // The only copy of the headers, if any callback edited them.
+    ctx->response_headers_overlay.ApplyTo(ctx->original_response_headers,
+                                          ctx->override_response_headers);
   }
-  RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+  return rv;
+}
+
+brave::RequestLatencyHistograms* BraveRequestHandler::GetLatencyHistograms(
+    brave::BraveNetworkDelegateEventType event_type) {
+  switch (event_type) {
+    case brave::kOnBeforeRequest:
+      return &before_url_request_latency_;
+    case brave::kOnBeforeStartTransaction:
+      return &before_start_transaction_latency_;
+    case brave::kOnHeadersReceived:
+      return &headers_received_latency_;
+    default:
+      NOTREACHED();
+      return &before_url_request_latency_;
+  }
+}
+
+void BraveRequestHandler::RecordCallback(brave::BraveRequestInfo* ctx,
+                                         size_t index,
+                                         base::TimeTicks start,
+                                         int rv) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  GetLatencyHistograms(ctx->event_type)->RecordRun(index, now - start);
+  if (rv == net::ERR_IO_PENDING) {
+    ctx->pending_start = now;
+  }
+  if (ctx->trace_record) {
+    TraceCallback(ctx, index, now - start, rv);
+  }
+}
+
+void BraveRequestHandler::TraceCallback(brave::BraveRequestInfo* ctx,
+                                        size_t index,
+                                        base::TimeDelta elapsed,
+                                        int rv) {
+  brave_shields::ShieldsTraceRecord* record = ctx->trace_record.get();
+  if (rv == net::ERR_IO_PENDING) {
+    record->flags |= brave_shields::ShieldsTraceRecord::kPending;
+  }
+  if (index >= brave_shields::kShieldsTraceMaxHelpers) {
+    return;
+  }
+  record->helper_us[index] = brave_shields::ShieldsTraceMicroseconds16(elapsed);
+  record->helper_count =
+      std::max(record->helper_count, static_cast<uint8_t>(index + 1));
+}
+
+void BraveRequestHandler::FinishTrace(brave::BraveRequestInfo* ctx, int rv) {
+  std::unique_ptr<brave_shields::ShieldsTraceRecord> record =
+      std::move(ctx->trace_record);
+  record->url_hash = base::PersistentHash(ctx->request_url.spec());
+  record->tab_host_hash = base::PersistentHash(ctx->tab_origin.host());
+  record->total_us = brave_shields::ShieldsTraceMicroseconds32(
+      base::TimeTicks::Now() - ctx->event_start);
+  // The invalid resource type is recorded as 255
+  record->resource_type = static_cast<uint8_t>(ctx->resource_type);
+  if (ctx->blocked_by != brave::kNotBlocked || rv != net::OK) {
+    record->flags |= brave_shields::ShieldsTraceRecord::kBlocked;
+  }
+  if (ctx->ad_block_decision_cache_hit) {
+    record->flags |= brave_shields::ShieldsTraceRecord::kDecisionCacheHit;
+  }
+  if (!ctx->new_url_spec.empty() &&
+      ctx->new_url_spec != ctx->request_url.spec()) {
+    record->flags |= brave_shields::ShieldsTraceRecord::kRedirected;
+  }
+  trace_writer_->Add(*record);
 }
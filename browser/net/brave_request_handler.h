@@ -6,17 +6,27 @@
 #ifndef BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 #define BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "brave/browser/net/brave_request_latency.h"
+#include "brave/browser/net/brave_websocket_decision_cache.h"
 #include "brave/browser/net/url_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_once_callback.h"
 
 class PrefChangeRegistrar;
 
+namespace brave {
+class ReferralHeadersMatcher;
+}
+
+namespace brave_shields {
+class ShieldsTraceWriter;
+}
+
 // Contains different network stack hooks (similar to capabilities of WebRequest
 // API).
 class BraveRequestHandler {
@@ -52,20 +62,55 @@ class BraveRequestHandler {
   void OnPreferenceChanged(const std::string& pref_name);
   void UpdateAdBlockFromPref(const std::string& pref_name);
 
+  // Starts running the callbacks for |ctx|. Finishes synchronously and
+  // returns net::OK when none of them has to wait for anything, otherwise
+  // returns net::ERR_IO_PENDING and completes through |callbacks_|.
+  int StartCallbacks(std::shared_ptr<brave::BraveRequestInfo> ctx,
+                     net::CompletionOnceCallback callback);
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  // Runs the callbacks for the current event of |ctx| until one of them
+  // returns net::ERR_IO_PENDING or an error, and returns that result.
+  int RunCallbacks(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  // Applies the outcome of the callbacks to the request and returns the
+  // result to complete it with.
+  int FinishCallbacks(std::shared_ptr<brave::BraveRequestInfo> ctx, int rv);
+  brave::RequestLatencyHistograms* GetLatencyHistograms(
+      brave::BraveNetworkDelegateEventType event_type);
+  // Records the time |ctx| spent in the callback at |index|, which started
+  // running at |start| and returned |rv|.
+  void RecordCallback(brave::BraveRequestInfo* ctx,
+                      size_t index,
+                      base::TimeTicks start,
+                      int rv);
+  void TraceCallback(brave::BraveRequestInfo* ctx,
+                     size_t index,
+                     base::TimeDelta elapsed,
+                     int rv);
+  void FinishTrace(brave::BraveRequestInfo* ctx, int rv);
 
   std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
   std::vector<brave::OnBeforeStartTransactionCallback>
       before_start_transaction_callbacks_;
   std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
+  // Whether the callback at the same index has anything to do for WebSocket
+  // handshakes, the others are skipped for ws: and wss: URLs.
+  std::vector<bool> before_url_request_websocket_;
+  std::vector<bool> before_start_transaction_websocket_;
+
+  brave::RequestLatencyHistograms before_url_request_latency_;
+  brave::RequestLatencyHistograms before_start_transaction_latency_;
+  brave::RequestLatencyHistograms headers_received_latency_;
 
   // TODO(iefremov): actually, we don't have to keep the list here, since
   // it is global for the whole browser and could live a singletonce in the
   // rewards service. Eliminating this will also help to avoid using
   // PrefChangeRegistrar and corresponding |base::Unretained| usages, that are
   // illegal.
-  std::unique_ptr<base::ListValue> referral_headers_list_;
-  std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
+  std::unique_ptr<brave::ReferralHeadersMatcher> referral_headers_matcher_;
+  std::unordered_map<uint64_t, net::CompletionOnceCallback> callbacks_;
+  brave::WebSocketDecisionCache websocket_decisions_;
+  // Shared by all the handlers, null unless a trace was requested.
+  brave_shields::ShieldsTraceWriter* trace_writer_ = nullptr;
   std::unique_ptr<PrefChangeRegistrar, content::BrowserThread::DeleteOnUIThread>
       pref_change_registrar_;
 
@@ -0,0 +1,117 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_latency.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "base/logging.h"
+#include "base/metrics/histogram.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/strings/string_util.h"
+
+namespace brave {
+
+const char kRequestLatencyHistogramPrefix[] = "Brave.RequestHandler.Latency.";
+
+namespace {
+
+// Helpers take microseconds, waits on the shields task runner can take
+// seconds when it is busy loading lists
+const int kBucketCount = 50;
+
+base::HistogramBase* GetHistogram(const std::string& name) {
+  return base::Histogram::FactoryMicrosecondsTimeGet(
+      kRequestLatencyHistogramPrefix + name,
+      base::TimeDelta::FromMicroseconds(1), base::TimeDelta::FromSeconds(10),
+      kBucketCount, base::HistogramBase::kNoFlags);
+}
+
+// Returns the upper bound of the bucket holding the |percentile| sample
+int64_t GetPercentile(const base::HistogramSamples& samples,
+                      int percentile) {
+  const int64_t target =
+      std::max<int64_t>(1, (samples.TotalCount() * percentile + 99) / 100);
+  int64_t seen = 0;
+  int64_t max = 0;
+  for (std::unique_ptr<base::SampleCountIterator> it = samples.Iterator();
+       !it->Done(); it->Next()) {
+    base::HistogramBase::Sample min;
+    int64_t bucket_max;
+    base::HistogramBase::Count count;
+    it->Get(&min, &bucket_max, &count);
+    seen += count;
+    max = bucket_max;
+    if (seen >= target)
+      break;
+  }
+  return max;
+}
+
+}  // namespace
+
+RequestLatencyHistograms::RequestLatencyHistograms(
+    const std::string& event_name)
+    : event_name_(event_name), event_histogram_(GetHistogram(event_name)) {}
+
+RequestLatencyHistograms::~RequestLatencyHistograms() = default;
+
+void RequestLatencyHistograms::AddCallback(const std::string& callback_name) {
+  const std::string name = event_name_ + "." + callback_name;
+  run_histograms_.push_back(GetHistogram(name));
+  wait_histograms_.push_back(GetHistogram(name + ".Wait"));
+}
+
+void RequestLatencyHistograms::RecordEvent(base::TimeDelta delta) {
+  event_histogram_->AddTimeMicrosecondsGranularity(delta);
+}
+
+void RequestLatencyHistograms::RecordRun(size_t index,
+                                         base::TimeDelta delta) {
+  DCHECK_LT(index, run_histograms_.size());
+  run_histograms_[index]->AddTimeMicrosecondsGranularity(delta);
+}
+
+void RequestLatencyHistograms::RecordWait(size_t index,
+                                          base::TimeDelta delta) {
+  DCHECK_LT(index, wait_histograms_.size());
+  wait_histograms_[index]->AddTimeMicrosecondsGranularity(delta);
+}
+
+base::Value GetRequestLatencySummary() {
+  base::Value summary(base::Value::Type::LIST);
+  for (base::HistogramBase* histogram : base::StatisticsRecorder::Sort(
+           base::StatisticsRecorder::GetHistograms())) {
+    const std::string name = histogram->histogram_name();
+    if (!base::StartsWith(name, kRequestLatencyHistogramPrefix,
+                          base::CompareCase::SENSITIVE)) {
+      continue;
+    }
+    std::unique_ptr<base::HistogramSamples> samples =
+        histogram->SnapshotSamples();
+    if (samples->TotalCount() == 0)
+      continue;
+
+    base::Value value(base::Value::Type::DICTIONARY);
+    value.SetStringKey(
+        "name", name.substr(strlen(kRequestLatencyHistogramPrefix)));
+    value.SetIntKey("count", samples->TotalCount());
+    value.SetDoubleKey("mean", static_cast<double>(samples->sum()) /
+                                   samples->TotalCount());
+    value.SetDoubleKey("p50",
+                       static_cast<double>(GetPercentile(*samples, 50)));
+    value.SetDoubleKey("p99",
+                       static_cast<double>(GetPercentile(*samples, 99)));
+    summary.Append(std::move(value));
+  }
+  return summary;
+}
+
+}  // namespace brave
@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_REQUEST_LATENCY_H_
+#define BRAVE_BROWSER_NET_BRAVE_REQUEST_LATENCY_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace base {
+class HistogramBase;
+}  // namespace base
+
+namespace brave {
+
+// Prefix of the histograms recorded by RequestLatencyHistograms.
+extern const char kRequestLatencyHistogramPrefix[];
+
+// Local histograms, in microseconds, of the time BraveRequestHandler adds to
+// one network event: the whole event from the first callback until the
+// request continues, the time each callback runs for, and the time a callback
+// which went pending waits before the handler resumes, which for shields is
+// mostly the hop to the shields task runner and back. Local histograms are
+// not uploaded, they are summarized on brave://adblock.
+class RequestLatencyHistograms {
+ public:
+  explicit RequestLatencyHistograms(const std::string& event_name);
+  ~RequestLatencyHistograms();
+
+  // Callbacks must be added in the order the handler runs them.
+  void AddCallback(const std::string& callback_name);
+
+  void RecordEvent(base::TimeDelta delta);
+  void RecordRun(size_t index, base::TimeDelta delta);
+  void RecordWait(size_t index, base::TimeDelta delta);
+
+ private:
+  const std::string event_name_;
+  base::HistogramBase* event_histogram_;
+  std::vector<base::HistogramBase*> run_histograms_;
+  std::vector<base::HistogramBase*> wait_histograms_;
+
+  DISALLOW_COPY_AND_ASSIGN(RequestLatencyHistograms);
+};
+
+// Returns a list with a dictionary of "name", "count", "mean", "p50" and
+// "p99" for every histogram recorded by RequestLatencyHistograms so far.
+// Percentiles are the upper bound of the bucket they fall in.
+base::Value GetRequestLatencySummary();
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_REQUEST_LATENCY_H_
@@ -0,0 +1,62 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_latency.h"
+
+#include <memory>
+
+#include "base/metrics/statistics_recorder.h"
+#include "base/time/time.h"
+#include "base/values.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+class BraveRequestLatencyTest : public ::testing::Test {
+ protected:
+  BraveRequestLatencyTest()
+      : statistics_recorder_(
+            base::StatisticsRecorder::CreateTemporaryForTesting()) {}
+
+  std::unique_ptr<base::StatisticsRecorder> statistics_recorder_;
+};
+
+TEST_F(BraveRequestLatencyTest, EmptyHistogramsAreSkipped) {
+  RequestLatencyHistograms histograms("Event");
+  histograms.AddCallback("Helper");
+
+  EXPECT_TRUE(GetRequestLatencySummary().GetList().empty());
+}
+
+TEST_F(BraveRequestLatencyTest, Summary) {
+  RequestLatencyHistograms histograms("Event");
+  histograms.AddCallback("First");
+  histograms.AddCallback("Second");
+
+  histograms.RecordEvent(base::TimeDelta::FromMicroseconds(10));
+  histograms.RecordEvent(base::TimeDelta::FromMicroseconds(20));
+  histograms.RecordEvent(base::TimeDelta::FromMicroseconds(1000));
+  histograms.RecordRun(1, base::TimeDelta::FromMicroseconds(5));
+  histograms.RecordWait(1, base::TimeDelta::FromMilliseconds(3));
+
+  const base::Value summary = GetRequestLatencySummary();
+  const auto& list = summary.GetList();
+  ASSERT_EQ(3u, list.size());
+
+  EXPECT_EQ("Event", *list[0].FindStringKey("name"));
+  EXPECT_EQ(3, *list[0].FindIntKey("count"));
+  EXPECT_DOUBLE_EQ(1030.0 / 3, *list[0].FindDoubleKey("mean"));
+  // Percentiles are bucket bounds, so only their order of magnitude is known
+  EXPECT_GE(*list[0].FindDoubleKey("p50"), 20);
+  EXPECT_LT(*list[0].FindDoubleKey("p50"), 1000);
+  EXPECT_GE(*list[0].FindDoubleKey("p99"), 1000);
+
+  EXPECT_EQ("Event.Second", *list[1].FindStringKey("name"));
+  EXPECT_EQ(1, *list[1].FindIntKey("count"));
+  EXPECT_EQ("Event.Second.Wait", *list[2].FindStringKey("name"));
+  EXPECT_GE(*list[2].FindDoubleKey("p50"), 3000);
+}
+
+}  // namespace brave
@@ -7,12 +7,15 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
-#include "base/lazy_instance.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
 #include "base/sequenced_task_runner.h"
+#include "base/stl_util.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/shield_exceptions.h"
@@ -24,7 +27,6 @@
 #include "content/public/common/referrer.h"
 #include "extensions/common/url_pattern.h"
 #include "net/url_request/url_request.h"
-#include "third_party/re2/src/re2/re2.h"
 
 using content::BrowserThread;
 using content::Referrer;
@@ -33,48 +35,38 @@ namespace brave {
 
 namespace {
 
-const std::string& GetQueryStringTrackers() {
-  static const base::NoDestructor<std::string> trackers(base::JoinString(
-      std::vector<std::string>(
-          {// https://github.com/brave/brave-browser/issues/4239
-           "fbclid", "gclid", "msclkid", "mc_eid",
-           // https://github.com/brave/brave-browser/issues/9879
-           "dclid",
-           // https://github.com/brave/brave-browser/issues/9019
-           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}),
-      "|"));
+// Stored lower case, parameter names are matched case insensitively
+const std::unordered_set<std::string>& GetQueryStringTrackers() {
+  static const base::NoDestructor<std::unordered_set<std::string>> trackers(
+      [] {
+        std::unordered_set<std::string> trackers;
+        for (const char* tracker :
+             {// https://github.com/brave/brave-browser/issues/4239
+              "fbclid", "gclid", "msclkid", "mc_eid",
+              // https://github.com/brave/brave-browser/issues/9879
+              "dclid",
+              // https://github.com/brave/brave-browser/issues/9019
+              "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}) {
+          trackers.insert(base::ToLowerASCII(tracker));
+        }
+        return trackers;
+      }());
   return *trackers;
 }
 
-// From src/components/autofill/content/renderer/page_passwords_analyser.cc
-// and password_form_conversion_utils.cc:
-#define DECLARE_LAZY_MATCHER(NAME, PATTERN)                                   \
-  struct LabelPatternLazyInstanceTraits_##NAME                                \
-      : public base::internal::DestructorAtExitLazyInstanceTraits<re2::RE2> { \
-    static re2::RE2* New(void* instance) {                                    \
-      re2::RE2::Options options;                                              \
-      options.set_case_sensitive(false);                                      \
-      re2::RE2* matcher = new (instance) re2::RE2(PATTERN, options);          \
-      DCHECK(matcher->ok());                                                  \
-      return matcher;                                                         \
-    }                                                                         \
-  };                                                                          \
-  base::LazyInstance<re2::RE2, LabelPatternLazyInstanceTraits_##NAME> NAME =  \
-      LAZY_INSTANCE_INITIALIZER
-
-// e.g. "?fbclid=1234"
-DECLARE_LAZY_MATCHER(tracker_only_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+$");
-
-// e.g. "?fbclid=1234&foo=1"
-DECLARE_LAZY_MATCHER(tracker_first_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+&");
-
-// e.g. "?foo=1&fbclid=1234" or "?foo=1&fbclid=1234&bar=2"
-DECLARE_LAZY_MATCHER(tracker_appended_matcher,
-                     "&(" + GetQueryStringTrackers() + ")=[^&]+");
-
-#undef DECLARE_LAZY_MATCHER
+// A parameter is a tracker if its name is one of the trackers and it has a
+// value, e.g. "fbclid=1234" but not "fbclid" or "fbclid="
+bool IsQueryStringTracker(base::StringPiece parameter) {
+  const size_t separator = parameter.find('=');
+  if (separator == base::StringPiece::npos ||
+      separator + 1 == parameter.size()) {
+    return false;
+  }
+
+  const std::string name =
+      base::ToLowerASCII(parameter.substr(0, separator));
+  return GetQueryStringTrackers().count(name) > 0;
+}
 
 bool ApplyPotentialReferrerBlock(std::shared_ptr<BraveRequestInfo> ctx) {
   GURL target_origin = ctx->request_url.GetOrigin();
@@ -100,14 +92,17 @@ void ApplyPotentialQueryStringFilter(const GURL& request_url,
                                      std::string* new_url_spec) {
   DCHECK(new_url_spec);
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.SiteHacks.QueryFilter");
-  std::string new_query = request_url.query();
-  // Note: the ordering of these replacements is important.
-  const int replacement_count =
-      re2::RE2::GlobalReplace(&new_query, tracker_appended_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_first_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_only_matcher.Get(), "");
-
-  if (replacement_count > 0) {
+  const std::string query = request_url.query();
+  std::vector<base::StringPiece> parameters = base::SplitStringPiece(
+      query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  const size_t parameter_count = parameters.size();
+  base::EraseIf(parameters, IsQueryStringTracker);
+  const bool was_filtered = parameters.size() != parameter_count;
+
+  if (was_filtered) {
+    // Joining what's left keeps empty parameters around the removed ones,
+    // e.g. "foo=1&fbclid=2&" becomes "foo=1&"
+    const std::string new_query = base::JoinString(parameters, "&");
     url::Replacements<char> replacements;
     if (new_query.empty()) {
       replacements.ClearQuery();
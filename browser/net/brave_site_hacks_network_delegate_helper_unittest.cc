@@ -198,6 +198,8 @@ TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringFiltered) {
            "https://example.com/?fbclid=&foo=1&bar=2"},
           {"http://u:p@example.com/path/file.html?foo=1&fbclid=abcd#fragment",
            "http://u:p@example.com/path/file.html?foo=1#fragment"},
+          {"https://example.com/?foo=1&FBCLID=1&_hsenc=x&hsctatracking=y&",
+           "https://example.com/?foo=1&"},
           // Obscure edge cases that break most parsers:
           {"https://example.com/?fbclid&foo&&gclid=2&bar=&%20",
            "https://example.com/?fbclid&foo&&bar=&%20"},
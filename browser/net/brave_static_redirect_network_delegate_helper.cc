@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/translate_network_constants.h"
@@ -15,6 +16,62 @@
 
 namespace brave {
 
+namespace {
+
+// Static redirect rules, in order of priority.
+enum StaticRedirectRule {
+  kGeoLocationRule,
+  kSafeBrowsingRule,
+  kSafeBrowsingFileCheckRule,
+  kCRXDownloadRule,
+  kAutofillRule,
+  kCRLSetRule1,
+  kCRLSetRule2,
+  kCRLSetRule3,
+  kCRLSetRule4,
+  kGvt1Rule,
+  kGoogleDlRule,
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+  kTranslateRule,
+  kTranslateLanguageRule,
+#endif
+  kStaticRedirectRuleCount,
+};
+
+URLPatternHostIndex* CreateStaticRedirectRules() {
+  const int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+  auto* rules = new URLPatternHostIndex();
+  rules->Add(URLPattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern));
+  rules->Add(URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix),
+             true /* match_host_only */);
+  rules->Add(
+      URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingFileCheckPrefix),
+      true /* match_host_only */);
+  rules->Add(URLPattern(kHttpOrHttps, kCRXDownloadPrefix));
+  rules->Add(URLPattern(URLPattern::SCHEME_HTTPS, kAutofillPrefix));
+  rules->Add(URLPattern(kHttpOrHttps, kCRLSetPrefix1));
+  rules->Add(URLPattern(kHttpOrHttps, kCRLSetPrefix2));
+  rules->Add(URLPattern(kHttpOrHttps, kCRLSetPrefix3));
+  rules->Add(URLPattern(kHttpOrHttps, kCRLSetPrefix4));
+  rules->Add(URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"));
+  rules->Add(URLPattern(kHttpOrHttps, "*://dl.google.com/*"));
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+  rules->Add(URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementJSPattern));
+  rules->Add(URLPattern(URLPattern::SCHEME_HTTPS, kTranslateLanguagePattern));
+#endif
+  DCHECK_EQ(static_cast<size_t>(kStaticRedirectRuleCount), rules->size());
+  return rules;
+}
+
+// Maps requests to their StaticRedirectRule, most of them with a single
+// lookup of their host.
+const URLPatternHostIndex& GetStaticRedirectRules() {
+  static const URLPatternHostIndex* rules = CreateStaticRedirectRules();
+  return *rules;
+}
+
+}  // namespace
+
 int OnBeforeURLRequest_StaticRedirectWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
@@ -31,129 +88,62 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
   GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingFileCheckPrefix);
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
+  switch (GetStaticRedirectRules().Match(request_url)) {
+    case kGeoLocationRule:
+      *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
+      break;
+    case kSafeBrowsingRule:
+      replacements.SetHostStr(SAFEBROWSING_ENDPOINT);
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kSafeBrowsingFileCheckRule:
+      // TODO(@fmarier): Re-enable download protection once we have
+      // truncated the list of metadata that it sends to the server
+      // (brave/brave-browser#6267).
+      //
+      // replacements.SetHostStr(kBraveSafeBrowsingFileCheckProxy);
+      // *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kCRXDownloadRule:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr("crxdownload.brave.com");
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kAutofillRule:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveStaticProxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kCRLSetRule1:
+    case kCRLSetRule2:
+    case kCRLSetRule3:
+    case kCRLSetRule4:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr("crlsets.brave.com");
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
+    case kGvt1Rule:
+    case kGoogleDlRule:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveRedirectorProxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      break;
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  static URLPattern translate_pattern(URLPattern::SCHEME_HTTPS,
-      kTranslateElementJSPattern);
-  static URLPattern translate_language_pattern(URLPattern::SCHEME_HTTPS,
-      kTranslateLanguagePattern);
+    case kTranslateRule:
+      replacements.SetQueryStr(request_url.query_piece());
+      replacements.SetPathStr(request_url.path_piece());
+      *new_url =
+        GURL(kBraveTranslateEndpoint).ReplaceComponents(replacements);
+      break;
+    case kTranslateLanguageRule:
+      *new_url = GURL(kBraveTranslateLanguageEndpoint);
+      break;
 #endif
-  if (geo_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
-    return net::OK;
+    default:
+      break;
   }
 
-  if (safeBrowsing_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(SAFEBROWSING_ENDPOINT);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
-    // TODO(@fmarier): Re-enable download protection once we have
-    // truncated the list of metadata that it sends to the server
-    // (brave/brave-browser#6267).
-    //
-    // replacements.SetHostStr(kBraveSafeBrowsingFileCheckProxy);
-    // *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crxDownload_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crxdownload.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (autofill_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveStaticProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (gvt1_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (googleDl_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  if (translate_pattern.MatchesURL(request_url)) {
-    replacements.SetQueryStr(request_url.query_piece());
-    replacements.SetPathStr(request_url.path_piece());
-    *new_url =
-      GURL(kBraveTranslateEndpoint).ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (translate_language_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(kBraveTranslateLanguageEndpoint);
-    return net::OK;
-  }
-#endif
-
   return net::OK;
 }
 
-
 }  // namespace brave
@@ -5,6 +5,8 @@
 
 #include "brave/browser/net/brave_stp_util.h"
 
+#include <string>
+
 #include "base/no_destructor.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
@@ -20,9 +22,9 @@ base::flat_set<base::StringPiece>* TrackableSecurityHeaders() {
 
 void RemoveTrackableSecurityHeadersForThirdParty(
     const GURL& request_url, const url::Origin& top_frame_origin,
-    const net::HttpResponseHeaders* original_response_headers,
-    scoped_refptr<net::HttpResponseHeaders>* override_response_headers) {
-  if (!original_response_headers && !override_response_headers->get()) {
+    const net::HttpResponseHeaders* response_headers,
+    ResponseHeadersOverlay* overlay) {
+  if (!response_headers) {
     return;
   }
 
@@ -32,12 +34,11 @@ void RemoveTrackableSecurityHeadersForThirdParty(
     return;
   }
 
-  if (!override_response_headers->get()) {
-    *override_response_headers =
-        new net::HttpResponseHeaders(original_response_headers->raw_headers());
-  }
   for (auto header : *TrackableSecurityHeaders()) {
-    (*override_response_headers)->RemoveHeader(header.as_string());
+    const std::string name = header.as_string();
+    if (response_headers->HasHeader(name)) {
+      overlay->RemoveHeader(name);
+    }
   }
 }
 
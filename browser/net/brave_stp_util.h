@@ -8,6 +8,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/strings/string_piece.h"
+#include "brave/browser/net/response_headers_overlay.h"
 #include "net/http/http_response_headers.h"
 #include "url/gurl.h"
 #include "url/origin.h"
@@ -16,10 +17,13 @@ namespace brave {
 
 base::flat_set<base::StringPiece>* TrackableSecurityHeaders();
 
+// Records the removal of the trackable security headers |response_headers|
+// actually has in |overlay|, so third-party responses without them don't get
+// their headers copied.
 void RemoveTrackableSecurityHeadersForThirdParty(
     const GURL& request_url, const url::Origin& top_frame_origin,
-    const net::HttpResponseHeaders* original_response_headers,
-    scoped_refptr<net::HttpResponseHeaders>* override_response_headers);
+    const net::HttpResponseHeaders* response_headers,
+    ResponseHeadersOverlay* overlay);
 
 }  // namespace brave
 
@@ -8,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <vector>
+
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/common/translate_network_constants.h"
 #include "extensions/common/url_pattern.h"
 
@@ -18,25 +20,27 @@ const char kTranslateElementLibQuery[] = "client=te_lib";
 namespace brave {
 
 bool IsTranslateScriptRequest(const GURL& gurl) {
-  static std::vector<URLPattern> translate_patterns({
-      URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementMainJSPattern),
-      URLPattern(URLPattern::SCHEME_HTTPS, kTranslateMainJSPattern),
-      });
-  return std::any_of(translate_patterns.begin(), translate_patterns.end(),
-      [&gurl](URLPattern pattern) {
-      return pattern.MatchesURL(gurl);
-      });
+  static const URLPatternHostIndex* translate_patterns = [] {
+    auto* patterns = new URLPatternHostIndex();
+    patterns->Add(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementMainJSPattern));
+    patterns->Add(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateMainJSPattern));
+    return patterns;
+  }();
+  return translate_patterns->Match(gurl) != URLPatternHostIndex::kNoMatch;
 }
 
 bool IsTranslateResourceRequest(const GURL& gurl) {
-  static std::vector<URLPattern> translate_patterns({
-      URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementMainCSSPattern),
-      URLPattern(URLPattern::SCHEME_HTTPS, kTranslateBrandingPNGPattern),
-      });
-  return std::any_of(translate_patterns.begin(), translate_patterns.end(),
-      [&gurl](URLPattern pattern) {
-      return pattern.MatchesURL(gurl);
-      });
+  static const URLPatternHostIndex* translate_patterns = [] {
+    auto* patterns = new URLPatternHostIndex();
+    patterns->Add(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementMainCSSPattern));
+    patterns->Add(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateBrandingPNGPattern));
+    return patterns;
+  }();
+  return translate_patterns->Match(gurl) != URLPatternHostIndex::kNoMatch;
 }
 
 bool IsTranslateRequest(const GURL& gurl) {
@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_websocket_decision_cache.h"
+
+#include "brave/browser/brave_browser_process_impl.h"
+#include "brave/components/brave_shields/browser/ad_block_request_matcher.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+// Number of sockets whose decisions are remembered per profile.
+constexpr size_t kMaxDecisions = 100;
+
+}  // namespace
+
+WebSocketDecisionCache::Entry::Entry() = default;
+
+WebSocketDecisionCache::Entry::Entry(const Entry& other) = default;
+
+WebSocketDecisionCache::Entry::~Entry() = default;
+
+WebSocketDecisionCache::WebSocketDecisionCache() : entries_(kMaxDecisions) {}
+
+WebSocketDecisionCache::~WebSocketDecisionCache() = default;
+
+bool WebSocketDecisionCache::Lookup(BraveRequestInfo* ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  auto it = entries_.Get(Key(ctx->tab_origin, ctx->request_url));
+  if (it == entries_.end()) {
+    return false;
+  }
+
+  const Entry& entry = it->second;
+  if (entry.allow_brave_shields != ctx->allow_brave_shields ||
+      entry.allow_ads != ctx->allow_ads ||
+      entry.allow_referrers != ctx->allow_referrers ||
+      entry.referrer != ctx->referrer ||
+      entry.engine_generations != GetEngineGenerations()) {
+    entries_.Erase(it);
+    return false;
+  }
+
+  ctx->new_url_spec = entry.new_url_spec;
+  ctx->new_referrer = entry.new_referrer;
+  ctx->blocked_by = entry.blocked_by;
+  ctx->cancel_request_explicitly = entry.cancel_request_explicitly;
+  ctx->mock_data_url = entry.mock_data_url;
+  // The shields panel counts every blocked attempt, not just the first one
+  if (ctx->blocked_by == kAdBlocked) {
+    brave_shields::DispatchBlockedEvent(
+        ctx->request_url, ctx->render_frame_id, ctx->render_process_id,
+        ctx->frame_tree_node_id, brave_shields::kAds);
+  }
+  return true;
+}
+
+void WebSocketDecisionCache::Store(const BraveRequestInfo& ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  Entry entry;
+  entry.engine_generations = GetEngineGenerations();
+  entry.allow_brave_shields = ctx.allow_brave_shields;
+  entry.allow_ads = ctx.allow_ads;
+  entry.allow_referrers = ctx.allow_referrers;
+  entry.referrer = ctx.referrer;
+  entry.new_url_spec = ctx.new_url_spec;
+  entry.new_referrer = ctx.new_referrer;
+  entry.blocked_by = ctx.blocked_by;
+  entry.cancel_request_explicitly = ctx.cancel_request_explicitly;
+  entry.mock_data_url = ctx.mock_data_url;
+  entries_.Put(Key(ctx.tab_origin, ctx.request_url), entry);
+}
+
+// static
+std::vector<int> WebSocketDecisionCache::GetEngineGenerations() {
+  return brave_shields::AdBlockRequestMatcher(
+             g_brave_browser_process->ad_block_service(),
+             g_brave_browser_process->ad_block_regional_service_manager(),
+             g_brave_browser_process->ad_block_custom_filters_service())
+      .GetEngineGenerations();
+}
+
+}  // namespace brave
@@ -0,0 +1,70 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_WEBSOCKET_DECISION_CACHE_H_
+#define BRAVE_BROWSER_NET_BRAVE_WEBSOCKET_DECISION_CACHE_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+#include "brave/browser/net/url_context.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+// Remembers the outcome of the OnBeforeURLRequest callbacks for WebSocket
+// handshakes, per page origin and socket URL, so pages that reconnect their
+// sockets over and over don't pay for the whole chain, and above all the hop
+// to the shields task runner, every time. An entry is only used as long as
+// the ad-block engines and the shields settings it was decided with are the
+// same. Lives on the UI thread.
+class WebSocketDecisionCache {
+ public:
+  WebSocketDecisionCache();
+  ~WebSocketDecisionCache();
+
+  // Restores the decision taken for a handshake like |ctx| into it. Returns
+  // false if there is none.
+  bool Lookup(BraveRequestInfo* ctx);
+  // Remembers the decision the callbacks took for |ctx|, which must have let
+  // the handshake continue.
+  void Store(const BraveRequestInfo& ctx);
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(const Entry& other);
+    ~Entry();
+
+    std::vector<int> engine_generations;
+    // What the callbacks decided on besides the URLs
+    bool allow_brave_shields = true;
+    bool allow_ads = false;
+    bool allow_referrers = false;
+    GURL referrer;
+
+    std::string new_url_spec;
+    GURL new_referrer;
+    BlockedBy blocked_by = kNotBlocked;
+    bool cancel_request_explicitly = false;
+    std::string mock_data_url;
+  };
+
+  // Tab origin and socket URL.
+  using Key = std::pair<GURL, GURL>;
+
+  static std::vector<int> GetEngineGenerations();
+
+  base::MRUCache<Key, Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebSocketDecisionCache);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_WEBSOCKET_DECISION_CACHE_H_
@@ -0,0 +1,68 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/response_headers_overlay.h"
+
+#include "base/logging.h"
+#include "net/http/http_response_headers.h"
+
+namespace brave {
+
+ResponseHeadersOverlay::ResponseHeadersOverlay() = default;
+
+ResponseHeadersOverlay::ResponseHeadersOverlay(
+    const ResponseHeadersOverlay& other) = default;
+
+ResponseHeadersOverlay::~ResponseHeadersOverlay() = default;
+
+void ResponseHeadersOverlay::ReplaceStatusLine(
+    const std::string& status_line) {
+  edits_.push_back({EditType::kReplaceStatusLine, std::string(), status_line});
+}
+
+void ResponseHeadersOverlay::RemoveHeader(const std::string& name) {
+  edits_.push_back({EditType::kRemoveHeader, name, std::string()});
+}
+
+void ResponseHeadersOverlay::AddHeader(const std::string& name,
+                                       const std::string& value) {
+  edits_.push_back({EditType::kAddHeader, name, value});
+}
+
+void ResponseHeadersOverlay::Clear() {
+  edits_.clear();
+}
+
+void ResponseHeadersOverlay::ApplyTo(
+    const net::HttpResponseHeaders* original_response_headers,
+    scoped_refptr<net::HttpResponseHeaders>* override_response_headers) const {
+  DCHECK(override_response_headers);
+  if (edits_.empty())
+    return;
+
+  if (!override_response_headers->get()) {
+    if (!original_response_headers)
+      return;
+    *override_response_headers =
+        new net::HttpResponseHeaders(original_response_headers->raw_headers());
+  }
+
+  net::HttpResponseHeaders* headers = override_response_headers->get();
+  for (const Edit& edit : edits_) {
+    switch (edit.type) {
+      case EditType::kReplaceStatusLine:
+        headers->ReplaceStatusLine(edit.value);
+        break;
+      case EditType::kRemoveHeader:
+        headers->RemoveHeader(edit.name);
+        break;
+      case EditType::kAddHeader:
+        headers->AddHeader(edit.name + ": " + edit.value);
+        break;
+    }
+  }
+}
+
+}  // namespace brave
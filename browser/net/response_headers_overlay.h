@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_RESPONSE_HEADERS_OVERLAY_H_
+#define BRAVE_BROWSER_NET_RESPONSE_HEADERS_OVERLAY_H_
+
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+
+namespace net {
+class HttpResponseHeaders;
+}  // namespace net
+
+namespace brave {
+
+// Edits OnHeadersReceived callbacks want to make to the response headers.
+// Callbacks read the original headers and only record what they would
+// change, BraveRequestHandler copies the headers once after the last callback
+// and only if something was recorded, so responses nobody edits are never
+// copied. Edits are applied in the order they were recorded.
+class ResponseHeadersOverlay {
+ public:
+  ResponseHeadersOverlay();
+  ResponseHeadersOverlay(const ResponseHeadersOverlay& other);
+  ~ResponseHeadersOverlay();
+
+  void ReplaceStatusLine(const std::string& status_line);
+  // Removes all the headers named |name|, case insensitively.
+  void RemoveHeader(const std::string& name);
+  void AddHeader(const std::string& name, const std::string& value);
+
+  bool empty() const { return edits_.empty(); }
+  void Clear();
+
+  // Applies the edits to |*override_response_headers|, copying
+  // |original_response_headers| into it first when it is still null. Leaves
+  // both untouched when there are no edits.
+  void ApplyTo(
+      const net::HttpResponseHeaders* original_response_headers,
+      scoped_refptr<net::HttpResponseHeaders>* override_response_headers) const;
+
+ private:
+  enum class EditType { kReplaceStatusLine, kRemoveHeader, kAddHeader };
+
+  struct Edit {
+    EditType type;
+    std::string name;
+    std::string value;
+  };
+
+  std::vector<Edit> edits_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_RESPONSE_HEADERS_OVERLAY_H_
@@ -0,0 +1,97 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/response_headers_overlay.h"
+
+#include <string>
+
+#include "brave/browser/net/brave_stp_util.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+using brave::ResponseHeadersOverlay;
+using net::HttpResponseHeaders;
+
+namespace {
+
+scoped_refptr<HttpResponseHeaders> CreateHeaders(const char* raw_headers) {
+  return base::MakeRefCounted<HttpResponseHeaders>(
+      net::HttpUtil::AssembleRawHeaders(raw_headers));
+}
+
+}  // namespace
+
+TEST(ResponseHeadersOverlayTest, NoEditsNoCopy) {
+  scoped_refptr<HttpResponseHeaders> original =
+      CreateHeaders("HTTP/1.1 200 OK\nContent-Type: text/html\n");
+  scoped_refptr<HttpResponseHeaders> override_headers;
+
+  ResponseHeadersOverlay overlay;
+  EXPECT_TRUE(overlay.empty());
+  overlay.ApplyTo(original.get(), &override_headers);
+  EXPECT_FALSE(override_headers);
+}
+
+TEST(ResponseHeadersOverlayTest, AppliesEditsInOrder) {
+  scoped_refptr<HttpResponseHeaders> original = CreateHeaders(
+      "HTTP/1.1 200 OK\nLocation: https://a.com/\nX-Foo: 1\nx-foo: 2\n");
+  scoped_refptr<HttpResponseHeaders> override_headers;
+
+  ResponseHeadersOverlay overlay;
+  overlay.ReplaceStatusLine("HTTP/1.1 307 Temporary Redirect");
+  overlay.RemoveHeader("Location");
+  overlay.AddHeader("Location", "https://b.com/");
+  overlay.RemoveHeader("X-FOO");
+  EXPECT_FALSE(overlay.empty());
+  overlay.ApplyTo(original.get(), &override_headers);
+
+  ASSERT_TRUE(override_headers);
+  EXPECT_EQ("HTTP/1.1 307 Temporary Redirect",
+            override_headers->GetStatusLine());
+  std::string location;
+  EXPECT_TRUE(override_headers->EnumerateHeader(nullptr, "Location",
+                                                &location));
+  EXPECT_EQ("https://b.com/", location);
+  EXPECT_FALSE(override_headers->HasHeader("X-Foo"));
+
+  // The original headers are left alone
+  EXPECT_EQ("HTTP/1.1 200 OK", original->GetStatusLine());
+  EXPECT_TRUE(original->HasHeader("X-Foo"));
+}
+
+TEST(ResponseHeadersOverlayTest, EditsExistingOverride) {
+  scoped_refptr<HttpResponseHeaders> original =
+      CreateHeaders("HTTP/1.1 200 OK\nX-Foo: 1\n");
+  scoped_refptr<HttpResponseHeaders> override_headers =
+      CreateHeaders("HTTP/1.1 200 OK\nX-Bar: 1\n");
+  HttpResponseHeaders* existing = override_headers.get();
+
+  ResponseHeadersOverlay overlay;
+  overlay.AddHeader("X-Baz", "1");
+  overlay.ApplyTo(original.get(), &override_headers);
+
+  EXPECT_EQ(existing, override_headers.get());
+  EXPECT_TRUE(override_headers->HasHeader("X-Bar"));
+  EXPECT_TRUE(override_headers->HasHeader("X-Baz"));
+  EXPECT_FALSE(override_headers->HasHeader("X-Foo"));
+
+  overlay.Clear();
+  EXPECT_TRUE(overlay.empty());
+}
+
+TEST(ResponseHeadersOverlayTest, ThirdPartyWithoutTrackableHeaders) {
+  scoped_refptr<HttpResponseHeaders> original =
+      CreateHeaders("HTTP/1.1 200 OK\nContent-Type: text/html\n");
+
+  ResponseHeadersOverlay overlay;
+  brave::RemoveTrackableSecurityHeadersForThirdParty(
+      GURL("https://thirdparty.com/"),
+      url::Origin::Create(GURL("https://firstparty.com/")), original.get(),
+      &overlay);
+  EXPECT_TRUE(overlay.empty());
+}
@@ -10,6 +10,8 @@
 
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "brave/components/brave_shields/browser/shields_trace.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "chrome/browser/profiles/profile.h"
@@ -17,30 +19,45 @@
 
 namespace brave {
 
-namespace {
+BraveRequestInfo::BraveRequestInfo() = default;
 
-std::string GetUploadData(const network::ResourceRequest& request) {
-  std::string upload_data;
-  if (!request.request_body) {
-    return {};
+BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
+
+BraveRequestInfo::~BraveRequestInfo() = default;
+
+std::vector<base::span<const uint8_t>> BraveRequestInfo::GetUploadDataSpans()
+    const {
+  std::vector<base::span<const uint8_t>> spans;
+  if (!request_body) {
+    return spans;
   }
-  const auto* elements = request.request_body->elements();
-  for (const network::DataElement& element : *elements) {
+  for (const network::DataElement& element : *request_body->elements()) {
     if (element.type() == network::mojom::DataElementType::kBytes) {
-      upload_data.append(element.bytes(), element.length());
+      spans.emplace_back(reinterpret_cast<const uint8_t*>(element.bytes()),
+                         element.length());
     }
   }
-
-  return upload_data;
+  return spans;
 }
 
-}  // namespace
-
-BraveRequestInfo::BraveRequestInfo() = default;
-
-BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
+std::string BraveRequestInfo::GetUploadData() const {
+  const std::vector<base::span<const uint8_t>> spans = GetUploadDataSpans();
+  size_t size = 0;
+  for (const auto& bytes : spans) {
+    size += bytes.size();
+  }
+  if (size > kMaxUploadDataSize) {
+    return std::string();
+  }
 
-BraveRequestInfo::~BraveRequestInfo() = default;
+  std::string upload_data;
+  upload_data.reserve(size);
+  for (const auto& bytes : spans) {
+    upload_data.append(reinterpret_cast<const char*>(bytes.data()),
+                       bytes.size());
+  }
+  return upload_data;
+}
 
 // static
 void BraveRequestInfo::FillCTX(const network::ResourceRequest& request,
@@ -93,15 +110,16 @@ void BraveRequestInfo::FillCTX(const network::ResourceRequest& request,
   }
 
   Profile* profile = Profile::FromBrowserContext(browser_context);
-  ctx->allow_brave_shields =
-      brave_shields::GetBraveShieldsEnabled(profile, ctx->tab_origin);
-  ctx->allow_ads = brave_shields::GetAdControlType(profile, ctx->tab_origin) ==
-                   brave_shields::ControlType::ALLOW;
+  const brave_shields::ShieldsSettingsSnapshot shields_settings =
+      brave_shields::ShieldsSettingsSnapshotCache::Get(profile,
+                                                       ctx->tab_origin);
+  ctx->allow_brave_shields = shields_settings.brave_shields_enabled;
+  ctx->allow_ads =
+      shields_settings.ad_control_type == brave_shields::ControlType::ALLOW;
   ctx->allow_http_upgradable_resource =
-      !brave_shields::GetHTTPSEverywhereEnabled(profile, ctx->tab_origin);
-  ctx->allow_referrers =
-      brave_shields::AllowReferrers(profile, ctx->tab_origin);
-  ctx->upload_data = GetUploadData(request);
+      !shields_settings.https_everywhere_enabled;
+  ctx->allow_referrers = shields_settings.allow_referrers;
+  ctx->request_body = request.request_body;
 }
 
 }  // namespace brave
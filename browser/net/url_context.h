@@ -9,13 +9,22 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "base/containers/span.h"
+#include "base/time/time.h"
+#include "brave/browser/net/response_headers_overlay.h"
 #include "net/url_request/url_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
 
 class BraveRequestHandler;
 
+namespace brave_shields {
+struct ShieldsTraceRecord;
+}
+
 namespace content {
 class BrowserContext;
 }
@@ -25,6 +34,7 @@ struct ResourceRequest;
 }
 
 namespace brave {
+class ReferralHeadersMatcher;
 struct BraveRequestInfo;
 using ResponseCallback = base::Callback<void()>;
 }  // namespace brave
@@ -76,6 +86,10 @@ struct BraveRequestInfo {
   int frame_tree_node_id = 0;
   uint64_t request_identifier = 0;
   size_t next_url_request_index = 0;
+  // Number of times HTTPS Everywhere has already upgraded this request and
+  // its redirects. Carried over to the info for each redirect hop so that
+  // rules that upgrade back and forth can't loop forever.
+  int httpse_redirect_count = 0;
 
   net::HttpRequestHeaders* headers = nullptr;
   // The following two sets are populated by |OnBeforeStartTransactionCallback|.
@@ -84,13 +98,18 @@ struct BraveRequestInfo {
   std::set<std::string> removed_headers;
   const net::HttpResponseHeaders* original_response_headers = nullptr;
   scoped_refptr<net::HttpResponseHeaders>* override_response_headers = nullptr;
+  // Edits to the response headers recorded by |OnHeadersReceivedCallback|s,
+  // applied to |override_response_headers| after the last one has run.
+  ResponseHeadersOverlay response_headers_overlay;
 
   GURL* allowed_unsafe_redirect_url = nullptr;
   BraveNetworkDelegateEventType event_type = kUnknownEventType;
-  const base::ListValue* referral_headers_list = nullptr;
+  const ReferralHeadersMatcher* referral_headers_matcher = nullptr;
   BlockedBy blocked_by = kNotBlocked;
   bool cancel_request_explicitly = false;
   std::string mock_data_url;
+  // Whether the default ad-block engine answered from its decision cache.
+  bool ad_block_decision_cache_hit = false;
 
   // Default to invalid type for resource_type, so delegate helpers
   // can properly detect that the info couldn't be obtained.
@@ -100,7 +119,18 @@ struct BraveRequestInfo {
       static_cast<blink::mojom::ResourceType>(-1);
   blink::mojom::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // Body of the request, shared with the request itself rather than copied.
+  // Use the accessors below to read it.
+  scoped_refptr<network::ResourceRequestBody> request_body;
+
+  // Largest body GetUploadData() will materialize.
+  static constexpr size_t kMaxUploadDataSize = 1024 * 1024;
+
+  // Returns views over the in-memory parts of the body, without copying.
+  std::vector<base::span<const uint8_t>> GetUploadDataSpans() const;
+  // Returns the in-memory parts of the body concatenated, or an empty string
+  // if they add up to more than |kMaxUploadDataSize|.
+  std::string GetUploadData() const;
 
   static void FillCTX(const network::ResourceRequest& request,
                       int render_process_id,
@@ -116,6 +146,13 @@ struct BraveRequestInfo {
 
   GURL* new_url = nullptr;
 
+  // When the handler started on the current event, and when the callback it
+  // waits for went pending.
+  base::TimeTicks event_start;
+  base::TimeTicks pending_start;
+  // Only set while a shields trace is being recorded.
+  std::unique_ptr<brave_shields::ShieldsTraceRecord> trace_record;
+
   DISALLOW_COPY_AND_ASSIGN(BraveRequestInfo);
 };
 
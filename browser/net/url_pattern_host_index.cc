@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <algorithm>
+
+#include "base/strings/string_piece.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+void AddCandidates(const std::vector<int>& ids, std::vector<int>* candidates) {
+  candidates->insert(candidates->end(), ids.begin(), ids.end());
+}
+
+}  // namespace
+
+URLPatternHostIndex::URLPatternHostIndex() = default;
+
+URLPatternHostIndex::~URLPatternHostIndex() = default;
+
+int URLPatternHostIndex::Add(const URLPattern& pattern, bool match_host_only) {
+  const int id = static_cast<int>(entries_.size());
+  entries_.push_back({pattern, match_host_only});
+  if (pattern.match_all_urls() || pattern.host().empty()) {
+    any_host_ids_.push_back(id);
+  } else if (pattern.match_subdomains()) {
+    domain_ids_[pattern.host()].push_back(id);
+  } else {
+    host_ids_[pattern.host()].push_back(id);
+  }
+  return id;
+}
+
+int URLPatternHostIndex::Match(const GURL& url) const {
+  if (!url.is_valid()) {
+    return kNoMatch;
+  }
+
+  base::StringPiece host = url.host_piece();
+  if (!host.empty() && host.back() == '.') {
+    host.remove_suffix(1);
+  }
+
+  std::vector<int> candidates = any_host_ids_;
+  auto host_it = host_ids_.find(host.as_string());
+  if (host_it != host_ids_.end()) {
+    AddCandidates(host_it->second, &candidates);
+  }
+  if (!domain_ids_.empty()) {
+    // Try the host and each of its parent domains.
+    base::StringPiece domain = host;
+    while (!domain.empty()) {
+      auto domain_it = domain_ids_.find(domain.as_string());
+      if (domain_it != domain_ids_.end()) {
+        AddCandidates(domain_it->second, &candidates);
+      }
+      const size_t dot = domain.find('.');
+      if (dot == base::StringPiece::npos) {
+        break;
+      }
+      domain.remove_prefix(dot + 1);
+    }
+  }
+
+  if (candidates.empty()) {
+    return kNoMatch;
+  }
+  std::sort(candidates.begin(), candidates.end());
+  for (int id : candidates) {
+    if (Matches(id, url)) {
+      return id;
+    }
+  }
+  return kNoMatch;
+}
+
+bool URLPatternHostIndex::Matches(int id, const GURL& url) const {
+  const Entry& entry = entries_[id];
+  return entry.match_host_only ? entry.pattern.MatchesHost(url)
+                               : entry.pattern.MatchesURL(url);
+}
+
+}  // namespace brave
@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+#define BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace brave {
+
+// A fixed set of URLPatterns indexed by host, so that matching a URL only
+// tries the patterns that can apply to its host instead of all of them.
+// Patterns are identified by the order in which they were added, and the
+// first one added wins when several match.
+class URLPatternHostIndex {
+ public:
+  static constexpr int kNoMatch = -1;
+
+  URLPatternHostIndex();
+  ~URLPatternHostIndex();
+
+  // Adds |pattern| and returns its id. With |match_host_only| only the host
+  // of URLs is checked against it.
+  int Add(const URLPattern& pattern, bool match_host_only = false);
+
+  // Returns the id of the first pattern that matches |url|, or kNoMatch.
+  int Match(const GURL& url) const;
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    URLPattern pattern;
+    bool match_host_only;
+  };
+
+  bool Matches(int id, const GURL& url) const;
+
+  std::vector<Entry> entries_;
+  // Ids of the patterns for exactly one host.
+  std::unordered_map<std::string, std::vector<int>> host_ids_;
+  // Ids of the patterns for a host and all of its subdomains.
+  std::unordered_map<std::string, std::vector<int>> domain_ids_;
+  // Ids of the patterns for any host.
+  std::vector<int> any_host_ids_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLPatternHostIndex);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
@@ -0,0 +1,66 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using brave::URLPatternHostIndex;
+
+namespace {
+
+const int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+}  // namespace
+
+TEST(URLPatternHostIndexTest, MatchesExactHosts) {
+  URLPatternHostIndex index;
+  const int dl = index.Add(URLPattern(kHttpOrHttps, "*://dl.google.com/*"));
+  const int www = index.Add(
+      URLPattern(URLPattern::SCHEME_HTTPS, "https://www.google.com/dl/*"));
+
+  EXPECT_EQ(dl, index.Match(GURL("https://dl.google.com/file")));
+  EXPECT_EQ(www, index.Match(GURL("https://www.google.com/dl/file")));
+  EXPECT_EQ(URLPatternHostIndex::kNoMatch,
+            index.Match(GURL("https://www.google.com/other")));
+  EXPECT_EQ(URLPatternHostIndex::kNoMatch,
+            index.Match(GURL("https://sub.dl.google.com/file")));
+  EXPECT_EQ(URLPatternHostIndex::kNoMatch,
+            index.Match(GURL("https://brave.com/")));
+}
+
+TEST(URLPatternHostIndexTest, MatchesSubdomains) {
+  URLPatternHostIndex index;
+  const int gvt1 = index.Add(URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"));
+
+  EXPECT_EQ(gvt1, index.Match(GURL("http://gvt1.com/file")));
+  EXPECT_EQ(gvt1, index.Match(GURL("http://r1---sn.gvt1.com/file")));
+  EXPECT_EQ(URLPatternHostIndex::kNoMatch,
+            index.Match(GURL("http://notgvt1.com/file")));
+}
+
+TEST(URLPatternHostIndexTest, FirstAddedPatternWins) {
+  URLPatternHostIndex index;
+  const int specific = index.Add(
+      URLPattern(kHttpOrHttps, "*://*.gvt1.com/edgedl/chromewebstore/*"));
+  const int general = index.Add(URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"));
+  const int any = index.Add(URLPattern(kHttpOrHttps, "*://*/crx/*"));
+
+  EXPECT_EQ(specific,
+            index.Match(GURL("https://r1.gvt1.com/edgedl/chromewebstore/x")));
+  EXPECT_EQ(general, index.Match(GURL("https://r1.gvt1.com/crx/x")));
+  EXPECT_EQ(any, index.Match(GURL("https://brave.com/crx/x")));
+}
+
+TEST(URLPatternHostIndexTest, MatchHostOnly) {
+  URLPatternHostIndex index;
+  const int clients4 = index.Add(
+      URLPattern(kHttpOrHttps, "*://clients4.google.com/"), true);
+
+  EXPECT_EQ(clients4, index.Match(GURL("https://clients4.google.com/path")));
+  EXPECT_EQ(URLPatternHostIndex::kNoMatch,
+            index.Match(GURL("https://clients5.google.com/")));
+}
@@ -28,10 +28,10 @@ void SpeedreaderTabHelper::UpdateActiveState(
   Profile* profile =
       Profile::FromBrowserContext(web_contents()->GetBrowserContext());
   DCHECK(profile);
-  const bool enabled =
-      SpeedreaderServiceFactory::GetForProfile(profile)->IsEnabled();
+  SpeedreaderService* service =
+      SpeedreaderServiceFactory::GetForProfile(profile);
 
-  if (!enabled) {
+  if (!service->IsEnabled()) {
     active_ = false;
     return;
   }
@@ -39,8 +39,11 @@ void SpeedreaderTabHelper::UpdateActiveState(
   // Work only with casual main frame navigations.
   if (handle->GetURL().SchemeIsHTTPOrHTTPS()) {
     auto* whitelist = g_brave_browser_process->speedreader_whitelist();
-    if (speedreader::IsWhitelistedForTest(handle->GetURL()) ||
-        whitelist->IsWhitelisted(handle->GetURL())) {
+    if (service->IsKnownUnreadable(handle->GetURL())) {
+      // Let the page load untouched rather than hold it back for nothing.
+      VLOG(2) << __func__ << " known unreadable " << handle->GetURL();
+    } else if (speedreader::IsWhitelistedForTest(handle->GetURL()) ||
+               whitelist->IsWhitelisted(handle->GetURL())) {
       VLOG(2) << __func__ << " SpeedReader active for " << handle->GetURL();
       active_ = true;
       return;
@@ -23,7 +23,8 @@ TorLauncherFactory* TorLauncherFactory::GetInstance() {
 
 TorLauncherFactory::TorLauncherFactory()
     : is_starting_(false),
-      tor_pid_(-1) {
+      tor_pid_(-1),
+      bootstrap_progress_(0) {
   if (g_prevent_tor_launch_for_tests) {
     tor_pid_ = 1234;
     VLOG(1) << "Skipping the tor process launch in tests.";
@@ -43,6 +44,9 @@ void TorLauncherFactory::Init() {
   tor_launcher_->SetCrashHandler(base::Bind(
                         &TorLauncherFactory::OnTorCrashed,
                         base::Unretained(this)));
+
+  observer_receiver_.reset();
+  tor_launcher_->SetObserver(observer_receiver_.BindNewPipeAndPassRemote());
 }
 
 TorLauncherFactory::~TorLauncherFactory() {}
@@ -115,7 +119,9 @@ void TorLauncherFactory::ReLaunchTorProcess(const tor::TorConfig& config) {
 
 void TorLauncherFactory::KillTorProcess() {
   tor_launcher_.reset();
+  observer_receiver_.reset();
   tor_pid_ = -1;
+  bootstrap_progress_ = 0;
 }
 
 void TorLauncherFactory::AddObserver(tor::TorProfileServiceImpl* service) {
@@ -129,6 +135,7 @@ void TorLauncherFactory::RemoveObserver(tor::TorProfileServiceImpl* service) {
 void TorLauncherFactory::OnTorLauncherCrashed() {
   LOG(ERROR) << "Tor Launcher Crashed";
   is_starting_ = false;
+  bootstrap_progress_ = 0;
   for (auto& observer : observers_)
     observer.NotifyTorLauncherCrashed();
 }
@@ -136,6 +143,7 @@ void TorLauncherFactory::OnTorLauncherCrashed() {
 void TorLauncherFactory::OnTorCrashed(int64_t pid) {
   LOG(ERROR) << "Tor Process(" << pid << ") Crashed";
   is_starting_ = false;
+  bootstrap_progress_ = 0;
   for (auto& observer : observers_)
     observer.NotifyTorCrashed(pid);
 }
@@ -151,6 +159,12 @@ void TorLauncherFactory::OnTorLaunched(bool result, int64_t pid) {
     observer.NotifyTorLaunched(result, pid);
 }
 
+void TorLauncherFactory::OnBootstrapProgress(int32_t progress) {
+  bootstrap_progress_ = progress;
+  for (auto& observer : observers_)
+    observer.NotifyTorBootstrapProgress(progress);
+}
+
 ScopedTorLaunchPreventerForTest::ScopedTorLaunchPreventerForTest() {
   g_prevent_tor_launch_for_tests = true;
 }
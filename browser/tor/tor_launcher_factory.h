@@ -12,13 +12,14 @@
 #include "base/observer_list.h"
 #include "brave/common/tor/tor_common.h"
 #include "brave/components/services/tor/public/interfaces/tor.mojom.h"
+#include "mojo/public/cpp/bindings/receiver.h"
 #include "mojo/public/cpp/bindings/remote.h"
 
 namespace tor {
 class TorProfileServiceImpl;
 }
 
-class TorLauncherFactory {
+class TorLauncherFactory : public tor::mojom::TorLauncherObserver {
  public:
   static TorLauncherFactory* GetInstance();
 
@@ -28,6 +29,8 @@ class TorLauncherFactory {
   void KillTorProcess();
   const tor::TorConfig& GetTorConfig() const { return config_; }
   int64_t GetTorPid() const { return tor_pid_; }
+  // Percentage of the tor bootstrap, 100 when tor is connected
+  int GetBootstrapProgress() const { return bootstrap_progress_; }
 
   void AddObserver(tor::TorProfileServiceImpl* serice);
   void RemoveObserver(tor::TorProfileServiceImpl* service);
@@ -36,10 +39,13 @@ class TorLauncherFactory {
   friend struct base::DefaultSingletonTraits<TorLauncherFactory>;
 
   TorLauncherFactory();
-  ~TorLauncherFactory();
+  ~TorLauncherFactory() override;
 
   bool SetConfig(const tor::TorConfig& config);
 
+  // tor::mojom::TorLauncherObserver
+  void OnBootstrapProgress(int32_t progress) override;
+
   void OnTorLauncherCrashed();
   void OnTorCrashed(int64_t pid);
   void OnTorLaunched(bool result, int64_t pid);
@@ -47,8 +53,10 @@ class TorLauncherFactory {
   bool is_starting_;
 
   mojo::Remote<tor::mojom::TorLauncher> tor_launcher_;
+  mojo::Receiver<tor::mojom::TorLauncherObserver> observer_receiver_{this};
 
   int64_t tor_pid_;
+  int bootstrap_progress_;
 
   tor::TorConfig config_;
 
@@ -15,6 +15,7 @@ class TorLauncherServiceObserver : public base::CheckedObserver {
   virtual void OnTorLauncherCrashed() {}
   virtual void OnTorCrashed(int64_t pid) {}
   virtual void OnTorLaunched(bool result, int64_t pid) {}
+  virtual void OnTorBootstrapProgress(int progress) {}
 };
 
 }  // namespace tor
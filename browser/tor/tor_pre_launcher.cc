@@ -0,0 +1,62 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/tor/tor_pre_launcher.h"
+
+#include "base/bind.h"
+#include "base/task/post_task.h"
+#include "brave/browser/tor/tor_launcher_factory.h"
+#include "brave/browser/tor/tor_profile_service.h"
+#include "brave/common/tor/pref_names.h"
+#include "brave/common/tor/tor_common.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace tor {
+
+TorPreLauncher::TorPreLauncher(
+    extensions::BraveTorClientUpdater* tor_client_updater,
+    PrefService* local_state)
+    : tor_client_updater_(tor_client_updater),
+      local_state_(local_state),
+      weak_ptr_factory_(this) {
+  tor_client_updater_->AddObserver(this);
+  OnExecutableReady(tor_client_updater_->GetExecutablePath());
+}
+
+TorPreLauncher::~TorPreLauncher() {
+  tor_client_updater_->RemoveObserver(this);
+}
+
+void TorPreLauncher::OnExecutableReady(const base::FilePath& path) {
+  if (path.empty())
+    return;
+
+  tor_client_updater_->RemoveObserver(this);
+
+  // Best effort UI tasks are deferred until startup is done
+  base::PostTask(
+      FROM_HERE,
+      {content::BrowserThread::UI, base::TaskPriority::BEST_EFFORT},
+      base::BindOnce(&TorPreLauncher::LaunchTor,
+                     weak_ptr_factory_.GetWeakPtr(), path));
+}
+
+void TorPreLauncher::LaunchTor(const base::FilePath& path) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (TorProfileService::IsTorDisabled())
+    return;
+
+  TorLauncherFactory* tor_launcher_factory = TorLauncherFactory::GetInstance();
+  if (tor_launcher_factory->GetTorPid() >= 0)
+    return;
+
+  VLOG(1) << "Pre-launching the tor process";
+  tor_launcher_factory->LaunchTorProcess(
+      TorConfig(path, local_state_->GetString(prefs::kTorProxyString)));
+}
+
+}  // namespace tor
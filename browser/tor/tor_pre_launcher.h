@@ -0,0 +1,41 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_TOR_TOR_PRE_LAUNCHER_H_
+#define BRAVE_BROWSER_TOR_TOR_PRE_LAUNCHER_H_
+
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/browser/extensions/brave_tor_client_updater.h"
+
+class PrefService;
+
+namespace tor {
+
+// Launches the tor process in the background once the browser is idle after
+// startup, so a Tor window opened later finds tor already bootstrapped from
+// the consensus cached in the tor data directory
+class TorPreLauncher : public extensions::BraveTorClientUpdater::Observer {
+ public:
+  TorPreLauncher(extensions::BraveTorClientUpdater* tor_client_updater,
+                 PrefService* local_state);
+  ~TorPreLauncher() override;
+
+ private:
+  // BraveTorClientUpdater::Observer
+  void OnExecutableReady(const base::FilePath& path) override;
+
+  void LaunchTor(const base::FilePath& path);
+
+  extensions::BraveTorClientUpdater* tor_client_updater_;  // NOT OWNED
+  PrefService* local_state_;  // NOT OWNED
+  base::WeakPtrFactory<TorPreLauncher> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(TorPreLauncher);
+};
+
+}  // namespace tor
+
+#endif  // BRAVE_BROWSER_TOR_TOR_PRE_LAUNCHER_H_
@@ -57,6 +57,7 @@ void TorProfileService::RegisterLocalStatePrefs(PrefRegistrySimple* registry) {
       std::string(kTorProxyScheme) + std::string(kTorProxyAddress) + ":" + port;
   registry->RegisterStringPref(prefs::kTorProxyString, tor_proxy_uri);
   registry->RegisterBooleanPref(prefs::kTorDisabled, false);
+  registry->RegisterBooleanPref(prefs::kTorPreLaunch, false);
 }
 
 // static
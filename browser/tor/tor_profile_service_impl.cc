@@ -201,6 +201,11 @@ void TorProfileServiceImpl::NotifyTorLaunched(bool result, int64_t pid) {
     observer.OnTorLaunched(result, pid);
 }
 
+void TorProfileServiceImpl::NotifyTorBootstrapProgress(int progress) {
+  for (auto& observer : observers_)
+    observer.OnTorBootstrapProgress(progress);
+}
+
 std::unique_ptr<net::ProxyConfigService>
 TorProfileServiceImpl::CreateProxyConfigService() {
   proxy_config_service_ = new net::ProxyConfigServiceTor(GetTorProxyURI());
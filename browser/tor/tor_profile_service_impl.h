@@ -45,6 +45,7 @@ class TorProfileServiceImpl : public TorProfileService,
   void NotifyTorLauncherCrashed();
   void NotifyTorCrashed(int64_t pid);
   void NotifyTorLaunched(bool result, int64_t pid);
+  void NotifyTorBootstrapProgress(int progress);
 
  private:
   void LaunchTor();
@@ -20,9 +20,7 @@
 #include "chrome/browser/ui/views/chrome_layout_provider.h"
 #include "chrome/browser/ui/views/chrome_typography.h"
 #include "components/grit/components_scaled_resources.h"
-#include "content/public/browser/browser_context.h"
 #include "content/public/browser/navigation_controller.h"
-#include "content/public/browser/storage_partition.h"
 #include "content/public/browser/web_contents.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/resource/resource_bundle.h"
@@ -54,11 +52,7 @@ BraveWaybackMachineInfoBarContentsView::BraveWaybackMachineInfoBarContentsView(
     content::WebContents* contents)
     : infobar_(infobar),
       contents_(contents),
-      wayback_machine_url_fetcher_(
-          this,
-          content::BrowserContext::GetDefaultStoragePartition(
-              contents->GetBrowserContext())->
-                  GetURLLoaderFactoryForBrowserProcess()) {
+      wayback_machine_url_fetcher_(this, contents->GetBrowserContext()) {
   SetLayoutManager(std::make_unique<views::FlexLayout>());
   InitializeChildren();
 }
@@ -6,11 +6,15 @@
 #include "brave/browser/ui/webui/brave_adblock_ui.h"
 
 #include "brave/browser/brave_browser_process_impl.h"
+#include "brave/browser/net/brave_request_latency.h"
 #include "brave/common/pref_names.h"
 #include "brave/common/webui_url_constants.h"
 #include "brave/components/brave_adblock/resources/grit/brave_adblock_generated_map.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 #include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/https_everywhere_service.h"
+#include "brave/components/brave_shields/browser/referrer_whitelist_service.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/grit/brave_components_resources.h"
 #include "components/prefs/pref_change_registrar.h"
@@ -22,6 +26,17 @@
 
 namespace {
 
+base::Value CacheStatsToValue(const std::string& name,
+                              const brave_shields::LookupCacheStats& stats) {
+  base::Value value(base::Value::Type::DICTIONARY);
+  value.SetStringKey("name", name);
+  value.SetDoubleKey("hits", static_cast<double>(stats.hits));
+  value.SetDoubleKey("misses", static_cast<double>(stats.misses));
+  value.SetIntKey("size", static_cast<int>(stats.size));
+  value.SetIntKey("capacity", static_cast<int>(stats.capacity));
+  return value;
+}
+
 class AdblockDOMHandler : public content::WebUIMessageHandler {
  public:
   AdblockDOMHandler();
@@ -32,8 +47,10 @@ class AdblockDOMHandler : public content::WebUIMessageHandler {
 
  private:
   void HandleEnableFilterList(const base::ListValue* args);
+  void HandleGetCacheStats(const base::ListValue* args);
   void HandleGetCustomFilters(const base::ListValue* args);
   void HandleGetRegionalLists(const base::ListValue* args);
+  void HandleGetRequestLatency(const base::ListValue* args);
   void HandleUpdateCustomFilters(const base::ListValue* args);
 
   DISALLOW_COPY_AND_ASSIGN(AdblockDOMHandler);
@@ -48,6 +65,10 @@ void AdblockDOMHandler::RegisterMessages() {
       "brave_adblock.enableFilterList",
       base::BindRepeating(&AdblockDOMHandler::HandleEnableFilterList,
                           base::Unretained(this)));
+  web_ui()->RegisterMessageCallback(
+      "brave_adblock.getCacheStats",
+      base::BindRepeating(&AdblockDOMHandler::HandleGetCacheStats,
+                          base::Unretained(this)));
   web_ui()->RegisterMessageCallback(
       "brave_adblock.getCustomFilters",
       base::BindRepeating(&AdblockDOMHandler::HandleGetCustomFilters,
@@ -56,6 +77,10 @@ void AdblockDOMHandler::RegisterMessages() {
       "brave_adblock.getRegionalLists",
       base::BindRepeating(&AdblockDOMHandler::HandleGetRegionalLists,
                           base::Unretained(this)));
+  web_ui()->RegisterMessageCallback(
+      "brave_adblock.getRequestLatency",
+      base::BindRepeating(&AdblockDOMHandler::HandleGetRequestLatency,
+                          base::Unretained(this)));
   web_ui()->RegisterMessageCallback(
       "brave_adblock.updateCustomFilters",
       base::BindRepeating(&AdblockDOMHandler::HandleUpdateCustomFilters,
@@ -74,6 +99,42 @@ void AdblockDOMHandler::HandleEnableFilterList(const base::ListValue* args) {
       ->EnableFilterList(uuid, enabled);
 }
 
+void AdblockDOMHandler::HandleGetCacheStats(const base::ListValue* args) {
+  DCHECK_EQ(args->GetSize(), 0U);
+  if (!web_ui()->CanCallJavascript())
+    return;
+  base::Value cache_stats(base::Value::Type::LIST);
+  cache_stats.Append(CacheStatsToValue(
+      "Ad block decisions",
+      g_brave_browser_process->ad_block_service()->GetDecisionCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "Regional ad block decisions",
+      g_brave_browser_process->ad_block_regional_service_manager()
+          ->GetDecisionCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "Custom filter decisions",
+      g_brave_browser_process->ad_block_custom_filters_service()
+          ->GetDecisionCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "Cosmetic resources",
+      g_brave_browser_process->ad_block_service()
+          ->GetCosmeticResourcesCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "Regional cosmetic resources",
+      g_brave_browser_process->ad_block_regional_service_manager()
+          ->GetCosmeticResourcesCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "HTTPS Everywhere",
+      g_brave_browser_process->https_everywhere_service()
+          ->GetRecentlyUsedCacheStats()));
+  cache_stats.Append(CacheStatsToValue(
+      "Referrer whitelist",
+      g_brave_browser_process->referrer_whitelist_service()
+          ->GetIOThreadCacheStats()));
+  web_ui()->CallJavascriptFunctionUnsafe("brave_adblock.onGetCacheStats",
+                                         cache_stats);
+}
+
 void AdblockDOMHandler::HandleGetCustomFilters(const base::ListValue* args) {
   DCHECK_EQ(args->GetSize(), 0U);
   const std::string custom_filters =
@@ -96,6 +157,14 @@ void AdblockDOMHandler::HandleGetRegionalLists(const base::ListValue* args) {
                                          *regional_lists);
 }
 
+void AdblockDOMHandler::HandleGetRequestLatency(const base::ListValue* args) {
+  DCHECK_EQ(args->GetSize(), 0U);
+  if (!web_ui()->CanCallJavascript())
+    return;
+  web_ui()->CallJavascriptFunctionUnsafe("brave_adblock.onGetRequestLatency",
+                                         brave::GetRequestLatencySummary());
+}
+
 void AdblockDOMHandler::HandleUpdateCustomFilters(const base::ListValue* args) {
   DCHECK_EQ(args->GetSize(), 1U);
   std::string custom_filters;
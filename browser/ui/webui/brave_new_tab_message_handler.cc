@@ -40,6 +40,9 @@ using ntp_background_images::ViewCounterServiceFactory;
 
 namespace {
 
+constexpr base::TimeDelta kStatsUpdateInterval =
+    base::TimeDelta::FromMilliseconds(500);
+
 bool IsPrivateNewTab(Profile* profile) {
   return brave::IsTorProfile(profile) ||
          profile->IsIncognitoProfile() ||
@@ -256,6 +259,7 @@ void BraveNewTabMessageHandler::OnJavascriptAllowed() {
 
 void BraveNewTabMessageHandler::OnJavascriptDisallowed() {
   pref_change_registrar_.RemoveAll();
+  stats_update_timer_.Stop();
 }
 
 void BraveNewTabMessageHandler::HandleGetPreferences(
@@ -270,6 +274,7 @@ void BraveNewTabMessageHandler::HandleGetStats(const base::ListValue* args) {
   AllowJavascript();
   PrefService* prefs = profile_->GetPrefs();
   auto data = GetStatsDictionary(prefs);
+  last_sent_stats_ = data.Clone();
   ResolveJavascriptCallback(args->GetList()[0], data);
 }
 
@@ -368,8 +373,34 @@ void BraveNewTabMessageHandler::OnPrivatePropertiesChanged() {
 }
 
 void BraveNewTabMessageHandler::OnStatsChanged() {
+  if (stats_update_timer_.IsRunning()) {
+    return;
+  }
+
+  stats_update_timer_.Start(FROM_HERE, kStatsUpdateInterval,
+      base::BindOnce(&BraveNewTabMessageHandler::SendStatsUpdate,
+          base::Unretained(this)));
+}
+
+void BraveNewTabMessageHandler::SendStatsUpdate() {
   PrefService* prefs = profile_->GetPrefs();
-  auto data = GetStatsDictionary(prefs);
+  auto stats = GetStatsDictionary(prefs);
+
+  base::DictionaryValue data;
+  for (const auto& item : stats.DictItems()) {
+    const base::Value* last_sent = last_sent_stats_.FindKey(item.first);
+    if (last_sent && *last_sent == item.second) {
+      continue;
+    }
+
+    data.SetKey(item.first, item.second.Clone());
+  }
+
+  if (data.empty()) {
+    return;
+  }
+
+  last_sent_stats_ = std::move(stats);
   FireWebUIListener("stats-updated", data);
 }
 
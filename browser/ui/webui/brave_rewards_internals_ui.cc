@@ -150,6 +150,13 @@ void RewardsInternalsDOMHandler::OnGetRewardsInternalsInfo(
     }
     info_dict.SetList("currentReconciles", std::move(current_reconciles));
     info_dict.SetInteger("bootStamp", info->boot_stamp);
+    base::Value performance_counters(base::Value::Type::DICTIONARY);
+    for (const auto& counter : info->performance_counters) {
+      performance_counters.SetDoubleKey(
+          counter.first,
+          static_cast<double>(counter.second));
+    }
+    info_dict.SetKey("performanceCounters", std::move(performance_counters));
   }
   web_ui()->CallJavascriptFunctionUnsafe(
       "brave_rewards_internals.onGetRewardsInternalsInfo", info_dict);
@@ -16,6 +16,7 @@
 #include "base/i18n/time_formatting.h"
 #include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/common/webui_url_constants.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
@@ -80,6 +81,14 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void UpdateAdsRewards(const base::ListValue* args);
   void OnContentSiteList(
       std::unique_ptr<brave_rewards::ContentSiteList>);
+  void GetContentSitePage(
+      const uint64_t request_id,
+      const std::string& cursor_publisher_key,
+      const double cursor_percentage);
+  void OnContentSitePage(
+      const uint64_t request_id,
+      const bool first_page,
+      std::unique_ptr<brave_rewards::ContentSiteList> list);
   void OnExcludedSiteList(
       std::unique_ptr<brave_rewards::ContentSiteList>);
   void ExcludePublisher(const base::ListValue* args);
@@ -134,6 +143,8 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void OnGetPendingContributionsTotal(double amount);
   void OnContentSiteUpdated(
       brave_rewards::RewardsService* rewards_service) override;
+  void ScheduleUpdate(const uint32_t sections);
+  void OnUpdateTimer();
   void GetTransactionHistory(const base::ListValue* args);
   void GetRewardsMainEnabled(const base::ListValue* args);
   void OnGetRewardsMainEnabled(bool enabled);
@@ -299,6 +310,18 @@ class RewardsDOMHandler : public WebUIMessageHandler,
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
   brave_ads::AdsService* ads_service_;
+
+  // Auto contribute list is sent page by page, pages of an older request are
+  // dropped
+  uint64_t content_site_request_id_ = 0;
+  std::unique_ptr<brave_rewards::AutoContributeProps> content_site_props_;
+
+  // Observer notifications come in bursts during reconcile, so the sections
+  // they touch are marked dirty and sent once per frame
+  uint32_t dirty_sections_ = 0;
+  std::unique_ptr<brave_rewards::ContentSiteList> normalized_content_sites_;
+  base::OneShotTimer update_timer_;
+
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
@@ -308,6 +331,38 @@ namespace {
 
 const int kDaysOfAdsHistory = 7;
 
+const uint32_t kContentSitePageSize = 100;
+
+// One frame at 60 fps
+const int kUpdateDelayMs = 16;
+
+enum UpdateSection : uint32_t {
+  kUpdateContentSites = 1 << 0,
+  kUpdateExcludedSites = 1 << 1,
+  kUpdateTransactionHistory = 1 << 2,
+  kUpdateUnblindedTokens = 1 << 3
+};
+
+std::unique_ptr<base::ListValue> ContentSiteListToValue(
+    const brave_rewards::ContentSiteList& list) {
+  auto publishers = std::make_unique<base::ListValue>();
+  for (auto const& item : list) {
+    auto publisher = std::make_unique<base::DictionaryValue>();
+    publisher->SetString("id", item.id);
+    publisher->SetDouble("percentage", item.percentage);
+    publisher->SetString("publisherKey", item.id);
+    publisher->SetInteger("status", item.status);
+    publisher->SetInteger("excluded", item.excluded);
+    publisher->SetString("name", item.name);
+    publisher->SetString("provider", item.provider);
+    publisher->SetString("url", item.url);
+    publisher->SetString("favIcon", item.favicon_url);
+    publishers->Append(std::move(publisher));
+  }
+
+  return publishers;
+}
+
 }  // namespace
 
 RewardsDOMHandler::RewardsDOMHandler() : weak_factory_(this) {}
@@ -760,22 +815,109 @@ void RewardsDOMHandler::GetReconcileStamp(const base::ListValue* args) {
 
 void RewardsDOMHandler::OnAutoContributePropsReady(
     std::unique_ptr<brave_rewards::AutoContributeProps> props) {
+  content_site_props_ = std::move(props);
+  GetContentSitePage(++content_site_request_id_, "", 0);
+}
+
+void RewardsDOMHandler::GetContentSitePage(
+    const uint64_t request_id,
+    const std::string& cursor_publisher_key,
+    const double cursor_percentage) {
+  if (!rewards_service_ || !content_site_props_) {
+    return;
+  }
+
   rewards_service_->GetContentSiteList(
       0,
-      0,
-      props->contribution_min_time,
-      props->reconcile_stamp,
-      props->contribution_non_verified,
-      props->contribution_min_visits,
-      base::Bind(&RewardsDOMHandler::OnContentSiteList,
-                 weak_factory_.GetWeakPtr()));
+      kContentSitePageSize,
+      content_site_props_->contribution_min_time,
+      content_site_props_->reconcile_stamp,
+      content_site_props_->contribution_non_verified,
+      content_site_props_->contribution_min_visits,
+      cursor_publisher_key,
+      cursor_percentage,
+      base::Bind(&RewardsDOMHandler::OnContentSitePage,
+                 weak_factory_.GetWeakPtr(),
+                 request_id,
+                 cursor_publisher_key.empty()));
+}
+
+void RewardsDOMHandler::OnContentSitePage(
+    const uint64_t request_id,
+    const bool first_page,
+    std::unique_ptr<brave_rewards::ContentSiteList> list) {
+  if (request_id != content_site_request_id_ || !list) {
+    return;
+  }
+
+  if (web_ui()->CanCallJavascript()) {
+    web_ui()->CallJavascriptFunctionUnsafe(
+        first_page
+            ? "brave_rewards.contributeList"
+            : "brave_rewards.contributeListPage",
+        *ContentSiteListToValue(*list));
+  }
+
+  if (list->size() < kContentSitePageSize) {
+    return;
+  }
+
+  const auto& last = list->back();
+  GetContentSitePage(request_id, last.id, last.percentage);
 }
 
 void RewardsDOMHandler::OnContentSiteUpdated(
     brave_rewards::RewardsService* rewards_service) {
-  rewards_service_->GetAutoContributeProps(
-      base::Bind(&RewardsDOMHandler::OnAutoContributePropsReady,
-        weak_factory_.GetWeakPtr()));
+  // A newer list has to be read from the database
+  normalized_content_sites_.reset();
+  ScheduleUpdate(kUpdateContentSites);
+}
+
+void RewardsDOMHandler::ScheduleUpdate(const uint32_t sections) {
+  dirty_sections_ |= sections;
+  if (update_timer_.IsRunning()) {
+    return;
+  }
+
+  update_timer_.Start(
+      FROM_HERE,
+      base::TimeDelta::FromMilliseconds(kUpdateDelayMs),
+      base::BindOnce(&RewardsDOMHandler::OnUpdateTimer,
+          base::Unretained(this)));
+}
+
+void RewardsDOMHandler::OnUpdateTimer() {
+  const uint32_t sections = dirty_sections_;
+  dirty_sections_ = 0;
+
+  if (sections & kUpdateContentSites) {
+    if (normalized_content_sites_) {
+      OnContentSiteList(std::move(normalized_content_sites_));
+    } else if (rewards_service_) {
+      rewards_service_->GetAutoContributeProps(
+          base::Bind(&RewardsDOMHandler::OnAutoContributePropsReady,
+            weak_factory_.GetWeakPtr()));
+    }
+  }
+
+  if (!web_ui()->CanCallJavascript()) {
+    return;
+  }
+
+  if (sections & kUpdateExcludedSites) {
+    web_ui()->CallJavascriptFunctionUnsafe(
+        "brave_rewards.excludedSiteChanged");
+  }
+
+  if (sections & kUpdateTransactionHistory) {
+    web_ui()->CallJavascriptFunctionUnsafe(
+        "brave_rewards.transactionHistoryChanged");
+  }
+
+  if (sections & kUpdateUnblindedTokens) {
+    web_ui()->CallJavascriptFunctionUnsafe(
+        "brave_rewards.unblindedTokensReady");
+  }
 }
 
 void RewardsDOMHandler::GetExcludedSites(const base::ListValue* args) {
@@ -788,11 +930,7 @@ void RewardsDOMHandler::OnExcludedSitesChanged(
     brave_rewards::RewardsService* rewards_service,
     std::string publisher_id,
     bool excluded) {
-  if (!web_ui()->CanCallJavascript()) {
-    return;
-  }
-
-  web_ui()->CallJavascriptFunctionUnsafe("brave_rewards.excludedSiteChanged");
+  ScheduleUpdate(kUpdateExcludedSites);
 }
 
 void RewardsDOMHandler::OnNotificationAdded(
@@ -918,24 +1056,12 @@ void RewardsDOMHandler::RestorePublisher(const base::ListValue *args) {
 
 void RewardsDOMHandler::OnContentSiteList(
     std::unique_ptr<brave_rewards::ContentSiteList> list) {
-  if (web_ui()->CanCallJavascript()) {
-    auto publishers = std::make_unique<base::ListValue>();
-    for (auto const& item : *list) {
-      auto publisher = std::make_unique<base::DictionaryValue>();
-      publisher->SetString("id", item.id);
-      publisher->SetDouble("percentage", item.percentage);
-      publisher->SetString("publisherKey", item.id);
-      publisher->SetInteger("status", item.status);
-      publisher->SetInteger("excluded", item.excluded);
-      publisher->SetString("name", item.name);
-      publisher->SetString("provider", item.provider);
-      publisher->SetString("url", item.url);
-      publisher->SetString("favIcon", item.favicon_url);
-      publishers->Append(std::move(publisher));
-    }
+  // Full list replaces any list which is still being paged in
+  content_site_request_id_++;
 
+  if (web_ui()->CanCallJavascript()) {
     web_ui()->CallJavascriptFunctionUnsafe(
-        "brave_rewards.contributeList", *publishers);
+        "brave_rewards.contributeList", *ContentSiteListToValue(*list));
   }
 }
 
@@ -1372,7 +1498,9 @@ void RewardsDOMHandler::OnRewardsMainEnabled(
 void RewardsDOMHandler::OnPublisherListNormalized(
     brave_rewards::RewardsService* rewards_service,
     const brave_rewards::ContentSiteList& list) {
-  OnContentSiteList(std::make_unique<brave_rewards::ContentSiteList>(list));
+  normalized_content_sites_ =
+      std::make_unique<brave_rewards::ContentSiteList>(list);
+  ScheduleUpdate(kUpdateContentSites);
 }
 
 void RewardsDOMHandler::GetTransactionHistory(
@@ -1411,10 +1539,7 @@ void RewardsDOMHandler::OnTransactionHistory(
 
 void RewardsDOMHandler::OnTransactionHistoryChanged(
     brave_rewards::RewardsService* rewards_service) {
-  if (web_ui()->CanCallJavascript()) {
-    web_ui()->CallJavascriptFunctionUnsafe(
-        "brave_rewards.transactionHistoryChanged");
-  }
+  ScheduleUpdate(kUpdateTransactionHistory);
 }
 
 void RewardsDOMHandler::GetRewardsMainEnabled(
@@ -1702,11 +1827,7 @@ void RewardsDOMHandler::OnlyAnonWallet(const base::ListValue* args) {
 
 void RewardsDOMHandler::OnUnblindedTokensReady(
     brave_rewards::RewardsService* rewards_service) {
-  if (!web_ui()->CanCallJavascript()) {
-    return;
-  }
-
-  web_ui()->CallJavascriptFunctionUnsafe("brave_rewards.unblindedTokensReady");
+  ScheduleUpdate(kUpdateUnblindedTokens);
 }
 
 void RewardsDOMHandler::ReconcileStampReset() {
@@ -777,6 +777,17 @@ void CustomizeWebUIHTMLSource(const std::string &name,
         { "adsBlocked", IDS_ADBLOCK_TOTAL_ADS_BLOCKED },
         { "customFiltersTitle", IDS_ADBLOCK_CUSTOM_FILTERS_TITLE },
         { "customFiltersInstructions", IDS_ADBLOCK_CUSTOM_FILTERS_INSTRUCTIONS },                // NOLINT
+        { "cacheStatsTitle", IDS_ADBLOCK_CACHE_STATS_TITLE },
+        { "cacheStatsName", IDS_ADBLOCK_CACHE_STATS_NAME },
+        { "cacheStatsHits", IDS_ADBLOCK_CACHE_STATS_HITS },
+        { "cacheStatsMisses", IDS_ADBLOCK_CACHE_STATS_MISSES },
+        { "cacheStatsSize", IDS_ADBLOCK_CACHE_STATS_SIZE },
+        { "requestLatencyTitle", IDS_ADBLOCK_REQUEST_LATENCY_TITLE },
+        { "requestLatencyName", IDS_ADBLOCK_REQUEST_LATENCY_NAME },
+        { "requestLatencyCount", IDS_ADBLOCK_REQUEST_LATENCY_COUNT },
+        { "requestLatencyMean", IDS_ADBLOCK_REQUEST_LATENCY_MEAN },
+        { "requestLatencyP50", IDS_ADBLOCK_REQUEST_LATENCY_P50 },
+        { "requestLatencyP99", IDS_ADBLOCK_REQUEST_LATENCY_P99 },
       }
     }, {
       std::string("tip"), {
@@ -834,6 +845,7 @@ void CustomizeWebUIHTMLSource(const std::string &name,
         { "currentReconcile", IDS_BRAVE_REWARDS_INTERNALS_CURRENT_RECONCILE },
         { "invalid", IDS_BRAVE_REWARDS_INTERNALS_INVALID },
         { "keyInfoSeed", IDS_BRAVE_REWARDS_INTERNALS_KEY_INFO_SEED },
+        { "performanceCounters", IDS_BRAVE_REWARDS_INTERNALS_PERFORMANCE_COUNTERS },             // NOLINT
         { "personaId", IDS_BRAVE_REWARDS_INTERNALS_PERSONA_ID },
         { "processorBraveTokens", IDS_BRAVE_UI_PROCESSOR_BRAVE_TOKENS },
         { "processorUphold", IDS_BRAVE_UI_PROCESSOR_UPHOLD },
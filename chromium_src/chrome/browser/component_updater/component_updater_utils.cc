@@ -11,12 +11,17 @@
 
 namespace component_updater {
 
-void BraveOnDemandUpdate(const std::string& component_id) {
+void BraveOnDemandUpdate(const std::vector<std::string>& component_ids) {
   component_updater::ComponentUpdateService* cus =
       g_browser_process->component_updater();
-  cus->GetOnDemandUpdater().OnDemandUpdate(
-      component_id, component_updater::OnDemandUpdater::Priority::FOREGROUND,
-      component_updater::Callback());
+  // OnDemandUpdater takes a single id, so the deduplicated batch is sent one
+  // component at a time from here.
+  auto& on_demand_updater = cus->GetOnDemandUpdater();
+  for (const auto& component_id : component_ids) {
+    on_demand_updater.OnDemandUpdate(
+        component_id, component_updater::OnDemandUpdater::Priority::FOREGROUND,
+        component_updater::Callback());
+  }
 }
 
 }  // namespace component_updater
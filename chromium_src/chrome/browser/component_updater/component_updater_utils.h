@@ -7,12 +7,13 @@
 #define BRAVE_CHROMIUM_SRC_CHROME_BROWSER_COMPONENT_UPDATER_COMPONENT_UPDATER_UTILS_H_
 
 #include <string>
+#include <vector>
 
 #include "../../../../../chrome/browser/component_updater/component_updater_utils.h"
 
 namespace component_updater {
 
-void BraveOnDemandUpdate(const std::string& component_id);
+void BraveOnDemandUpdate(const std::vector<std::string>& component_ids);
 
 }  // namespace component_updater
 
@@ -19,7 +19,7 @@ namespace component_updater {
 void OnCRLSetRegistered() {
 // https://github.com/brave/browser-android-tabs/issues/857
 #if !defined(OS_ANDROID)
-  component_updater::BraveOnDemandUpdate(crl_set_extension_id);
+  component_updater::BraveOnDemandUpdate({crl_set_extension_id});
 #endif
 }
 
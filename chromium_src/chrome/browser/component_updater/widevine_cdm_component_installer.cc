@@ -16,7 +16,7 @@
 namespace component_updater {
 
 void OnWidevineRegistered() {
-  component_updater::BraveOnDemandUpdate(widevine_extension_id);
+  component_updater::BraveOnDemandUpdate({widevine_extension_id});
 }
 
 void RegisterAndInstallWidevine() {
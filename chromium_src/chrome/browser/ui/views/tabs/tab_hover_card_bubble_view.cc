@@ -11,6 +11,7 @@
 #include "chrome/browser/ui/views/tabs/tab_hover_card_bubble_view.h"
 #include "content/public/common/url_constants.h"
 #include "ui/views/controls/label.h"
+#include "ui/views/widget/widget.h"
 
 #define TabHoverCardBubbleView TabHoverCardBubbleView_ChromiumImpl
 #include "../../../../../../chrome/browser/ui/views/tabs/tab_hover_card_bubble_view.cc"
@@ -34,6 +35,60 @@ void TabHoverCardBubbleView_ChromiumImpl::BraveUpdateCardContent(
   }
 }
 
+namespace {
+
+// Sweeping across a large tab strip hovers a new tab every few milliseconds.
+// Content updates of a visible card are limited to this interval, the card
+// keeps sliding to the hovered tab in between.
+constexpr base::TimeDelta kMinCardContentUpdateInterval =
+    base::TimeDelta::FromMilliseconds(50);
+
+}  // namespace
+
 void TabHoverCardBubbleView::UpdateCardContent(const Tab* tab) {
+  // Nothing to relayout when hovering back onto the tab the card shows.
+  if (last_tab_.view() == tab && last_tab_data_ == tab->data()) {
+    deferred_update_timer_.Stop();
+    deferred_tab_.SetView(nullptr);
+    return;
+  }
+
+  const base::TimeDelta since_last_update =
+      base::TimeTicks::Now() - last_update_time_;
+  if (!GetWidget() || !GetWidget()->IsVisible() ||
+      since_last_update >= kMinCardContentUpdateInterval) {
+    deferred_update_timer_.Stop();
+    deferred_tab_.SetView(nullptr);
+    ApplyCardContent(tab);
+    return;
+  }
+
+  // Only the latest tab matters once the timer fires.
+  deferred_tab_.SetView(const_cast<Tab*>(tab));
+  if (!deferred_update_timer_.IsRunning()) {
+    deferred_update_timer_.Start(
+        FROM_HERE, kMinCardContentUpdateInterval - since_last_update, this,
+        &TabHoverCardBubbleView::OnDeferredUpdateTimer);
+  }
+}
+
+void TabHoverCardBubbleView::ApplyCardContent(const Tab* tab) {
   BraveUpdateCardContent(tab);
+  last_tab_.SetView(const_cast<Tab*>(tab));
+  last_tab_data_ = tab->data();
+  last_update_time_ = base::TimeTicks::Now();
+}
+
+void TabHoverCardBubbleView::OnDeferredUpdateTimer() {
+  // The tracker drops tabs which were closed in the meantime.
+  Tab* tab = static_cast<Tab*>(deferred_tab_.view());
+  deferred_tab_.SetView(nullptr);
+  if (!tab || !GetWidget() || !GetWidget()->IsVisible() ||
+      GetDesiredAnchorView() != tab) {
+    return;
+  }
+
+  // Goes through UpdateCardContent again, which applies the content now, and
+  // resizes the card or retargets its slide animation for the new content.
+  UpdateAndShow(tab);
 }
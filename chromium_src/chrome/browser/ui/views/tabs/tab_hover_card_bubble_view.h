@@ -6,6 +6,11 @@
 #ifndef BRAVE_CHROMIUM_SRC_CHROME_BROWSER_UI_VIEWS_TABS_TAB_HOVER_CARD_BUBBLE_VIEW_H_
 #define BRAVE_CHROMIUM_SRC_CHROME_BROWSER_UI_VIEWS_TABS_TAB_HOVER_CARD_BUBBLE_VIEW_H_
 
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "chrome/browser/ui/tabs/tab_renderer_data.h"
+#include "ui/views/view_tracker.h"
+
 // Inject a protected method that will have access to the private members of the
 // base class. Then, we can call this method from the subclass' override.
 #define BRAVE_TAB_HOVER_CARD_BUBBLE_VIEW_H_ \
@@ -26,6 +31,16 @@ class TabHoverCardBubbleView : public TabHoverCardBubbleView_ChromiumImpl {
 
  private:
   void UpdateCardContent(const Tab* tab) override;
+  void ApplyCardContent(const Tab* tab);
+  void OnDeferredUpdateTimer();
+
+  // The tab and data the card content was last built from.
+  views::ViewTracker last_tab_;
+  TabRendererData last_tab_data_;
+  base::TimeTicks last_update_time_;
+  // Latest tab hovered while updates were rate limited.
+  views::ViewTracker deferred_tab_;
+  base::OneShotTimer deferred_update_timer_;
 
   DISALLOW_COPY_AND_ASSIGN(TabHoverCardBubbleView);
 };
@@ -8,7 +8,8 @@
 
 #define BRAVE_COMPONENT_UPDATER_SERVICE_H_                \
  private:                                                 \
-  friend void BraveOnDemandUpdate(const std::string&);    \
+  friend void BraveOnDemandUpdate(                        \
+      const std::vector<std::string>&);                   \
                                                           \
  public:
 #include "../../../../components/component_updater/component_updater_service.h"
@@ -5,8 +5,46 @@
 #include "brave/components/content_settings/core/browser/brave_content_settings_ephemeral_provider.h"
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+// Brave shields settings are looked up through the host index of
+// BravePrefProvider instead of walking all of its rules. The same goes for
+// every setting of BraveEphemeralProvider, which private profiles consult
+// before the pref provider.
+#define BRAVE_GET_WEBSITE_SETTING_INTERNAL                                    \
+  if (it->first == EPHEMERAL_PROVIDER) {                                      \
+    std::unique_ptr<base::Value> value;                                       \
+    if (static_cast<content_settings::BraveEphemeralProvider*>(               \
+            it->second.get())                                                 \
+            ->GetIndexedWebsiteSetting(primary_url, secondary_url,            \
+                                       content_type, resource_identifier,     \
+                                       &value, primary_pattern,               \
+                                       secondary_pattern)) {                  \
+      if (value) {                                                            \
+        if (info)                                                             \
+          info->source = kProviderNamesSourceMap[it->first].provider_source;  \
+        return value;                                                         \
+      }                                                                       \
+      continue;                                                               \
+    }                                                                         \
+  }                                                                           \
+  if (it->first == PREF_PROVIDER) {                                           \
+    std::unique_ptr<base::Value> value;                                       \
+    if (static_cast<content_settings::BravePrefProvider*>(it->second.get())   \
+            ->GetIndexedWebsiteSetting(primary_url, secondary_url,            \
+                                       content_type, resource_identifier,     \
+                                       is_off_the_record_, &value,            \
+                                       primary_pattern, secondary_pattern)) { \
+      if (value) {                                                            \
+        if (info)                                                             \
+          info->source = kProviderNamesSourceMap[it->first].provider_source;  \
+        return value;                                                         \
+      }                                                                       \
+      continue;                                                               \
+    }                                                                         \
+  }
+
 #define EphemeralProvider BraveEphemeralProvider
 #define PrefProvider BravePrefProvider
 #include "../../../../../../components/content_settings/core/browser/host_content_settings_map.cc"
 #undef EphemeralProvider
 #undef PrefProvider
+#undef BRAVE_GET_WEBSITE_SETTING_INTERNAL
@@ -41,19 +41,17 @@ void OnNudgeSyncCycle(WeakHandle<SyncEngineImpl> sync_engine_impl,
 }
 
 void OnPollSyncCycleOnOwnerThread(base::WeakPtr<SyncEngineImpl> sync_engine,
-                                  GetRecordsCallback cb,
-                                  base::WaitableEvent* wevent) {
+                                  GetRecordsCallback cb) {
   if (sync_engine.get())
     static_cast<BraveProfileSyncService*>(
         BraveGetSyncEngineHost(sync_engine.get()))
-        ->OnPollSyncCycle(std::move(cb), wevent);
+        ->OnPollSyncCycle(std::move(cb));
 }
 
 void OnPollSyncCycle(WeakHandle<SyncEngineImpl> sync_engine_impl,
-                     GetRecordsCallback cb,
-                     base::WaitableEvent* wevent) {
+                     GetRecordsCallback cb) {
   sync_engine_impl.Call(FROM_HERE, &OnPollSyncCycleOnOwnerThread,
-                        base::Passed(&cb), wevent);
+                        base::Passed(&cb));
 }
 #endif
 
@@ -39,11 +39,10 @@ void OnNudgeSyncCycle(base::WeakPtr<ProfileSyncService> profile_sync_service,
 }
 
 void OnPollSyncCycle(base::WeakPtr<ProfileSyncService> profile_sync_service,
-                     brave_sync::GetRecordsCallback cb,
-                     base::WaitableEvent* wevent) {
+                     brave_sync::GetRecordsCallback cb) {
   if (profile_sync_service.get()) {
     static_cast<BraveProfileSyncService*>(profile_sync_service.get())
-        ->OnPollSyncCycle(std::move(cb), wevent);
+        ->OnPollSyncCycle(std::move(cb));
   }
 }
 #endif
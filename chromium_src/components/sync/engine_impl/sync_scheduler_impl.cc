@@ -5,6 +5,10 @@
 
 #include "components/sync/engine_impl/sync_scheduler_impl.h"
 
+#include <memory>
+#include <utility>
+
+#include "base/bind.h"
 #include "brave/components/brave_sync/jslib_messages.h"
 
 namespace syncer {
@@ -15,18 +19,46 @@ void SyncSchedulerImpl::OnNudgeSyncCycle(
   nudge_sync_cycle_delegate_function_.Run(std::move(records_list));
 }
 
-void SyncSchedulerImpl::OnPollSyncCycle(brave_sync::GetRecordsCallback cb,
-                                        base::WaitableEvent* wevent) {
+void SyncSchedulerImpl::OnPollSyncCycle(brave_sync::GetRecordsCallback cb) {
   DCHECK(poll_sync_cycle_delegate_function_);
-  poll_sync_cycle_delegate_function_.Run(std::move(cb), wevent);
+  poll_sync_cycle_delegate_function_.Run(std::move(cb));
+}
+
+// Brave records are fetched by the sync extension on the UI thread. Rather
+// than blocking the sync sequence until they arrive, the cycle job returns and
+// is tried again once they are handed back. Jobs tried in the meantime are
+// covered by that one
+bool SyncSchedulerImpl::DownloadBraveRecordsIfNeeded() {
+  if (mode_ == CONFIGURATION_MODE)
+    return false;
+
+  if (brave_records_downloaded_) {
+    brave_records_downloaded_ = false;
+    return false;
+  }
+
+  if (brave_records_download_pending_)
+    return true;
+
+  brave_records_download_pending_ = true;
+  OnPollSyncCycle(base::BindOnce(&SyncSchedulerImpl::OnBraveRecordsDownloaded,
+                                 weak_ptr_factory_.GetWeakPtr()));
+  return true;
+}
+
+void SyncSchedulerImpl::OnBraveRecordsDownloaded(
+    std::unique_ptr<brave_sync::RecordsList> records) {
+  DCHECK(brave_records_download_pending_);
+  brave_records_download_pending_ = false;
+  brave_records_downloaded_ = true;
+  syncer_->AddBraveRecords(std::move(records));
+  TrySyncCycleJob();
 }
 
 }  // namespace syncer
 
 #define BRAVE_SYNC_SCHEDULER_IMPL_TRY_SYNC_CYCLE_JOB \
-  SyncCycle cycle(cycle_context_, this);             \
-  if (mode_ != CONFIGURATION_MODE) {                 \
-    syncer_->DownloadBraveRecords(&cycle);           \
-  }
+  if (DownloadBraveRecordsIfNeeded())                \
+    return;
 
 #include "../../../../../components/sync/engine_impl/sync_scheduler_impl.cc"  // NOLINT
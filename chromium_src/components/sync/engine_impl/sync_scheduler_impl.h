@@ -10,13 +10,17 @@
 
 #define BRAVE_SYNC_SCHEDULER_IMPL_H_                                       \
   void OnNudgeSyncCycle(brave_sync::RecordsListPtr records_list) override; \
-  void OnPollSyncCycle(brave_sync::GetRecordsCallback cb,                  \
-                       base::WaitableEvent* wevent) override;              \
+  void OnPollSyncCycle(brave_sync::GetRecordsCallback cb) override;        \
                                                                            \
  private:                                                                  \
   friend class SyncManagerImpl;                                            \
+  bool DownloadBraveRecordsIfNeeded();                                     \
+  void OnBraveRecordsDownloaded(                                           \
+      std::unique_ptr<brave_sync::RecordsList> records);                   \
   brave_sync::NudgeSyncCycleDelegate nudge_sync_cycle_delegate_function_;  \
-  brave_sync::PollSyncCycleDelegate poll_sync_cycle_delegate_function_;
+  brave_sync::PollSyncCycleDelegate poll_sync_cycle_delegate_function_;    \
+  bool brave_records_download_pending_ = false;                            \
+  bool brave_records_downloaded_ = false;
 
 #include "../../../../../components/sync/engine_impl/sync_scheduler_impl.h"
 #undef BRAVE_SYNC_SCHEDULER_IMPL_H_
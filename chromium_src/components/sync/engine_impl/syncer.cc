@@ -8,27 +8,14 @@
 #include <memory>
 #include <utility>
 
-#include "base/bind.h"
-
 #include "../../../../../components/sync/engine_impl/syncer.cc"  // NOLINT
 
 namespace syncer {
 
-using brave_sync::GetRecordsCallback;
 using brave_sync::RecordsList;
 
-void Syncer::OnGetRecords(std::unique_ptr<RecordsList> records) {
+void Syncer::AddBraveRecords(std::unique_ptr<RecordsList> records) {
   brave_records_ = std::move(records);
 }
 
-void Syncer::DownloadBraveRecords(SyncCycle* cycle) {
-  // syncer will be alive as long as sync is enabled
-  brave_records_.reset();
-  brave_sync::GetRecordsCallback on_get_records =
-      base::BindOnce(&Syncer::OnGetRecords, base::Unretained(this));
-  base::WaitableEvent wevent;
-  cycle->delegate()->OnPollSyncCycle(std::move(on_get_records), &wevent);
-  wevent.Wait();
-}
-
 }  // namespace syncer
@@ -9,12 +9,11 @@
 #include "brave/components/brave_sync/jslib_messages.h"
 #include "brave/components/brave_sync/jslib_messages_fwd.h"
 
-#define BRAVE_SYNCER_H                                                 \
- public:                                                               \
-  void DownloadBraveRecords(SyncCycle* cycle);                         \
-                                                                       \
- private:                                                              \
-  void OnGetRecords(std::unique_ptr<brave_sync::RecordsList> records); \
+#define BRAVE_SYNCER_H                                                    \
+ public:                                                                  \
+  void AddBraveRecords(std::unique_ptr<brave_sync::RecordsList> records); \
+                                                                          \
+ private:                                                                 \
   std::unique_ptr<brave_sync::RecordsList> brave_records_;
 
 #include "../../../../../components/sync/engine_impl/syncer.h"
@@ -13,18 +13,135 @@
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/platform/audio/vector_math.h"
 #include "third_party/blink/renderer/platform/bindings/script_state.h"
 #include "third_party/blink/renderer/platform/graphics/image_data_buffer.h"
 #include "third_party/blink/renderer/platform/graphics/static_bitmap_image.h"
 #include "third_party/blink/renderer/platform/graphics/unaccelerated_static_bitmap_image.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
 #include "third_party/blink/renderer/platform/supplementable.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/threading.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkPixmap.h"
 
 namespace brave {
 
 const char kBraveSessionToken[] = "brave_session_token";
 const char BraveSessionCache::kSupplementName[] = "BraveSessionCache";
 
+namespace {
+
+struct DomainKey {
+  uint8_t key[32];
+};
+
+// Bounds the renderer wide cache, it's dropped when full
+constexpr wtf_size_t kMaxCachedDomainKeys = 256;
+
+uint64_t ReadSessionKey() {
+  base::CommandLine* cmd_line = base::CommandLine::ForCurrentProcess();
+  DCHECK(cmd_line->HasSwitch(kBraveSessionToken));
+  uint64_t session_key = 0;
+  base::StringToUint64(cmd_line->GetSwitchValueASCII(kBraveSessionToken),
+                       &session_key);
+  return session_key;
+}
+
+// The session token can't change during the lifetime of a renderer, so domain
+// keys computed by one document are reused by every document (iframes, same
+// site navigations) of the same eTLD+1
+void GetDomainKey(uint64_t session_key,
+                  const std::string& domain,
+                  uint8_t* domain_key,
+                  size_t domain_key_size) {
+  DCHECK(IsMainThread());
+  DCHECK_EQ(domain_key_size, sizeof(DomainKey::key));
+  using DomainKeyMap = WTF::HashMap<String, DomainKey>;
+  DEFINE_STATIC_LOCAL(DomainKeyMap, domain_keys, ());
+
+  const String cache_key = String::FromUTF8(domain.data(), domain.size());
+  auto it = domain_keys.find(cache_key);
+  if (it != domain_keys.end()) {
+    memcpy(domain_key, it->value.key, domain_key_size);
+    return;
+  }
+
+  crypto::HMAC h(crypto::HMAC::SHA256);
+  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_key),
+               sizeof session_key));
+  CHECK(h.Sign(domain, domain_key, domain_key_size));
+
+  if (domain_keys.size() >= kMaxCachedDomainKeys)
+    domain_keys.clear();
+  DomainKey value;
+  memcpy(value.key, domain_key, domain_key_size);
+  domain_keys.insert(cache_key, value);
+}
+
+// Both work on RGBA pixel data, 4 bytes per pixel, and don't touch the
+// document so they can run on any thread
+void PerturbBalancedPixels(uint64_t session_key,
+                           const uint8_t* domain_key,
+                           uint8_t* pixels,
+                           int width,
+                           int height) {
+  // This needs to be type size_t because we pass it to base::StringPiece
+  // later for content hashing. This is safe because the maximum canvas
+  // dimensions are less than SIZE_T_MAX. (Width and height are each
+  // limited to 32,767 pixels.)
+  const size_t pixel_count = static_cast<size_t>(width) * height;
+  // choose which channel (R, G, or B) to perturb
+  const uint8_t* first_byte = domain_key;
+  uint8_t channel = *first_byte % 3;
+  // calculate initial seed to find first pixel to perturb, based on session
+  // key, domain key, and canvas contents
+  crypto::HMAC h(crypto::HMAC::SHA256);
+  uint64_t session_plus_domain_key =
+      session_key ^ *reinterpret_cast<const uint64_t*>(domain_key);
+  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
+               sizeof session_plus_domain_key));
+  uint8_t canvas_key[32];
+  CHECK(h.Sign(
+      base::StringPiece(reinterpret_cast<const char*>(pixels), pixel_count),
+      canvas_key, sizeof canvas_key));
+  uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key);
+  const uint64_t zero = 0;
+  uint64_t pixel_index;
+  // iterate through 32-byte canvas key and use each bit to determine how to
+  // perturb the current pixel
+  for (int i = 0; i < 32; i++) {
+    uint8_t bit = canvas_key[i];
+    for (int j = 8; j >= 0; j--) {
+      pixel_index = 4 * (v % pixel_count) + channel;
+      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
+      bit = bit >> 1;
+      // find next pixel to perturb
+      v = ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+    }
+  }
+}
+
+void PerturbMaxPixels(const uint8_t* domain_key,
+                      uint8_t* pixels,
+                      int width,
+                      int height) {
+  const uint64_t count = 4 * static_cast<uint64_t>(width) * height;
+  // initial seed based on domain key
+  uint64_t v = *reinterpret_cast<const uint64_t*>(domain_key);
+  const uint64_t zero = 0;
+  // iterate through pixel data and overwrite with next value in PRNG sequence
+  for (uint64_t i = 0; i < count; i++) {
+    pixels[i] = v % 256;
+    v = ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+  }
+}
+
+}  // namespace
+
 BraveSessionCache::BraveSessionCache(Document& document)
     : Supplement<Document>(document) {
   base::StringPiece host =
@@ -33,14 +150,15 @@ BraveSessionCache::BraveSessionCache(Document& document)
       host, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
   farbling_enabled_ = !domain.empty();
   if (farbling_enabled_) {
-    base::CommandLine* cmd_line = base::CommandLine::ForCurrentProcess();
-    DCHECK(cmd_line->HasSwitch(kBraveSessionToken));
-    base::StringToUint64(cmd_line->GetSwitchValueASCII(kBraveSessionToken),
-                         &session_key_);
-    crypto::HMAC h(crypto::HMAC::SHA256);
-    CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_key_),
-                 sizeof session_key_));
-    CHECK(h.Sign(domain, domain_key_, sizeof domain_key_));
+    static const uint64_t session_key = ReadSessionKey();
+    session_key_ = session_key;
+    GetDomainKey(session_key_, domain, domain_key_, sizeof domain_key_);
+
+    const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
+    const double maxUInt64AsDouble = UINT64_MAX;
+    fudge_factor_ = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
+    VLOG(1) << "audio fudge factor (based on session token) = "
+            << fudge_factor_;
   }
 }
 
@@ -55,14 +173,34 @@ BraveSessionCache& BraveSessionCache::From(Document& document) {
 }
 
 double BraveSessionCache::GetFudgeFactor() {
-  double fudge_factor = 1.0;
-  if (farbling_enabled_) {
-    const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
-    const double maxUInt64AsDouble = UINT64_MAX;
-    fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
-    VLOG(1) << "audio fudge factor (based on session token) = " << fudge_factor;
-  }
-  return fudge_factor;
+  return fudge_factor_;
+}
+
+void BraveSessionCache::FarbleAudioChannel(blink::DOMFloat32Array* channel) {
+  if (!farbling_enabled_ || !channel || IsAudioChannelFarbled(channel))
+    return;
+
+  FarbleAudioSamples(channel->Data(), channel->lengthAsSizeT());
+  farbled_audio_channels_.insert(channel);
+}
+
+bool BraveSessionCache::IsAudioChannelFarbled(
+    blink::DOMFloat32Array* channel) const {
+  return farbled_audio_channels_.Contains(channel);
+}
+
+void BraveSessionCache::FarbleAudioSamples(float* samples, size_t count) {
+  if (!farbling_enabled_ || !count)
+    return;
+
+  const float fudge_factor = static_cast<float>(fudge_factor_);
+  blink::vector_math::Vsmul(samples, 1, &fudge_factor, samples, 1,
+                            static_cast<uint32_t>(count));
+}
+
+void BraveSessionCache::Trace(blink::Visitor* visitor) {
+  visitor->Trace(farbled_audio_channels_);
+  Supplement<Document>::Trace(visitor);
 }
 
 scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbPixels(
@@ -71,9 +209,25 @@ scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbPixels(
   if (!farbling_enabled_ || !frame || !frame->GetContentSettingsClient()) {
     return image_bitmap;
   }
-  switch (frame->GetContentSettingsClient()->GetBraveFarblingLevel()) {
-    case BraveFarblingLevel::OFF:
-      break;
+  const BraveFarblingLevel level =
+      frame->GetContentSettingsClient()->GetBraveFarblingLevel();
+  if (level == BraveFarblingLevel::OFF || !image_bitmap ||
+      image_bitmap->IsNull()) {
+    return image_bitmap;
+  }
+
+  // Reading the id doesn't read back accelerated images
+  sk_sp<SkImage> sk_image =
+      image_bitmap->PaintImageForCurrentFrame().GetSkImage();
+  const uint32_t source_id = sk_image ? sk_image->uniqueID() : 0;
+  if (source_id) {
+    scoped_refptr<blink::StaticBitmapImage> cached_image =
+        GetPerturbedImage(source_id, level);
+    if (cached_image)
+      return cached_image;
+  }
+
+  switch (level) {
     case BraveFarblingLevel::BALANCED: {
       image_bitmap = PerturbBalanced(image_bitmap);
       break;
@@ -85,9 +239,34 @@ scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbPixels(
     default:
       NOTREACHED();
   }
+
+  if (source_id)
+    AddPerturbedImage(source_id, level, image_bitmap);
   return image_bitmap;
 }
 
+scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::GetPerturbedImage(
+    uint32_t source_id,
+    BraveFarblingLevel level) {
+  for (const auto& perturbed_image : perturbed_images_) {
+    if (perturbed_image.source_id == source_id &&
+        perturbed_image.level == level) {
+      return perturbed_image.image;
+    }
+  }
+  return nullptr;
+}
+
+void BraveSessionCache::AddPerturbedImage(
+    uint32_t source_id,
+    BraveFarblingLevel level,
+    scoped_refptr<blink::StaticBitmapImage> image) {
+  // Only the latest snapshots are kept, every entry holds a full RGBA copy
+  if (perturbed_images_.size() == kPerturbedImageCacheSize)
+    perturbed_images_.EraseAt(0);
+  perturbed_images_.push_back(PerturbedImage{source_id, level, image});
+}
+
 scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbBalanced(
     scoped_refptr<blink::StaticBitmapImage> image_bitmap) {
   DCHECK(image_bitmap);
@@ -97,41 +276,9 @@ scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbBalanced(
   // per pixel
   std::unique_ptr<blink::ImageDataBuffer> data_buffer =
       blink::ImageDataBuffer::Create(image_bitmap);
-  uint8_t* pixels = const_cast<uint8_t*>(data_buffer->Pixels());
-  // This needs to be type size_t because we pass it to base::StringPiece
-  // later for content hashing. This is safe because the maximum canvas
-  // dimensions are less than SIZE_T_MAX. (Width and height are each
-  // limited to 32,767 pixels.)
-  const size_t pixel_count = data_buffer->Width() * data_buffer->Height();
-  // choose which channel (R, G, or B) to perturb
-  const uint8_t* first_byte = reinterpret_cast<const uint8_t*>(domain_key_);
-  uint8_t channel = *first_byte % 3;
-  // calculate initial seed to find first pixel to perturb, based on session
-  // key, domain key, and canvas contents
-  crypto::HMAC h(crypto::HMAC::SHA256);
-  uint64_t session_plus_domain_key =
-      session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_);
-  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
-               sizeof session_plus_domain_key));
-  uint8_t canvas_key[32];
-  CHECK(h.Sign(
-      base::StringPiece(reinterpret_cast<const char*>(pixels), pixel_count),
-      canvas_key, sizeof canvas_key));
-  uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key);
-  const uint64_t zero = 0;
-  uint64_t pixel_index;
-  // iterate through 32-byte canvas key and use each bit to determine how to
-  // perturb the current pixel
-  for (int i = 0; i < 32; i++) {
-    uint8_t bit = canvas_key[i];
-    for (int j = 8; j >= 0; j--) {
-      pixel_index = 4 * (v % pixel_count) + channel;
-      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
-      bit = bit >> 1;
-      // find next pixel to perturb
-      v = ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
-    }
-  }
+  PerturbBalancedPixels(session_key_, domain_key_,
+                        const_cast<uint8_t*>(data_buffer->Pixels()),
+                        data_buffer->Width(), data_buffer->Height());
   // convert back to a StaticBitmapImage to return to the caller
   scoped_refptr<blink::StaticBitmapImage> perturbed_bitmap =
       blink::UnacceleratedStaticBitmapImage::Create(
@@ -148,16 +295,8 @@ scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbMax(
   // per pixel
   std::unique_ptr<blink::ImageDataBuffer> data_buffer =
       blink::ImageDataBuffer::Create(image_bitmap);
-  uint8_t* pixels = const_cast<uint8_t*>(data_buffer->Pixels());
-  const uint64_t count = 4 * data_buffer->Width() * data_buffer->Height();
-  // initial seed based on domain key
-  uint64_t v = *reinterpret_cast<uint64_t*>(domain_key_);
-  const uint64_t zero = 0;
-  // iterate through pixel data and overwrite with next value in PRNG sequence
-  for (uint64_t i = 0; i < count; i++) {
-    pixels[i] = v % 256;
-    v = ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
-  }
+  PerturbMaxPixels(domain_key_, const_cast<uint8_t*>(data_buffer->Pixels()),
+                   data_buffer->Width(), data_buffer->Height());
   // convert back to a StaticBitmapImage to return to the caller
   scoped_refptr<blink::StaticBitmapImage> perturbed_bitmap =
       blink::UnacceleratedStaticBitmapImage::Create(
@@ -165,6 +304,55 @@ scoped_refptr<blink::StaticBitmapImage> BraveSessionCache::PerturbMax(
   return perturbed_bitmap;
 }
 
+std::unique_ptr<BraveCanvasFarbler> BraveSessionCache::GetCanvasFarbler(
+    blink::LocalFrame* frame) {
+  if (!farbling_enabled_ || !frame || !frame->GetContentSettingsClient()) {
+    return nullptr;
+  }
+  const BraveFarblingLevel level =
+      frame->GetContentSettingsClient()->GetBraveFarblingLevel();
+  if (level == BraveFarblingLevel::OFF)
+    return nullptr;
+
+  auto farbler = std::make_unique<BraveCanvasFarbler>();
+  farbler->level = level;
+  farbler->session_key = session_key_;
+  memcpy(farbler->domain_key, domain_key_, sizeof domain_key_);
+  return farbler;
+}
+
+sk_sp<SkImage> BraveCanvasFarbler::Perturb(const SkPixmap& pixmap) const {
+  if (pixmap.width() <= 0 || pixmap.height() <= 0)
+    return nullptr;
+  // normalize the pixel data to RGBA, 4 bytes per pixel, the same way
+  // ImageDataBuffer does for the snapshots farbled on the main thread
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(pixmap.info()
+                                 .makeColorType(kRGBA_8888_SkColorType)
+                                 .makeAlphaType(kUnpremul_SkAlphaType)) ||
+      !pixmap.readPixels(bitmap.pixmap())) {
+    return nullptr;
+  }
+
+  uint8_t* pixels = static_cast<uint8_t*>(bitmap.getPixels());
+  switch (level) {
+    case BraveFarblingLevel::BALANCED: {
+      PerturbBalancedPixels(session_key, domain_key, pixels, bitmap.width(),
+                            bitmap.height());
+      break;
+    }
+    case BraveFarblingLevel::MAXIMUM: {
+      PerturbMaxPixels(domain_key, pixels, bitmap.width(), bitmap.height());
+      break;
+    }
+    default:
+      NOTREACHED();
+  }
+
+  bitmap.setImmutable();
+  return SkImage::MakeFromBitmap(bitmap);
+}
+
 }  // namespace brave
 
 #include "../../../../../../third_party/blink/renderer/core/dom/document.cc"
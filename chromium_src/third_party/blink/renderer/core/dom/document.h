@@ -8,6 +8,18 @@
 
 #include "../../../../../../../third_party/blink/renderer/core/dom/document.h"
 
+#include <memory>
+
+#include "brave/third_party/blink/renderer/brave_farbling_constants.h"
+#include "third_party/blink/renderer/core/typed_arrays/dom_typed_array.h"
+#include "third_party/blink/renderer/platform/heap/heap_allocator.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+
+class SkImage;
+class SkPixmap;
+
 using blink::Document;
 using blink::GarbageCollected;
 using blink::HeapObjectHeader;
@@ -22,6 +34,21 @@ class StaticBitmapImage;
 }  // namespace blink
 
 namespace brave {
+
+// Keys to farble canvas pixels with, a copy doesn't need the document and can
+// be used on any thread
+struct CORE_EXPORT BraveCanvasFarbler {
+  USING_FAST_MALLOC(BraveCanvasFarbler);
+
+ public:
+  BraveFarblingLevel level;
+  uint64_t session_key;
+  uint8_t domain_key[32];
+
+  // Returns a farbled RGBA copy of |pixmap|, null if it can't be read
+  sk_sp<SkImage> Perturb(const SkPixmap& pixmap) const;
+};
+
 class CORE_EXPORT BraveSessionCache final
     : public GarbageCollected<BraveSessionCache>,
       public Supplement<Document> {
@@ -36,14 +63,44 @@ class CORE_EXPORT BraveSessionCache final
   static BraveSessionCache& From(Document&);
 
   double GetFudgeFactor();
+  // Scales |channel| by the fudge factor once, repeated getChannelData calls
+  // neither rescan the buffer nor compound the factor
+  void FarbleAudioChannel(blink::DOMFloat32Array* channel);
+  bool IsAudioChannelFarbled(blink::DOMFloat32Array* channel) const;
+  void FarbleAudioSamples(float* samples, size_t count);
   scoped_refptr<blink::StaticBitmapImage> PerturbPixels(
       blink::LocalFrame* frame,
       scoped_refptr<blink::StaticBitmapImage> image_bitmap);
+  // Null if canvas pixels of |frame| are not farbled
+  std::unique_ptr<BraveCanvasFarbler> GetCanvasFarbler(
+      blink::LocalFrame* frame);
+
+  void Trace(blink::Visitor* visitor) override;
 
  private:
+  // Perturbed snapshots are reused while the canvas is unchanged, snapshots
+  // of an unchanged canvas share the same SkImage unique id
+  struct PerturbedImage {
+    uint32_t source_id;
+    BraveFarblingLevel level;
+    scoped_refptr<blink::StaticBitmapImage> image;
+  };
+  static constexpr wtf_size_t kPerturbedImageCacheSize = 4;
+
+  scoped_refptr<blink::StaticBitmapImage> GetPerturbedImage(
+      uint32_t source_id,
+      BraveFarblingLevel level);
+  void AddPerturbedImage(uint32_t source_id,
+                         BraveFarblingLevel level,
+                         scoped_refptr<blink::StaticBitmapImage> image);
+
   bool farbling_enabled_;
   uint64_t session_key_;
   uint8_t domain_key_[32];
+  double fudge_factor_ = 1.0;
+  blink::HeapHashSet<blink::WeakMember<blink::DOMFloat32Array>>
+      farbled_audio_channels_;
+  WTF::Vector<PerturbedImage, kPerturbedImageCacheSize> perturbed_images_;
 
   scoped_refptr<blink::StaticBitmapImage> PerturbBalanced(
       scoped_refptr<blink::StaticBitmapImage> image_bitmap);
@@ -4,14 +4,68 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/platform/graphics/unaccelerated_static_bitmap_image.h"
+#include "third_party/blink/renderer/platform/scheduler/public/post_cross_thread_task.h"
+#include "third_party/blink/renderer/platform/scheduler/public/worker_pool.h"
+#include "third_party/blink/renderer/platform/wtf/cross_thread_functional.h"
 
-#define BRAVE_CANVAS_ASYNC_BLOB_CREATOR                               \
-  Document* document = Document::From(context);                       \
-  if (document) {                                                     \
-    image_ = brave::BraveSessionCache::From(*document).PerturbPixels( \
-        document->GetFrame(), image_);                                \
+#define BRAVE_CANVAS_ASYNC_BLOB_CREATOR                                    \
+  Document* document = Document::From(context);                            \
+  if (document) {                                                          \
+    farbler_ = brave::BraveSessionCache::From(*document).GetCanvasFarbler( \
+        document->GetFrame());                                             \
   }
 
+#define BRAVE_CANVAS_ASYNC_BLOB_CREATOR_SCHEDULE_ASYNC_BLOB_CREATION \
+  if (FarbleOnWorkerThreadIfNeeded(quality))                         \
+    return;
+
 #include "../../../../../../../third_party/blink/renderer/core/html/canvas/canvas_async_blob_creator.cc"  // NOLINT
 
+#undef BRAVE_CANVAS_ASYNC_BLOB_CREATOR_SCHEDULE_ASYNC_BLOB_CREATION
 #undef BRAVE_CANVAS_ASYNC_BLOB_CREATOR
+
+namespace blink {
+
+bool CanvasAsyncBlobCreator::FarbleOnWorkerThreadIfNeeded(double quality) {
+  if (!farbler_ || !static_bitmap_image_loaded_)
+    return false;
+
+  DCHECK(IsMainThread());
+  worker_pool::PostTask(
+      FROM_HERE,
+      CrossThreadBindOnce(
+          &CanvasAsyncBlobCreator::FarbleImageOnWorkerThread,
+          WrapCrossThreadPersistent(this),
+          context_->GetTaskRunner(TaskType::kCanvasBlobSerialization),
+          quality));
+  return true;
+}
+
+void CanvasAsyncBlobCreator::FarbleImageOnWorkerThread(
+    scoped_refptr<base::SingleThreadTaskRunner> reply,
+    double quality) {
+  DCHECK(!IsMainThread());
+  farbled_image_ = farbler_->Perturb(src_data_);
+  PostCrossThreadTask(
+      *reply, FROM_HERE,
+      CrossThreadBindOnce(&CanvasAsyncBlobCreator::OnImageFarbled,
+                          WrapCrossThreadPersistent(this), quality));
+}
+
+void CanvasAsyncBlobCreator::OnImageFarbled(double quality) {
+  DCHECK(IsMainThread());
+  farbler_.reset();
+  if (farbled_image_) {
+    image_ = UnacceleratedStaticBitmapImage::Create(std::move(farbled_image_));
+    static_bitmap_image_loaded_ =
+        image_->PaintImageForCurrentFrame().GetSkImage()->peekPixels(
+            &src_data_);
+  } else {
+    // The pixels are never encoded without farbling
+    static_bitmap_image_loaded_ = false;
+  }
+  ScheduleAsyncBlobCreation(quality);
+}
+
+}  // namespace blink
@@ -0,0 +1,29 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_CORE_HTML_CANVAS_CANVAS_ASYNC_BLOB_CREATOR_H_
+#define BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_CORE_HTML_CANVAS_CANVAS_ASYNC_BLOB_CREATOR_H_
+
+#include <memory>
+
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+// The image is farbled on a worker thread before it is encoded, rather than
+// on the main thread when toBlob is called
+#define BRAVE_CANVAS_ASYNC_BLOB_CREATOR_H                 \
+  bool FarbleOnWorkerThreadIfNeeded(double quality);      \
+  void FarbleImageOnWorkerThread(                         \
+      scoped_refptr<base::SingleThreadTaskRunner> reply,  \
+      double quality);                                    \
+  void OnImageFarbled(double quality);                    \
+  std::unique_ptr<brave::BraveCanvasFarbler> farbler_;    \
+  sk_sp<SkImage> farbled_image_;
+
+#include "../../../../../../../third_party/blink/renderer/core/html/canvas/canvas_async_blob_creator.h"
+
+#undef BRAVE_CANVAS_ASYNC_BLOB_CREATOR_H
+
+#endif  // BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_CORE_HTML_CANVAS_CANVAS_ASYNC_BLOB_CREATOR_H_
@@ -6,33 +6,22 @@
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/modules/webaudio/analyser_node.h"
 
-#define BRAVE_AUDIOBUFFER_GETCHANNELDATA                            \
-  NotShared<DOMFloat32Array> array = getChannelData(channel_index); \
-  LocalDOMWindow* window = LocalDOMWindow::From(script_state);      \
-  if (window) {                                                     \
-    DOMFloat32Array* destination_array = array.View();              \
-    size_t len = destination_array->lengthAsSizeT();                \
-    if (len > 0) {                                                  \
-      float* destination = destination_array->Data();               \
-      double fudge_factor =                                         \
-          brave::BraveSessionCache::From(*(window->document()))     \
-              .GetFudgeFactor();                                    \
-      for (unsigned i = 0; i < len; ++i) {                          \
-        destination[i] = destination[i] * fudge_factor;             \
-      }                                                             \
-      return array;                                                 \
-    }                                                               \
-  }
-
-#define BRAVE_AUDIOBUFFER_COPYFROMCHANNEL                      \
+#define BRAVE_AUDIOBUFFER_GETCHANNELDATA                       \
   LocalDOMWindow* window = LocalDOMWindow::From(script_state); \
   if (window) {                                                \
-    double fudge_factor =                                      \
-        brave::BraveSessionCache::From(*(window->document()))  \
-            .GetFudgeFactor();                                 \
-    for (unsigned i = 0; i < count; i++) {                     \
-      dst[i] = dst[i] * fudge_factor;                          \
-    }                                                          \
+    brave::BraveSessionCache::From(*(window->document()))      \
+        .FarbleAudioChannel(channels_[channel_index].Get());   \
+  }
+
+// The source channel may already be farbled in place by getChannelData
+#define BRAVE_AUDIOBUFFER_COPYFROMCHANNEL                              \
+  LocalDOMWindow* window = LocalDOMWindow::From(script_state);         \
+  if (window) {                                                        \
+    brave::BraveSessionCache& session_cache =                          \
+        brave::BraveSessionCache::From(*(window->document()));         \
+    DOMFloat32Array* source_channel = channels_[channel_number].Get(); \
+    if (!session_cache.IsAudioChannelFarbled(source_channel))          \
+      session_cache.FarbleAudioSamples(dst, count);                    \
   }
 
 #include "../../../../../../third_party/blink/renderer/modules/webaudio/audio_buffer.cc"
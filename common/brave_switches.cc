@@ -56,4 +56,8 @@ const char kComponentUpdateIntervalInSec[] = "component-update-interval-in-sec";
 
 // Disables DOH using a runtime flag mainly for network audit
 const char kDisableDnsOverHttps[] = "disable-doh";
+
+// Records the shields decision for every request to a ring file at the given
+// path, see ShieldsTraceWriter for the format
+const char kBraveShieldsTrace[] = "brave-shields-trace";
 }  // namespace switches
@@ -10,6 +10,7 @@ namespace prefs {
 
 const char kTorProxyString[] = "tor.tor_proxy_string";
 const char kTorDisabled[] = "tor.tor_disabled";
+const char kTorPreLaunch[] = "tor.tor_pre_launch";
 
 }  // namespace prefs
 }  // namespace tor
@@ -11,6 +11,7 @@ namespace prefs {
 
 extern const char kTorProxyString[];
 extern const char kTorDisabled[];
+extern const char kTorPreLaunch[];
 
 }  // namespace prefs
 }  // namespace tor
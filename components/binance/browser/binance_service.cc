@@ -18,6 +18,7 @@
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/token.h"
 #include "brave/common/pref_names.h"
@@ -45,6 +46,14 @@ const char oauth_scope[] =
 const char oauth_url[] = "https://accounts.binance.com/en/oauth/authorize";
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// The widget refreshes every 30 seconds, cache balances for less than that so
+// a single NTP still sees fresh numbers on every refresh
+constexpr base::TimeDelta kAccountBalancesTTL =
+    base::TimeDelta::FromSeconds(20);
+constexpr base::TimeDelta kDepositInfoTTL = base::TimeDelta::FromMinutes(10);
+constexpr base::TimeDelta kConvertAssetsTTL = base::TimeDelta::FromHours(1);
+constexpr base::TimeDelta kCoinNetworksTTL = base::TimeDelta::FromHours(1);
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("binance_service", R"(
       semantics {
@@ -163,8 +172,8 @@ bool BinanceService::GetAccountBalances(GetAccountBalancesCallback callback) {
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(oauth_host_, oauth_path_account_balances);
   url = net::AppendQueryParameter(url, "access_token", access_token_);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false);
+  return CachedGetRequest(
+      url, kAccountBalancesTTL, std::move(internal_callback));
 }
 
 void BinanceService::OnGetAccountBalances(GetAccountBalancesCallback callback,
@@ -237,6 +246,96 @@ bool BinanceService::OAuthRequest(const GURL &url,
   return true;
 }
 
+BinanceService::CachedResponse::CachedResponse() = default;
+
+BinanceService::CachedResponse::CachedResponse(CachedResponse&& other) =
+    default;
+
+BinanceService::CachedResponse& BinanceService::CachedResponse::operator=(
+    CachedResponse&& other) = default;
+
+BinanceService::CachedResponse::~CachedResponse() = default;
+
+bool BinanceService::CachedGetRequest(const GURL& url,
+                                      base::TimeDelta ttl,
+                                      URLRequestCallback callback) {
+  const std::string cache_key = url.spec();
+
+  auto cached = response_cache_.find(cache_key);
+  if (cached != response_cache_.end()) {
+    if (base::TimeTicks::Now() < cached->second.expiry) {
+      // Keep the callback asynchronous like a network response
+      base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
+          base::BindOnce(&BinanceService::RunCachedResponse,
+                         weak_factory_.GetWeakPtr(), cache_key,
+                         std::move(callback)));
+      return true;
+    }
+    response_cache_.erase(cached);
+  }
+
+  auto pending = pending_get_requests_.find(cache_key);
+  if (pending != pending_get_requests_.end()) {
+    pending->second.push_back(std::move(callback));
+    return true;
+  }
+
+  pending_get_requests_[cache_key].push_back(std::move(callback));
+  return OAuthRequest(
+      url, "GET", "",
+      base::BindOnce(&BinanceService::OnCachedGetRequestComplete,
+                     base::Unretained(this), cache_key, ttl),
+      true, false);
+}
+
+void BinanceService::OnCachedGetRequestComplete(
+    const std::string& cache_key,
+    base::TimeDelta ttl,
+    const int status, const std::string& body,
+    const std::map<std::string, std::string>& headers) {
+  auto pending = pending_get_requests_.find(cache_key);
+  // The cache was cleared while the request was in flight
+  if (pending == pending_get_requests_.end())
+    return;
+  std::vector<URLRequestCallback> callbacks = std::move(pending->second);
+  pending_get_requests_.erase(pending);
+
+  // Errors are not cached so the next refresh tries again
+  if (status >= 200 && status <= 299) {
+    CachedResponse& response = response_cache_[cache_key];
+    response.status = status;
+    response.body = body;
+    response.headers = headers;
+    response.expiry = base::TimeTicks::Now() + ttl;
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(status, body, headers);
+}
+
+void BinanceService::RunCachedResponse(const std::string& cache_key,
+                                       URLRequestCallback callback) {
+  auto cached = response_cache_.find(cache_key);
+  if (cached == response_cache_.end()) {
+    std::move(callback).Run(-1, "", {});
+    return;
+  }
+
+  std::move(callback).Run(cached->second.status, cached->second.body,
+                          cached->second.headers);
+}
+
+void BinanceService::ClearResponseCache() {
+  response_cache_.clear();
+  // Callers waiting for a request made with the old token get an error
+  auto pending_get_requests = std::move(pending_get_requests_);
+  pending_get_requests_.clear();
+  for (auto& pending : pending_get_requests) {
+    for (auto& callback : pending.second)
+      std::move(callback).Run(-1, "", {});
+  }
+}
+
 void BinanceService::OnURLLoaderComplete(
     SimpleURLLoaderList::iterator iter,
     URLRequestCallback callback,
@@ -268,6 +367,7 @@ bool BinanceService::SetAccessTokens(const std::string& access_token,
                                      const std::string& refresh_token) {
   access_token_ = access_token;
   refresh_token_ = refresh_token;
+  ClearResponseCache();
 
   std::string encrypted_access_token;
   std::string encrypted_refresh_token;
@@ -297,6 +397,7 @@ bool BinanceService::SetAccessTokens(const std::string& access_token,
 void BinanceService::ResetAccessTokens() {
   access_token_ = "";
   refresh_token_ = "";
+  ClearResponseCache();
 
   PrefService* prefs = user_prefs::UserPrefs::Get(context_);
   prefs->SetString(kBinanceAccessToken, access_token_);
@@ -381,8 +482,8 @@ bool BinanceService::GetCoinNetworks(GetCoinNetworksCallback callback) {
   auto internal_callback = base::BindOnce(&BinanceService::OnGetCoinNetworks,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(gateway_host_, gateway_path_networks);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false);
+  return CachedGetRequest(
+      url, kCoinNetworksTTL, std::move(internal_callback));
 }
 
 void BinanceService::OnGetCoinNetworks(
@@ -405,8 +506,8 @@ bool BinanceService::GetDepositInfo(const std::string& symbol,
   url = net::AppendQueryParameter(url, "coin", symbol);
   url = net::AppendQueryParameter(url, "network", ticker_network);
   url = net::AppendQueryParameter(url, "access_token", access_token_);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false);
+  return CachedGetRequest(
+      url, kDepositInfoTTL, std::move(internal_callback));
 }
 
 void BinanceService::OnGetDepositInfo(
@@ -456,8 +557,8 @@ bool BinanceService::GetConvertAssets(GetConvertAssetsCallback callback) {
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(oauth_host_, oauth_path_convert_assets);
   url = net::AppendQueryParameter(url, "access_token", access_token_);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false);
+  return CachedGetRequest(
+      url, kConvertAssetsTTL, std::move(internal_callback));
 }
 
 void BinanceService::OnGetConvertAssets(GetConvertAssetsCallback callback,
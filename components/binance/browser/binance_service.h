@@ -19,6 +19,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_observer.h"
+#include "base/time/time.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -107,6 +108,18 @@ class BinanceService : public KeyedService {
       base::OnceCallback<void(const int, const std::string&,
                               const std::map<std::string, std::string>&)>;
 
+  struct CachedResponse {
+    CachedResponse();
+    CachedResponse(CachedResponse&& other);
+    CachedResponse& operator=(CachedResponse&& other);
+    ~CachedResponse();
+
+    int status = -1;
+    std::string body;
+    std::map<std::string, std::string> headers;
+    base::TimeTicks expiry;
+  };
+
   base::SequencedTaskRunner* io_task_runner();
   void OnGetAccessToken(GetAccessTokenCallback callback,
                            const int status, const std::string& body,
@@ -135,6 +148,17 @@ class BinanceService : public KeyedService {
   bool OAuthRequest(const GURL& url, const std::string& method,
       const std::string& post_data, URLRequestCallback callback,
       bool auto_retry_on_network_change, bool save_send_cookies);
+  // GETs |url| like OAuthRequest, but successful responses are reused for
+  // |ttl| and simultaneous requests for the same url share one load, so
+  // several NTPs refreshing the widget only hit the API once.
+  bool CachedGetRequest(const GURL& url, base::TimeDelta ttl,
+      URLRequestCallback callback);
+  void OnCachedGetRequestComplete(const std::string& cache_key,
+      base::TimeDelta ttl, const int status, const std::string& body,
+      const std::map<std::string, std::string>& headers);
+  void RunCachedResponse(const std::string& cache_key,
+      URLRequestCallback callback);
+  void ClearResponseCache();
   bool LoadTokensFromPrefs();
   void OnURLLoaderComplete(
       SimpleURLLoaderList::iterator iter,
@@ -157,6 +181,8 @@ class BinanceService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+  std::map<std::string, CachedResponse> response_cache_;
+  std::map<std::string, std::vector<URLRequestCallback>> pending_get_requests_;
   base::WeakPtrFactory<BinanceService> weak_factory_;
 
   FRIEND_TEST_ALL_PREFIXES(BinanceAPIBrowserTest, GetOAuthClientURL);
@@ -13,10 +13,19 @@ export const enableFilterList = (uuid: string, enabled: boolean) =>
     enabled
   })
 
+export const getCacheStats = () => action(types.ADBLOCK_GET_CACHE_STATS)
+
 export const getCustomFilters = () => action(types.ADBLOCK_GET_CUSTOM_FILTERS)
 
 export const getRegionalLists = () => action(types.ADBLOCK_GET_REGIONAL_LISTS)
 
+export const getRequestLatency = () => action(types.ADBLOCK_GET_REQUEST_LATENCY)
+
+export const onGetCacheStats = (cacheStats: AdBlock.CacheStats[]) =>
+  action(types.ADBLOCK_ON_GET_CACHE_STATS, {
+    cacheStats
+  })
+
 export const onGetCustomFilters = (customFilters: string) =>
   action(types.ADBLOCK_ON_GET_CUSTOM_FILTERS, {
     customFilters
@@ -27,6 +36,11 @@ export const onGetRegionalLists = (regionalLists: AdBlock.FilterList[]) =>
     regionalLists
   })
 
+export const onGetRequestLatency = (requestLatency: AdBlock.LatencyStats[]) =>
+  action(types.ADBLOCK_ON_GET_REQUEST_LATENCY, {
+    requestLatency
+  })
+
 export const statsUpdated = () => action(types.ADBLOCK_STATS_UPDATED)
 
 export const updateCustomFilters = (customFilters: string) =>
@@ -17,6 +17,11 @@ import * as adblockActions from './actions/adblock_actions'
 window.cr.define('brave_adblock', function () {
   'use strict'
 
+  function getCacheStats () {
+    const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+    actions.getCacheStats()
+  }
+
   function getCustomFilters () {
     const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
     actions.getCustomFilters()
@@ -27,9 +32,18 @@ window.cr.define('brave_adblock', function () {
     actions.getRegionalLists()
   }
 
+  function getRequestLatency () {
+    const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+    actions.getRequestLatency()
+  }
+
   function initialize () {
     getCustomFilters()
     getRegionalLists()
+    getCacheStats()
+    getRequestLatency()
+    // Keep the latency summary live while the page is open
+    window.setInterval(getRequestLatency, 2000)
     render(
       <Provider store={store}>
         <App />
@@ -38,6 +52,11 @@ window.cr.define('brave_adblock', function () {
     window.i18nTemplate.process(window.document, window.loadTimeData)
   }
 
+  function onGetCacheStats (cacheStats: AdBlock.CacheStats[]) {
+    const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+    actions.onGetCacheStats(cacheStats)
+  }
+
   function onGetCustomFilters (customFilters: string) {
     const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
     actions.onGetCustomFilters(customFilters)
@@ -48,6 +67,11 @@ window.cr.define('brave_adblock', function () {
     actions.onGetRegionalLists(regionalLists)
   }
 
+  function onGetRequestLatency (requestLatency: AdBlock.LatencyStats[]) {
+    const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+    actions.onGetRequestLatency(requestLatency)
+  }
+
   function statsUpdated () {
     const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
     actions.statsUpdated()
@@ -55,8 +79,10 @@ window.cr.define('brave_adblock', function () {
 
   return {
     initialize,
+    onGetCacheStats,
     onGetCustomFilters,
     onGetRegionalLists,
+    onGetRequestLatency,
     statsUpdated
   }
 })
@@ -8,8 +8,10 @@ import { connect } from 'react-redux'
 
 // Components
 import { AdBlockItemList } from './adBlockItemList'
+import { CacheStats } from './cacheStats'
 import { CustomFilters } from './customFilters'
 import { NumBlockedStat } from './numBlockedStat'
+import { RequestLatency } from './requestLatency'
 
 // Utils
 import * as adblockActions from '../actions/adblock_actions'
@@ -41,6 +43,8 @@ export class AdblockPage extends React.Component<Props, {}> {
           actions={actions}
           rules={adblockData.settings.customFilters || ''}
         />
+        <CacheStats stats={adblockData.cacheStats || []} />
+        <RequestLatency stats={adblockData.requestLatency || []} />
       </div>
     )
   }
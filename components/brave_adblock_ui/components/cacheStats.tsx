@@ -0,0 +1,38 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+
+interface Props {
+  stats: AdBlock.CacheStats[]
+}
+
+export const CacheStats = (props: Props) => (
+  <div>
+    <div
+      i18n-content='cacheStatsTitle'
+      style={{ fontSize: '18px', marginTop: '20px' }}
+    />
+    <table>
+      <thead>
+        <tr>
+          <th i18n-content='cacheStatsName' />
+          <th i18n-content='cacheStatsHits' />
+          <th i18n-content='cacheStatsMisses' />
+          <th i18n-content='cacheStatsSize' />
+        </tr>
+      </thead>
+      <tbody>
+        {props.stats.map((cache) =>
+          <tr key={cache.name}>
+            <td>{cache.name}</td>
+            <td>{cache.hits}</td>
+            <td>{cache.misses}</td>
+            <td>{cache.size} / {cache.capacity}</td>
+          </tr>
+        )}
+      </tbody>
+    </table>
+  </div>
+)
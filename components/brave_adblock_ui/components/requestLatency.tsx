@@ -0,0 +1,40 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+
+interface Props {
+  stats: AdBlock.LatencyStats[]
+}
+
+export const RequestLatency = (props: Props) => (
+  <div>
+    <div
+      i18n-content='requestLatencyTitle'
+      style={{ fontSize: '18px', marginTop: '20px' }}
+    />
+    <table>
+      <thead>
+        <tr>
+          <th i18n-content='requestLatencyName' />
+          <th i18n-content='requestLatencyCount' />
+          <th i18n-content='requestLatencyMean' />
+          <th i18n-content='requestLatencyP50' />
+          <th i18n-content='requestLatencyP99' />
+        </tr>
+      </thead>
+      <tbody>
+        {props.stats.map((stage) =>
+          <tr key={stage.name}>
+            <td>{stage.name}</td>
+            <td>{stage.count}</td>
+            <td>{Math.round(stage.mean)}</td>
+            <td>{stage.p50}</td>
+            <td>{stage.p99}</td>
+          </tr>
+        )}
+      </tbody>
+    </table>
+  </div>
+)
@@ -4,10 +4,14 @@
 
 export const enum types {
   ADBLOCK_ENABLE_FILTER_LIST = '@@adblock/ADBLOCK_ENABLE_FILTER_LIST',
+  ADBLOCK_GET_CACHE_STATS = '@@adblock/ADBLOCK_GET_CACHE_STATS',
   ADBLOCK_GET_CUSTOM_FILTERS = '@@adblock/ADBLOCK_GET_CUSTOM_FILTERS',
   ADBLOCK_GET_REGIONAL_LISTS = '@@adblock/ADBLOCK_GET_REGIONAL_LISTS',
+  ADBLOCK_GET_REQUEST_LATENCY = '@@adblock/ADBLOCK_GET_REQUEST_LATENCY',
+  ADBLOCK_ON_GET_CACHE_STATS = '@@adblock/ADBLOCK_ON_GET_CACHE_STATS',
   ADBLOCK_ON_GET_CUSTOM_FILTERS = '@@adblock/ADBLOCK_ON_GET_CUSTOM_FILTERS',
   ADBLOCK_ON_GET_REGIONAL_LISTS = '@@adblock/ADBLOCK_ON_GET_REGIONAL_LISTS',
+  ADBLOCK_ON_GET_REQUEST_LATENCY = '@@adblock/ADBLOCK_ON_GET_REQUEST_LATENCY',
   ADBLOCK_STATS_UPDATED = '@@adblock/ADBLOCK_STATS_UPDATED',
   ADBLOCK_UPDATE_CUSTOM_FILTERS = '@@adblock/ADBLOCK_UPDATE_CUSTOM_FILTERS'
 }
@@ -34,18 +34,30 @@ const adblockReducer: Reducer<AdBlock.State | undefined> = (state: AdBlock.State
         }
       }
       break
+    case types.ADBLOCK_GET_CACHE_STATS:
+      chrome.send('brave_adblock.getCacheStats')
+      break
     case types.ADBLOCK_GET_CUSTOM_FILTERS:
       chrome.send('brave_adblock.getCustomFilters')
       break
     case types.ADBLOCK_GET_REGIONAL_LISTS:
       chrome.send('brave_adblock.getRegionalLists')
       break
+    case types.ADBLOCK_GET_REQUEST_LATENCY:
+      chrome.send('brave_adblock.getRequestLatency')
+      break
+    case types.ADBLOCK_ON_GET_CACHE_STATS:
+      state = { ...state, cacheStats: action.payload.cacheStats }
+      break
     case types.ADBLOCK_ON_GET_CUSTOM_FILTERS:
       state = { ...state, settings: { ...state.settings, customFilters: action.payload.customFilters } }
       break
     case types.ADBLOCK_ON_GET_REGIONAL_LISTS:
       state = { ...state, settings: { ...state.settings, regionalLists: action.payload.regionalLists } }
       break
+    case types.ADBLOCK_ON_GET_REQUEST_LATENCY:
+      state = { ...state, requestLatency: action.payload.requestLatency }
+      break
     case types.ADBLOCK_STATS_UPDATED:
       state = storage.getLoadTimeData(state)
       break
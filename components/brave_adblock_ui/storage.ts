@@ -29,7 +29,11 @@ export const getLoadTimeData = (state: AdBlock.State): AdBlock.State => {
 }
 
 export const cleanData = (state: AdBlock.State): AdBlock.State => {
-  return getLoadTimeData(state)
+  state = getLoadTimeData(state)
+  // Cache and latency statistics are fetched fresh on every load
+  delete state.cacheStats
+  delete state.requestLatency
+  return state
 }
 
 export const load = (): AdBlock.State => {
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/browser/ads_service_impl.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -14,7 +15,9 @@
 #include "base/guid.h"
 #include "base/logging.h"
 #include "base/memory/ptr_util.h"
+#include "base/no_destructor.h"
 #include "base/sequenced_task_runner.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
@@ -30,6 +33,7 @@
 #include "brave/components/brave_ads/browser/bundle_state_database.h"
 #include "brave/components/brave_ads/common/pref_names.h"
 #include "brave/components/brave_ads/common/switches.h"
+#include "brave/components/brave_rewards/browser/background_job_scheduler.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
 #include "brave/components/brave_rewards/browser/rewards_p3a.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
@@ -51,13 +55,16 @@
 #include "chrome/browser/first_run/first_run.h"
 #include "chrome/common/buildflags.h"
 #include "chrome/common/chrome_constants.h"
+#include "components/compression/compression_utils.h"
 #include "components/prefs/pref_service.h"
 #include "components/wifi/wifi_service.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/network_service_instance.h"
 #include "content/public/browser/storage_partition.h"
 #include "content/public/common/service_manager_connection.h"
+#include "net/base/net_errors.h"
 #include "net/base/network_change_notifier.h"
+#include "net/base/request_priority.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "services/service_manager/public/cpp/connector.h"
@@ -65,6 +72,7 @@
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/message_center/public/cpp/notification.h"
+#include "url/gurl.h"
 
 #if defined(OS_ANDROID)
 #include "brave/browser/notifications/brave_notification_platform_bridge_helper_android.h"
@@ -85,6 +93,39 @@ const char kRewardsNotificationAdsOnboarding[] =
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// The catalog is the only large response, anything larger is dropped rather
+// than buffered whole
+const size_t kMaxResponseBodySize = 1024 * 1024;
+const size_t kMaxCatalogResponseBodySize = 32 * 1024 * 1024;
+
+size_t GetMaxResponseBodySize(const GURL& url) {
+  if (url.path_piece() == "/v2/catalog") {
+    return kMaxCatalogResponseBodySize;
+  }
+
+  return kMaxResponseBodySize;
+}
+
+const int kIdlePollIntervalInSeconds = 1;
+
+const int kDefaultIdleShutdownDelayInSeconds =
+    15 * base::Time::kSecondsPerMinute;
+
+base::TimeDelta GetIdleShutdownDelay() {
+  int seconds = kDefaultIdleShutdownDelayInSeconds;
+
+  const auto& command_line = *base::CommandLine::ForCurrentProcess();
+  if (command_line.HasSwitch(switches::kIdleShutdownDelay)) {
+    const std::string value =
+        command_line.GetSwitchValueASCII(switches::kIdleShutdownDelay);
+    if (!base::StringToInt(value, &seconds) || seconds < 0) {
+      seconds = kDefaultIdleShutdownDelayInSeconds;
+    }
+  }
+
+  return base::TimeDelta::FromSeconds(seconds);
+}
+
 }  // namespace
 
 namespace {
@@ -111,6 +152,17 @@ static std::map<std::string, int> g_user_model_resource_ids = {
   {"fr", IDR_ADS_USER_MODEL_FR},
 };
 
+std::unique_ptr<std::string> DecompressDataResource(
+    const base::StringPiece data_resource) {
+  auto decompressed_data_resource = std::make_unique<std::string>();
+  if (!compression::GzipUncompress(data_resource,
+      decompressed_data_resource.get())) {
+    return nullptr;
+  }
+
+  return decompressed_data_resource;
+}
+
 int GetUserModelResourceId(
     const std::string& locale) {
   if (g_user_model_resource_ids.find(locale) !=
@@ -248,6 +300,14 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     )");
 }
 
+// Decompressed user models and JSON schemas keyed by resource id. They are
+// the same for every profile, so they are shared by the ads services of all
+// profiles. Only used on the UI thread
+std::map<int, std::string>& GetDataResources() {
+  static base::NoDestructor<std::map<int, std::string>> data_resources;
+  return *data_resources;
+}
+
 }  // namespace
 
 AdsServiceImpl::AdsServiceImpl(Profile* profile) :
@@ -259,6 +319,7 @@ AdsServiceImpl::AdsServiceImpl(Profile* profile) :
             base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
     base_path_(profile_->GetPath().AppendASCII("ads_service")),
     last_idle_state_(ui::IdleState::IDLE_STATE_ACTIVE),
+    is_stopped_for_idle_(false),
     bundle_state_backend_(new BundleStateDatabase(
         base_path_.AppendASCII("bundle_state"))),
     display_service_(NotificationDisplayService::GetForProfile(profile_)),
@@ -280,6 +341,9 @@ AdsServiceImpl::AdsServiceImpl(Profile* profile) :
   profile_pref_change_registrar_.Add(prefs::kIdleThreshold,
       base::Bind(&AdsServiceImpl::OnPrefsChanged, base::Unretained(this)));
 
+  memory_pressure_listener_.reset(new base::MemoryPressureListener(
+      base::Bind(&AdsServiceImpl::OnMemoryPressure, base::Unretained(this))));
+
 #if !defined(OS_ANDROID)
   // TODO(tmancey): Refactor on-boarding to be platform agnostic
   MaybeShowOnboarding();
@@ -355,6 +419,8 @@ void AdsServiceImpl::ChangeLocale(
 void AdsServiceImpl::OnPageLoaded(
     const std::string& url,
     const std::string& content) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -364,6 +430,8 @@ void AdsServiceImpl::OnPageLoaded(
 
 void AdsServiceImpl::OnMediaStart(
     const SessionID& tab_id) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -373,6 +441,8 @@ void AdsServiceImpl::OnMediaStart(
 
 void AdsServiceImpl::OnMediaStop(
     const SessionID& tab_id) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -384,6 +454,8 @@ void AdsServiceImpl::OnTabUpdated(
     const SessionID& tab_id,
     const GURL& url,
     const bool is_active) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -394,6 +466,8 @@ void AdsServiceImpl::OnTabUpdated(
 
 void AdsServiceImpl::OnTabClosed(
     const SessionID& tab_id) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -405,6 +479,8 @@ void AdsServiceImpl::GetAdsHistory(
     const uint64_t from_timestamp,
     const uint64_t to_timestamp,
     OnGetAdsHistoryCallback callback) {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -419,6 +495,12 @@ void AdsServiceImpl::ToggleAdThumbUp(
     const std::string& creative_set_id,
     const int action,
     OnToggleAdThumbUpCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleAdThumbUp(creative_instance_id, creative_set_id, action,
       base::BindOnce(&AdsServiceImpl::OnToggleAdThumbUp, AsWeakPtr(),
           std::move(callback)));
@@ -429,6 +511,12 @@ void AdsServiceImpl::ToggleAdThumbDown(
     const std::string& creative_set_id,
     const int action,
     OnToggleAdThumbDownCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleAdThumbDown(creative_instance_id, creative_set_id, action,
       base::BindOnce(&AdsServiceImpl::OnToggleAdThumbDown, AsWeakPtr(),
           std::move(callback)));
@@ -438,6 +526,12 @@ void AdsServiceImpl::ToggleAdOptInAction(
     const std::string& category,
     const int action,
     OnToggleAdOptInActionCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleAdOptInAction(category, action,
       base::BindOnce(&AdsServiceImpl::OnToggleAdOptInAction, AsWeakPtr(),
           std::move(callback)));
@@ -447,6 +541,12 @@ void AdsServiceImpl::ToggleAdOptOutAction(
     const std::string& category,
     const int action,
     OnToggleAdOptOutActionCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleAdOptOutAction(category, action,
       base::BindOnce(&AdsServiceImpl::OnToggleAdOptOutAction, AsWeakPtr(),
           std::move(callback)));
@@ -457,6 +557,12 @@ void AdsServiceImpl::ToggleSaveAd(
     const std::string& creative_set_id,
     const bool saved,
     OnToggleSaveAdCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleSaveAd(creative_instance_id, creative_set_id, saved,
       base::BindOnce(&AdsServiceImpl::OnToggleSaveAd, AsWeakPtr(),
           std::move(callback)));
@@ -467,6 +573,12 @@ void AdsServiceImpl::ToggleFlagAd(
     const std::string& creative_set_id,
     const bool flagged,
     OnToggleFlagAdCallback callback) {
+  RestartIdleShutdownTimer();
+
+  if (!connected()) {
+    return;
+  }
+
   bat_ads_->ToggleFlagAd(creative_instance_id, creative_set_id, flagged,
       base::BindOnce(&AdsServiceImpl::OnToggleFlagAd, AsWeakPtr(),
           std::move(callback)));
@@ -504,6 +616,7 @@ void AdsServiceImpl::Shutdown() {
   url_loaders_.clear();
 
   idle_poll_timer_.Stop();
+  idle_shutdown_timer_.Stop();
 
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
@@ -536,6 +649,8 @@ void AdsServiceImpl::OnInitialize(
     MaybeViewAdNotification();
 
     StartCheckIdleStateTimer();
+
+    RestartIdleShutdownTimer();
   }
 }
 
@@ -562,6 +677,35 @@ void AdsServiceImpl::OnShutdownBatAds(
   VLOG(1) << "Successfully shutdown ads";
 }
 
+void AdsServiceImpl::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  if (memory_pressure_level !=
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    // Decompressed resources are reloaded from the resource bundle on demand
+    GetDataResources().clear();
+  }
+
+  if (!connected()) {
+    return;
+  }
+
+  switch (memory_pressure_level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE: {
+      return;
+    }
+
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE: {
+      bat_ads_->OnMemoryPressure(ads::MemoryPressureLevel::MODERATE);
+      return;
+    }
+
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL: {
+      bat_ads_->OnMemoryPressure(ads::MemoryPressureLevel::CRITICAL);
+      return;
+    }
+  }
+}
+
 bool AdsServiceImpl::StartService() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK(!connected());
@@ -582,6 +726,7 @@ bool AdsServiceImpl::StartService() {
 
   SetEnvironment();
   UpdateIsDebugFlag();
+  SetLogCategories();
 
   return true;
 }
@@ -622,6 +767,12 @@ void AdsServiceImpl::Start() {
 }
 
 void AdsServiceImpl::Stop() {
+  if (is_stopped_for_idle_) {
+    is_stopped_for_idle_ = false;
+    ResetAllState();
+    return;
+  }
+
   if (!connected()) {
     return;
   }
@@ -629,6 +780,55 @@ void AdsServiceImpl::Stop() {
   ShutdownBatAds();
 }
 
+void AdsServiceImpl::RestartIdleShutdownTimer() {
+  if (is_stopped_for_idle_) {
+    VLOG(1) << "Restarting idle ads service";
+    is_stopped_for_idle_ = false;
+    MaybeStart(false);
+    return;
+  }
+
+  const base::TimeDelta delay = GetIdleShutdownDelay();
+  if (delay.is_zero() || !connected() || !is_initialized_) {
+    return;
+  }
+
+  idle_shutdown_timer_.Start(FROM_HERE, delay, this,
+      &AdsServiceImpl::OnIdleShutdownTimerFired);
+}
+
+void AdsServiceImpl::OnIdleShutdownTimerFired() {
+  if (!connected() || !is_initialized_) {
+    return;
+  }
+
+  // Shutting down removes ad notifications, wait for them and for pending
+  // requests to finish
+  if (!url_loaders_.empty() || !notification_timers_.empty()) {
+    RestartIdleShutdownTimer();
+    return;
+  }
+
+  VLOG(1) << "Stopping idle ads service";
+
+  bat_ads_->Shutdown(base::BindOnce(&AdsServiceImpl::OnIdleShutdown,
+      AsWeakPtr()));
+}
+
+void AdsServiceImpl::OnIdleShutdown(
+    const int32_t result) {
+  if (result != ads::Result::SUCCESS) {
+    VLOG(0) << "Failed to stop idle ads service";
+    return;
+  }
+
+  // State was saved by bat_ads, dropping the service lets the utility
+  // process exit
+  Shutdown();
+
+  is_stopped_for_idle_ = true;
+}
+
 void AdsServiceImpl::ResetAllState() {
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
@@ -713,18 +913,53 @@ bool AdsServiceImpl::IsDebug() const {
   #endif
 }
 
+void AdsServiceImpl::SetLogCategories() {
+  const auto& command_line = *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(switches::kLogCategories)) {
+    return;
+  }
+
+  bat_ads_service_->SetLogCategories(
+      command_line.GetSwitchValueASCII(switches::kLogCategories),
+      base::NullCallback());
+}
+
 void AdsServiceImpl::StartCheckIdleStateTimer() {
 #if !defined(OS_ANDROID)
   idle_poll_timer_.Stop();
 
-  idle_poll_timer_.Start(FROM_HERE, base::TimeDelta::FromSeconds(1), this,
+  idle_poll_timer_.Start(FROM_HERE,
+      base::TimeDelta::FromSeconds(kIdlePollIntervalInSeconds), this,
       &AdsServiceImpl::CheckIdleState);
 #endif
 }
 
 void AdsServiceImpl::CheckIdleState() {
-  auto idle_state = ui::CalculateIdleState(GetIdleThreshold());
+  const int idle_threshold = GetIdleThreshold();
+  const int idle_time = ui::CalculateIdleTime();
+
+  ui::IdleState idle_state;
+  if (ui::CheckIdleStateIsLocked()) {
+    idle_state = ui::IdleState::IDLE_STATE_LOCKED;
+  } else if (idle_time >= idle_threshold) {
+    idle_state = ui::IdleState::IDLE_STATE_IDLE;
+  } else {
+    idle_state = ui::IdleState::IDLE_STATE_ACTIVE;
+  }
+
   ProcessIdleState(idle_state);
+
+  // An active user cannot become idle before the threshold is reached, so
+  // sleep until then instead of waking up every second. Becoming active again
+  // can only be noticed by polling
+  int delay_in_seconds = kIdlePollIntervalInSeconds;
+  if (idle_state == ui::IdleState::IDLE_STATE_ACTIVE) {
+    delay_in_seconds = std::max(idle_threshold - idle_time, delay_in_seconds);
+  }
+
+  idle_poll_timer_.Start(FROM_HERE,
+      base::TimeDelta::FromSeconds(delay_in_seconds), this,
+      &AdsServiceImpl::CheckIdleState);
 }
 
 void AdsServiceImpl::ProcessIdleState(
@@ -734,6 +969,7 @@ void AdsServiceImpl::ProcessIdleState(
   }
 
   if (idle_state == ui::IdleState::IDLE_STATE_ACTIVE) {
+    RestartIdleShutdownTimer();
     bat_ads_->OnUnIdle();
   } else {
     bat_ads_->OnIdle();
@@ -914,7 +1150,16 @@ void AdsServiceImpl::OnURLLoaderComplete(
     }
   }
 
-  callback(response_code, response_body ? *response_body : "", headers);
+  // A body over the size limit is a failed request, not an empty response
+  if (loader->NetError() == net::ERR_INSUFFICIENT_RESOURCES) {
+    VLOG(0) << "Response body of " << loader->GetFinalURL().spec()
+        << " is too large";
+    response_code = -1;
+  }
+
+  const std::string empty_response_body;
+  callback(response_code, response_body ? *response_body : empty_response_body,
+      headers);
 }
 
 bool AdsServiceImpl::CanShowBackgroundNotifications() const {
@@ -1816,10 +2061,7 @@ std::string AdsServiceImpl::GetLocale() const {
 }
 
 const std::string AdsServiceImpl::GetCountryCode() const {
-  const std::string locale = GetLocale();
-  const std::string country_code =
-      brave_l10n::LocaleHelper::GetInstance()->GetCountryCode(locale);
-  return country_code;
+  return brave_l10n::LocaleHelper::GetInstance()->GetCountryCode();
 }
 
 bool AdsServiceImpl::IsNetworkConnectionAvailable() const {
@@ -1851,6 +2093,12 @@ std::vector<std::string> AdsServiceImpl::GetUserModelLanguages() const {
 
 std::string AdsServiceImpl::LoadDataResourceAndDecompressIfNeeded(
     const int id) const {
+  auto& data_resources = GetDataResources();
+  const auto iter = data_resources.find(id);
+  if (iter != data_resources.end()) {
+    return iter->second;
+  }
+
   std::string data_resource;
 
   auto& resource_bundle = ui::ResourceBundle::GetSharedInstance();
@@ -1860,6 +2108,8 @@ std::string AdsServiceImpl::LoadDataResourceAndDecompressIfNeeded(
     data_resource = resource_bundle.GetRawDataResource(id).as_string();
   }
 
+  data_resources[id] = data_resource;
+
   return data_resource;
 }
 
@@ -1867,8 +2117,65 @@ void AdsServiceImpl::LoadUserModelForLanguage(
     const std::string& language,
     ads::LoadCallback callback) const {
   const auto resource_id = GetUserModelResourceId(language);
-  const auto user_model = LoadDataResourceAndDecompressIfNeeded(resource_id);
-  callback(ads::Result::SUCCESS, user_model);
+
+  const auto& data_resources = GetDataResources();
+  const auto iter = data_resources.find(resource_id);
+  if (iter != data_resources.end()) {
+    callback(ads::Result::SUCCESS, iter->second);
+    return;
+  }
+
+  auto& resource_bundle = ui::ResourceBundle::GetSharedInstance();
+  const base::StringPiece data_resource =
+      resource_bundle.GetRawDataResource(resource_id);
+  if (!resource_bundle.IsGzipped(resource_id)) {
+    callback(ads::Result::SUCCESS, data_resource.as_string());
+    return;
+  }
+
+  auto& callbacks = pending_data_resource_callbacks_[resource_id];
+  callbacks.push_back(callback);
+  if (callbacks.size() > 1) {
+    return;
+  }
+
+  // User models are several megabytes once decompressed, so decompress them
+  // on the thread pool. Data packs stay mapped for the lifetime of the
+  // process, so |data_resource| is still valid when the task runs
+  base::PostTaskAndReplyWithResult(FROM_HERE,
+      {base::ThreadPool(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&DecompressDataResource, data_resource),
+      base::BindOnce(&AdsServiceImpl::OnLoadUserModelForLanguage,
+          const_cast<AdsServiceImpl*>(this)->AsWeakPtr(), resource_id));
+}
+
+void AdsServiceImpl::OnLoadUserModelForLanguage(
+    const int resource_id,
+    std::unique_ptr<std::string> user_model) {
+  const auto iter = pending_data_resource_callbacks_.find(resource_id);
+  if (iter == pending_data_resource_callbacks_.end()) {
+    return;
+  }
+
+  const std::vector<ads::LoadCallback> callbacks = std::move(iter->second);
+  pending_data_resource_callbacks_.erase(iter);
+
+  if (!user_model) {
+    VLOG(0) << "Failed to decompress user model with resource id "
+        << resource_id;
+
+    for (const auto& callback : callbacks) {
+      callback(ads::Result::FAILED, "");
+    }
+
+    return;
+  }
+
+  GetDataResources()[resource_id] = *user_model;
+
+  for (const auto& callback : callbacks) {
+    callback(ads::Result::SUCCESS, *user_model);
+  }
 }
 
 void AdsServiceImpl::ShowNotification(
@@ -1953,10 +2260,25 @@ void AdsServiceImpl::URLRequest(
       const std::string& content_type,
       const ads::URLRequestMethod method,
       ads::URLRequestCallback callback) {
+  // Ads only download the catalog, which can wait for the browser to be idle
+  brave_rewards::BackgroundJobScheduler::GetInstance()->RunWhenIdle(
+      base::BindOnce(&AdsServiceImpl::StartURLLoader, AsWeakPtr(), url,
+          headers, content, content_type, method, callback));
+}
+
+void AdsServiceImpl::StartURLLoader(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& content,
+    const std::string& content_type,
+    const ads::URLRequestMethod method,
+    ads::URLRequestCallback callback) {
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = GURL(url);
   request->method = URLMethodToRequestType(method);
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
+  // Ads traffic happens in the background, let page loads go first
+  request->priority = net::LOWEST;
   for (const auto& header : headers) {
     request->headers.AddHeaderFromString(header);
   }
@@ -1979,9 +2301,10 @@ void AdsServiceImpl::URLRequest(
   auto* url_loader_factory =
       default_storage_partition->GetURLLoaderFactoryForBrowserProcess().get();
 
-  url_loader->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-      url_loader_factory, base::BindOnce(&AdsServiceImpl::OnURLLoaderComplete,
-          base::Unretained(this), url_loader, callback));
+  url_loader->DownloadToString(url_loader_factory,
+      base::BindOnce(&AdsServiceImpl::OnURLLoaderComplete,
+          base::Unretained(this), url_loader, callback),
+      GetMaxResponseBodySize(GURL(url)));
 }
 
 void AdsServiceImpl::Save(
@@ -2072,6 +2395,8 @@ void AdsServiceImpl::Log(
 ///////////////////////////////////////////////////////////////////////////////
 
 void AdsServiceImpl::OnBackground() {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -2080,6 +2405,8 @@ void AdsServiceImpl::OnBackground() {
 }
 
 void AdsServiceImpl::OnForeground() {
+  RestartIdleShutdownTimer();
+
   if (!connected()) {
     return;
   }
@@ -16,6 +16,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "base/timer/timer.h"
 #include "bat/ads/ads.h"
@@ -163,6 +164,18 @@ class AdsServiceImpl : public AdsService,
   void OnShutdownBatAds(
       const int32_t result);
 
+  // Restarts ads stopped for being idle and pushes the idle shutdown back,
+  // called for everything which needs ads
+  void RestartIdleShutdownTimer();
+  void OnIdleShutdownTimerFired();
+  void OnIdleShutdown(
+      const int32_t result);
+
+  // Asks ads to drop what it can rebuild, without restarting ads stopped for
+  // being idle
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
   bool StartService();
 
   void MaybeStart(
@@ -183,6 +196,8 @@ class AdsServiceImpl : public AdsService,
   void UpdateIsDebugFlag();
   bool IsDebug() const;
 
+  void SetLogCategories();
+
   void StartCheckIdleStateTimer();
   void CheckIdleState();
   void ProcessIdleState(
@@ -217,6 +232,13 @@ class AdsServiceImpl : public AdsService,
   void NotificationTimedOut(
       const std::string& uuid);
 
+  void StartURLLoader(
+      const std::string& url,
+      const std::vector<std::string>& headers,
+      const std::string& content,
+      const std::string& content_type,
+      const ads::URLRequestMethod method,
+      ads::URLRequestCallback callback);
   void OnURLLoaderComplete(
       network::SimpleURLLoader* loader,
       ads::URLRequestCallback callback,
@@ -372,6 +394,9 @@ class AdsServiceImpl : public AdsService,
   void LoadUserModelForLanguage(
       const std::string& language,
       ads::LoadCallback callback) const override;
+  void OnLoadUserModelForLanguage(
+      const int resource_id,
+      std::unique_ptr<std::string> user_model);
 
   void ShowNotification(
       std::unique_ptr<ads::AdNotificationInfo> info) override;
@@ -461,7 +486,12 @@ class AdsServiceImpl : public AdsService,
 
   ui::IdleState last_idle_state_;
 
-  base::RepeatingTimer idle_poll_timer_;
+  base::OneShotTimer idle_poll_timer_;
+
+  base::OneShotTimer idle_shutdown_timer_;
+  bool is_stopped_for_idle_;
+
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   PrefChangeRegistrar profile_pref_change_registrar_;
 
@@ -469,6 +499,11 @@ class AdsServiceImpl : public AdsService,
 
   std::unique_ptr<BundleStateDatabase> bundle_state_backend_;
 
+  // Decompressed user models are shared by every profile, callbacks wait
+  // here while this service decompresses one
+  mutable std::map<int, std::vector<ads::LoadCallback>>
+      pending_data_resource_callbacks_;
+
   NotificationDisplayService* display_service_;  // NOT OWNED
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
 
@@ -36,13 +36,15 @@ class MockRewardsService : public RewardsService {
 
   MOCK_METHOD1(CreateWallet, void(brave_rewards::CreateWalletCallback));
   MOCK_METHOD0(FetchWalletProperties, void());
-  MOCK_METHOD7(GetContentSiteList,
+  MOCK_METHOD9(GetContentSiteList,
       void(uint32_t,
            uint32_t,
            uint64_t,
            uint64_t,
            bool,
            uint32_t,
+           const std::string&,
+           double,
            const brave_rewards::GetContentSiteListCallback&));
   MOCK_METHOD1(GetExcludedList,
       void(const brave_rewards::GetContentSiteListCallback&));
@@ -78,22 +80,22 @@ class MockRewardsService : public RewardsService {
   MOCK_METHOD1(SetRewardsMainEnabled, void(bool));
   MOCK_METHOD1(GetPublisherMinVisitTime,
       void(const brave_rewards::GetPublisherMinVisitTimeCallback&));
-  MOCK_CONST_METHOD1(SetPublisherMinVisitTime, void(int));
+  MOCK_METHOD1(SetPublisherMinVisitTime, void(int));
   MOCK_METHOD1(GetPublisherMinVisits,
       void(const brave_rewards::GetPublisherMinVisitsCallback&));
-  MOCK_CONST_METHOD1(SetPublisherMinVisits, void(int));
+  MOCK_METHOD1(SetPublisherMinVisits, void(int));
   MOCK_METHOD1(GetPublisherAllowNonVerified,
       void(const brave_rewards::GetPublisherAllowNonVerifiedCallback&));
-  MOCK_CONST_METHOD1(SetPublisherAllowNonVerified, void(bool));
+  MOCK_METHOD1(SetPublisherAllowNonVerified, void(bool));
   MOCK_METHOD1(GetPublisherAllowVideos,
       void(const brave_rewards::GetPublisherAllowVideosCallback&));
-  MOCK_CONST_METHOD1(SetPublisherAllowVideos, void(bool));
-  MOCK_CONST_METHOD1(SetContributionAmount, void(double));
-  MOCK_CONST_METHOD0(SetUserChangedContribution, void());
+  MOCK_METHOD1(SetPublisherAllowVideos, void(bool));
+  MOCK_METHOD1(SetContributionAmount, void(double));
+  MOCK_METHOD0(SetUserChangedContribution, void());
   MOCK_METHOD1(GetAutoContribute,
       void(brave_rewards::GetAutoContributeCallback));
   MOCK_METHOD1(SetAutoContribute, void(bool));
-  MOCK_CONST_METHOD0(UpdateAdsRewards, void());
+  MOCK_METHOD0(UpdateAdsRewards, void());
   MOCK_METHOD2(SetTimer, void(uint64_t, uint32_t*));
   MOCK_METHOD1(IsWalletCreated,
       void(const brave_rewards::IsWalletCreatedCallback&));
@@ -126,7 +128,7 @@ class MockRewardsService : public RewardsService {
       void(const brave_rewards::GetAutoContributePropsCallback&));
   MOCK_METHOD1(GetPendingContributionsTotal,
       void(const brave_rewards::GetPendingContributionsTotalCallback&));
-  MOCK_CONST_METHOD1(GetRewardsMainEnabled,
+  MOCK_METHOD1(GetRewardsMainEnabled,
       void(const brave_rewards::GetRewardsMainEnabledCallback&));
   MOCK_METHOD1(SetCatalogIssuers, void(
       const std::string&));
@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/strings/stringprintf.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -27,6 +28,58 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Collects the text of the page for classification. Unlike innerText it
+// doesn't need layout, skips the contents of elements that are never
+// rendered as text and stops once |kMaximumPageContentLength| characters
+// were collected, so large pages don't send all of their text to the ads
+// service. Page content is normalized before it is classified, so text nodes
+// are joined with a single space
+constexpr size_t kMaximumPageContentLength = 64 * 1024;
+
+constexpr char kGetPageContentScript[] = R"(
+  (function(maxLength) {
+    if (!document.body) {
+      return '';
+    }
+
+    const skippedElements = new Set(['script', 'style', 'noscript',
+        'template', 'svg', 'iframe', 'object', 'canvas']);
+
+    const walker = document.createTreeWalker(document.body,
+        NodeFilter.SHOW_ELEMENT | NodeFilter.SHOW_TEXT, {
+      acceptNode(node) {
+        if (node.nodeType === Node.TEXT_NODE) {
+          return NodeFilter.FILTER_ACCEPT;
+        }
+
+        if (skippedElements.has(node.localName) || node.hidden) {
+          return NodeFilter.FILTER_REJECT;
+        }
+
+        return NodeFilter.FILTER_SKIP;
+      }
+    });
+
+    const texts = [];
+    let length = 0;
+    while (length < maxLength && walker.nextNode()) {
+      const text = walker.currentNode.nodeValue.trim();
+      if (!text) {
+        continue;
+      }
+
+      texts.push(text);
+      length += text.length + 1;
+    }
+
+    return texts.join(' ').substring(0, maxLength);
+  })
+)";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -79,7 +132,8 @@ void AdsTabHelper::DocumentOnLoadCompletedInMainFrame() {
   DCHECK(render_frame_host);
 
   dom_distiller::RunIsolatedJavaScript(render_frame_host,
-      "document.body.innerText",
+      base::StringPrintf("%s(%zu)", kGetPageContentScript,
+          kMaximumPageContentLength),
           base::BindOnce(&AdsTabHelper::OnWebContentsDistillationDone,
               weak_factory_.GetWeakPtr(),
                   source_page_handle->web_contents()->GetLastCommittedURL(),
@@ -8,11 +8,15 @@
 #include <stdint.h>
 #include <limits>
 #include <map>
+#include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "base/bind.h"
 #include "base/files/file_util.h"
+#include "base/hash/sha1.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
@@ -28,6 +32,22 @@ namespace {
 const int kCurrentVersionNumber = 5;
 const int kCompatibleVersionNumber = 5;
 
+// Hash of the bundle state the tables were last updated to
+const char kBundleStateHashKey[] = "bundle_state_hash";
+
+std::string GetBundleStateHash(
+    const ads::BundleState& bundle_state) {
+  // Only what is saved to the tables is hashed, as the catalog timestamps
+  // change every time it is downloaded
+  ads::BundleState hashed_bundle_state;
+  hashed_bundle_state.creative_ad_notifications =
+      bundle_state.creative_ad_notifications;
+  hashed_bundle_state.ad_conversions = bundle_state.ad_conversions;
+
+  return base::HexEncode(base::SHA1HashString(
+      hashed_bundle_state.ToJson()).data(), base::kSHA1Length);
+}
+
 }  // namespace
 
 BundleStateDatabase::BundleStateDatabase(
@@ -111,18 +131,20 @@ bool BundleStateDatabase::CreateCategoriesTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateCategoriesTable() {
+bool BundleStateDatabase::GetCategories(
+    std::set<std::string>* categories) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  const bool is_initialized = Init();
-  DCHECK(is_initialized);
+  DCHECK(categories);
 
-  const std::string sql =
-      "DELETE FROM category";
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT name FROM category"));
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  while (statement.Step()) {
+    categories->insert(statement.ColumnString(0));
+  }
 
-  return statement.Run();
+  return statement.Succeeded();
 }
 
 bool BundleStateDatabase::InsertOrUpdateCategory(
@@ -137,7 +159,20 @@ bool BundleStateDatabase::InsertOrUpdateCategory(
           "(name) VALUES (%s)",
       CreateBindingParameterPlaceholders(1).c_str());
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      sql.c_str()));
+
+  statement.BindString(0, category);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::DeleteCategory(
+    const std::string& category) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM category WHERE name = ?"));
 
   statement.BindString(0, category);
 
@@ -175,18 +210,20 @@ bool BundleStateDatabase::CreateCreativeAdNotificationsTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateCreativeAdNotificationsTable() {
+bool BundleStateDatabase::GetCreativeAdNotificationKeys(
+    std::set<CreativeAdNotificationKey>* keys) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  const bool is_initialized = Init();
-  DCHECK(is_initialized);
+  DCHECK(keys);
 
-  const std::string sql =
-      "DELETE FROM ad_info";
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT region, uuid FROM ad_info"));
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  while (statement.Step()) {
+    keys->emplace(statement.ColumnString(0), statement.ColumnString(1));
+  }
 
-  return statement.Run();
+  return statement.Succeeded();
 }
 
 bool BundleStateDatabase::InsertOrUpdateCreativeAdNotification(
@@ -214,7 +251,8 @@ bool BundleStateDatabase::InsertOrUpdateCreativeAdNotification(
             "region) VALUES (%s)",
       CreateBindingParameterPlaceholders(13).c_str());
 
-    sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+    sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+        sql.c_str()));
 
     statement.BindString(0, info.creative_set_id);
     statement.BindString(1, info.title);
@@ -254,6 +292,19 @@ bool BundleStateDatabase::InsertOrUpdateCreativeAdNotification(
   return true;
 }
 
+bool BundleStateDatabase::DeleteCreativeAdNotification(
+    const CreativeAdNotificationKey& key) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info WHERE region = ? AND uuid = ?"));
+
+  statement.BindString(0, key.first);
+  statement.BindString(1, key.second);
+
+  return statement.Run();
+}
+
 bool BundleStateDatabase::CreateCreativeAdNotificationCategoriesTable() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -280,18 +331,20 @@ bool BundleStateDatabase::CreateCreativeAdNotificationCategoriesTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateCreativeAdNotificationCategoriesTable() {
+bool BundleStateDatabase::GetCreativeAdNotificationCategoryKeys(
+    std::set<CreativeAdNotificationCategoryKey>* keys) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  const bool is_initialized = Init();
-  DCHECK(is_initialized);
+  DCHECK(keys);
 
-  const std::string sql =
-      "DELETE FROM ad_info_category";
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT ad_info_uuid, category_name FROM ad_info_category"));
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  while (statement.Step()) {
+    keys->emplace(statement.ColumnString(0), statement.ColumnString(1));
+  }
 
-  return statement.Run();
+  return statement.Succeeded();
 }
 
 bool BundleStateDatabase::InsertOrUpdateCreativeAdNotificationCategory(
@@ -308,7 +361,8 @@ bool BundleStateDatabase::InsertOrUpdateCreativeAdNotificationCategory(
           "category_name) VALUES (%s)",
       CreateBindingParameterPlaceholders(2).c_str());
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      sql.c_str()));
 
   statement.BindString(0, info.creative_instance_id);
   statement.BindString(1, category);
@@ -316,6 +370,20 @@ bool BundleStateDatabase::InsertOrUpdateCreativeAdNotificationCategory(
   return statement.Run();
 }
 
+bool BundleStateDatabase::DeleteCreativeAdNotificationCategory(
+    const CreativeAdNotificationCategoryKey& key) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info_category "
+          "WHERE ad_info_uuid = ? AND category_name = ?"));
+
+  statement.BindString(0, key.first);
+  statement.BindString(1, key.second);
+
+  return statement.Run();
+}
+
 bool
 BundleStateDatabase::CreateCreativeAdNotificationCategoriesCategoryIndex() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -349,18 +417,39 @@ bool BundleStateDatabase::CreateAdConversionsTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateAdConversionsTable() {
+// static
+BundleStateDatabase::AdConversionKey BundleStateDatabase::GetAdConversionKey(
+    const ads::AdConversionInfo& info) {
+  return std::make_tuple(info.creative_set_id, info.type, info.url_pattern,
+      info.observation_window);
+}
+
+bool BundleStateDatabase::GetAdConversionIds(
+    AdConversionIdsMap* ids) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  const bool is_initialized = Init();
-  DCHECK(is_initialized);
+  DCHECK(ids);
 
-  const std::string sql =
-      "DELETE FROM ad_conversions";
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT "
+          "id, "
+          "creative_set_id, "
+          "type, "
+          "url_pattern, "
+          "observation_window "
+      "FROM ad_conversions"));
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  while (statement.Step()) {
+    ads::AdConversionInfo info;
+    info.creative_set_id = statement.ColumnString(1);
+    info.type = statement.ColumnString(2);
+    info.url_pattern = statement.ColumnString(3);
+    info.observation_window = statement.ColumnInt(4);
 
-  return statement.Run();
+    (*ids)[GetAdConversionKey(info)].push_back(statement.ColumnInt64(0));
+  }
+
+  return statement.Succeeded();
 }
 
 bool BundleStateDatabase::InsertOrUpdateAdConversion(
@@ -378,7 +467,8 @@ bool BundleStateDatabase::InsertOrUpdateAdConversion(
           "observation_window) VALUES (%s)",
       CreateBindingParameterPlaceholders(4).c_str());
 
-  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      sql.c_str()));
 
   statement.BindString(0, info.creative_set_id);
   statement.BindString(1, info.type);
@@ -389,6 +479,18 @@ bool BundleStateDatabase::InsertOrUpdateAdConversion(
   return statement.Run();
 }
 
+bool BundleStateDatabase::DeleteAdConversion(
+    const int64_t id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_conversions WHERE id = ?"));
+
+  statement.BindInt64(0, id);
+
+  return statement.Run();
+}
+
 bool BundleStateDatabase::SaveBundleState(
     const ads::BundleState& bundle_state) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -396,49 +498,133 @@ bool BundleStateDatabase::SaveBundleState(
   const bool is_initialized = Init();
   DCHECK(is_initialized);
 
+  // Catalogs are downloaded again periodically and are usually unchanged
+  const std::string bundle_state_hash = GetBundleStateHash(bundle_state);
+  std::string last_bundle_state_hash;
+  if (GetMetaTable().GetValue(kBundleStateHashKey, &last_bundle_state_hash) &&
+      last_bundle_state_hash == bundle_state_hash) {
+    return true;
+  }
+
   if (!GetDB().BeginTransaction()) {
     return false;
   }
 
-  // We are completely replacing the database here so truncate all the tables
-  if (!TruncateCategoriesTable() ||
-      !TruncateCreativeAdNotificationCategoriesTable() ||
-      !TruncateCreativeAdNotificationsTable() ||
-      !TruncateAdConversionsTable()) {
+  // Rows of the last bundle state which are removed from the tables unless
+  // they are still in this one
+  std::set<std::string> stale_categories;
+  std::set<CreativeAdNotificationKey> stale_creative_ad_notifications;
+  std::set<CreativeAdNotificationCategoryKey>
+      stale_creative_ad_notification_categories;
+  AdConversionIdsMap stale_ad_conversions;
+  if (!GetCategories(&stale_categories) ||
+      !GetCreativeAdNotificationKeys(&stale_creative_ad_notifications) ||
+      !GetCreativeAdNotificationCategoryKeys(
+          &stale_creative_ad_notification_categories) ||
+      !GetAdConversionIds(&stale_ad_conversions)) {
     GetDB().RollbackTransaction();
     return false;
   }
 
   for (const auto& creative_ad_notification :
       bundle_state.creative_ad_notifications) {
-    const std::string category = creative_ad_notification.first;
+    const std::string& category = creative_ad_notification.first;
     if (!InsertOrUpdateCategory(category)) {
       GetDB().RollbackTransaction();
       return false;
     }
 
-    const ads::CreativeAdNotificationList ads = creative_ad_notification.second;
+    stale_categories.erase(category);
+
+    const ads::CreativeAdNotificationList& ads =
+        creative_ad_notification.second;
     for (const auto& ad : ads) {
       if (!InsertOrUpdateCreativeAdNotification(ad) ||
           !InsertOrUpdateCreativeAdNotificationCategory(ad, category)) {
         GetDB().RollbackTransaction();
         return false;
       }
+
+      for (const auto& geo_target : ad.geo_targets) {
+        stale_creative_ad_notifications.erase(
+            {geo_target, ad.creative_instance_id});
+      }
+
+      stale_creative_ad_notification_categories.erase(
+          {ad.creative_instance_id, category});
     }
   }
 
   for (const auto& ad_conversion : bundle_state.ad_conversions) {
+    // Ad conversions have no id of their own, so a row with the same values
+    // is kept for each one that is still in the bundle state
+    const auto iter =
+        stale_ad_conversions.find(GetAdConversionKey(ad_conversion));
+    if (iter != stale_ad_conversions.end() && !iter->second.empty()) {
+      iter->second.pop_back();
+      continue;
+    }
+
     if (!InsertOrUpdateAdConversion(ad_conversion)) {
       GetDB().RollbackTransaction();
       return false;
     }
   }
 
+  size_t deleted_rows_count = 0;
+
+  for (const auto& key : stale_creative_ad_notification_categories) {
+    if (!DeleteCreativeAdNotificationCategory(key)) {
+      GetDB().RollbackTransaction();
+      return false;
+    }
+
+    deleted_rows_count++;
+  }
+
+  for (const auto& key : stale_creative_ad_notifications) {
+    if (!DeleteCreativeAdNotification(key)) {
+      GetDB().RollbackTransaction();
+      return false;
+    }
+
+    deleted_rows_count++;
+  }
+
+  for (const auto& category : stale_categories) {
+    if (!DeleteCategory(category)) {
+      GetDB().RollbackTransaction();
+      return false;
+    }
+
+    deleted_rows_count++;
+  }
+
+  for (const auto& ad_conversion : stale_ad_conversions) {
+    for (const int64_t id : ad_conversion.second) {
+      if (!DeleteAdConversion(id)) {
+        GetDB().RollbackTransaction();
+        return false;
+      }
+
+      deleted_rows_count++;
+    }
+  }
+
+  if (!GetMetaTable().SetValue(kBundleStateHashKey, bundle_state_hash)) {
+    GetDB().RollbackTransaction();
+    return false;
+  }
+
   if (!GetDB().CommitTransaction()) {
     return false;
   }
 
-  Vacuum();
+  // Only space freed by deleted rows is worth reclaiming
+  if (deleted_rows_count > 0) {
+    Vacuum();
+  }
+
   return true;
 }
 
@@ -648,6 +834,11 @@ bool BundleStateDatabase::Migrate() {
 
   meta_table_.SetVersionNumber(dest_version);
 
+  // Migrations may recreate tables, so the next bundle state is saved in full
+  if (source_version != dest_version) {
+    meta_table_.DeleteKey(kBundleStateHashKey);
+  }
+
   if (!GetDB().CommitTransaction()) {
     return false;
   }
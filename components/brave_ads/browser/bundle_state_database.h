@@ -7,7 +7,12 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_BUNDLE_STATE_DATABASE_H_
 
 #include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <set>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -42,6 +47,9 @@ class BundleStateDatabase {
     db_.set_error_callback(error_callback);
   }
 
+  // Updates the tables to |bundle_state|, only writing rows which were added
+  // or may have changed and deleting rows which are no longer in it. Nothing
+  // is written if it is the bundle state that was last saved
   bool SaveBundleState(
       const ads::BundleState& bundle_state);
 
@@ -68,28 +76,54 @@ class BundleStateDatabase {
   void OnMemoryPressure(
       base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
 
+  // Region and uuid of an ad_info row
+  using CreativeAdNotificationKey = std::pair<std::string, std::string>;
+  // Uuid and category name of an ad_info_category row
+  using CreativeAdNotificationCategoryKey =
+      std::pair<std::string, std::string>;
+  // Creative set id, type, url pattern and observation window of an
+  // ad_conversions row, which has no other key
+  using AdConversionKey =
+      std::tuple<std::string, std::string, std::string, unsigned int>;
+  using AdConversionIdsMap = std::map<AdConversionKey, std::vector<int64_t>>;
+
+  static AdConversionKey GetAdConversionKey(
+      const ads::AdConversionInfo& info);
+
   bool CreateCategoriesTable();
-  bool TruncateCategoriesTable();
+  bool GetCategories(
+      std::set<std::string>* categories);
   bool InsertOrUpdateCategory(
       const std::string& category);
+  bool DeleteCategory(
+      const std::string& category);
 
   bool CreateCreativeAdNotificationsTable();
-  bool TruncateCreativeAdNotificationsTable();
+  bool GetCreativeAdNotificationKeys(
+      std::set<CreativeAdNotificationKey>* keys);
   bool InsertOrUpdateCreativeAdNotification(
       const ads::CreativeAdNotificationInfo& info);
+  bool DeleteCreativeAdNotification(
+      const CreativeAdNotificationKey& key);
 
   bool CreateCreativeAdNotificationCategoriesTable();
-  bool TruncateCreativeAdNotificationCategoriesTable();
+  bool GetCreativeAdNotificationCategoryKeys(
+      std::set<CreativeAdNotificationCategoryKey>* keys);
   bool InsertOrUpdateCreativeAdNotificationCategory(
       const ads::CreativeAdNotificationInfo& info,
       const std::string& category);
+  bool DeleteCreativeAdNotificationCategory(
+      const CreativeAdNotificationCategoryKey& key);
 
   bool CreateCreativeAdNotificationCategoriesCategoryIndex();
 
   bool CreateAdConversionsTable();
-  bool TruncateAdConversionsTable();
+  bool GetAdConversionIds(
+      AdConversionIdsMap* ids);
   bool InsertOrUpdateAdConversion(
       const ads::AdConversionInfo& info);
+  bool DeleteAdConversion(
+      const int64_t id);
 
   std::string CreateBindingParameterPlaceholders(
       const size_t count);
@@ -13,6 +13,10 @@ const char kProduction[] = "brave-ads-production";
 const char kStaging[] = "brave-ads-staging";
 const char kDevelopment[] = "brave-ads-development";
 const char kDebug[] = "brave-ads-debug";
+const char kLogCategories[] = "brave-ads-log-categories";
+// Seconds without ads activity before the ads utility process is stopped, 0
+// keeps it running
+const char kIdleShutdownDelay[] = "brave-ads-idle-shutdown-delay";
 
 }  // namespace switches
 
@@ -14,6 +14,8 @@ extern const char kProduction[];
 extern const char kStaging[];
 extern const char kDevelopment[];
 extern const char kDebug[];
+extern const char kLogCategories[];
+extern const char kIdleShutdownDelay[];
 extern const char kTesting[];
 
 }  // namespace switches
@@ -5,9 +5,15 @@
 
 #include "brave/components/brave_component_updater/browser/brave_on_demand_updater.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/bind.h"
+#include "base/location.h"
 #include "base/memory/singleton.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 
 namespace brave_component_updater {
 
@@ -20,13 +26,41 @@ BraveOnDemandUpdater::BraveOnDemandUpdater() {}
 BraveOnDemandUpdater::~BraveOnDemandUpdater() {}
 
 void BraveOnDemandUpdater::OnDemandUpdate(const std::string& id) {
+  OnDemandUpdate(std::vector<std::string>{id});
+}
+
+void BraveOnDemandUpdater::OnDemandUpdate(
+    const std::vector<std::string>& ids) {
   DCHECK(!on_demand_update_callback_.is_null());
-  on_demand_update_callback_.Run(id);
+
+  const bool is_send_pending = !pending_ids_.empty();
+  for (const auto& id : ids) {
+    if (std::find(pending_ids_.begin(), pending_ids_.end(), id) ==
+        pending_ids_.end()) {
+      pending_ids_.push_back(id);
+    }
+  }
+
+  if (is_send_pending || pending_ids_.empty()) {
+    return;
+  }
+
+  // Components registered at startup or refreshed after a locale change ask
+  // for updates one after the other, so collect them before sending.
+  base::SequencedTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&BraveOnDemandUpdater::SendPendingUpdates,
+                     base::Unretained(this)));
 }
 
 void BraveOnDemandUpdater::RegisterOnDemandUpdateCallback(Callback callback) {
   on_demand_update_callback_ = callback;
 }
 
+void BraveOnDemandUpdater::SendPendingUpdates() {
+  std::vector<std::string> ids;
+  ids.swap(pending_ids_);
+  on_demand_update_callback_.Run(ids);
+}
 
 }  // namespace brave_component_updater
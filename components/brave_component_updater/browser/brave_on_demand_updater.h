@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_COMPONENT_UPDATER_BROWSER_BRAVE_ON_DEMAND_UPDATER_H_
 
 #include <string>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/macros.h"
@@ -20,11 +21,15 @@ namespace brave_component_updater {
 
 class BraveOnDemandUpdater {
  public:
-  using Callback = base::RepeatingCallback<void(const std::string&)>;
+  using Callback =
+      base::RepeatingCallback<void(const std::vector<std::string>&)>;
   static BraveOnDemandUpdater* GetInstance();
 
   ~BraveOnDemandUpdater();
   void OnDemandUpdate(const std::string& id);
+  // Ids requested before the current task finishes are deduplicated and sent
+  // to the registered callback together.
+  void OnDemandUpdate(const std::vector<std::string>& ids);
 
   void RegisterOnDemandUpdateCallback(Callback callback);
 
@@ -32,7 +37,10 @@ class BraveOnDemandUpdater {
   friend struct base::DefaultSingletonTraits<BraveOnDemandUpdater>;
   BraveOnDemandUpdater();
 
+  void SendPendingUpdates();
+
   Callback on_demand_update_callback_;
+  std::vector<std::string> pending_ids_;
 
   DISALLOW_COPY_AND_ASSIGN(BraveOnDemandUpdater);
 };
@@ -0,0 +1,58 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_component_updater/browser/brave_on_demand_updater.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_component_updater {
+
+class BraveOnDemandUpdaterTest : public testing::Test {
+ public:
+  BraveOnDemandUpdaterTest() {
+    BraveOnDemandUpdater::GetInstance()->RegisterOnDemandUpdateCallback(
+        base::BindRepeating(&BraveOnDemandUpdaterTest::OnDemandUpdate,
+                            base::Unretained(this)));
+  }
+
+ protected:
+  void OnDemandUpdate(const std::vector<std::string>& ids) {
+    batches_.push_back(ids);
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  std::vector<std::vector<std::string>> batches_;
+};
+
+TEST_F(BraveOnDemandUpdaterTest, BatchesRequestsOfTheSameTask) {
+  auto* updater = BraveOnDemandUpdater::GetInstance();
+  updater->OnDemandUpdate("a");
+  updater->OnDemandUpdate(std::vector<std::string>{"b", "a", "c"});
+  updater->OnDemandUpdate("b");
+  EXPECT_TRUE(batches_.empty());
+
+  base::RunLoop().RunUntilIdle();
+  ASSERT_EQ(1u, batches_.size());
+  EXPECT_EQ((std::vector<std::string>{"a", "b", "c"}), batches_[0]);
+
+  updater->OnDemandUpdate("a");
+  base::RunLoop().RunUntilIdle();
+  ASSERT_EQ(2u, batches_.size());
+  EXPECT_EQ(std::vector<std::string>{"a"}, batches_[1]);
+}
+
+TEST_F(BraveOnDemandUpdaterTest, IgnoresEmptyRequests) {
+  BraveOnDemandUpdater::GetInstance()->OnDemandUpdate(
+      std::vector<std::string>());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(batches_.empty());
+}
+
+}  // namespace brave_component_updater
@@ -10,6 +10,8 @@
 #include "base/logging.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/json/json_reader.h"
 
 namespace brave_component_updater {
 
@@ -44,4 +46,28 @@ std::string GetDATFileAsString(const base::FilePath& file_path) {
   return contents;
 }
 
+base::Optional<base::Value> GetDATFileAsJSON(const base::FilePath& file_path) {
+  const std::string contents = GetDATFileAsString(file_path);
+  if (contents.empty())
+    return base::nullopt;
+
+  base::Optional<base::Value> root = base::JSONReader::Read(contents);
+  if (!root) {
+    LOG(ERROR) << "GetDATFileAsJSON: cannot "
+               << "parse dat file " << file_path;
+  }
+  return root;
+}
+
+std::unique_ptr<base::MemoryMappedFile> MapDATFile(
+    const base::FilePath& file_path) {
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(file_path) || mapped_file->length() == 0) {
+    LOG(ERROR) << "MapDATFile: cannot "
+               << "map dat file " << file_path;
+    return nullptr;
+  }
+  return mapped_file;
+}
+
 }  // namespace brave_component_updater
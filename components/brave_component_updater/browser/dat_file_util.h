@@ -12,6 +12,12 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/optional.h"
+#include "base/values.h"
+
+namespace base {
+class MemoryMappedFile;
+}  // namespace base
 
 namespace brave_component_updater {
 
@@ -20,6 +26,14 @@ using DATFileDataBuffer = std::vector<unsigned char>;
 void GetDATFileData(const base::FilePath& file_path,
                     DATFileDataBuffer* buffer);
 std::string GetDATFileAsString(const base::FilePath& file_path);
+// Reads and parses a JSON dat file, so that callers can do both off the UI
+// thread. Returns nullopt if the file can't be read or parsed.
+base::Optional<base::Value> GetDATFileAsJSON(const base::FilePath& file_path);
+// Maps the file read-only instead of copying it into a buffer. The pages are
+// clean and can be dropped by the OS under memory pressure, so this suits
+// files that are parsed once. Returns nullptr if the file is missing or empty.
+std::unique_ptr<base::MemoryMappedFile> MapDATFile(
+    const base::FilePath& file_path);
 
 template<typename T>
 using LoadDATFileDataResult =
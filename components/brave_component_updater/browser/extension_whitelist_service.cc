@@ -22,7 +22,7 @@ ExtensionWhitelistService::ExtensionWhitelistService(
     const std::vector<std::string>& whitelist)
     : LocalDataFilesObserver(local_data_files_service),
       extension_whitelist_client_(new ExtensionWhitelistParser()),
-      whitelist_(whitelist),
+      whitelist_(whitelist.begin(), whitelist.end()),
       weak_factory_(this) {
 }
 
@@ -48,11 +48,17 @@ bool ExtensionWhitelistService::IsVetted(const Extension* extension) const {
 }
 
 bool ExtensionWhitelistService::IsVetted(const std::string& id) const {
-  if (std::find(whitelist_.begin(), whitelist_.end(), id) !=
-      whitelist_.end())
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (whitelist_.count(id))
     return true;
 
-  return IsWhitelisted(id);
+  const auto it = vetted_cache_.find(id);
+  if (it != vetted_cache_.end())
+    return it->second;
+
+  const bool is_vetted = IsWhitelisted(id);
+  vetted_cache_[id] = is_vetted;
+  return is_vetted;
 }
 
 void ExtensionWhitelistService::OnComponentReady(
@@ -87,6 +93,7 @@ void ExtensionWhitelistService::OnGetDATFileData(GetDATFileDataResult result) {
 
   extension_whitelist_client_ = std::move(result.first);
   buffer_ = std::move(result.second);
+  vetted_cache_.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
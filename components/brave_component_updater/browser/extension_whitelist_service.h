@@ -9,6 +9,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -58,7 +60,10 @@ class ExtensionWhitelistService : public LocalDataFilesObserver {
   SEQUENCE_CHECKER(sequence_checker_);
   std::unique_ptr<ExtensionWhitelistParser> extension_whitelist_client_;
   brave_component_updater::DATFileDataBuffer buffer_;
-  std::vector<std::string> whitelist_;
+  const std::unordered_set<std::string> whitelist_;
+  // Answers of |extension_whitelist_client_| for extensions which are not in
+  // |whitelist_|, dropped whenever a new whitelist is loaded
+  mutable std::unordered_map<std::string, bool> vetted_cache_;
   base::WeakPtrFactory<ExtensionWhitelistService> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(ExtensionWhitelistService);
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
 
+#include "base/trace_event/trace_event.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 
 using brave_component_updater::BraveComponent;
@@ -40,6 +41,7 @@ void LocalDataFilesService::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
     const std::string& manifest) {
+  TRACE_EVENT0("startup", "LocalDataFilesService::OnComponentReady");
   for (auto& observer : observers_)
     observer.OnComponentReady(component_id, install_dir, manifest);
 }
@@ -17,9 +17,49 @@ const informTabOfCosmeticRulesToConsider = (tabId: number, selectors: string[])
   }
 }
 
+interface CosmeticFilterSession {
+  classes: Set<string>
+  ids: Set<string>
+}
+
+// Classes and ids already resolved for each tab since its last page load.
+// Every frame of a tab sends its own queries, and their results are all
+// injected into the tab, so each class or id only has to be resolved once.
+const cosmeticFilterSessions = new Map<number, CosmeticFilterSession>()
+
+const getCosmeticFilterSession = (tabId: number) => {
+  let session = cosmeticFilterSessions.get(tabId)
+  if (session === undefined) {
+    session = { classes: new Set<string>(), ids: new Set<string>() }
+    cosmeticFilterSessions.set(tabId, session)
+  }
+  return session
+}
+
+const takeNotYetResolved = (resolved: Set<string>, values: string[]) => {
+  const notYetResolved: string[] = []
+  for (const value of values) {
+    if (!resolved.has(value)) {
+      resolved.add(value)
+      notYetResolved.push(value)
+    }
+  }
+  return notYetResolved
+}
+
+export const resetCosmeticFilterSession = (tabId: number) => {
+  cosmeticFilterSessions.delete(tabId)
+}
+
 // Fires when content-script calls hiddenClassIdSelectors
 export const injectClassIdStylesheet = (tabId: number, classes: string[], ids: string[], exceptions: string[], hide1pContent: boolean) => {
-  chrome.braveShields.hiddenClassIdSelectors(classes, ids, exceptions, (selectors, forceHideSelectors) => {
+  const session = getCosmeticFilterSession(tabId)
+  const newClasses = takeNotYetResolved(session.classes, classes)
+  const newIds = takeNotYetResolved(session.ids, ids)
+  if (newClasses.length === 0 && newIds.length === 0) {
+    return
+  }
+  chrome.braveShields.hiddenClassIdSelectors(newClasses, newIds, exceptions, (selectors, forceHideSelectors) => {
     if (hide1pContent) {
       forceHideSelectors.push(...selectors)
     } else {
@@ -40,6 +80,9 @@ export const injectClassIdStylesheet = (tabId: number, classes: string[], ids: s
 
 // Fires on content-script loaded
 export const applyAdblockCosmeticFilters = (tabId: number, hostname: string, hide1pContent: boolean) => {
+  // A new document was loaded, and it doesn't have any of the stylesheets
+  // injected for the previous one.
+  resetCosmeticFilterSession(tabId)
   chrome.braveShields.hostnameCosmeticResources(hostname, async (resources) => {
     if (chrome.runtime.lastError) {
       console.warn('Unable to get cosmetic filter data for the current host', chrome.runtime.lastError)
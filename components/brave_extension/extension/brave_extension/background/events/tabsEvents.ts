@@ -3,6 +3,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 import tabActions from '../actions/tabActions'
+import { resetCosmeticFilterSession } from '../api/cosmeticFilterAPI'
 
 chrome.tabs.onActivated.addListener((activeInfo: chrome.tabs.TabActiveInfo) => {
   tabActions.activeTabChanged(activeInfo.windowId, activeInfo.tabId)
@@ -15,3 +16,7 @@ chrome.tabs.onCreated.addListener(function (tab: chrome.tabs.Tab) {
 chrome.tabs.onUpdated.addListener(function (tabId: number, changeInfo: chrome.tabs.TabChangeInfo, tab: chrome.tabs.Tab) {
   tabActions.tabDataChanged(tabId, changeInfo, tab)
 })
+
+chrome.tabs.onRemoved.addListener(function (tabId: number) {
+  resetCosmeticFilterSession(tabId)
+})
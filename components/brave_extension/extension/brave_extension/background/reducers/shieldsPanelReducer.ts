@@ -197,6 +197,24 @@ export default function shieldsPanelReducer (
       }
       break
     }
+    case shieldsPanelTypes.RESOURCES_BLOCKED: {
+      // Blocked resources arrive in batches, the badge is updated once for all
+      // of them
+      const currentTabId: number = shieldsPanelState.getActiveTabId(state)
+      let currentTabUpdated: boolean = false
+      for (const details of action.details) {
+        state = shieldsPanelState.updateResourceBlocked(
+          state, details.tabId, details.blockType, details.subresource)
+        currentTabUpdated = currentTabUpdated || details.tabId === currentTabId
+      }
+      if (currentTabUpdated) {
+        const isShieldsActive: boolean = shieldsPanelState.isShieldsActive(state, currentTabId)
+        if (isShieldsActive) {
+          shieldsPanelState.updateShieldsIconBadgeText(state)
+        }
+      }
+      break
+    }
     case shieldsPanelTypes.BLOCK_ADS_TRACKERS: {
       const tabId: number = shieldsPanelState.getActiveTabId(state)
       const tabData = shieldsPanelState.getActiveTabData(state)
@@ -6,6 +6,7 @@ export const SHIELDS_PANEL_DATA_UPDATED = 'SHIELDS_PANEL_DATA_UPDATED'
 export const SHIELDS_TOGGLED = 'SHIELDS_TOGGLED'
 export const REPORT_BROKEN_SITE = 'REPORT_BROKEN_SITE'
 export const RESOURCE_BLOCKED = 'RESOURCE_BLOCKED'
+export const RESOURCES_BLOCKED = 'RESOURCES_BLOCKED'
 export const BLOCK_ADS_TRACKERS = 'BLOCK_ADS_TRACKERS'
 export const CONTROLS_TOGGLED = 'CONTROLS_TOGGLED'
 export const HTTPS_EVERYWHERE_TOGGLED = 'HTTPS_EVERYWHERE_TOGGLED'
@@ -12,7 +12,7 @@ import { Stats } from '../api/stats'
 import { PrivateTabData } from '../api/privateTabData'
 import { InitialData } from '../api/initialData'
 
-export const statsUpdated = (stats: Stats) =>
+export const statsUpdated = (stats: Partial<Stats>) =>
   action(types.NEW_TAB_STATS_UPDATED, {
     stats
   })
@@ -17,7 +17,8 @@ export type Stats = {
   bandwidthSavedStat: number
 }
 
-type StatsUpdatedHandler = (statsData: Stats) => void
+// Updates only carry the stats which changed since the last update
+type StatsUpdatedHandler = (statsData: Partial<Stats>) => void
 
 export function getStats (): Promise<Stats> {
   return window.cr.sendWithPromise<Stats>('getNewTabPageStats')
@@ -13,7 +13,7 @@ async function updatePreferences (prefData: preferencesAPI.Preferences) {
   getActions().preferencesUpdated(prefData)
 }
 
-async function updateStats (statsData: statsAPI.Stats) {
+async function updateStats (statsData: Partial<statsAPI.Stats>) {
   getActions().statsUpdated(statsData)
 }
 
@@ -74,10 +74,13 @@ export const newTabReducer: Reducer<NewTab.State | undefined> = (state: NewTab.S
       break
 
     case types.NEW_TAB_STATS_UPDATED:
-      const stats: Stats = payload.stats
+      const stats: Partial<Stats> = payload.stats
       state = {
         ...state,
-        stats
+        stats: {
+          ...state.stats,
+          ...stats
+        }
       }
       break
 
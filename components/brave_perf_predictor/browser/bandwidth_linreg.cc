@@ -9,8 +9,11 @@
 #include <cmath>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -35,8 +38,40 @@ bool StandardiseFeatsNoOutliers(
   return false;
 }
 
+// Maps third party names to the positions of their blocked features
+base::flat_map<base::StringPiece, size_t>
+BuildThirdPartyBlockedFeatureIndexes() {
+  constexpr base::StringPiece kPrefix = "thirdParties.";
+  constexpr base::StringPiece kSuffix = ".blocked";
+
+  std::vector<std::pair<base::StringPiece, size_t>> indexes;
+  for (size_t i = 0; i < feature_sequence.size(); i++) {
+    const base::StringPiece feature = feature_sequence[i];
+    if (!base::StartsWith(feature, kPrefix, base::CompareCase::SENSITIVE) ||
+        !base::EndsWith(feature, kSuffix, base::CompareCase::SENSITIVE)) {
+      continue;
+    }
+    indexes.emplace_back(
+        feature.substr(kPrefix.size(),
+                       feature.size() - kPrefix.size() - kSuffix.size()),
+        i);
+  }
+
+  return base::flat_map<base::StringPiece, size_t>(std::move(indexes));
+}
+
 }  // namespace
 
+size_t ThirdPartyBlockedFeatureIndex(base::StringPiece name) {
+  static const base::NoDestructor<base::flat_map<base::StringPiece, size_t>>
+      indexes(BuildThirdPartyBlockedFeatureIndexes());
+
+  const auto it = indexes->find(name);
+  if (it == indexes->end())
+    return feature_count;
+  return it->second;
+}
+
 double LinregPredictVector(const std::array<double, feature_count>& features) {
   // Standardise numeric features
   std::array<double, standardise_feat_count> numeric_features;
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -18,6 +19,34 @@ constexpr double kOutlierThreshold = 6;
 // if above 20MB _and_ more than 6x of the transfer size, probably an outlier
 constexpr double kSavingsAbsoluteOutlier = 20 << 20;
 
+namespace internal {
+
+constexpr bool FeatureNameEquals(base::StringPiece a, base::StringPiece b) {
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i] != b[i])
+      return false;
+  }
+  return true;
+}
+
+}  // namespace internal
+
+// Returns the position of |name| in |feature_sequence|, or |feature_count| if
+// the model doesn't use the feature. Meant to be evaluated at compile time.
+constexpr size_t FeatureIndex(base::StringPiece name) {
+  for (size_t i = 0; i < feature_sequence.size(); i++) {
+    if (internal::FeatureNameEquals(feature_sequence[i], name))
+      return i;
+  }
+  return feature_count;
+}
+
+// Returns the position of the "thirdParties.<name>.blocked" feature, or
+// |feature_count| if the model doesn't use the third party.
+size_t ThirdPartyBlockedFeatureIndex(base::StringPiece name);
+
 // Computes prediction based on the provided feature vector.
 // It is the client's responsibility to provide features in
 // the exact order expected by the predictor.
@@ -54,7 +54,7 @@ TEST(BraveSavingsPredictorTest, HandlesEmptyFeatureset) {
 TEST(BraveSavingsPredictorTest, HandlesCompleteFeatureset) {
   base::flat_map<std::string, double> features;
   for (unsigned int i = 0; i < feature_count; i++) {
-    features[feature_sequence.at(i)] = 0;
+    features[feature_sequence.at(i).as_string()] = 0;
   }
   const double result = LinregPredictNamed(features);
   const std::array<double, feature_count> array_features{};
@@ -104,4 +104,20 @@ TEST(BraveSavingsPredictorTest, HandesSpecificFeaturemapExample) {
             794);  // Equal on the order of thousands
 }
 
+TEST(BraveSavingsPredictorTest, FeatureIndexMatchesSequence) {
+  static_assert(FeatureIndex("adblockRequests") == 0,
+                "Feature index is evaluated at compile time");
+  EXPECT_EQ(feature_sequence.at(FeatureIndex("resources.total.size")),
+            "resources.total.size");
+  EXPECT_EQ(FeatureIndex("transfer.total.size"),
+            static_cast<size_t>(feature_count));
+}
+
+TEST(BraveSavingsPredictorTest, ThirdPartyBlockedFeatureIndex) {
+  EXPECT_EQ(ThirdPartyBlockedFeatureIndex("Google Analytics"),
+            FeatureIndex("thirdParties.Google Analytics.blocked"));
+  EXPECT_EQ(ThirdPartyBlockedFeatureIndex("Not A Third Party"),
+            static_cast<size_t>(feature_count));
+}
+
 }  // namespace brave_perf_predictor
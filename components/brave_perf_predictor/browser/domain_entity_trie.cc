@@ -0,0 +1,184 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/domain_entity_trie.h"
+
+#include <utility>
+
+namespace brave_perf_predictor {
+
+namespace {
+
+// Splits the last label off |domain|, labels are visited from the top level
+// domain down without copying
+bool PopLastLabel(base::StringPiece* domain, base::StringPiece* label) {
+  if (domain->empty())
+    return false;
+
+  const size_t dot = domain->rfind('.');
+  if (dot == base::StringPiece::npos) {
+    *label = *domain;
+    *domain = base::StringPiece();
+    return true;
+  }
+
+  *label = domain->substr(dot + 1);
+  *domain = domain->substr(0, dot);
+  return true;
+}
+
+}  // namespace
+
+DomainEntityTrie::Node::Node() = default;
+
+DomainEntityTrie::Node::Node(Node&& other) = default;
+
+DomainEntityTrie::Node& DomainEntityTrie::Node::operator=(Node&& other) =
+    default;
+
+DomainEntityTrie::Node::~Node() = default;
+
+DomainEntityTrie::DomainEntityTrie() : nodes_(1) {}
+
+DomainEntityTrie::~DomainEntityTrie() = default;
+
+DomainEntityTrie::DomainEntityTrie(DomainEntityTrie&& other) = default;
+
+DomainEntityTrie& DomainEntityTrie::operator=(DomainEntityTrie&& other) =
+    default;
+
+bool DomainEntityTrie::AddDomain(const base::StringPiece domain,
+                                 const base::StringPiece entity_name) {
+  if (domain.empty())
+    return false;
+
+  Node& node = nodes_[InsertNode(domain)];
+  if (node.domain_entity != kNoEntity)
+    return false;
+
+  node.domain_entity = InternEntity(entity_name);
+  domain_count_++;
+  return true;
+}
+
+void DomainEntityTrie::AddRootDomain(const base::StringPiece root_domain,
+                                     const base::StringPiece entity_name) {
+  if (root_domain.empty())
+    return;
+
+  const int32_t entity = InternEntity(entity_name);
+  Node& node = nodes_[InsertNode(root_domain)];
+  if (node.root_entity == kNoEntity) {
+    node.root_entity = entity;
+    root_domain_count_++;
+    return;
+  }
+
+  // If there is a clash at root domain level, neither is correct
+  if (node.root_entity != entity) {
+    node.root_entity = kNoEntity;
+    root_domain_count_--;
+  }
+}
+
+base::Optional<std::string> DomainEntityTrie::FindDomain(
+    const base::StringPiece host) const {
+  const Node* node = FindNode(host);
+  if (!node || node->domain_entity == kNoEntity)
+    return base::nullopt;
+
+  return entity_names_[node->domain_entity];
+}
+
+base::Optional<std::string> DomainEntityTrie::FindRootDomain(
+    const base::StringPiece root_domain) const {
+  const Node* node = FindNode(root_domain);
+  if (!node || node->root_entity == kNoEntity)
+    return base::nullopt;
+
+  return entity_names_[node->root_entity];
+}
+
+bool DomainEntityTrie::HasRootDomainSuffix(
+    const base::StringPiece host) const {
+  const Node* node = &nodes_[0];
+  base::StringPiece rest = host;
+  base::StringPiece label;
+  while (PopLastLabel(&rest, &label)) {
+    const auto it = node->children.find(label);
+    if (it == node->children.end())
+      return false;
+
+    node = &nodes_[it->second];
+    if (node->root_entity != kNoEntity)
+      return true;
+  }
+
+  return false;
+}
+
+void DomainEntityTrie::ShrinkToFit() {
+  nodes_.shrink_to_fit();
+  for (auto& node : nodes_) {
+    node.children.shrink_to_fit();
+  }
+  entity_names_.shrink_to_fit();
+
+  // Only needed while adding domains
+  entity_indexes_.clear();
+  entity_indexes_.shrink_to_fit();
+}
+
+int32_t DomainEntityTrie::InternEntity(const base::StringPiece entity_name) {
+  const auto it = entity_indexes_.find(entity_name);
+  if (it != entity_indexes_.end())
+    return it->second;
+
+  const int32_t index = static_cast<int32_t>(entity_names_.size());
+  entity_names_.push_back(entity_name.as_string());
+  entity_indexes_.emplace(entity_name.as_string(), index);
+  return index;
+}
+
+uint32_t DomainEntityTrie::InsertNode(const base::StringPiece domain) {
+  uint32_t index = 0;
+  base::StringPiece rest = domain;
+  base::StringPiece label;
+  while (PopLastLabel(&rest, &label)) {
+    const auto it = nodes_[index].children.find(label);
+    if (it != nodes_[index].children.end()) {
+      index = it->second;
+      continue;
+    }
+
+    const uint32_t child = static_cast<uint32_t>(nodes_.size());
+    nodes_[index].children.emplace(label.as_string(), child);
+    nodes_.emplace_back();
+    index = child;
+  }
+
+  return index;
+}
+
+const DomainEntityTrie::Node* DomainEntityTrie::FindNode(
+    const base::StringPiece domain) const {
+  if (domain.empty())
+    return nullptr;
+
+  const Node* node = &nodes_[0];
+  base::StringPiece rest = domain;
+  base::StringPiece label;
+  while (PopLastLabel(&rest, &label)) {
+    const auto it = node->children.find(label);
+    if (it == node->children.end())
+      return nullptr;
+
+    node = &nodes_[it->second];
+  }
+
+  return node;
+}
+
+}  // namespace brave_perf_predictor
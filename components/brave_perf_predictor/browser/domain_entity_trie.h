@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_DOMAIN_ENTITY_TRIE_H_
+#define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_DOMAIN_ENTITY_TRIE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/optional.h"
+#include "base/strings/string_piece.h"
+
+namespace brave_perf_predictor {
+
+// Maps domains to entity names using a trie of host labels in reverse order
+// (i.e. "com" -> "facebook" -> "m"). Entity names are interned, so every node
+// only keeps the index of its entity.
+//
+// Each node can carry two entities: the one its exact domain belongs to, and
+// the one which owns the node when it is the registrable (root) domain of an
+// entity domain. Root domains claimed by different entities are dropped.
+class DomainEntityTrie {
+ public:
+  DomainEntityTrie();
+  ~DomainEntityTrie();
+
+  DomainEntityTrie(DomainEntityTrie&& other);
+  DomainEntityTrie& operator=(DomainEntityTrie&& other);
+
+  DomainEntityTrie(const DomainEntityTrie&) = delete;
+  DomainEntityTrie& operator=(const DomainEntityTrie&) = delete;
+
+  // Returns false if |domain| was already added
+  bool AddDomain(const base::StringPiece domain,
+                 const base::StringPiece entity_name);
+  void AddRootDomain(const base::StringPiece root_domain,
+                     const base::StringPiece entity_name);
+
+  // Returns the entity of the exact |host|
+  base::Optional<std::string> FindDomain(const base::StringPiece host) const;
+  // Returns the entity owning |root_domain|
+  base::Optional<std::string> FindRootDomain(
+      const base::StringPiece root_domain) const;
+  // Returns true if a suffix of |host| is the root domain of some entity, so
+  // callers can skip computing the registrable domain of unknown hosts
+  bool HasRootDomainSuffix(const base::StringPiece host) const;
+
+  size_t domain_count() const { return domain_count_; }
+  size_t root_domain_count() const { return root_domain_count_; }
+  void ShrinkToFit();
+
+ private:
+  static constexpr int32_t kNoEntity = -1;
+
+  struct Node {
+    Node();
+    Node(Node&& other);
+    Node& operator=(Node&& other);
+    ~Node();
+
+    base::flat_map<std::string, uint32_t> children;
+    int32_t domain_entity = kNoEntity;
+    int32_t root_entity = kNoEntity;
+  };
+
+  int32_t InternEntity(const base::StringPiece entity_name);
+  uint32_t InsertNode(const base::StringPiece domain);
+  const Node* FindNode(const base::StringPiece domain) const;
+
+  std::vector<Node> nodes_;
+  std::vector<std::string> entity_names_;
+  base::flat_map<std::string, int32_t> entity_indexes_;
+  size_t domain_count_ = 0;
+  size_t root_domain_count_ = 0;
+};
+
+}  // namespace brave_perf_predictor
+
+#endif  // BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_DOMAIN_ENTITY_TRIE_H_
@@ -0,0 +1,67 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/domain_entity_trie.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_perf_predictor {
+
+TEST(DomainEntityTrieTest, FindsExactDomain) {
+  DomainEntityTrie trie;
+  EXPECT_TRUE(trie.AddDomain("m.facebook.com", "Facebook"));
+  EXPECT_TRUE(trie.AddDomain("www.google-analytics.com", "Google Analytics"));
+
+  EXPECT_EQ(trie.FindDomain("m.facebook.com"), "Facebook");
+  EXPECT_EQ(trie.FindDomain("www.google-analytics.com"), "Google Analytics");
+  EXPECT_FALSE(trie.FindDomain("facebook.com"));
+  EXPECT_FALSE(trie.FindDomain("test.m.facebook.com"));
+  EXPECT_FALSE(trie.FindDomain(""));
+  EXPECT_EQ(trie.domain_count(), 2u);
+}
+
+TEST(DomainEntityTrieTest, RejectsDuplicateDomain) {
+  DomainEntityTrie trie;
+  EXPECT_TRUE(trie.AddDomain("facebook.com", "Facebook"));
+  EXPECT_FALSE(trie.AddDomain("facebook.com", "Other"));
+
+  EXPECT_EQ(trie.FindDomain("facebook.com"), "Facebook");
+  EXPECT_EQ(trie.domain_count(), 1u);
+}
+
+TEST(DomainEntityTrieTest, FindsRootDomain) {
+  DomainEntityTrie trie;
+  trie.AddRootDomain("facebook.com", "Facebook");
+
+  EXPECT_EQ(trie.FindRootDomain("facebook.com"), "Facebook");
+  EXPECT_FALSE(trie.FindDomain("facebook.com"));
+  EXPECT_TRUE(trie.HasRootDomainSuffix("test.m.facebook.com"));
+  EXPECT_FALSE(trie.HasRootDomainSuffix("example.com"));
+  EXPECT_EQ(trie.root_domain_count(), 1u);
+}
+
+TEST(DomainEntityTrieTest, DropsClashingRootDomain) {
+  DomainEntityTrie trie;
+  trie.AddRootDomain("akamai.net", "Facebook");
+  trie.AddRootDomain("akamai.net", "Facebook");
+  EXPECT_EQ(trie.FindRootDomain("akamai.net"), "Facebook");
+
+  trie.AddRootDomain("akamai.net", "Akamai");
+  EXPECT_FALSE(trie.FindRootDomain("akamai.net"));
+  EXPECT_FALSE(trie.HasRootDomainSuffix("a.akamai.net"));
+  EXPECT_EQ(trie.root_domain_count(), 0u);
+}
+
+TEST(DomainEntityTrieTest, KeepsEntitiesAfterShrink) {
+  DomainEntityTrie trie;
+  trie.AddDomain("connect.facebook.net", "Facebook");
+  trie.AddRootDomain("facebook.net", "Facebook");
+  trie.ShrinkToFit();
+
+  EXPECT_EQ(trie.FindDomain("connect.facebook.net"), "Facebook");
+  EXPECT_EQ(trie.FindRootDomain("facebook.net"), "Facebook");
+}
+
+}  // namespace brave_perf_predictor
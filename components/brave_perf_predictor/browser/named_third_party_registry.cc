@@ -5,7 +5,7 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
-#include <tuple>
+#include <utility>
 
 #include "base/bind.h"
 #include "base/containers/flat_set.h"
@@ -27,11 +27,9 @@ namespace brave_perf_predictor {
 
 namespace {
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
-  base::flat_map<std::string, std::string> entity_by_domain;
-  base::flat_map<std::string, std::string> entity_by_root_domain;
+DomainEntityTrie ParseMappings(const base::StringPiece entities,
+                               bool discard_irrelevant) {
+  DomainEntityTrie trie;
 
   // Parse the JSON
   base::Optional<base::Value> document = base::JSONReader::Read(entities);
@@ -59,34 +57,22 @@ ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
       }
       const base::StringPiece entity_domain(entity_domain_it.GetString());
 
-      const auto inserted =
-          entity_by_domain.emplace(entity_domain, *entity_name);
-      if (!inserted.second) {
+      if (!trie.AddDomain(entity_domain, *entity_name)) {
         VLOG(2) << "Malformed data: duplicate domain " << entity_domain;
       }
-      auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
-          entity_domain,
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
-      auto root_entity_entry = entity_by_root_domain.find(root_domain);
-      if (root_entity_entry != entity_by_root_domain.end() &&
-          root_entity_entry->second != *entity_name) {
-        // If there is a clash at root domain level, neither is correct
-        entity_by_root_domain.erase(root_entity_entry);
-      } else {
-        entity_by_root_domain.emplace(root_domain, *entity_name);
-      }
+      const auto root_domain =
+          net::registry_controlled_domains::GetDomainAndRegistry(
+              entity_domain,
+              net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+      trie.AddRootDomain(root_domain, *entity_name);
     }
   }
 
-  entity_by_domain.shrink_to_fit();
-  entity_by_root_domain.shrink_to_fit();
-  return std::make_tuple(entity_by_domain, entity_by_root_domain);
+  trie.ShrinkToFit();
+  return trie;
 }
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseFromResource(int resource_id) {
+DomainEntityTrie ParseFromResource(int resource_id) {
   // TODO(AndriusA): insert trace event here
   SCOPED_UMA_HISTOGRAM_TIMER(
       "Brave.Savings.NamedThirdPartyRegistry.LoadTimeMS");
@@ -102,25 +88,20 @@ ParseFromResource(int resource_id) {
 bool NamedThirdPartyRegistry::LoadMappings(const base::StringPiece entities,
                                            bool discard_irrelevant) {
   // Reset previous mappings
-  entity_by_domain_.clear();
-  entity_by_root_domain_.clear();
   initialized_ = false;
 
-  tie(entity_by_domain_, entity_by_root_domain_) =
-      ParseMappings(entities, discard_irrelevant);
-  if (entity_by_domain_.size() == 0 || entity_by_root_domain_.size() == 0)
+  entities_ = ParseMappings(entities, discard_irrelevant);
+  if (entities_.domain_count() == 0 || entities_.root_domain_count() == 0)
     return false;
 
   initialized_ = true;
   return true;
 }
 
-void NamedThirdPartyRegistry::UpdateMappings(
-    std::tuple<base::flat_map<std::string, std::string>,
-               base::flat_map<std::string, std::string>> entity_mappings) {
-  tie(entity_by_domain_, entity_by_root_domain_) = entity_mappings;
-  VLOG(2) << "Loaded " << entity_by_domain_.size() << " mappings by domain and "
-          << entity_by_root_domain_.size() << " by root domain; size";
+void NamedThirdPartyRegistry::UpdateMappings(DomainEntityTrie entities) {
+  entities_ = std::move(entities);
+  VLOG(2) << "Loaded " << entities_.domain_count() << " mappings by domain and "
+          << entities_.root_domain_count() << " by root domain; size";
   initialized_ = true;
 }
 
@@ -136,16 +117,20 @@ base::Optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return base::nullopt;
 
   if (url.has_host()) {
-    auto domain_entry = entity_by_domain_.find(url.host());
-    if (domain_entry != entity_by_domain_.end())
-      return domain_entry->second;
-
-    auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
-        url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
-    auto root_domain_entry = entity_by_root_domain_.find(root_domain);
-    if (root_domain_entry != entity_by_root_domain_.end())
-      return root_domain_entry->second;
+    const base::StringPiece host = url.host_piece();
+    auto entity = entities_.FindDomain(host);
+    if (entity)
+      return entity;
+
+    // Registrable domain is only looked up when the host is under a known
+    // root domain
+    if (!entities_.HasRootDomainSuffix(host))
+      return base::nullopt;
+
+    const auto root_domain =
+        net::registry_controlled_domains::GetDomainAndRegistry(
+            url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+    return entities_.FindRootDomain(root_domain);
   }
 
   return base::nullopt;
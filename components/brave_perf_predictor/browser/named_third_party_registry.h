@@ -7,11 +7,11 @@
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
 #include <string>
-#include <tuple>
 
-#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
-#include "base/values.h"
+#include "base/optional.h"
+#include "base/strings/string_piece.h"
+#include "brave/components/brave_perf_predictor/browser/domain_entity_trie.h"
 #include "components/keyed_service/core/keyed_service.h"
 
 namespace brave_perf_predictor {
@@ -39,13 +39,10 @@ class NamedThirdPartyRegistry : public KeyedService {
  private:
   bool IsInitialized() const { return initialized_; }
   void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
+  void UpdateMappings(DomainEntityTrie entities);
 
   bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
+  DomainEntityTrie entities_;
 
   base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
 };
@@ -5,7 +5,10 @@
 
 #include "brave/components/brave_private_cdn/private_cdn_helper.h"
 
+#include <algorithm>
+
 #include "base/big_endian.h"
+#include "base/logging.h"
 
 namespace brave {
 
@@ -14,22 +17,36 @@ bool PrivateCdnHelper::RemovePadding(std::string* padded_string) const {
     return false;
   }
 
+  base::StringPiece payload(*padded_string);
+  if (!RemovePadding(&payload)) {
+    return false;
+  }
+
+  // Drop the padding before the length header so only the payload is moved.
+  padded_string->resize(sizeof(uint32_t) + payload.size());
+  padded_string->erase(0, sizeof(uint32_t));
+  return true;
+}
+
+bool PrivateCdnHelper::RemovePadding(base::StringPiece* padded_string) const {
+  if (!padded_string) {
+    return false;
+  }
+
   if (padded_string->size() < sizeof(uint32_t)) {
     return false;  // Missing length field
   }
 
   // Read payload length from the header.
   uint32_t data_length;
-  base::ReadBigEndian(padded_string->c_str(), &data_length);
+  base::ReadBigEndian(padded_string->data(), &data_length);
 
-  // Remove length header.
-  padded_string->erase(0, sizeof(uint32_t));
-  if (padded_string->size() < data_length) {
+  if (padded_string->size() - sizeof(uint32_t) < data_length) {
     return false;  // Payload shorter than expected length
   }
 
-  // Remove padding.
-  padded_string->resize(data_length);
+  // Remove length header and padding.
+  *padded_string = padded_string->substr(sizeof(uint32_t), data_length);
   return true;
 }
 
@@ -37,4 +54,36 @@ PrivateCdnHelper::PrivateCdnHelper() = default;
 
 PrivateCdnHelper::~PrivateCdnHelper() = default;
 
+PrivateCdnPaddingRemover::PrivateCdnPaddingRemover() = default;
+
+PrivateCdnPaddingRemover::~PrivateCdnPaddingRemover() = default;
+
+void PrivateCdnPaddingRemover::Append(base::StringPiece chunk,
+                                      base::StringPiece* payload) {
+  DCHECK(payload);
+
+  // The length field can be split over several chunks.
+  if (length_field_size_ < sizeof(length_field_)) {
+    const size_t size =
+        std::min(chunk.size(), sizeof(length_field_) - length_field_size_);
+    chunk.copy(length_field_ + length_field_size_, size);
+    length_field_size_ += size;
+    chunk.remove_prefix(size);
+    if (length_field_size_ < sizeof(length_field_)) {
+      *payload = base::StringPiece();
+      return;
+    }
+
+    base::ReadBigEndian(length_field_, &remaining_payload_length_);
+  }
+
+  *payload = chunk.substr(0, remaining_payload_length_);
+  remaining_payload_length_ -= static_cast<uint32_t>(payload->size());
+}
+
+bool PrivateCdnPaddingRemover::IsComplete() const {
+  return length_field_size_ == sizeof(length_field_) &&
+         remaining_payload_length_ == 0;
+}
+
 }  // namespace brave
@@ -6,12 +6,18 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_PRIVATE_CDN_PRIVATE_CDN_HELPER_H_
 #define BRAVE_COMPONENTS_BRAVE_PRIVATE_CDN_PRIVATE_CDN_HELPER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <string>
 
 #include "base/memory/singleton.h"
+#include "base/strings/string_piece.h"
 
 namespace brave {
 
+// Private CDN payloads are a big endian uint32 payload length, the payload
+// and padding.
 class PrivateCdnHelper final {
  public:
   PrivateCdnHelper(const PrivateCdnHelper&) = delete;
@@ -22,6 +28,8 @@ class PrivateCdnHelper final {
   }
 
   bool RemovePadding(std::string* padded_string) const;
+  // Narrows |padded_string| to the payload without copying it.
+  bool RemovePadding(base::StringPiece* padded_string) const;
 
  private:
   friend struct base::DefaultSingletonTraits<PrivateCdnHelper>;
@@ -30,6 +38,30 @@ class PrivateCdnHelper final {
   ~PrivateCdnHelper();
 };
 
+// Removes the padding of a private CDN payload received in chunks, e.g. from
+// SimpleURLLoader::DownloadAsStream(), so that the payload can be written out
+// as it arrives.
+class PrivateCdnPaddingRemover final {
+ public:
+  PrivateCdnPaddingRemover();
+  ~PrivateCdnPaddingRemover();
+
+  PrivateCdnPaddingRemover(const PrivateCdnPaddingRemover&) = delete;
+  PrivateCdnPaddingRemover& operator=(const PrivateCdnPaddingRemover&) = delete;
+
+  // Sets |payload| to the part of |chunk| which belongs to the payload, it
+  // may be empty.
+  void Append(base::StringPiece chunk, base::StringPiece* payload);
+
+  // Returns true if the whole payload has been appended.
+  bool IsComplete() const;
+
+ private:
+  char length_field_[sizeof(uint32_t)];
+  size_t length_field_size_ = 0;
+  uint32_t remaining_payload_length_ = 0;
+};
+
 }  // namespace brave
 
 #endif  // BRAVE_COMPONENTS_BRAVE_PRIVATE_CDN_PRIVATE_CDN_HELPER_H_
@@ -77,3 +77,58 @@ TEST(BravePrivateCdnHelper, RemovePadding) {
     EXPECT_EQ(inputs[i], outputs[i]);
   }
 }
+
+TEST(BravePrivateCdnHelper, RemovePaddingFromView) {
+  auto* helper = brave::PrivateCdnHelper::GetInstance();
+
+  using std::string_literals::operator""s;
+
+  const std::string padded = "\x00\x00\x00\x04"s
+                             "ABCDPPPP"s;
+  base::StringPiece payload(padded);
+  EXPECT_TRUE(helper->RemovePadding(&payload));
+  EXPECT_EQ("ABCD", payload);
+  // The view points into the padded string.
+  EXPECT_EQ(padded.data() + 4, payload.data());
+
+  base::StringPiece truncated("\x00\x00\x00\x08"
+                              "ABCD",
+                              8);
+  EXPECT_FALSE(helper->RemovePadding(&truncated));
+}
+
+TEST(BravePrivateCdnHelper, PaddingRemover) {
+  using std::string_literals::operator""s;
+
+  const std::string padded = "\x00\x00\x00\x05"s
+                             "AB"s
+                             "\x00"s
+                             "CDPPPPPPPPPP"s;
+  for (size_t chunk_size = 1; chunk_size <= padded.size(); chunk_size++) {
+    brave::PrivateCdnPaddingRemover remover;
+    std::string output;
+    for (size_t i = 0; i < padded.size(); i += chunk_size) {
+      base::StringPiece payload;
+      remover.Append(base::StringPiece(padded).substr(i, chunk_size),
+                     &payload);
+      output.append(payload.data(), payload.size());
+    }
+    EXPECT_TRUE(remover.IsComplete());
+    EXPECT_EQ("AB"s
+              "\x00"s
+              "CD"s,
+              output);
+  }
+
+  brave::PrivateCdnPaddingRemover truncated;
+  base::StringPiece payload;
+  truncated.Append(base::StringPiece("\x00\x00", 2), &payload);
+  EXPECT_TRUE(payload.empty());
+  EXPECT_FALSE(truncated.IsComplete());
+  truncated.Append(base::StringPiece("\x00\x08"
+                                     "ABC",
+                                     5),
+                   &payload);
+  EXPECT_EQ("ABC", payload);
+  EXPECT_FALSE(truncated.IsComplete());
+}
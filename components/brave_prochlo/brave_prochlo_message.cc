@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_prochlo/brave_prochlo_message.h"
 
+#include <memory>
 #include <vector>
 
 #include "base/containers/flat_set.h"
@@ -35,6 +36,53 @@ MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAEQCeVJbcADloHb8bwftIi1UO0smiz
 8ObdAFQ8j3U9cMehGqI3zXgS8APvBW/9XxMkb4XWQe+t9h6qHq82P6zcBg==
 -----END PUBLIC KEY-----)";
 
+// Parsing the public keys is the same for every message, so they are only
+// loaded once. Returns nullptr if the keys can't be loaded.
+BraveProchloCrypto* GetProchloCrypto() {
+  static BraveProchloCrypto* crypto = []() -> BraveProchloCrypto* {
+    auto crypto = std::make_unique<BraveProchloCrypto>();
+
+    const std::vector<char> shuffler_key(
+        &kShufflerKey[0], &kShufflerKey[0] + base::size(kShufflerKey));
+    if (!crypto->load_shuffler_key_from_bytes(shuffler_key)) {
+      return nullptr;
+    }
+
+    const std::vector<char> analyzer_key(
+        &kAnalyzerKey[0], &kAnalyzerKey[0] + base::size(kAnalyzerKey));
+    if (!crypto->load_analyzer_key_from_bytes(analyzer_key)) {
+      return nullptr;
+    }
+
+    return crypto.release();
+  }();
+  return crypto;
+}
+
+// Fills |data| with the boolean flags, |metastring| and |metric_value|.
+void FillProchlomationData(const std::string& metastring,
+                           uint64_t metric_value,
+                           uint8_t* data) {
+  // First byte contains the 4 booleans.
+  const char daily = 1;
+  const char weekly = 0;
+  const char monthly = 2;
+  const char first = 0;
+  data[0] = daily | weekly | monthly | first;
+  uint8_t* ptr = data;
+  ptr++;
+
+  const std::string metric_value_str = base::NumberToString(metric_value);
+
+  // TODO(iefremov): replace with 'if'?
+  CHECK_LE(metastring.size() + metric_value_str.size(),
+           kProchlomationDataLength - 1);
+
+  memcpy(ptr, metastring.data(), metastring.size());
+  ptr += metastring.size();
+  memcpy(ptr, metric_value_str.data(), metric_value_str.size());
+}
+
 bool MakeProchlomation(uint64_t metric,
                        const uint8_t* data,
                        const uint8_t* crowd_id,
@@ -46,17 +94,8 @@ bool MakeProchlomation(uint64_t metric,
   // to src/base/trace_event/builtin_categories.h
   // TRACE_EVENT0("brave_p3a", "MakeProchlomation");
 
-  BraveProchloCrypto crypto;
-
-  const std::vector<char> shuffler_key(
-      &kShufflerKey[0], &kShufflerKey[0] + base::size(kShufflerKey));
-  if (!crypto.load_shuffler_key_from_bytes(shuffler_key)) {
-    return false;
-  }
-
-  const std::vector<char> analyzer_key(
-      &kAnalyzerKey[0], &kAnalyzerKey[0] + base::size(kAnalyzerKey));
-  if (!crypto.load_analyzer_key_from_bytes(analyzer_key)) {
+  BraveProchloCrypto* crypto = GetProchloCrypto();
+  if (!crypto) {
     return false;
   }
 
@@ -71,8 +110,8 @@ bool MakeProchlomation(uint64_t metric,
   memcpy(prochlomation.data, data, kProchlomationDataLength);
 
   // Then the AnalyzerItem of the PlainShufflerItem
-  if (!crypto.EncryptForAnalyzer(prochlomation,
-                                 &plain_shuffler_item.analyzer_item)) {
+  if (!crypto->EncryptForAnalyzer(prochlomation,
+                                  &plain_shuffler_item.analyzer_item)) {
     NOTREACHED();
     return false;
   }
@@ -81,7 +120,7 @@ bool MakeProchlomation(uint64_t metric,
   memcpy(plain_shuffler_item.crowd_id, crowd_id, kCrowdIdLength);
 
   // And create the ShufflerItem
-  if (!crypto.EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
+  if (!crypto->EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
     NOTREACHED();
     return false;
   }
@@ -106,26 +145,7 @@ void InitProchloMessage(uint64_t metric_hash,
 MessageMetainfo::MessageMetainfo() = default;
 MessageMetainfo::~MessageMetainfo() = default;
 
-void GenerateProchloMessage(uint64_t metric_hash,
-                            uint64_t metric_value,
-                            const MessageMetainfo& meta,
-                            brave_pyxis::PyxisMessage* pyxis_message) {
-  // TODO(iefremov): - create patch for adding `brave_p3a`
-  // to src/base/trace_event/builtin_categories.h
-  // TRACE_EVENT0("brave_p3a", "GenerateProchloMessage");
-  ShufflerItem item;
-  uint8_t data[kProchlomationDataLength] = {0};
-  uint8_t crowd_id[kCrowdIdLength] = {0};
-
-  // First byte contains the 4 booleans.
-  const char daily = 1;
-  const char weekly = 0;
-  const char monthly = 2;
-  const char first = 0;
-  data[0] = daily | weekly | monthly | first;
-  uint8_t* ptr = data;
-  ptr++;
-
+std::string GenerateMessageMetastring(const MessageMetainfo& meta) {
   // Find out years of install and survey.
   base::Time::Exploded exploded;
   meta.date_of_survey.LocalExplode(&exploded);
@@ -135,20 +155,23 @@ void GenerateProchloMessage(uint64_t metric_hash,
   DCHECK_GE(exploded.year, 999);
   const std::string yoi = base::NumberToString(exploded.year).substr(2, 4);
 
-  const std::string metastring =
-      "," + meta.country_code + "," + meta.platform + "," + meta.version + "," +
-      meta.channel + "," + yoi + base::NumberToString(meta.woi) + "," + yos +
-      base::NumberToString(meta.wos) + "," + meta.refcode + ",";
-
-  const std::string metric_value_str = base::NumberToString(metric_value);
+  return "," + meta.country_code + "," + meta.platform + "," + meta.version +
+         "," + meta.channel + "," + yoi + base::NumberToString(meta.woi) +
+         "," + yos + base::NumberToString(meta.wos) + "," + meta.refcode + ",";
+}
 
-  // TODO(iefremov): replace with 'if'?
-  CHECK_LE(metastring.size() + metric_value_str.size(),
-           kProchlomationDataLength - 1);
+void GenerateProchloMessage(uint64_t metric_hash,
+                            uint64_t metric_value,
+                            const MessageMetainfo& meta,
+                            brave_pyxis::PyxisMessage* pyxis_message) {
+  // TODO(iefremov): - create patch for adding `brave_p3a`
+  // to src/base/trace_event/builtin_categories.h
+  // TRACE_EVENT0("brave_p3a", "GenerateProchloMessage");
+  ShufflerItem item;
+  uint8_t data[kProchlomationDataLength] = {0};
+  uint8_t crowd_id[kCrowdIdLength] = {0};
 
-  memcpy(ptr, metastring.data(), metastring.size());
-  ptr += metastring.size();
-  memcpy(ptr, metric_value_str.data(), metric_value_str.size());
+  FillProchlomationData(GenerateMessageMetastring(meta), metric_value, data);
 
   // TODO(iefremov): Salt?
   crypto::SHA256HashString(
@@ -163,43 +186,19 @@ void GenerateP3AMessage(uint64_t metric_hash,
                         uint64_t metric_value,
                         const MessageMetainfo& meta,
                         brave_pyxis::RawP3AValue* p3a_message) {
+  GenerateP3AMessage(metric_hash, metric_value,
+                     GenerateMessageMetastring(meta), p3a_message);
+}
+
+void GenerateP3AMessage(uint64_t metric_hash,
+                        uint64_t metric_value,
+                        const std::string& metastring,
+                        brave_pyxis::RawP3AValue* p3a_message) {
   // TODO(iefremov): - create patch for adding `brave_p3a`
   // to src/base/trace_event/builtin_categories.h
   // TRACE_EVENT0("brave_p3a", "GenerateP3AMessage");
   uint8_t data[kProchlomationDataLength] = {0};
-
-  // First byte contains the 4 booleans.
-  const char daily = 1;
-  const char weekly = 0;
-  const char monthly = 2;
-  const char first = 0;
-  data[0] = daily | weekly | monthly | first;
-  uint8_t* ptr = data;
-  ptr++;
-
-  // Find out years of install and survey.
-  base::Time::Exploded exploded;
-  meta.date_of_survey.LocalExplode(&exploded);
-  DCHECK_GE(exploded.year, 999);
-  const std::string yos = base::NumberToString(exploded.year).substr(2, 4);
-  meta.date_of_install.LocalExplode(&exploded);
-  DCHECK_GE(exploded.year, 999);
-  const std::string yoi = base::NumberToString(exploded.year).substr(2, 4);
-
-  const std::string metastring =
-      "," + meta.country_code + "," + meta.platform + "," + meta.version + "," +
-      meta.channel + "," + yoi + base::NumberToString(meta.woi) + "," + yos +
-      base::NumberToString(meta.wos) + "," + meta.refcode + ",";
-
-  const std::string metric_value_str = base::NumberToString(metric_value);
-
-  // TODO(iefremov): replace with 'if'?
-  CHECK_LE(metastring.size() + metric_value_str.size(),
-           kProchlomationDataLength - 1);
-
-  memcpy(ptr, metastring.data(), metastring.size());
-  ptr += metastring.size();
-  memcpy(ptr, metric_value_str.data(), metric_value_str.size());
+  FillProchlomationData(metastring, metric_value, data);
 
   // Init the message.
   p3a_message->set_metric_id(metric_hash);
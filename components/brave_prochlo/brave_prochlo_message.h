@@ -33,6 +33,10 @@ struct MessageMetainfo {
   std::string refcode;
 };
 
+// Returns the part of the message built from |meta|. It is the same for all
+// the metrics sent with the same metainfo, so it can be computed once.
+std::string GenerateMessageMetastring(const MessageMetainfo& meta);
+
 void GenerateProchloMessage(uint64_t metric_hash,
                             uint64_t metric_value,
                             const MessageMetainfo& meta,
@@ -43,6 +47,12 @@ void GenerateP3AMessage(uint64_t metric_hash,
                         const MessageMetainfo& meta,
                         brave_pyxis::RawP3AValue* p3a_message);
 
+// Same as above with the result of |GenerateMessageMetastring()|.
+void GenerateP3AMessage(uint64_t metric_hash,
+                        uint64_t metric_value,
+                        const std::string& metastring,
+                        brave_pyxis::RawP3AValue* p3a_message);
+
 // Ensures that country/refcode represent the big enough cohort that will not
 // let anybody identify the sender.
 void MaybeStripRefcodeAndCountry(prochlo::MessageMetainfo* meta);
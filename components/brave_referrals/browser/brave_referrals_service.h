@@ -42,11 +42,6 @@ class BraveReferralsService {
   void SetReferralInitializedCallbackForTest(
                   ReferralInitializedCallback referral_initialized_callback);
 
-  static bool GetMatchingReferralHeaders(
-      const base::ListValue& referral_headers_list,
-      const base::DictionaryValue** request_headers_dict,
-      const GURL& url);
-
   static bool IsDefaultReferralCode(const std::string& code);
 
  private:
@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_referrals/browser/referral_headers_matcher.h"
+
+#include <utility>
+
+#include "base/logging.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+ReferralHeadersMatcher::ReferralHeadersMatcher(
+    const base::ListValue& referral_headers_list) {
+  for (const auto& headers_value : referral_headers_list) {
+    const base::Value* domains_list =
+        headers_value.FindKeyOfType("domains", base::Value::Type::LIST);
+    if (!domains_list) {
+      LOG(WARNING) << "Failed to retrieve 'domains' key from referral headers";
+      continue;
+    }
+    const base::DictionaryValue* headers_dict = nullptr;
+    const base::Value* headers =
+        headers_value.FindKeyOfType("headers", base::Value::Type::DICTIONARY);
+    if (!headers || !headers->GetAsDictionary(&headers_dict)) {
+      LOG(WARNING) << "Failed to retrieve 'headers' key from referral headers";
+      continue;
+    }
+
+    const size_t index = headers_.size();
+    headers_.push_back(std::move(*headers_dict->CreateDeepCopy()));
+    for (const auto& domain_value : domains_list->GetList()) {
+      if (!domain_value.is_string() || domain_value.GetString().empty())
+        continue;
+      // Earlier entries win, like they did when the list was walked in order.
+      domains_.emplace(base::ToLowerASCII(domain_value.GetString()), index);
+    }
+  }
+}
+
+ReferralHeadersMatcher::~ReferralHeadersMatcher() = default;
+
+const base::DictionaryValue* ReferralHeadersMatcher::GetMatchingHeaders(
+    const GURL& url) const {
+  if (domains_.empty() || !url.SchemeIsHTTPOrHTTPS())
+    return nullptr;
+
+  // Check the host and every parent domain of it, the entry that comes first
+  // in the list wins if several of them are listed.
+  base::StringPiece host = url.host_piece();
+  size_t match_index = headers_.size();
+  while (!host.empty()) {
+    const auto it = domains_.find(host.as_string());
+    if (it != domains_.end() && it->second < match_index)
+      match_index = it->second;
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    host.remove_prefix(dot + 1);
+  }
+
+  if (match_index == headers_.size())
+    return nullptr;
+  return &headers_[match_index];
+}
+
+}  // namespace brave
@@ -0,0 +1,47 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_MATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_MATCHER_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/values.h"
+
+class GURL;
+
+namespace brave {
+
+// Referral headers list from the referral server, compiled into a lookup by
+// domain. Each entry of the list holds "domains" and the "headers" to send to
+// them, a domain also matches all of its subdomains. Build it once whenever
+// the list changes, a lookup only walks the suffixes of the request host.
+class ReferralHeadersMatcher {
+ public:
+  explicit ReferralHeadersMatcher(const base::ListValue& referral_headers_list);
+  ~ReferralHeadersMatcher();
+
+  // Returns the headers of the first list entry with a domain matching the
+  // http(s) |url|, or null if there is none.
+  const base::DictionaryValue* GetMatchingHeaders(const GURL& url) const;
+
+  bool empty() const { return domains_.empty(); }
+
+ private:
+  std::vector<base::DictionaryValue> headers_;
+  // Domain to the index of its entry in |headers_|.
+  std::unordered_map<std::string, size_t> domains_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReferralHeadersMatcher);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_MATCHER_H_
@@ -0,0 +1,102 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/background_job_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/logging.h"
+
+namespace brave_rewards {
+
+constexpr base::TimeDelta BackgroundJobScheduler::kQuietPeriod;
+constexpr base::TimeDelta BackgroundJobScheduler::kMaxDeferral;
+
+// static
+BackgroundJobScheduler* BackgroundJobScheduler::GetInstance() {
+  static base::NoDestructor<BackgroundJobScheduler> instance;
+  return instance.get();
+}
+
+BackgroundJobScheduler::BackgroundJobScheduler() = default;
+
+BackgroundJobScheduler::~BackgroundJobScheduler() = default;
+
+void BackgroundJobScheduler::OnLoadingStarted() {
+  loading_count_++;
+  UpdateTimer();
+}
+
+void BackgroundJobScheduler::OnLoadingStopped() {
+  DCHECK_GT(loading_count_, 0);
+  if (loading_count_ == 0) {
+    return;
+  }
+
+  loading_count_--;
+  if (loading_count_ == 0) {
+    last_loading_stopped_at_ = base::TimeTicks::Now();
+  }
+
+  UpdateTimer();
+}
+
+bool BackgroundJobScheduler::IsIdle() const {
+  if (loading_count_ > 0) {
+    return false;
+  }
+
+  return last_loading_stopped_at_.is_null() ||
+      base::TimeTicks::Now() - last_loading_stopped_at_ >= kQuietPeriod;
+}
+
+void BackgroundJobScheduler::RunWhenIdle(base::OnceClosure job) {
+  if (pending_jobs_.empty() && IsIdle()) {
+    std::move(job).Run();
+    return;
+  }
+
+  if (pending_jobs_.empty()) {
+    first_job_queued_at_ = base::TimeTicks::Now();
+  }
+
+  pending_jobs_.push_back(std::move(job));
+  UpdateTimer();
+}
+
+size_t BackgroundJobScheduler::GetPendingJobCount() const {
+  return pending_jobs_.size();
+}
+
+void BackgroundJobScheduler::UpdateTimer() {
+  if (pending_jobs_.empty()) {
+    timer_.Stop();
+    return;
+  }
+
+  base::TimeTicks run_at = first_job_queued_at_ + kMaxDeferral;
+  if (loading_count_ == 0 && !last_loading_stopped_at_.is_null()) {
+    run_at = std::min(run_at, last_loading_stopped_at_ + kQuietPeriod);
+  }
+
+  const base::TimeDelta delay =
+      std::max(run_at - base::TimeTicks::Now(), base::TimeDelta());
+  timer_.Start(FROM_HERE, delay,
+      base::BindOnce(&BackgroundJobScheduler::RunPendingJobs,
+          base::Unretained(this)));
+}
+
+void BackgroundJobScheduler::RunPendingJobs() {
+  std::vector<base::OnceClosure> jobs = std::move(pending_jobs_);
+  pending_jobs_.clear();
+
+  for (auto& job : jobs) {
+    std::move(job).Run();
+  }
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,61 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_BACKGROUND_JOB_SCHEDULER_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_BACKGROUND_JOB_SCHEDULER_H_
+
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/no_destructor.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace brave_rewards {
+
+// Holds back non-urgent rewards and ads jobs while tabs are loading and runs
+// all of them together once loading has been quiet for |kQuietPeriod|. A job
+// is never held back for longer than |kMaxDeferral|. Shared by every profile
+// and must only be used on the UI thread
+class BackgroundJobScheduler {
+ public:
+  static constexpr base::TimeDelta kQuietPeriod =
+      base::TimeDelta::FromSeconds(5);
+  static constexpr base::TimeDelta kMaxDeferral =
+      base::TimeDelta::FromMinutes(2);
+
+  static BackgroundJobScheduler* GetInstance();
+
+  BackgroundJobScheduler();
+  ~BackgroundJobScheduler();
+
+  // Calls have to be balanced for each tab
+  void OnLoadingStarted();
+  void OnLoadingStopped();
+
+  bool IsIdle() const;
+
+  // Runs |job| right away if the browser is idle, otherwise queues it
+  void RunWhenIdle(base::OnceClosure job);
+
+  size_t GetPendingJobCount() const;
+
+ private:
+  void UpdateTimer();
+  void RunPendingJobs();
+
+  int loading_count_ = 0;
+  base::TimeTicks last_loading_stopped_at_;
+  base::TimeTicks first_job_queued_at_;
+  std::vector<base::OnceClosure> pending_jobs_;
+  base::OneShotTimer timer_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundJobScheduler);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_BACKGROUND_JOB_SCHEDULER_H_
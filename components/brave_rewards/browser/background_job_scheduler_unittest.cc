@@ -0,0 +1,80 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/background_job_scheduler.h"
+
+#include "base/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BackgroundJobSchedulerTest.*
+
+namespace brave_rewards {
+
+class BackgroundJobSchedulerTest : public ::testing::Test {
+ protected:
+  base::OnceClosure CountJob() {
+    return base::BindOnce([](int* count) { (*count)++; }, &job_count_);
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  BackgroundJobScheduler scheduler_;
+  int job_count_ = 0;
+};
+
+TEST_F(BackgroundJobSchedulerTest, RunsJobRightAwayWhenIdle) {
+  scheduler_.RunWhenIdle(CountJob());
+
+  EXPECT_EQ(job_count_, 1);
+  EXPECT_EQ(scheduler_.GetPendingJobCount(), 0u);
+}
+
+TEST_F(BackgroundJobSchedulerTest, RunsJobsTogetherAfterLoading) {
+  scheduler_.OnLoadingStarted();
+  scheduler_.RunWhenIdle(CountJob());
+  scheduler_.RunWhenIdle(CountJob());
+  EXPECT_EQ(job_count_, 0);
+
+  scheduler_.OnLoadingStopped();
+  EXPECT_FALSE(scheduler_.IsIdle());
+  task_environment_.FastForwardBy(
+      BackgroundJobScheduler::kQuietPeriod / 2);
+  EXPECT_EQ(job_count_, 0);
+
+  task_environment_.FastForwardBy(BackgroundJobScheduler::kQuietPeriod);
+  EXPECT_TRUE(scheduler_.IsIdle());
+  EXPECT_EQ(job_count_, 2);
+  EXPECT_EQ(scheduler_.GetPendingJobCount(), 0u);
+}
+
+TEST_F(BackgroundJobSchedulerTest, WaitsForEveryTabToStopLoading) {
+  scheduler_.OnLoadingStarted();
+  scheduler_.OnLoadingStarted();
+  scheduler_.RunWhenIdle(CountJob());
+
+  scheduler_.OnLoadingStopped();
+  task_environment_.FastForwardBy(BackgroundJobScheduler::kQuietPeriod * 2);
+  EXPECT_EQ(job_count_, 0);
+
+  scheduler_.OnLoadingStopped();
+  task_environment_.FastForwardBy(BackgroundJobScheduler::kQuietPeriod);
+  EXPECT_EQ(job_count_, 1);
+}
+
+TEST_F(BackgroundJobSchedulerTest, RunsJobsAfterMaxDeferral) {
+  scheduler_.OnLoadingStarted();
+  scheduler_.RunWhenIdle(CountJob());
+
+  task_environment_.FastForwardBy(
+      BackgroundJobScheduler::kMaxDeferral - base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(job_count_, 0);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(job_count_, 1);
+  EXPECT_FALSE(scheduler_.IsIdle());
+}
+
+}  // namespace brave_rewards
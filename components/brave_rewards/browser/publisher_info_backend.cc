@@ -4,6 +4,7 @@
 
 #include "brave/components/brave_rewards/browser/publisher_info_backend.h"
 
+#include "base/bind.h"
 #include "base/files/file_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "third_party/leveldatabase/env_chromium.h"
@@ -12,6 +13,7 @@
 #include "third_party/leveldatabase/src/include/leveldb/options.h"
 #include "third_party/leveldatabase/src/include/leveldb/slice.h"
 #include "third_party/leveldatabase/src/include/leveldb/status.h"
+#include "third_party/leveldatabase/src/include/leveldb/write_batch.h"
 
 #include <codecvt>
 
@@ -41,6 +43,27 @@ bool PublisherInfoBackend::Put(const std::string& key,
   return false;
 }
 
+bool PublisherInfoBackend::PutBatch(
+    const std::vector<std::pair<std::string, std::string>>& entries) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  bool initialized = EnsureInitialized();
+  DCHECK(initialized);
+
+  if (!initialized)
+    return false;
+
+  leveldb::WriteBatch batch;
+  for (const auto& entry : entries)
+    batch.Put(entry.first, entry.second);
+
+  leveldb::WriteOptions options;
+  leveldb::Status status = db_->Write(options, &batch);
+  if (status.ok())
+    return true;
+
+  return false;
+}
+
 bool PublisherInfoBackend::Get(const std::string& lookup,
                                std::string* value) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -98,6 +121,25 @@ bool PublisherInfoBackend::Search(const std::vector<std::string>& prefixes,
 bool PublisherInfoBackend::Load(uint32_t start,
                                 uint32_t limit,
                                 std::vector<std::string>& results) {
+  uint32_t count = 0;
+  uint32_t position = 0;
+  return Scan("", base::BindRepeating(
+      [](uint32_t start, uint32_t limit, uint32_t* count, uint32_t* position,
+         std::vector<std::string>* results, base::StringPiece key,
+         base::StringPiece value) {
+        if (*count >= limit)
+          return false;
+        if ((*position)++ < start)
+          return true;
+        (*count)++;
+        results->push_back(value.as_string());
+        return true;
+      },
+      start, limit, &count, &position, &results));
+}
+
+bool PublisherInfoBackend::Scan(const std::string& prefix,
+                                const ScanCallback& callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   bool initialized = EnsureInitialized();
   DCHECK(initialized);
@@ -106,19 +148,23 @@ bool PublisherInfoBackend::Load(uint32_t start,
     return false;
 
   leveldb::ReadOptions options;
+  // A scan can cover the whole database, don't evict hotter blocks for it
+  options.fill_cache = false;
   std::unique_ptr<leveldb::Iterator> db_it(db_->NewIterator(options));
 
-  uint32_t count = 0;
-  uint32_t position = 0;
-  for (db_it->SeekToFirst(); count < limit && db_it->Valid(); db_it->Next()) {
-    if (position++ < start)
-      continue;
-    else
-      count++;
-    results.push_back(db_it->value().ToString());
+  const leveldb::Slice slice(prefix);
+  for (db_it->Seek(slice);
+       db_it->Valid() && db_it->key().starts_with(slice);
+       db_it->Next()) {
+    const leveldb::Slice key = db_it->key();
+    const leveldb::Slice value = db_it->value();
+    if (!callback.Run(base::StringPiece(key.data(), key.size()),
+                      base::StringPiece(value.data(), value.size()))) {
+      break;
+    }
   }
 
-  return true;
+  return db_it->status().ok();
 }
 
 bool PublisherInfoBackend::EnsureInitialized() {
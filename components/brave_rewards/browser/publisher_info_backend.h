@@ -5,9 +5,16 @@
 #ifndef BRAVE_BROWSER_PAYMENTS_PUBLISHER_INFO_BACKEND_
 #define BRAVE_BROWSER_PAYMENTS_PUBLISHER_INFO_BACKEND_
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/sequence_checker.h"
+#include "base/strings/string_piece.h"
 
 namespace leveldb {
 class DB;
@@ -17,16 +24,28 @@ namespace brave_rewards {
 
 class PublisherInfoBackend {
  public:
+  // Called for every entry of a scan, in key order. The key and value are
+  // only valid during the call. Return false to stop the scan.
+  using ScanCallback =
+      base::RepeatingCallback<bool(base::StringPiece key,
+                                   base::StringPiece value)>;
+
   PublisherInfoBackend(const base::FilePath& path);
   ~PublisherInfoBackend();
 
   bool Put(const std::string& key, const std::string& value);
+  // Writes all |entries| atomically with a single write.
+  bool PutBatch(
+      const std::vector<std::pair<std::string, std::string>>& entries);
   bool Get(const std::string& lookup, std::string* value);
   bool Search(const std::vector<std::string>& prefixes,
               uint32_t start, uint32_t limit,
               std::vector<std::string>& results);
   bool Load(uint32_t start, uint32_t limit,
             std::vector<std::string>& results);
+  // Streams the entries whose key starts with |prefix|, all entries if
+  // |prefix| is empty, without copying them.
+  bool Scan(const std::string& prefix, const ScanCallback& callback);
 
  private:
   bool EnsureInitialized();
@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/publisher_info_backend.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=PublisherInfoBackendTest.*
+
+namespace brave_rewards {
+
+class PublisherInfoBackendTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    backend_ = std::make_unique<PublisherInfoBackend>(
+        temp_dir_.GetPath().AppendASCII("publisher_info"));
+  }
+
+  std::vector<std::string> ScanKeys(const std::string& prefix,
+                                    size_t max_keys) {
+    std::vector<std::string> keys;
+    EXPECT_TRUE(backend_->Scan(prefix, base::BindRepeating(
+        [](size_t max_keys, std::vector<std::string>* keys,
+           base::StringPiece key, base::StringPiece value) {
+          keys->push_back(key.as_string());
+          return keys->size() < max_keys;
+        },
+        max_keys, &keys)));
+    return keys;
+  }
+
+  // leveldb schedules compactions on the thread pool
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<PublisherInfoBackend> backend_;
+};
+
+TEST_F(PublisherInfoBackendTest, PutBatch) {
+  ASSERT_TRUE(backend_->PutBatch({{"brave.com", "1"},
+                                  {"github.com", "2"},
+                                  {"brave.com", "3"}}));
+
+  std::string value;
+  ASSERT_TRUE(backend_->Get("brave.com", &value));
+  // Later entries of a batch win
+  EXPECT_EQ("3", value);
+  ASSERT_TRUE(backend_->Get("github.com", &value));
+  EXPECT_EQ("2", value);
+}
+
+TEST_F(PublisherInfoBackendTest, Scan) {
+  ASSERT_TRUE(backend_->PutBatch({{"youtube#channel:a", "a"},
+                                  {"youtube#channel:b", "b"},
+                                  {"twitch#author:c", "c"},
+                                  {"youtube#channel:d", "d"}}));
+
+  EXPECT_EQ((std::vector<std::string>{"youtube#channel:a",
+                                      "youtube#channel:b",
+                                      "youtube#channel:d"}),
+            ScanKeys("youtube#", 10));
+  EXPECT_EQ((std::vector<std::string>{"twitch#author:c"}),
+            ScanKeys("", 1));
+  EXPECT_TRUE(ScanKeys("reddit#", 10).empty());
+}
+
+TEST_F(PublisherInfoBackendTest, Load) {
+  ASSERT_TRUE(backend_->PutBatch({{"a", "1"}, {"b", "2"}, {"c", "3"}}));
+
+  std::vector<std::string> results;
+  ASSERT_TRUE(backend_->Load(1, 1, results));
+  EXPECT_EQ(std::vector<std::string>{"2"}, results);
+
+  results.clear();
+  ASSERT_TRUE(backend_->Load(0, 0, results));
+  EXPECT_TRUE(results.empty());
+}
+
+}  // namespace brave_rewards
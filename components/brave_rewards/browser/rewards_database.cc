@@ -18,36 +18,41 @@ namespace brave_rewards {
 
 namespace {
 
-void HandleBinding(
+// Some commands embed values in their SQL, so only this many distinct
+// statements are cached and any others are prepared for each command
+const size_t kMaximumCachedStatements = 128;
+
+void BindValue(
     sql::Statement* statement,
-    const ledger::DBCommandBinding& binding) {
+    const int index,
+    const ledger::DBValue& value) {
   if (!statement) {
     return;
   }
 
-  switch (binding.value->which()) {
+  switch (value.which()) {
     case ledger::DBValue::Tag::STRING_VALUE: {
-      statement->BindString(binding.index, binding.value->get_string_value());
+      statement->BindString(index, value.get_string_value());
       return;
     }
     case ledger::DBValue::Tag::INT_VALUE: {
-      statement->BindInt(binding.index, binding.value->get_int_value());
+      statement->BindInt(index, value.get_int_value());
       return;
     }
     case ledger::DBValue::Tag::INT64_VALUE: {
-      statement->BindInt64(binding.index, binding.value->get_int64_value());
+      statement->BindInt64(index, value.get_int64_value());
       return;
     }
     case ledger::DBValue::Tag::DOUBLE_VALUE: {
-      statement->BindDouble(binding.index, binding.value->get_double_value());
+      statement->BindDouble(index, value.get_double_value());
       return;
     }
     case ledger::DBValue::Tag::BOOL_VALUE: {
-      statement->BindBool(binding.index, binding.value->get_bool_value());
+      statement->BindBool(index, value.get_bool_value());
       return;
     }
     case ledger::DBValue::Tag::NULL_VALUE: {
-      statement->BindNull(binding.index);
+      statement->BindNull(index);
       return;
     }
     default: {
@@ -56,6 +61,12 @@ void HandleBinding(
   }
 }
 
+void HandleBinding(
+    sql::Statement* statement,
+    const ledger::DBCommandBinding& binding) {
+  BindValue(statement, binding.index, *binding.value);
+}
+
 ledger::DBRecordPtr CreateRecord(
     sql::Statement* statement,
     const std::vector<ledger::DBCommand::RecordBindingType>& bindings) {
@@ -100,6 +111,47 @@ ledger::DBRecordPtr CreateRecord(
   return record;
 }
 
+void AppendColumnValues(
+    sql::Statement* statement,
+    const std::vector<ledger::DBCommand::RecordBindingType>& bindings,
+    ledger::DBColumns* columns) {
+  if (!statement || !columns) {
+    return;
+  }
+
+  for (size_t i = 0; i < bindings.size(); i++) {
+    const int index = static_cast<int>(i);
+    auto* column = columns->columns.at(i).get();
+    switch (bindings[i]) {
+      case ledger::DBCommand::RecordBindingType::STRING_TYPE: {
+        column->string_data += statement->ColumnString(index);
+        column->string_ends.push_back(
+            static_cast<uint32_t>(column->string_data.size()));
+        break;
+      }
+      case ledger::DBCommand::RecordBindingType::INT_TYPE: {
+        column->int_values.push_back(statement->ColumnInt(index));
+        break;
+      }
+      case ledger::DBCommand::RecordBindingType::INT64_TYPE: {
+        column->int_values.push_back(statement->ColumnInt64(index));
+        break;
+      }
+      case ledger::DBCommand::RecordBindingType::DOUBLE_TYPE: {
+        column->double_values.push_back(statement->ColumnDouble(index));
+        break;
+      }
+      case ledger::DBCommand::RecordBindingType::BOOL_TYPE: {
+        column->int_values.push_back(statement->ColumnBool(index) ? 1 : 0);
+        break;
+      }
+      default: {
+        NOTREACHED();
+      }
+    }
+  }
+}
+
 }  // namespace
 
 RewardsDatabase::RewardsDatabase(const base::FilePath& db_path) :
@@ -155,6 +207,14 @@ void RewardsDatabase::RunTransaction(
         status = Run(command.get());
         break;
       }
+      case ledger::DBCommand::Type::RUN_BULK: {
+        status = RunBulk(command.get());
+        break;
+      }
+      case ledger::DBCommand::Type::READ_COLUMNS: {
+        status = ReadColumns(command.get(), response);
+        break;
+      }
       case ledger::DBCommand::Type::MIGRATE: {
         status = Migrate(
             transaction->version,
@@ -250,7 +310,7 @@ ledger::DBCommandResponse::Status RewardsDatabase::Run(
     return ledger::DBCommandResponse::Status::RESPONSE_ERROR;
   }
 
-  sql::Statement statement(db_.GetUniqueStatement(command->command.c_str()));
+  sql::Statement statement(GetStatement(command->command));
 
   for (auto const& binding : command->bindings) {
     HandleBinding(&statement, *binding.get());
@@ -268,6 +328,49 @@ ledger::DBCommandResponse::Status RewardsDatabase::Run(
   return ledger::DBCommandResponse::Status::RESPONSE_OK;
 }
 
+ledger::DBCommandResponse::Status RewardsDatabase::RunBulk(
+    ledger::DBCommand* command) {
+  if (!initialized_) {
+    return ledger::DBCommandResponse::Status::INITIALIZATION_ERROR;
+  }
+
+  if (!command || command->bulk_bindings.empty()) {
+    return ledger::DBCommandResponse::Status::RESPONSE_ERROR;
+  }
+
+  const size_t rows = command->bulk_bindings.front()->values.size();
+  for (auto const& binding : command->bulk_bindings) {
+    if (binding->values.size() != rows) {
+      return ledger::DBCommandResponse::Status::RESPONSE_ERROR;
+    }
+  }
+
+  sql::Statement statement(GetStatement(command->command));
+
+  for (size_t row = 0; row < rows; row++) {
+    for (auto const& binding : command->bindings) {
+      HandleBinding(&statement, *binding.get());
+    }
+
+    for (auto const& binding : command->bulk_bindings) {
+      BindValue(&statement, binding->index, *binding->values.at(row));
+    }
+
+    if (!statement.Run()) {
+      LOG(ERROR) <<
+      "DB Run bulk error: " <<
+      db_.GetErrorMessage() <<
+      " (" << db_.GetErrorCode() <<
+      ")";
+      return ledger::DBCommandResponse::Status::COMMAND_ERROR;
+    }
+
+    statement.Reset(true);
+  }
+
+  return ledger::DBCommandResponse::Status::RESPONSE_OK;
+}
+
 ledger::DBCommandResponse::Status RewardsDatabase::Read(
     ledger::DBCommand* command,
     ledger::DBCommandResponse* response) {
@@ -279,8 +382,7 @@ ledger::DBCommandResponse::Status RewardsDatabase::Read(
     return ledger::DBCommandResponse::Status::RESPONSE_ERROR;
   }
 
-  sql::Statement statement(
-      db_.GetUniqueStatement(command->command.c_str()));
+  sql::Statement statement(GetStatement(command->command));
 
   for (auto const& binding : command->bindings) {
     HandleBinding(&statement, *binding.get());
@@ -297,6 +399,58 @@ ledger::DBCommandResponse::Status RewardsDatabase::Read(
   return ledger::DBCommandResponse::Status::RESPONSE_OK;
 }
 
+ledger::DBCommandResponse::Status RewardsDatabase::ReadColumns(
+    ledger::DBCommand* command,
+    ledger::DBCommandResponse* response) {
+  if (!initialized_) {
+    return ledger::DBCommandResponse::Status::INITIALIZATION_ERROR;
+  }
+
+  if (!command || !response) {
+    return ledger::DBCommandResponse::Status::RESPONSE_ERROR;
+  }
+
+  sql::Statement statement(GetStatement(command->command));
+
+  for (auto const& binding : command->bindings) {
+    HandleBinding(&statement, *binding.get());
+  }
+
+  auto columns = ledger::DBColumns::New();
+  for (size_t i = 0; i < command->record_bindings.size(); i++) {
+    columns->columns.push_back(ledger::DBColumn::New());
+  }
+
+  uint32_t row_count = 0;
+  while (statement.Step()) {
+    AppendColumnValues(&statement, command->record_bindings, columns.get());
+    row_count++;
+  }
+
+  columns->row_count = row_count;
+
+  auto result = ledger::DBCommandResult::New();
+  result->set_columns(std::move(columns));
+  response->result = std::move(result);
+
+  return ledger::DBCommandResponse::Status::RESPONSE_OK;
+}
+
+scoped_refptr<sql::Database::StatementRef> RewardsDatabase::GetStatement(
+    const std::string& sql) {
+  auto iter = cached_statements_sql_.find(sql);
+  if (iter == cached_statements_sql_.end()) {
+    if (cached_statements_sql_.size() >= kMaximumCachedStatements) {
+      return db_.GetUniqueStatement(sql.c_str());
+    }
+
+    iter = cached_statements_sql_.insert(sql).first;
+  }
+
+  return db_.GetCachedStatement(sql::StatementID(iter->c_str(), 0),
+      iter->c_str());
+}
+
 ledger::DBCommandResponse::Status RewardsDatabase::Migrate(
     const int32_t version,
     const int32_t compatible_version) {
@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_REWARDS_DATABASE_H_
 
 #include <memory>
+#include <set>
+#include <string>
 
 #include "base/compiler_specific.h"
 #include "base/files/file_path.h"
@@ -39,10 +41,24 @@ class RewardsDatabase {
 
   ledger::DBCommandResponse::Status Run(ledger::DBCommand* command);
 
+  // Runs the statement once for each row of |command->bulk_bindings|
+  ledger::DBCommandResponse::Status RunBulk(ledger::DBCommand* command);
+
   ledger::DBCommandResponse::Status Read(
       ledger::DBCommand* command,
       ledger::DBCommandResponse* response);
 
+  // Same as Read, but returns the values of each column together instead of
+  // a record for each row
+  ledger::DBCommandResponse::Status ReadColumns(
+      ledger::DBCommand* command,
+      ledger::DBCommandResponse* response);
+
+  // Returns a statement for |sql|, reusing the statement prepared for an
+  // earlier command with the same SQL
+  scoped_refptr<sql::Database::StatementRef> GetStatement(
+      const std::string& sql);
+
   ledger::DBCommandResponse::Status Migrate(
       const int32_t version,
       const int32_t compatible_version);
@@ -51,6 +67,11 @@ class RewardsDatabase {
       base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
 
   const base::FilePath db_path_;
+
+  // SQL of the cached statements. |db_| keeps a pointer to each string as the
+  // statement id, so the strings must outlive |db_|
+  std::set<std::string> cached_statements_sql_;
+
   sql::Database db_;
   sql::MetaTable meta_table_;
   bool initialized_;
@@ -0,0 +1,457 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/path_service.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/time/time.h"
+#include "bat/ledger/ledger.h"
+#include "brave/common/brave_paths.h"
+#include "sql/database.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// Seeds a rewards database of the size of a heavily used profile with the
+// current schema, then times the queries which the ledger runs most often and
+// prints their query plans. Full table scans in the plans are reported as
+// candidates for an index. The tests are disabled so that they don't slow
+// down the unit tests, run them with
+//
+// npm run test -- brave_unit_tests --filter=*RewardsDatabasePerfTest* \
+//     --gtest_also_run_disabled_tests
+
+namespace brave_rewards {
+
+namespace {
+
+const int kPublishers = 20000;
+const int kServerPublishers = 500000;
+const int kActivityRows = 50000;
+const int kReconcileStamps = 12;
+const int kContributions = 5000;
+const int kPublishersPerContribution = 3;
+const int kPendingContributions = 500;
+
+const int kIterations = 20;
+
+// Default minimum visit time in seconds
+const int kMinVisitTime = 8;
+
+// 1 January 2020 00:00:00 UTC
+const int64_t kFirstReconcileStamp = 1577836800;
+const int64_t kReconcileInterval = 30 * 24 * 60 * 60;
+
+const int kStepCompleted =
+    static_cast<int>(ledger::ContributionStep::STEP_COMPLETED);
+const int kStepStart = static_cast<int>(ledger::ContributionStep::STEP_START);
+
+const int kTypeAutoContribute =
+    static_cast<int>(ledger::RewardsType::AUTO_CONTRIBUTE);
+const int kTypeOneTimeTip = static_cast<int>(ledger::RewardsType::ONE_TIME_TIP);
+
+std::string GetPublisherKey(const int index) {
+  return base::StringPrintf("publisher%d.com", index);
+}
+
+std::string GetContributionId(const int index) {
+  return base::StringPrintf("contribution-%d", index);
+}
+
+int64_t GetReconcileStamp(const int index) {
+  return kFirstReconcileStamp + (index % kReconcileStamps) * kReconcileInterval;
+}
+
+struct Query {
+  std::string name;
+  std::string sql;
+  std::function<void(sql::Statement*)> bind;
+  // Tables which the query must not scan, by the alias used in the query
+  std::vector<std::string> indexed_tables;
+};
+
+// The queries are copies of the ones built by the ledger database classes
+std::vector<Query> GetQueries() {
+  const int64_t reconcile_stamp = GetReconcileStamp(kReconcileStamps - 1);
+
+  return {
+    {
+      "activity list",  // DatabaseActivityInfo::GetRecordsList
+      "SELECT ai.publisher_id, ai.duration, ai.score, "
+      "ai.percent, ai.weight, spi.status, pi.excluded, "
+      "pi.name, pi.url, pi.provider, "
+      "pi.favIcon, ai.reconcile_stamp, ai.visits "
+      "FROM activity_info AS ai "
+      "INNER JOIN publisher_info AS pi "
+      "ON ai.publisher_id = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id "
+      "WHERE 1 = 1 AND ai.reconcile_stamp = ? AND ai.duration >= ? "
+      "AND pi.excluded != ? AND ai.percent >= ? AND ai.visits >= ? "
+      "ORDER BY ai.percent DESC, ai.publisher_id ASC LIMIT 100",
+      [reconcile_stamp](sql::Statement* statement) {
+        statement->BindInt64(0, reconcile_stamp);
+        statement->BindInt(1, kMinVisitTime);
+        statement->BindInt(2, 1);
+        statement->BindInt(3, 1);
+        statement->BindInt(4, 1);
+      },
+      { "ai" }
+    },
+    {
+      "activity list page",  // DatabaseActivityInfo::GetRecordsList
+      "SELECT ai.publisher_id, ai.duration, ai.score, "
+      "ai.percent, ai.weight, spi.status, pi.excluded, "
+      "pi.name, pi.url, pi.provider, "
+      "pi.favIcon, ai.reconcile_stamp, ai.visits "
+      "FROM activity_info AS ai "
+      "INNER JOIN publisher_info AS pi "
+      "ON ai.publisher_id = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id "
+      "WHERE 1 = 1 AND ai.reconcile_stamp = ? AND ai.duration >= ? "
+      "AND pi.excluded != ? AND ai.percent >= ? AND ai.visits >= ? "
+      "AND (ai.percent < ? OR (ai.percent = ? AND ai.publisher_id > ?)) "
+      "ORDER BY ai.percent DESC, ai.publisher_id ASC LIMIT 100",
+      [reconcile_stamp](sql::Statement* statement) {
+        statement->BindInt64(0, reconcile_stamp);
+        statement->BindInt(1, kMinVisitTime);
+        statement->BindInt(2, 1);
+        statement->BindInt(3, 1);
+        statement->BindInt(4, 1);
+        statement->BindDouble(5, 5);
+        statement->BindDouble(6, 5);
+        statement->BindString(7, GetPublisherKey(kPublishers / 2));
+      },
+      { "ai" }
+    },
+    {
+      "panel activity",  // DatabaseActivityInfo::GetRecordsList
+      "SELECT ai.publisher_id, ai.duration, ai.score, "
+      "ai.percent, ai.weight, spi.status, pi.excluded, "
+      "pi.name, pi.url, pi.provider, "
+      "pi.favIcon, ai.reconcile_stamp, ai.visits "
+      "FROM activity_info AS ai "
+      "INNER JOIN publisher_info AS pi "
+      "ON ai.publisher_id = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id "
+      "WHERE 1 = 1 AND ai.publisher_id = ? AND ai.reconcile_stamp = ?",
+      [reconcile_stamp](sql::Statement* statement) {
+        statement->BindString(0, GetPublisherKey(42));
+        statement->BindInt64(1, reconcile_stamp);
+      },
+      { "ai", "pi", "spi" }
+    },
+    {
+      "one time tips",  // DatabaseContributionInfo::GetOneTimeTips
+      "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+      "ci.amount, ci.created_at, spi.status, pi.provider "
+      "FROM contribution_info as ci "
+      "INNER JOIN contribution_info_publishers AS cp "
+      "ON cp.contribution_id = ci.contribution_id "
+      "INNER JOIN publisher_info AS pi ON cp.publisher_key = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id "
+      "WHERE strftime('%m',  datetime(ci.created_at, 'unixepoch')) = ? AND "
+      "strftime('%Y', datetime(ci.created_at, 'unixepoch')) = ? "
+      "AND ci.type = ? AND ci.step = ?",
+      [](sql::Statement* statement) {
+        statement->BindString(0, "06");
+        statement->BindString(1, "2020");
+        statement->BindInt(2, kTypeOneTimeTip);
+        statement->BindInt(3, kStepCompleted);
+      },
+      { "pi", "spi" }
+    },
+    {
+      // DatabaseContributionInfo::GetContributionReport
+      "contribution report",
+      "SELECT ci.contribution_id, ci.amount, ci.type, ci.created_at, "
+      "ci.processor FROM contribution_info as ci "
+      "WHERE strftime('%m',  datetime(ci.created_at, 'unixepoch')) = ? AND "
+      "strftime('%Y', datetime(ci.created_at, 'unixepoch')) = ? AND step = ?",
+      [](sql::Statement* statement) {
+        statement->BindString(0, "06");
+        statement->BindString(1, "2020");
+        statement->BindInt(2, kStepCompleted);
+      },
+      {}
+    },
+    {
+      // DatabaseContributionInfo::GetNotCompletedRecords
+      "not completed contributions",
+      "SELECT ci.contribution_id, ci.amount, ci.type, ci.step, ci.retry_count, "
+      "ci.processor "
+      "FROM contribution_info as ci WHERE ci.step > 0",
+      [](sql::Statement* statement) {},
+      { "ci" }
+    },
+    {
+      "pending contributions",  // DatabasePendingContribution::GetAllRecords
+      "SELECT pc.pending_contribution_id, pi.publisher_id, pi.name, "
+      "pi.url, pi.favIcon, spi.status, pi.provider, pc.amount, pc.added_date, "
+      "pc.viewing_id, pc.type "
+      "FROM pending_contribution as pc "
+      "INNER JOIN publisher_info AS pi ON pc.publisher_id = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id",
+      [](sql::Statement* statement) {},
+      { "pi", "spi" }
+    },
+    {
+      "server publisher",  // DatabaseServerPublisherInfo::GetRecord
+      "SELECT status, excluded, address FROM server_publisher_info "
+      "WHERE publisher_key=?",
+      [](sql::Statement* statement) {
+        statement->BindString(0, GetPublisherKey(kServerPublishers / 2));
+      },
+      { "server_publisher_info" }
+    }
+  };
+}
+
+// Returns true if |detail| of a query plan step reads every row of |table|.
+// Depending on the SQLite version |table| appears by its alias or as
+// "TABLE name AS alias"
+bool IsFullScan(const std::string& detail, const std::string& table) {
+  if (!base::StartsWith(detail, "SCAN ", base::CompareCase::SENSITIVE)) {
+    return false;
+  }
+
+  if (detail.find(" USING ") != std::string::npos) {
+    return false;
+  }
+
+  const auto words = base::SplitString(
+      detail,
+      " ",
+      base::TRIM_WHITESPACE,
+      base::SPLIT_WANT_NONEMPTY);
+  return std::find(words.begin(), words.end(), table) != words.end();
+}
+
+}  // namespace
+
+class RewardsDatabasePerfTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    ASSERT_TRUE(db_.Open(temp_dir_.GetPath().AppendASCII("publisher_info_db")));
+
+    CreateSchema();
+    Seed();
+  }
+
+  // The schema file is kept equal to a migrated database by the schema check
+  // in RewardsDatabaseBrowserTest
+  void CreateSchema() {
+    base::FilePath path;
+    ASSERT_TRUE(base::PathService::Get(brave::DIR_TEST_DATA, &path));
+    path = path.AppendASCII("rewards-data")
+        .AppendASCII("migration")
+        .AppendASCII("publisher_info_schema_current.txt");
+
+    std::string schema;
+    ASSERT_TRUE(base::ReadFileToString(path, &schema));
+
+    std::vector<std::string> tables;
+    std::vector<std::string> indexes;
+    for (const auto& line : base::SplitString(
+        schema,
+        "\r\n",
+        base::KEEP_WHITESPACE,
+        base::SPLIT_WANT_NONEMPTY)) {
+      // type|name|tbl_name|sql
+      const auto columns = base::SplitString(
+          line,
+          "|",
+          base::KEEP_WHITESPACE,
+          base::SPLIT_WANT_ALL);
+      if (columns.size() != 4 || columns.at(3).empty() ||
+          base::StartsWith(columns.at(1), "sqlite_",
+              base::CompareCase::SENSITIVE)) {
+        continue;
+      }
+
+      if (columns.at(0) == "table") {
+        tables.push_back(columns.at(3));
+      } else if (columns.at(0) == "index") {
+        indexes.push_back(columns.at(3));
+      }
+    }
+
+    for (const auto& sql : tables) {
+      ASSERT_TRUE(db_.Execute(sql.c_str())) << sql;
+    }
+
+    for (const auto& sql : indexes) {
+      ASSERT_TRUE(db_.Execute(sql.c_str())) << sql;
+    }
+  }
+
+  void Seed() {
+    sql::Transaction transaction(&db_);
+    ASSERT_TRUE(transaction.Begin());
+
+    sql::Statement publisher(db_.GetUniqueStatement(
+        "INSERT INTO publisher_info "
+        "(publisher_id, excluded, name, favIcon, url, provider) "
+        "VALUES (?, ?, ?, '', ?, '')"));
+    for (int i = 0; i < kPublishers; i++) {
+      const std::string publisher_key = GetPublisherKey(i);
+      publisher.BindString(0, publisher_key);
+      publisher.BindInt(1, i % 3);
+      publisher.BindString(2, publisher_key);
+      publisher.BindString(3, "https://" + publisher_key);
+      ASSERT_TRUE(publisher.Run());
+      publisher.Reset(true);
+    }
+
+    sql::Statement server_publisher(db_.GetUniqueStatement(
+        "INSERT INTO server_publisher_info "
+        "(publisher_key, status, excluded, address) VALUES (?, ?, 0, '')"));
+    for (int i = 0; i < kServerPublishers; i++) {
+      server_publisher.BindString(0, GetPublisherKey(i));
+      server_publisher.BindInt(1, i % 3);
+      ASSERT_TRUE(server_publisher.Run());
+      server_publisher.Reset(true);
+    }
+
+    // Each publisher is visited in several reconcile periods
+    sql::Statement activity(db_.GetUniqueStatement(
+        "INSERT INTO activity_info "
+        "(publisher_id, duration, visits, score, percent, weight, "
+        "reconcile_stamp) VALUES (?, ?, ?, ?, ?, ?, ?)"));
+    for (int i = 0; i < kActivityRows; i++) {
+      activity.BindString(0, GetPublisherKey(i % kPublishers));
+      activity.BindInt(1, i % 600);
+      activity.BindInt(2, i % 20);
+      activity.BindDouble(3, (i % 100) / 10.0);
+      activity.BindInt(4, i % 100);
+      activity.BindDouble(5, (i % 100) / 100.0);
+      activity.BindInt64(6, GetReconcileStamp(i / kPublishers * 5 + i));
+      ASSERT_TRUE(activity.Run());
+      activity.Reset(true);
+    }
+
+    // Nearly all contributions are completed
+    sql::Statement contribution(db_.GetUniqueStatement(
+        "INSERT INTO contribution_info "
+        "(contribution_id, amount, type, step, retry_count, created_at, "
+        "processor) VALUES (?, 1.0, ?, ?, 0, ?, 1)"));
+    sql::Statement contribution_publisher(db_.GetUniqueStatement(
+        "INSERT INTO contribution_info_publishers "
+        "(contribution_id, publisher_key, total_amount, contributed_amount) "
+        "VALUES (?, ?, 1.0, 1.0)"));
+    for (int i = 0; i < kContributions; i++) {
+      const std::string contribution_id = GetContributionId(i);
+      contribution.BindString(0, contribution_id);
+      contribution.BindInt(1, i % 2 ? kTypeOneTimeTip : kTypeAutoContribute);
+      contribution.BindInt(2, i % 100 ? kStepCompleted : kStepStart);
+      contribution.BindInt64(3,
+          kFirstReconcileStamp - 365 * 24 * 60 * 60 + i * 12000);
+      ASSERT_TRUE(contribution.Run());
+      contribution.Reset(true);
+
+      for (int j = 0; j < kPublishersPerContribution; j++) {
+        contribution_publisher.BindString(0, contribution_id);
+        contribution_publisher.BindString(1,
+            GetPublisherKey((i * kPublishersPerContribution + j) %
+                kPublishers));
+        ASSERT_TRUE(contribution_publisher.Run());
+        contribution_publisher.Reset(true);
+      }
+    }
+
+    sql::Statement pending(db_.GetUniqueStatement(
+        "INSERT INTO pending_contribution "
+        "(publisher_id, amount, added_date, viewing_id, type) "
+        "VALUES (?, 1.0, 0, '', ?)"));
+    for (int i = 0; i < kPendingContributions; i++) {
+      pending.BindString(0, GetPublisherKey(i * 7 % kPublishers));
+      pending.BindInt(1, kTypeOneTimeTip);
+      ASSERT_TRUE(pending.Run());
+      pending.Reset(true);
+    }
+
+    ASSERT_TRUE(transaction.Commit());
+  }
+
+  std::vector<std::string> GetQueryPlan(const Query& query) {
+    sql::Statement statement(db_.GetUniqueStatement(
+        ("EXPLAIN QUERY PLAN " + query.sql).c_str()));
+    query.bind(&statement);
+
+    // id|parent|notused|detail
+    std::vector<std::string> plan;
+    while (statement.Step()) {
+      plan.push_back(statement.ColumnString(3));
+    }
+
+    return plan;
+  }
+
+  void Measure(const Query& query) {
+    std::vector<base::TimeDelta> timings;
+    size_t rows = 0;
+    for (int i = 0; i < kIterations; i++) {
+      sql::Statement statement(db_.GetUniqueStatement(query.sql.c_str()));
+      query.bind(&statement);
+
+      rows = 0;
+      const base::TimeTicks start_time = base::TimeTicks::Now();
+      while (statement.Step()) {
+        rows++;
+      }
+      timings.push_back(base::TimeTicks::Now() - start_time);
+      ASSERT_TRUE(statement.Succeeded()) << query.name;
+    }
+
+    std::sort(timings.begin(), timings.end());
+    std::cout << "[ PERF     ] " << query.name << ": " << rows << " rows p50="
+        << timings.at(timings.size() / 2).InMicrosecondsF() << "us p99="
+        << timings.at(timings.size() * 99 / 100).InMicrosecondsF() << "us"
+        << std::endl;
+
+    for (const auto& detail : GetQueryPlan(query)) {
+      std::cout << "[ PLAN     ]   " << detail << std::endl;
+
+      if (base::StartsWith(detail, "SCAN ", base::CompareCase::SENSITIVE) &&
+          detail.find(" USING ") == std::string::npos) {
+        std::cout << "[ ADVISOR  ]   full scan, consider an index for the "
+            << "filtered columns" << std::endl;
+      }
+
+      for (const auto& table : query.indexed_tables) {
+        EXPECT_FALSE(IsFullScan(detail, table))
+            << query.name << " scans " << table << ": " << detail;
+      }
+    }
+  }
+
+  base::ScopedTempDir temp_dir_;
+  sql::Database db_;
+};
+
+TEST_F(RewardsDatabasePerfTest, DISABLED_HotQueries) {
+  for (const auto& query : GetQueries()) {
+    Measure(query);
+  }
+}
+
+}  // namespace brave_rewards
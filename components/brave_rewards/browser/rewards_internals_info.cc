@@ -12,7 +12,9 @@ RewardsInternalsInfo::RewardsInternalsInfo() {}
 RewardsInternalsInfo::RewardsInternalsInfo(const RewardsInternalsInfo& info)
     : payment_id(info.payment_id),
       is_key_info_seed_valid(info.is_key_info_seed_valid),
-      current_reconciles(info.current_reconciles) {
+      boot_stamp(info.boot_stamp),
+      current_reconciles(info.current_reconciles),
+      performance_counters(info.performance_counters) {
 }
 
 RewardsInternalsInfo::~RewardsInternalsInfo() {}
@@ -23,6 +23,7 @@ struct RewardsInternalsInfo {
   uint64_t boot_stamp;
 
   std::map<std::string, ReconcileInfo> current_reconciles;
+  std::map<std::string, uint64_t> performance_counters;
 };
 
 }  // namespace brave_rewards
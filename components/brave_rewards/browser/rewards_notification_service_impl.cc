@@ -10,7 +10,6 @@
 #include <utility>
 
 #include "base/json/json_reader.h"
-#include "base/json/json_writer.h"
 #include "base/rand_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
@@ -19,16 +18,36 @@
 #include "brave/components/brave_rewards/common/pref_names.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
 
 namespace brave_rewards {
 
+namespace {
+
+base::Value SerializeRewardsNotification(
+    const RewardsNotificationService::RewardsNotification&
+        rewards_notification) {
+  base::Value args(base::Value::Type::LIST);
+  for (const auto& arg : rewards_notification.args_) {
+    args.Append(base::Value(arg));
+  }
+
+  base::Value dict(base::Value::Type::DICTIONARY);
+  dict.SetIntKey("type", rewards_notification.type_);
+  dict.SetIntKey("timestamp",
+      static_cast<int>(rewards_notification.timestamp_));
+  dict.SetKey("args", std::move(args));
+  return dict;
+}
+
+}  // namespace
+
 RewardsNotificationServiceImpl::RewardsNotificationServiceImpl(Profile* profile)
     : profile_(profile) {
   ReadRewardsNotificationsJSON();
 }
 
 RewardsNotificationServiceImpl::~RewardsNotificationServiceImpl() {
-  StoreRewardsNotifications();
   if (extension_observer_) {
     RemoveObserver(extension_observer_.get());
   }
@@ -62,11 +81,12 @@ void RewardsNotificationServiceImpl::AddNotification(
   RewardsNotification rewards_notification(
       id, type, GenerateRewardsNotificationTimestamp(), std::move(args));
   rewards_notifications_[id] = rewards_notification;
-  StoreRewardsNotifications();
+  StoreRewardsNotification(rewards_notification);
   OnNotificationAdded(rewards_notification);
 
   if (only_once) {
     rewards_notifications_displayed_.push_back(id);
+    StoreRewardsNotificationDisplayed(id);
   }
 }
 
@@ -82,21 +102,23 @@ void RewardsNotificationServiceImpl::DeleteNotification(
     // clean up, so that we don't have long standing notifications
     if (rewards_notifications_.size() == 1) {
       rewards_notifications_.clear();
+      profile_->GetPrefs()->ClearPref(prefs::kRewardsNotificationsById);
     }
   } else {
     rewards_notification = rewards_notifications_[id];
     rewards_notifications_.erase(id);
+    RemoveStoredRewardsNotification(id);
   }
-  StoreRewardsNotifications();
 
   OnNotificationDeleted(rewards_notification);
 }
 
 void RewardsNotificationServiceImpl::DeleteAllNotifications() {
   rewards_notifications_.clear();
+  profile_->GetPrefs()->ClearPref(prefs::kRewardsNotificationsById);
 #if defined(OS_ANDROID)
   rewards_notifications_displayed_.clear();
-  StoreRewardsNotifications();
+  profile_->GetPrefs()->ClearPref(prefs::kRewardsNotificationsDisplayed);
 #endif
   OnAllNotificationsDeleted();
 }
@@ -133,6 +155,45 @@ RewardsNotificationServiceImpl::GenerateRewardsNotificationTimestamp() const {
 }
 
 void RewardsNotificationServiceImpl::ReadRewardsNotificationsJSON() {
+  PrefService* prefs = profile_->GetPrefs();
+  if (!prefs->GetString(prefs::kRewardsNotifications).empty()) {
+    ReadLegacyRewardsNotificationsJSON();
+    StoreRewardsNotifications();
+    prefs->ClearPref(prefs::kRewardsNotifications);
+    return;
+  }
+
+  const base::Value* notifications =
+      prefs->GetDictionary(prefs::kRewardsNotificationsById);
+  for (const auto& item : notifications->DictItems()) {
+    if (!item.second.is_dict())
+      continue;
+
+    RewardsNotificationArgs notification_args;
+    const base::Value* args =
+        item.second.FindKeyOfType("args", base::Value::Type::LIST);
+    if (args) {
+      for (const auto& arg : args->GetList()) {
+        notification_args.push_back(arg.GetString());
+      }
+    }
+
+    RewardsNotification notification(item.first,
+        static_cast<RewardsNotificationType>(
+            item.second.FindIntKey("type").value_or(0)),
+        item.second.FindIntKey("timestamp").value_or(0),
+        notification_args);
+    rewards_notifications_[notification.id_] = notification;
+  }
+
+  const base::Value* displayed =
+      prefs->GetList(prefs::kRewardsNotificationsDisplayed);
+  for (const auto& it : displayed->GetList()) {
+    rewards_notifications_displayed_.push_back(it.GetString());
+  }
+}
+
+void RewardsNotificationServiceImpl::ReadLegacyRewardsNotificationsJSON() {
   std::string json =
       profile_->GetPrefs()->GetString(prefs::kRewardsNotifications);
   if (json.empty())
@@ -210,37 +271,41 @@ void RewardsNotificationServiceImpl::ReadRewardsNotifications(
 }
 
 void RewardsNotificationServiceImpl::StoreRewardsNotifications() {
-  base::DictionaryValue root;
-
-  auto notifications = std::make_unique<base::ListValue>();
-  for (auto& item : rewards_notifications_) {
-    auto dict = std::make_unique<base::DictionaryValue>();
-    dict->SetString("id", item.second.id_);
-    dict->SetInteger("type", item.second.type_);
-    dict->SetInteger("timestamp", item.second.timestamp_);
-    auto args = std::make_unique<base::ListValue>();
-    for (auto& arg : item.second.args_) {
-      args->AppendString(arg);
-    }
-    dict->SetList("args", std::move(args));
-    notifications->Append(std::move(dict));
+  base::Value notifications(base::Value::Type::DICTIONARY);
+  for (const auto& item : rewards_notifications_) {
+    notifications.SetKey(item.first, SerializeRewardsNotification(item.second));
   }
 
-  auto displayed = std::make_unique<base::ListValue>();
-  for (auto& item : rewards_notifications_displayed_) {
-    displayed->AppendString(item);
+  base::Value displayed(base::Value::Type::LIST);
+  for (const auto& item : rewards_notifications_displayed_) {
+    displayed.Append(base::Value(item));
   }
 
-  root.SetList("notifications", std::move(notifications));
-  root.SetList("displayed", std::move(displayed));
+  PrefService* prefs = profile_->GetPrefs();
+  prefs->Set(prefs::kRewardsNotificationsById, notifications);
+  prefs->Set(prefs::kRewardsNotificationsDisplayed, displayed);
+}
 
-  std::string result;
-  if (!base::JSONWriter::Write(root, &result)) {
-    LOG(ERROR) << "Failed to serialize rewards notifications on shutdown";
-    return;
-  }
+void RewardsNotificationServiceImpl::StoreRewardsNotification(
+    const RewardsNotification& rewards_notification) {
+  DictionaryPrefUpdate update(profile_->GetPrefs(),
+      prefs::kRewardsNotificationsById);
+  update->SetKey(rewards_notification.id_,
+      SerializeRewardsNotification(rewards_notification));
+}
 
-  profile_->GetPrefs()->SetString(prefs::kRewardsNotifications, result);
+void RewardsNotificationServiceImpl::RemoveStoredRewardsNotification(
+    RewardsNotificationID id) {
+  DictionaryPrefUpdate update(profile_->GetPrefs(),
+      prefs::kRewardsNotificationsById);
+  update->RemoveKey(id);
+}
+
+void RewardsNotificationServiceImpl::StoreRewardsNotificationDisplayed(
+    RewardsNotificationID id) {
+  ListPrefUpdate update(profile_->GetPrefs(),
+      prefs::kRewardsNotificationsDisplayed);
+  update->Append(base::Value(id));
 }
 
 bool RewardsNotificationServiceImpl::Exists(RewardsNotificationID id) const {
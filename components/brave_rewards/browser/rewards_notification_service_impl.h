@@ -49,6 +49,14 @@ class RewardsNotificationServiceImpl
   bool Exists(RewardsNotificationID id) const override;
 
  private:
+  // Notifications used to be stored as one JSON string, they are now stored
+  // by ID so that adding or deleting one only updates that entry
+  void ReadLegacyRewardsNotificationsJSON();
+  void StoreRewardsNotification(
+      const RewardsNotification& rewards_notification);
+  void RemoveStoredRewardsNotification(RewardsNotificationID id);
+  void StoreRewardsNotificationDisplayed(RewardsNotificationID id);
+
   bool IsAds(const uint32_t promotion_type);
   std::string GetPromotionIdPrefix(const uint32_t promotion_type);
 
@@ -0,0 +1,109 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/rewards_notification_service_impl.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/values.h"
+#include "brave/components/brave_rewards/browser/test_util.h"
+#include "brave/components/brave_rewards/common/pref_names.h"
+#include "chrome/browser/profiles/profile.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=RewardsNotificationServiceTest.*
+
+namespace brave_rewards {
+
+class RewardsNotificationServiceTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    profile_ = CreateBraveRewardsProfile(temp_dir_.GetPath());
+    ASSERT_TRUE(profile_);
+  }
+
+  std::unique_ptr<RewardsNotificationServiceImpl> CreateService() {
+    return std::make_unique<RewardsNotificationServiceImpl>(profile_.get());
+  }
+
+  PrefService* prefs() { return profile_->GetPrefs(); }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<Profile> profile_;
+};
+
+TEST_F(RewardsNotificationServiceTest, StoresNotificationsById) {
+  auto service = CreateService();
+  service->AddNotification(
+      RewardsNotificationService::REWARDS_NOTIFICATION_AUTO_CONTRIBUTE,
+      {"contribution", "0"}, "contribution_1");
+  service->AddNotification(
+      RewardsNotificationService::REWARDS_NOTIFICATION_GRANT, {},
+      "rewards_notification_grant_1", true);
+  service->DeleteNotification("contribution_1");
+  service.reset();
+
+  const base::Value* stored =
+      prefs()->GetDictionary(prefs::kRewardsNotificationsById);
+  EXPECT_EQ(1u, stored->DictSize());
+  EXPECT_TRUE(stored->FindKey("rewards_notification_grant_1"));
+
+  service = CreateService();
+  EXPECT_FALSE(service->Exists("contribution_1"));
+  ASSERT_TRUE(service->Exists("rewards_notification_grant_1"));
+  EXPECT_EQ(RewardsNotificationService::REWARDS_NOTIFICATION_GRANT,
+            service->GetAllNotifications()
+                .at("rewards_notification_grant_1").type_);
+
+  // Notifications which were displayed once are not added again
+  service->DeleteNotification("rewards_notification_grant_1");
+  service = CreateService();
+  service->AddNotification(
+      RewardsNotificationService::REWARDS_NOTIFICATION_GRANT, {},
+      "rewards_notification_grant_1", true);
+  EXPECT_FALSE(service->Exists("rewards_notification_grant_1"));
+}
+
+TEST_F(RewardsNotificationServiceTest, DeleteAllNotifications) {
+  auto service = CreateService();
+  service->AddNotification(
+      RewardsNotificationService::REWARDS_NOTIFICATION_AUTO_CONTRIBUTE, {},
+      "contribution_1");
+  service->DeleteAllNotifications();
+  service.reset();
+
+  service = CreateService();
+  EXPECT_TRUE(service->GetAllNotifications().empty());
+}
+
+TEST_F(RewardsNotificationServiceTest, MigratesLegacyNotifications) {
+  prefs()->SetString(prefs::kRewardsNotifications,
+      "{\"notifications\":[{\"id\":\"contribution_1\",\"type\":1,"
+      "\"timestamp\":5,\"args\":[\"contribution\"]}],"
+      "\"displayed\":[\"rewards_notification_grant_1\"]}");
+
+  auto service = CreateService();
+  ASSERT_TRUE(service->Exists("contribution_1"));
+  const auto& notification =
+      service->GetAllNotifications().at("contribution_1");
+  EXPECT_EQ(5u, notification.timestamp_);
+  EXPECT_EQ(std::vector<std::string>{"contribution"}, notification.args_);
+
+  EXPECT_TRUE(prefs()->GetString(prefs::kRewardsNotifications).empty());
+  EXPECT_TRUE(prefs()->GetDictionary(prefs::kRewardsNotificationsById)
+                  ->FindKey("contribution_1"));
+  EXPECT_EQ(1u, prefs()->GetList(prefs::kRewardsNotificationsDisplayed)
+                    ->GetList().size());
+}
+
+}  // namespace brave_rewards
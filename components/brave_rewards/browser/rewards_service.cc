@@ -44,6 +44,8 @@ void RewardsService::RemoveObserver(RewardsServiceObserver* observer) {
 // static
 void RewardsService::RegisterProfilePrefs(PrefRegistrySimple* registry) {
   registry->RegisterStringPref(prefs::kRewardsNotifications, "");
+  registry->RegisterDictionaryPref(prefs::kRewardsNotificationsById);
+  registry->RegisterListPref(prefs::kRewardsNotificationsDisplayed);
   registry->RegisterTimeDeltaPref(prefs::kRewardsNotificationTimerInterval,
                                   base::TimeDelta::FromDays(1));
   registry->RegisterTimeDeltaPref(prefs::kRewardsBackupNotificationFrequency,
@@ -65,6 +67,9 @@ void RewardsService::RegisterProfilePrefs(PrefRegistrySimple* registry) {
   registry->RegisterBooleanPref(prefs::kUseRewardsStagingServer, false);
 #endif
   registry->RegisterUint64Pref(prefs::kStatePromotionLastFetchStamp, 0ull);
+  registry->RegisterStringPref(prefs::kStatePromotionETag, "");
+  registry->RegisterStringPref(prefs::kStatePromotionLastModified, "");
+  registry->RegisterStringPref(prefs::kStatePromotionValidatorsUrl, "");
   registry->RegisterBooleanPref(prefs::kStatePromotionCorruptedMigrated, false);
   registry->RegisterBooleanPref(prefs::kStateAnonTransferChecked, false);
   registry->RegisterIntegerPref(prefs::kStateVersion, 0);
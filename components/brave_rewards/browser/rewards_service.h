@@ -135,6 +135,8 @@ class RewardsService : public KeyedService {
       uint64_t reconcile_stamp,
       bool allow_non_verified,
       uint32_t min_visits,
+      const std::string& cursor_publisher_key,
+      double cursor_percentage,
       const GetContentSiteListCallback& callback) = 0;
   virtual void GetExcludedList(const GetContentSiteListCallback& callback) = 0;
   virtual void FetchPromotions() = 0;
@@ -175,22 +177,22 @@ class RewardsService : public KeyedService {
   virtual void SetRewardsMainEnabled(bool enabled) = 0;
   virtual void GetPublisherMinVisitTime(
       const GetPublisherMinVisitTimeCallback& callback) = 0;
-  virtual void SetPublisherMinVisitTime(int duration_in_seconds) const = 0;
+  virtual void SetPublisherMinVisitTime(int duration_in_seconds) = 0;
   virtual void GetPublisherMinVisits(
       const GetPublisherMinVisitsCallback& callback) = 0;
-  virtual void SetPublisherMinVisits(int visits) const = 0;
+  virtual void SetPublisherMinVisits(int visits) = 0;
   virtual void GetPublisherAllowNonVerified(
       const GetPublisherAllowNonVerifiedCallback& callback) = 0;
-  virtual void SetPublisherAllowNonVerified(bool allow) const = 0;
+  virtual void SetPublisherAllowNonVerified(bool allow) = 0;
   virtual void GetPublisherAllowVideos(
       const GetPublisherAllowVideosCallback& callback) = 0;
-  virtual void SetPublisherAllowVideos(bool allow) const = 0;
-  virtual void SetContributionAmount(double amount) const = 0;
-  virtual void SetUserChangedContribution() const = 0;
+  virtual void SetPublisherAllowVideos(bool allow) = 0;
+  virtual void SetContributionAmount(double amount) = 0;
+  virtual void SetUserChangedContribution() = 0;
   virtual void GetAutoContribute(
       GetAutoContributeCallback callback) = 0;
   virtual void SetAutoContribute(bool enabled) = 0;
-  virtual void UpdateAdsRewards() const = 0;
+  virtual void UpdateAdsRewards() = 0;
   virtual void SetTimer(uint64_t time_offset, uint32_t* timer_id) = 0;
   virtual void GetBalanceReport(
       const uint32_t month,
@@ -231,7 +233,7 @@ class RewardsService : public KeyedService {
   virtual void GetPendingContributionsTotal(
     const GetPendingContributionsTotalCallback& callback) = 0;
   virtual void GetRewardsMainEnabled(
-    const GetRewardsMainEnabledCallback& callback) const = 0;
+    const GetRewardsMainEnabledCallback& callback) = 0;
   // TODO(Terry Mancey): remove this hack when ads is moved to the same process
   // as ledger
   virtual void SetCatalogIssuers(
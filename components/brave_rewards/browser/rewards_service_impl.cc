@@ -31,6 +31,7 @@
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
 #include "base/threading/sequenced_task_runner_handle.h"
+#include "base/timer/timer.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/global_constants.h"
 #include "bat/ledger/mojom_structs.h"
@@ -45,6 +46,7 @@
 #include "brave/components/brave_ads/common/pref_names.h"
 #include "brave/components/brave_rewards/browser/android_util.h"
 #include "brave/components/brave_rewards/browser/auto_contribution_props.h"
+#include "brave/components/brave_rewards/browser/background_job_scheduler.h"
 #include "brave/components/brave_rewards/browser/balance_report.h"
 #include "brave/components/brave_rewards/browser/content_site.h"
 #include "brave/components/brave_rewards/browser/publisher_banner.h"
@@ -71,7 +73,9 @@
 #include "content/public/browser/url_data_source.h"
 #include "content/public/common/service_manager_connection.h"
 #include "net/base/escape.h"
+#include "net/base/net_errors.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "net/base/request_priority.h"
 #include "net/base/url_util.h"
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -104,6 +108,27 @@ static const unsigned int kRetriesCountOnNetworkChange = 1;
 
 namespace {
 
+// Responses of the ledger endpoints are small, apart from pages of the
+// publisher list. Anything larger is dropped rather than buffered whole
+const size_t kMaxResponseBodySize = 4 * 1024 * 1024;
+const size_t kMaxPublisherListResponseBodySize = 64 * 1024 * 1024;
+
+size_t GetMaxResponseBodySize(const GURL& url) {
+  if (base::StartsWith(url.path_piece(), "/api/v3/public/channels",
+                       base::CompareCase::SENSITIVE)) {
+    return kMaxPublisherListResponseBodySize;
+  }
+
+  return kMaxResponseBodySize;
+}
+
+// Requests of bat-native-confirmations (token refill, confirmations, payment
+// polling) are background work which can wait for the browser to be idle
+bool IsConfirmationsURL(const GURL& url) {
+  return base::StartsWith(url.path_piece(), "/v1/confirmation/",
+                          base::CompareCase::SENSITIVE);
+}
+
 ContentSite PublisherInfoToContentSite(
     const ledger::PublisherInfo& publisher_info) {
   ContentSite content_site(publisher_info.id);
@@ -273,6 +298,23 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTagForURLLoad() {
 
 const char pref_prefix[] = "brave.rewards.";
 
+// Tab events are sent to the ledger in batches, at most this long after the
+// first event of a batch or once a batch has this many events
+constexpr base::TimeDelta kTabEventsDelay =
+    base::TimeDelta::FromMilliseconds(500);
+const size_t kMaxPendingTabEvents = 64;
+
+// The ledger utility process is stopped after this long without any call
+// into it and started again by the next call
+constexpr base::TimeDelta kLedgerIdleShutdownDelay =
+    base::TimeDelta::FromMinutes(15);
+
+bool IsTabHiddenEvent(bat_ledger::mojom::TabEventType type) {
+  return type == bat_ledger::mojom::TabEventType::UNLOAD ||
+         type == bat_ledger::mojom::TabEventType::HIDE ||
+         type == bat_ledger::mojom::TabEventType::BACKGROUND;
+}
+
 }  // namespace
 
 bool IsMediaLink(const GURL& url,
@@ -323,13 +365,18 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       rewards_database_(new RewardsDatabase(publisher_info_db_path_)),
       notification_service_(new RewardsNotificationServiceImpl(profile)),
       next_timer_id_(0),
-      reset_states_(false) {
+      reset_states_(false),
+      ledger_idle_delay_(kLedgerIdleShutdownDelay) {
   file_task_runner_->PostTask(
       FROM_HERE, base::BindOnce(&EnsureRewardsBaseDirectoryExists,
                                 rewards_base_path_));
   // Set up the rewards data source
   content::URLDataSource::Add(profile_,
                               std::make_unique<BraveRewardsSource>(profile_));
+
+  memory_pressure_listener_.reset(new base::MemoryPressureListener(
+      base::Bind(&RewardsServiceImpl::OnMemoryPressure,
+      base::Unretained(this))));
 }
 
 RewardsServiceImpl::~RewardsServiceImpl() {
@@ -383,16 +430,17 @@ void RewardsServiceImpl::StartLedger() {
   bat_ledger_service_.set_disconnect_handler(
       base::Bind(&RewardsServiceImpl::ConnectionClosed, AsWeakPtr()));
 
-  ledger::Environment environment = ledger::Environment::STAGING;
+  ledger_options_ = bat_ledger::mojom::BatLedgerOptions::New();
+  ledger_options_->environment = ledger::Environment::STAGING;
   // Environment
   #if defined(OFFICIAL_BUILD) && defined(OS_ANDROID)
-    environment = GetServerEnvironmentForAndroid();
+    ledger_options_->environment = GetServerEnvironmentForAndroid();
   #elif defined(OFFICIAL_BUILD)
-    environment = ledger::Environment::PRODUCTION;
+    ledger_options_->environment = ledger::Environment::PRODUCTION;
   #endif
-  SetEnvironment(environment);
-
-  SetDebug(false);
+  ledger_options_->is_debug = false;
+  ledger_options_->reconcile_time = 0;
+  ledger_options_->short_retries = false;
 
   const base::CommandLine& command_line =
       *base::CommandLine::ForCurrentProcess();
@@ -406,7 +454,8 @@ void RewardsServiceImpl::StartLedger() {
   }
 
   bat_ledger_service_->Create(std::move(client_ptr_info),
-      MakeRequest(&bat_ledger_));
+      MakeRequest(&bat_ledger_),
+      std::move(ledger_options_));
 
   auto callback = base::BindOnce(&RewardsServiceImpl::OnWalletInitialized,
       AsWeakPtr());
@@ -518,6 +567,10 @@ void RewardsServiceImpl::CreateWalletAttestationResult(
     OnWalletInitialized(ledger::Result::SAFETYNET_ATTESTATION_FAILED);
     return;
   }
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->CreateWallet(std::move(callback));
 }
 #endif
@@ -529,6 +582,8 @@ void RewardsServiceImpl::GetContentSiteList(
     uint64_t reconcile_stamp,
     bool allow_non_verified,
     uint32_t min_visits,
+    const std::string& cursor_publisher_key,
+    double cursor_percentage,
     const GetContentSiteListCallback& callback) {
   auto filter = ledger::ActivityInfoFilter::New();
   filter->min_duration = min_visit_time;
@@ -539,6 +594,15 @@ void RewardsServiceImpl::GetContentSiteList(
   filter->percent = 1;
   filter->non_verified = allow_non_verified;
   filter->min_visits = min_visits;
+  if (!cursor_publisher_key.empty()) {
+    filter->cursor = ledger::ActivityInfoCursor::New(
+        cursor_percentage,
+        cursor_publisher_key);
+  }
+
+  if (!Connected()) {
+    return;
+  }
 
   bat_ledger_->GetActivityInfoList(
       start,
@@ -551,6 +615,10 @@ void RewardsServiceImpl::GetContentSiteList(
 
 void RewardsServiceImpl::GetExcludedList(
     const GetContentSiteListCallback& callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetExcludedList(base::BindOnce(
       &RewardsServiceImpl::OnGetContentSiteList,
       AsWeakPtr(),
@@ -588,42 +656,76 @@ void RewardsServiceImpl::OnLoad(SessionID tab_id, const GURL& url) {
   data->path = url.path();
   data->tab_id = tab_id.id();
   data->url = publisher_url;
+  // The ledger needs the tab events which happened before this load
+  SendTabEvents();
   bat_ledger_->OnLoad(std::move(data), GetCurrentTimestamp());
 }
 
 void RewardsServiceImpl::OnUnload(SessionID tab_id) {
-  if (!Connected())
-    return;
-
-  bat_ledger_->OnUnload(tab_id.id(), GetCurrentTimestamp());
+  AddTabEvent(bat_ledger::mojom::TabEventType::UNLOAD, tab_id);
 }
 
 void RewardsServiceImpl::OnShow(SessionID tab_id) {
-  if (!Connected())
-    return;
-
-  bat_ledger_->OnShow(tab_id.id(), GetCurrentTimestamp());
+  AddTabEvent(bat_ledger::mojom::TabEventType::SHOW, tab_id);
 }
 
 void RewardsServiceImpl::OnHide(SessionID tab_id) {
-  if (!Connected())
-    return;
-
-  bat_ledger_->OnHide(tab_id.id(), GetCurrentTimestamp());
+  AddTabEvent(bat_ledger::mojom::TabEventType::HIDE, tab_id);
 }
 
 void RewardsServiceImpl::OnForeground(SessionID tab_id) {
+  AddTabEvent(bat_ledger::mojom::TabEventType::FOREGROUND, tab_id);
+}
+
+void RewardsServiceImpl::OnBackground(SessionID tab_id) {
+  AddTabEvent(bat_ledger::mojom::TabEventType::BACKGROUND, tab_id);
+}
+
+void RewardsServiceImpl::AddTabEvent(
+    bat_ledger::mojom::TabEventType type,
+    SessionID tab_id) {
   if (!Connected())
     return;
 
-  bat_ledger_->OnForeground(tab_id.id(), GetCurrentTimestamp());
+  // The ledger ignores a hide for a tab which is already hidden, e.g. the
+  // background event which follows a hide when a window is minimized
+  if (type != bat_ledger::mojom::TabEventType::UNLOAD &&
+      IsTabHiddenEvent(type) && !pending_tab_events_.empty() &&
+      pending_tab_events_.back()->tab_id == tab_id.id() &&
+      IsTabHiddenEvent(pending_tab_events_.back()->type)) {
+    return;
+  }
+
+  pending_tab_events_.push_back(bat_ledger::mojom::TabEvent::New(
+      type, tab_id.id(), GetCurrentTimestamp()));
+
+  if (pending_tab_events_.size() >= kMaxPendingTabEvents) {
+    SendTabEvents();
+    return;
+  }
+
+  if (!tab_events_timer_)
+    tab_events_timer_ = std::make_unique<base::OneShotTimer>();
+  if (!tab_events_timer_->IsRunning()) {
+    tab_events_timer_->Start(FROM_HERE, kTabEventsDelay,
+        base::BindOnce(&RewardsServiceImpl::SendTabEvents,
+            base::Unretained(this)));
+  }
 }
 
-void RewardsServiceImpl::OnBackground(SessionID tab_id) {
+void RewardsServiceImpl::SendTabEvents() {
+  if (tab_events_timer_)
+    tab_events_timer_->Stop();
+
+  if (pending_tab_events_.empty())
+    return;
+
+  std::vector<bat_ledger::mojom::TabEventPtr> events;
+  events.swap(pending_tab_events_);
   if (!Connected())
     return;
 
-  bat_ledger_->OnBackground(tab_id.id(), GetCurrentTimestamp());
+  bat_ledger_->OnTabEvents(std::move(events));
 }
 
 void RewardsServiceImpl::OnPostData(SessionID tab_id,
@@ -650,6 +752,7 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
   data->path = url.spec(),
   data->tab_id = tab_id.id();
 
+  SendTabEvents();
   bat_ledger_->OnPostData(url.spec(),
                           first_party_url.spec(),
                           referrer.spec(),
@@ -664,6 +767,14 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
   if (!Connected())
     return;
 
+  // Nearly all resource loads are not media activity, so they are filtered
+  // here rather than parsed and sent to the ledger process to be discarded
+  if (!ledger::Ledger::IsMediaXHRLoad(url.spec(),
+                                      first_party_url.spec(),
+                                      referrer.spec())) {
+    return;
+  }
+
   std::map<std::string, std::string> parts;
 
   for (net::QueryIterator it(url); !it.IsAtEnd(); it.Advance()) {
@@ -674,6 +785,7 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
   data->path = url.spec();
   data->tab_id = tab_id.id();
 
+  SendTabEvents();
   bat_ledger_->OnXHRLoad(tab_id.id(),
                          url.spec(),
                          base::MapToFlatMap(parts),
@@ -708,6 +820,10 @@ std::string RewardsServiceImpl::URIEncode(const std::string& value) {
 }
 
 void RewardsServiceImpl::Shutdown() {
+  if (ledger_idle_timer_)
+    ledger_idle_timer_->Stop();
+  ledger_stopped_for_idle_ = false;
+
   RemoveObserver(notification_service_.get());
 
   if (extension_observer_) {
@@ -731,6 +847,7 @@ void RewardsServiceImpl::Shutdown() {
   }
   url_loaders_.clear();
 
+  SendTabEvents();
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
@@ -819,6 +936,8 @@ void RewardsServiceImpl::OnGetRewardsInternalsInfo(
   rewards_internals_info->payment_id = info->payment_id;
   rewards_internals_info->is_key_info_seed_valid = info->is_key_info_seed_valid;
   rewards_internals_info->boot_stamp = info->boot_stamp;
+  rewards_internals_info->performance_counters =
+      base::FlatMapToMap(info->performance_counters);
 
   // TODO(https://github.com/brave/brave-browser/issues/8633)
   // add active contributions
@@ -1023,10 +1142,30 @@ void RewardsServiceImpl::LoadURL(
     return;
   }
 
+  if (IsConfirmationsURL(parsed_url)) {
+    BackgroundJobScheduler::GetInstance()->RunWhenIdle(
+        base::BindOnce(&RewardsServiceImpl::StartURLLoader, AsWeakPtr(),
+            url, headers, content, contentType, method, callback));
+    return;
+  }
+
+  StartURLLoader(url, headers, content, contentType, method, callback);
+}
+
+void RewardsServiceImpl::StartURLLoader(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& content,
+    const std::string& content_type,
+    const ledger::UrlMethod method,
+    ledger::LoadURLCallback callback) {
+  const GURL parsed_url(url);
   const std::string request_method = URLMethodToRequestType(method);
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = GURL(url);
   request->method = request_method;
+  // Rewards traffic happens in the background, let page loads go first
+  request->priority = net::LOWEST;
 
   // Loading Twitter requires credentials
   if (request->url.DomainIs("twitter.com")) {
@@ -1053,16 +1192,17 @@ void RewardsServiceImpl::LoadURL(
       network::SimpleURLLoader::RetryMode::RETRY_ON_NETWORK_CHANGE);
 
   if (!content.empty()) {
-    loader->AttachStringForUpload(content, contentType);
+    loader->AttachStringForUpload(content, content_type);
   }
 
-  loader->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
+  loader->DownloadToString(
       content::BrowserContext::GetDefaultStoragePartition(profile_)
           ->GetURLLoaderFactoryForBrowserProcess().get(),
       base::BindOnce(&RewardsServiceImpl::OnURLLoaderComplete,
                      base::Unretained(this),
                      loader,
-                     callback));
+                     callback),
+      GetMaxResponseBodySize(parsed_url));
 }
 
 void RewardsServiceImpl::OnURLLoaderComplete(
@@ -1080,12 +1220,20 @@ void RewardsServiceImpl::OnURLLoaderComplete(
   std::unique_ptr<network::SimpleURLLoader> scoped_loader(loader);
 
   ledger::UrlResponse response;
-  response.body = response_body ? *response_body : "";
+  if (response_body) {
+    response.body = std::move(*response_body);
+  }
 
   int response_code = -1;
   if (loader->ResponseInfo() && loader->ResponseInfo()->headers) {
     response_code = loader->ResponseInfo()->headers->response_code();
   }
+  // A body over the size limit is a failed request, not an empty response
+  if (loader->NetError() == net::ERR_INSUFFICIENT_RESOURCES) {
+    VLOG(0) << "Response body of " << loader->GetFinalURL().spec()
+            << " is too large";
+    response_code = -1;
+  }
   response.status_code = response_code;
 
   const auto url = loader->GetFinalURL();
@@ -1278,6 +1426,10 @@ void RewardsServiceImpl::OnAttestationAndroid(
   std::string json;
   base::JSONWriter::Write(solution, &json);
 
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->AttestPromotion(
       promotion_id,
       json,
@@ -1407,7 +1559,7 @@ void RewardsServiceImpl::SetRewardsMainEnabled(bool enabled) {
 }
 
 void RewardsServiceImpl::GetRewardsMainEnabled(
-    const GetRewardsMainEnabledCallback& callback) const {
+    const GetRewardsMainEnabledCallback& callback) {
   if (!Connected()) {
     return;
   }
@@ -1707,7 +1859,7 @@ void RewardsServiceImpl::GetPublisherMinVisitTime(
 }
 
 void RewardsServiceImpl::SetPublisherMinVisitTime(
-    int duration_in_seconds) const {
+    int duration_in_seconds) {
   if (!Connected()) {
     return;
   }
@@ -1724,7 +1876,7 @@ void RewardsServiceImpl::GetPublisherMinVisits(
   bat_ledger_->GetPublisherMinVisits(callback);
 }
 
-void RewardsServiceImpl::SetPublisherMinVisits(int visits) const {
+void RewardsServiceImpl::SetPublisherMinVisits(int visits) {
   if (!Connected()) {
     return;
   }
@@ -1741,7 +1893,7 @@ void RewardsServiceImpl::GetPublisherAllowNonVerified(
   bat_ledger_->GetPublisherAllowNonVerified(callback);
 }
 
-void RewardsServiceImpl::SetPublisherAllowNonVerified(bool allow) const {
+void RewardsServiceImpl::SetPublisherAllowNonVerified(bool allow) {
   if (!Connected()) {
     return;
   }
@@ -1758,7 +1910,7 @@ void RewardsServiceImpl::GetPublisherAllowVideos(
   bat_ledger_->GetPublisherAllowVideos(callback);
 }
 
-void RewardsServiceImpl::SetPublisherAllowVideos(bool allow) const {
+void RewardsServiceImpl::SetPublisherAllowVideos(bool allow) {
   if (!Connected()) {
     return;
   }
@@ -1766,7 +1918,7 @@ void RewardsServiceImpl::SetPublisherAllowVideos(bool allow) const {
   bat_ledger_->SetPublisherAllowVideos(allow);
 }
 
-void RewardsServiceImpl::SetContributionAmount(const double amount) const {
+void RewardsServiceImpl::SetContributionAmount(const double amount) {
   if (!Connected()) {
     return;
   }
@@ -1778,7 +1930,7 @@ void RewardsServiceImpl::SetContributionAmount(const double amount) const {
 // TODO(brave): Remove me (and pure virtual definition)
 // see https://github.com/brave/brave-core/commit/c4ef62c954a64fca18ae83ff8ffd611137323420#diff-aa3505dbf36b5d03d8ba0751e0c99904R385
 // and https://github.com/brave-intl/bat-native-ledger/commit/27f3ceb471d61c84052737ff201fe18cb9a6af32#diff-e303122e010480b2226895b9470891a3R135
-void RewardsServiceImpl::SetUserChangedContribution() const {
+void RewardsServiceImpl::SetUserChangedContribution() {
   if (!Connected()) {
     return;
   }
@@ -1844,11 +1996,20 @@ void RewardsServiceImpl::SetTimer(uint64_t time_offset,
 }
 
 void RewardsServiceImpl::OnTimer(uint32_t timer_id) {
+  timers_.erase(timer_id);
+
+  // Every ledger timer (contribution queue, publisher list and promotion
+  // refresh, ...) fires through here, none of them is urgent
+  BackgroundJobScheduler::GetInstance()->RunWhenIdle(
+      base::BindOnce(&RewardsServiceImpl::RunLedgerTimer, AsWeakPtr(),
+          timer_id));
+}
+
+void RewardsServiceImpl::RunLedgerTimer(uint32_t timer_id) {
   if (!Connected()) {
     return;
   }
 
-  timers_.erase(timer_id);
   bat_ledger_->OnTimer(timer_id);
 }
 
@@ -1886,6 +2047,10 @@ void RewardsServiceImpl::GetBalanceReport(
     const uint32_t month,
     const uint32_t year,
     GetBalanceReportCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetBalanceReport(
       static_cast<ledger::ActivityMonth>(month),
       year,
@@ -2081,6 +2246,10 @@ void RewardsServiceImpl::SaveRecurringTip(
   info->amount = amount;
   info->created_at = GetCurrentTimestamp();
 
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->SaveRecurringTip(
       std::move(info),
       base::BindOnce(&RewardsServiceImpl::OnSaveRecurringTip,
@@ -2110,6 +2279,10 @@ void RewardsServiceImpl::SaveInlineMediaInfo(
     const std::string& media_type,
     const std::map<std::string, std::string>& args,
     SaveMediaInfoCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->SaveMediaInfo(
       media_type,
       base::MapToFlatMap(args),
@@ -2135,6 +2308,10 @@ void RewardsServiceImpl::OnGetRecurringTips(
 
 void RewardsServiceImpl::GetRecurringTips(
     GetRecurringTipsCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetRecurringTips(
       base::BindOnce(&RewardsServiceImpl::OnGetRecurringTips,
                      AsWeakPtr(),
@@ -2157,6 +2334,10 @@ void RewardsServiceImpl::OnGetOneTimeTips(
 }
 
 void RewardsServiceImpl::GetOneTimeTips(GetOneTimeTipsCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetOneTimeTips(
       base::BindOnce(&RewardsServiceImpl::OnGetOneTimeTips,
                      AsWeakPtr(),
@@ -2182,7 +2363,7 @@ void RewardsServiceImpl::RemoveRecurringTip(
                AsWeakPtr()));
 }
 
-void RewardsServiceImpl::UpdateAdsRewards() const {
+void RewardsServiceImpl::UpdateAdsRewards() {
   if (!Connected()) {
     return;
   }
@@ -2270,6 +2451,10 @@ void RewardsServiceImpl::OnNotificationTimerFired() {
 }
 
 void RewardsServiceImpl::MaybeShowNotificationAddFunds() {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->HasSufficientBalanceToReconcile(
       base::BindOnce(&RewardsServiceImpl::ShowNotificationAddFunds,
         AsWeakPtr()));
@@ -2277,6 +2462,10 @@ void RewardsServiceImpl::MaybeShowNotificationAddFunds() {
 
 void RewardsServiceImpl::MaybeShowNotificationAddFundsForTesting(
     base::OnceCallback<void(bool)> callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->HasSufficientBalanceToReconcile(
       base::BindOnce(
           &RewardsServiceImpl::OnMaybeShowNotificationAddFundsForTesting,
@@ -2411,6 +2600,17 @@ void RewardsServiceImpl::HandleFlags(const std::string& options) {
       SetShortRetries(short_retries);
     }
 
+    if (name == "idle-shutdown-delay") {
+      int seconds;
+      bool success = base::StringToInt(value, &seconds);
+
+      if (success && seconds >= 0) {
+        ledger_idle_delay_ = base::TimeDelta::FromSeconds(seconds);
+      }
+
+      continue;
+    }
+
     if (name == "uphold-token") {
       std::string token = base::ToLowerASCII(value);
 
@@ -2445,6 +2645,10 @@ void RewardsServiceImpl::SetBackupCompleted() {
 
 void RewardsServiceImpl::GetRewardsInternalsInfo(
     GetRewardsInternalsInfoCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetRewardsInternalsInfo(
       base::BindOnce(&RewardsServiceImpl::OnGetRewardsInternalsInfo,
                      AsWeakPtr(), std::move(callback)));
@@ -2466,6 +2670,10 @@ void RewardsServiceImpl::OnTip(
   info->provider = site->provider;
   info->favicon_url = site->favicon_url;
 
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->SavePublisherInfo(
       std::move(info),
       base::BindOnce(&RewardsServiceImpl::OnTipPublisherSaved,
@@ -2496,13 +2704,72 @@ void RewardsServiceImpl::OnTip(
     return;
   }
 
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->OneTimeTip(publisher_key, amount, base::DoNothing());
 }
 
-bool RewardsServiceImpl::Connected() const {
+bool RewardsServiceImpl::Connected() {
+  if (ledger_stopped_for_idle_) {
+    VLOG(1) << "Restarting idle ledger";
+    ledger_stopped_for_idle_ = false;
+    StartLedger();
+  }
+
+  RestartLedgerIdleTimer();
   return bat_ledger_.is_bound();
 }
 
+void RewardsServiceImpl::RestartLedgerIdleTimer() {
+  if (ledger_idle_delay_.is_zero()) {
+    return;
+  }
+
+  if (!ledger_idle_timer_)
+    ledger_idle_timer_ = std::make_unique<base::OneShotTimer>();
+  ledger_idle_timer_->Start(FROM_HERE, ledger_idle_delay_,
+      base::BindOnce(&RewardsServiceImpl::OnLedgerIdle, AsWeakPtr()));
+}
+
+void RewardsServiceImpl::OnLedgerIdle() {
+  if (!bat_ledger_.is_bound()) {
+    return;
+  }
+
+  // The ledger keeps no state of its own across restarts, everything it
+  // needs is written through the client, so only wait for those writes
+  if (!url_loaders_.empty() || pending_db_transactions_ > 0) {
+    RestartLedgerIdleTimer();
+    return;
+  }
+
+  VLOG(1) << "Stopping idle ledger";
+  bat_ledger_.reset();
+  bat_ledger_client_binding_.Close();
+  bat_ledger_service_.reset();
+  ledger_stopped_for_idle_ = true;
+}
+
+void RewardsServiceImpl::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  if (!bat_ledger_.is_bound()) {
+    return;
+  }
+
+  switch (memory_pressure_level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      return;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      bat_ledger_->OnMemoryPressure(ledger::MemoryPressureLevel::MODERATE);
+      return;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      bat_ledger_->OnMemoryPressure(ledger::MemoryPressureLevel::CRITICAL);
+      return;
+  }
+}
+
 void RewardsServiceImpl::SetLedgerEnvForTesting() {
   bat_ledger_service_->SetTesting();
 
@@ -2518,6 +2785,10 @@ void RewardsServiceImpl::SetLedgerEnvForTesting() {
 }
 
 void RewardsServiceImpl::StartMonthlyContributionForTest() {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->StartMonthlyContribution();
 }
 
@@ -2550,23 +2821,47 @@ void RewardsServiceImpl::GetShortRetries(
 }
 
 void RewardsServiceImpl::SetEnvironment(ledger::Environment environment) {
+  if (ledger_options_) {
+    ledger_options_->environment = environment;
+    return;
+  }
+
   bat_ledger_service_->SetEnvironment(environment);
 }
 
 void RewardsServiceImpl::SetDebug(bool debug) {
+  if (ledger_options_) {
+    ledger_options_->is_debug = debug;
+    return;
+  }
+
   bat_ledger_service_->SetDebug(debug);
 }
 
 void RewardsServiceImpl::SetReconcileTime(int32_t time) {
+  if (ledger_options_) {
+    ledger_options_->reconcile_time = time;
+    return;
+  }
+
   bat_ledger_service_->SetReconcileTime(time);
 }
 
 void RewardsServiceImpl::SetShortRetries(bool short_retries) {
+  if (ledger_options_) {
+    ledger_options_->short_retries = short_retries;
+    return;
+  }
+
   bat_ledger_service_->SetShortRetries(short_retries);
 }
 
 void RewardsServiceImpl::GetPendingContributionsTotal(
     const GetPendingContributionsTotalCallback& callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetPendingContributionsTotal(std::move(callback));
 }
 
@@ -2615,12 +2910,20 @@ RewardsServiceImpl::GetAllNotifications() {
 
 void RewardsServiceImpl::SetInlineTipSetting(const std::string& key,
                                              bool enabled) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->SetInlineTipSetting(key, enabled);
 }
 
 void RewardsServiceImpl::GetInlineTipSetting(
       const std::string& key,
       GetInlineTipSettingCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetInlineTipSetting(
       key,
       base::BindOnce(&RewardsServiceImpl::OnInlineTipSetting,
@@ -2638,6 +2941,10 @@ void RewardsServiceImpl::GetShareURL(
       const std::string& type,
       const std::map<std::string, std::string>& args,
       GetShareURLCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetShareURL(
       type,
       base::MapToFlatMap(args),
@@ -2686,6 +2993,10 @@ void RewardsServiceImpl::OnGetPendingContributions(
 
 void RewardsServiceImpl::GetPendingContributions(
     GetPendingContributionsCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetPendingContributions(
       base::BindOnce(&RewardsServiceImpl::OnGetPendingContributions,
                      AsWeakPtr(),
@@ -2700,6 +3011,10 @@ void RewardsServiceImpl::OnPendingContributionRemoved(
 }
 
 void RewardsServiceImpl::RemovePendingContribution(const uint64_t id) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->RemovePendingContribution(
       id,
       base::BindOnce(&RewardsServiceImpl::OnPendingContributionRemoved,
@@ -2714,6 +3029,10 @@ void RewardsServiceImpl::OnRemoveAllPendingContributions(
 }
 
 void RewardsServiceImpl::RemoveAllPendingContributions() {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->RemoveAllPendingContributions(
       base::BindOnce(&RewardsServiceImpl::OnRemoveAllPendingContributions,
                      AsWeakPtr()));
@@ -2784,6 +3103,10 @@ void RewardsServiceImpl::OnFetchBalance(FetchBalanceCallback callback,
 }
 
 void RewardsServiceImpl::FetchBalance(FetchBalanceCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->FetchBalance(
       base::BindOnce(&RewardsServiceImpl::OnFetchBalance,
                      AsWeakPtr(),
@@ -2888,6 +3211,10 @@ void RewardsServiceImpl::OnGetExternalWallet(
 
 void RewardsServiceImpl::GetExternalWallet(const std::string& wallet_type,
                                            GetExternalWalletCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetExternalWallet(wallet_type,
       base::BindOnce(&RewardsServiceImpl::OnGetExternalWallet,
                      AsWeakPtr(),
@@ -2907,6 +3234,10 @@ void RewardsServiceImpl::ExternalWalletAuthorization(
       const std::string& wallet_type,
       const std::map<std::string, std::string>& args,
       ExternalWalletAuthorizationCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->ExternalWalletAuthorization(
       wallet_type,
       base::MapToFlatMap(args),
@@ -2984,6 +3315,10 @@ void RewardsServiceImpl::OnDisconnectWallet(
 }
 
 void RewardsServiceImpl::DisconnectWallet(const std::string& wallet_type) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->DisconnectWallet(
       wallet_type,
       base::BindOnce(&RewardsServiceImpl::OnDisconnectWallet,
@@ -3151,6 +3486,10 @@ bool RewardsServiceImpl::OnlyAnonWallet() {
 }
 
 void RewardsServiceImpl::RecordBackendP3AStats() {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetRecurringTips(
       base::BindOnce(&RewardsServiceImpl::OnRecordBackendP3AStatsRecurring,
           AsWeakPtr()));
@@ -3158,6 +3497,10 @@ void RewardsServiceImpl::RecordBackendP3AStats() {
 
 void RewardsServiceImpl::OnRecordBackendP3AStatsRecurring(
     ledger::PublisherInfoList list) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetAllContributions(
       base::BindOnce(&RewardsServiceImpl::OnRecordBackendP3AStatsContributions,
           AsWeakPtr(),
@@ -3252,6 +3595,10 @@ void RewardsServiceImpl::UnblindedTokensReady() {
 
 void RewardsServiceImpl::GetAnonWalletStatus(
     GetAnonWalletStatusCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetAnonWalletStatus(
       base::BindOnce(&RewardsServiceImpl::OnGetAnonWalletStatus,
                      AsWeakPtr(),
@@ -3268,6 +3615,10 @@ void RewardsServiceImpl::GetMonthlyReport(
     const uint32_t month,
     const uint32_t year,
     GetMonthlyReportCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetMonthlyReport(
       static_cast<ledger::ActivityMonth>(month),
       year,
@@ -3368,6 +3719,7 @@ ledger::DBCommandResponsePtr RunDBTransactionOnFileTaskRunner(
 void RewardsServiceImpl::RunDBTransaction(
     ledger::DBTransactionPtr transaction,
     ledger::RunDBTransactionCallback callback) {
+  pending_db_transactions_++;
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -3382,6 +3734,7 @@ void RewardsServiceImpl::RunDBTransaction(
 void RewardsServiceImpl::OnRunDBTransaction(
     ledger::RunDBTransactionCallback callback,
     ledger::DBCommandResponsePtr response) {
+  pending_db_transactions_--;
   callback(std::move(response));
 }
 
@@ -3407,6 +3760,10 @@ void RewardsServiceImpl::ForTestingSetTestResponseCallback(
 
 void RewardsServiceImpl::GetAllMonthlyReportIds(
       GetAllMonthlyReportIdsCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetAllMonthlyReportIds(
       base::BindOnce(&RewardsServiceImpl::OnGetAllMonthlyReportIds,
                      AsWeakPtr(),
@@ -3420,6 +3777,10 @@ void RewardsServiceImpl::OnGetAllMonthlyReportIds(
 }
 
 void RewardsServiceImpl::GetAllPromotions(GetAllPromotionsCallback callback) {
+  if (!Connected()) {
+    return;
+  }
+
   bat_ledger_->GetAllPromotions(
       base::BindOnce(&RewardsServiceImpl::OnGetAllPromotions,
                      AsWeakPtr(),
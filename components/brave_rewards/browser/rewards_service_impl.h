@@ -18,6 +18,8 @@
 #include "base/files/file_path.h"
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
+#include "base/time/time.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
@@ -134,6 +136,8 @@ class RewardsServiceImpl : public RewardsService,
       uint64_t reconcile_stamp,
       bool allow_non_verified,
       uint32_t min_visits,
+      const std::string& cursor_publisher_key,
+      double cursor_percentage,
       const GetContentSiteListCallback& callback) override;
 
   void GetExcludedList(const GetContentSiteListCallback& callback) override;
@@ -213,7 +217,7 @@ class RewardsServiceImpl : public RewardsService,
   void GetPendingContributionsTotal(
       const GetPendingContributionsTotalCallback& callback) override;
   void GetRewardsMainEnabled(
-      const GetRewardsMainEnabledCallback& callback) const override;
+      const GetRewardsMainEnabledCallback& callback) override;
 
   void GetOneTimeTips(GetOneTimeTipsCallback callback) override;
   void RefreshPublisher(
@@ -233,7 +237,7 @@ class RewardsServiceImpl : public RewardsService,
     GetAllNotifications() override;
   void ResetTheWholeState(const base::Callback<void(bool)>& callback) override;
 
-  void SetContributionAmount(const double amount) const override;
+  void SetContributionAmount(const double amount) override;
 
   void SaveInlineMediaInfo(
       const std::string& media_type,
@@ -269,7 +273,7 @@ class RewardsServiceImpl : public RewardsService,
       const double amount,
       const bool recurring) override;
 
-  void SetPublisherMinVisitTime(int duration_in_seconds) const override;
+  void SetPublisherMinVisitTime(int duration_in_seconds) override;
 
   void FetchBalance(FetchBalanceCallback callback) override;
 
@@ -354,6 +358,7 @@ class RewardsServiceImpl : public RewardsService,
                                  ledger::PublisherInfoListCallback callback,
                                  ledger::PublisherInfoList list);
   void OnTimer(uint32_t timer_id);
+  void RunLedgerTimer(uint32_t timer_id);
   void OnSavedState(ledger::ResultCallback callback, bool success);
   void OnLoadedState(ledger::OnLoadCallback callback,
                      const std::string& value);
@@ -389,10 +394,19 @@ class RewardsServiceImpl : public RewardsService,
     GetPendingContributionsCallback callback,
     ledger::PendingContributionInfoList list);
 
+  void StartURLLoader(const std::string& url,
+                     const std::vector<std::string>& headers,
+                     const std::string& content,
+                     const std::string& content_type,
+                     const ledger::UrlMethod method,
+                     ledger::LoadURLCallback callback);
   void OnURLLoaderComplete(network::SimpleURLLoader* loader,
                            ledger::LoadURLCallback callback,
                            std::unique_ptr<std::string> response_body);
 
+  void AddTabEvent(bat_ledger::mojom::TabEventType type, SessionID tab_id);
+  void SendTabEvents();
+
   void StartNotificationTimers(bool main_enabled);
   void StopNotificationTimers();
   void OnNotificationTimerFired();
@@ -494,11 +508,11 @@ class RewardsServiceImpl : public RewardsService,
       const ledger::UrlMethod method,
       ledger::LoadURLCallback callback) override;
   void SetRewardsMainEnabled(bool enabled) override;
-  void SetPublisherMinVisits(int visits) const override;
-  void SetPublisherAllowNonVerified(bool allow) const override;
-  void SetPublisherAllowVideos(bool allow) const override;
-  void SetUserChangedContribution() const override;
-  void UpdateAdsRewards() const override;
+  void SetPublisherMinVisits(int visits) override;
+  void SetPublisherAllowNonVerified(bool allow) override;
+  void SetPublisherAllowVideos(bool allow) override;
+  void SetUserChangedContribution() override;
+  void UpdateAdsRewards() override;
   void SetCatalogIssuers(
       const std::string& json) override;
   void ConfirmAd(
@@ -632,7 +646,14 @@ class RewardsServiceImpl : public RewardsService,
       const std::string& publisher_key,
       const std::string& publisher_name) override;
 
-  bool Connected() const;
+  // Starts the ledger again when it was stopped for being idle, so every
+  // call into it has to check this first
+  bool Connected();
+  void RestartLedgerIdleTimer();
+  void OnLedgerIdle();
+  // Passed on to a running ledger only, a stopped one holds nothing
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
   void ConnectionClosed();
   void AddPrivateObserver(RewardsServicePrivateObserver* observer) override;
   void RemovePrivateObserver(RewardsServicePrivateObserver* observer) override;
@@ -688,6 +709,8 @@ class RewardsServiceImpl : public RewardsService,
       bat_ledger_client_binding_;
   bat_ledger::mojom::BatLedgerAssociatedPtr bat_ledger_;
   mojo::Remote<bat_ledger::mojom::BatLedgerService> bat_ledger_service_;
+  // Settings made while the ledger is starting, sent with Create
+  bat_ledger::mojom::BatLedgerOptionsPtr ledger_options_;
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
@@ -707,10 +730,18 @@ class RewardsServiceImpl : public RewardsService,
       current_media_fetchers_;
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
+  // Tab visibility events waiting to be sent to the ledger in one batch
+  std::vector<bat_ledger::mojom::TabEventPtr> pending_tab_events_;
+  std::unique_ptr<base::OneShotTimer> tab_events_timer_;
 
   uint32_t next_timer_id_;
   bool reset_states_;
   bool is_wallet_initialized_ = false;
+  std::unique_ptr<base::OneShotTimer> ledger_idle_timer_;
+  base::TimeDelta ledger_idle_delay_;
+  bool ledger_stopped_for_idle_ = false;
+  int pending_db_transactions_ = 0;
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   GetTestResponseCallback test_response_callback_;
 
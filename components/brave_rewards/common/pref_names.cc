@@ -12,6 +12,9 @@ const char kHideBraveRewardsButton[] = "brave.hide_brave_rewards_button";
 const char kBraveRewardsEnabled[] = "brave.rewards.enabled";
 const char kBraveRewardsEnabledMigrated[] = "brave.rewards.enabled_migrated";
 const char kRewardsNotifications[] = "brave.rewards.notifications";
+const char kRewardsNotificationsById[] = "brave.rewards.notifications_by_id";
+const char kRewardsNotificationsDisplayed[] =
+    "brave.rewards.notifications_displayed";
 const char kRewardsNotificationTimerInterval[]=
     "brave.rewards.notification_timer_interval";
 const char kRewardsBackupNotificationFrequency[] =
@@ -33,6 +36,11 @@ const char kRewardsBadgeText[] = "brave.rewards.badge_text";
 const char kUseRewardsStagingServer[] = "brave.rewards.use_staging_server";
 const char kStatePromotionLastFetchStamp[] =
     "brave.rewards.promotion_last_fetch_stamp";
+const char kStatePromotionETag[] = "brave.rewards.promotion_etag";
+const char kStatePromotionLastModified[] =
+    "brave.rewards.promotion_last_modified";
+const char kStatePromotionValidatorsUrl[] =
+    "brave.rewards.promotion_validators_url";
 const char kStatePromotionCorruptedMigrated[] =
     "brave.rewards.promotion_corrupted_migrated2";
 const char kStateAnonTransferChecked[] =  "brave.rewards.anon_transfer_checked";
@@ -13,6 +13,8 @@ extern const char kHideBraveRewardsButton[];
 extern const char kBraveRewardsEnabled[];
 extern const char kBraveRewardsEnabledMigrated[];
 extern const char kRewardsNotifications[];
+extern const char kRewardsNotificationsById[];
+extern const char kRewardsNotificationsDisplayed[];
 extern const char kRewardsNotificationTimerInterval[];
 extern const char kRewardsBackupNotificationFrequency[];
 extern const char kRewardsBackupNotificationInterval[];
@@ -27,6 +29,9 @@ extern const char kRewardsBadgeText[];
 extern const char kStateServerPublisherListStamp[];
 extern const char kStateUpholdAnonAddress[];
 extern const char kStatePromotionLastFetchStamp[];
+extern const char kStatePromotionETag[];
+extern const char kStatePromotionLastModified[];
+extern const char kStatePromotionValidatorsUrl[];
 extern const char kStatePromotionCorruptedMigrated[];
 extern const char kStateAnonTransferChecked[];
 extern const char kStateVersion[];
@@ -11,6 +11,7 @@ import { Contributions } from './contributions'
 import { WalletInfo } from './walletInfo'
 import { Balance } from './balance'
 import { Promotions } from './promotions'
+import { PerformanceCounters } from './performanceCounters'
 
 // Utils
 import { getLocale } from '../../../../common/locale'
@@ -53,6 +54,7 @@ export class RewardsInternalsPage extends React.Component<Props, {}> {
           <br/>
           <button type='button' onClick={this.onRefresh}>{getLocale('refreshButton')}</button>
           <Contributions items={info.currentReconciles} />
+          <PerformanceCounters counters={info.performanceCounters} />
         </div>)
     } else {
       return (
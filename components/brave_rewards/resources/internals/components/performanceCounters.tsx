@@ -0,0 +1,33 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+
+// Utils
+import { getLocale } from '../../../../common/locale'
+
+interface Props {
+  counters: Record<string, number>
+}
+
+const getCounters = (counters: Record<string, number>) => {
+  let items = []
+  for (const key of Object.keys(counters).sort()) {
+    items.push(<div key={'counter-' + key}> {key}: {counters[key]} </div>)
+  }
+
+  return items
+}
+
+export const PerformanceCounters = (props: Props) => {
+  if (!props.counters) {
+    return null
+  }
+
+  return (
+    <>
+      <h3>{getLocale('performanceCounters')}</h3>
+      {getCounters(props.counters)}
+    </>)
+}
@@ -16,7 +16,8 @@ const defaultState: RewardsInternals.State = {
     isKeyInfoSeedValid: false,
     walletPaymentId: '',
     currentReconciles: [],
-    bootStamp: 0
+    bootStamp: 0,
+    performanceCounters: {}
   },
   promotions: []
 }
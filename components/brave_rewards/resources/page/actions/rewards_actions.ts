@@ -89,6 +89,10 @@ export const onContributeList = (list: Rewards.Publisher[]) => action(types.ON_C
   list
 })
 
+export const onContributeListPage = (list: Rewards.Publisher[]) => action(types.ON_CONTRIBUTE_LIST_PAGE, {
+  list
+})
+
 export const onExcludedList = (list: Rewards.ExcludedPublisher[]) => action(types.ON_EXCLUDED_LIST, {
   list
 })
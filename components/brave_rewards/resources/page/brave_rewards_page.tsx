@@ -89,6 +89,10 @@ window.cr.define('brave_rewards', function () {
     getActions().onContributeList(list)
   }
 
+  function contributeListPage (list: Rewards.Publisher[]) {
+    getActions().onContributeListPage(list)
+  }
+
   function excludedList (list: Rewards.ExcludedPublisher[]) {
     getActions().onExcludedList(list)
   }
@@ -262,6 +266,7 @@ window.cr.define('brave_rewards', function () {
     promotionFinish,
     reconcileStamp,
     contributeList,
+    contributeListPage,
     excludedList,
     balanceReport,
     walletExists,
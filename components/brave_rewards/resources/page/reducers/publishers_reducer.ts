@@ -19,6 +19,14 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
 
       state.autoContributeList = action.payload.list
       break
+    case types.ON_CONTRIBUTE_LIST_PAGE:
+      if (!action.payload.list || action.payload.list.length === 0) {
+        break
+      }
+
+      state = { ...state }
+      state.autoContributeList = state.autoContributeList.concat(action.payload.list)
+      break
     case types.ON_EXCLUDED_LIST: {
       if (!action.payload.list) {
         break
@@ -10,103 +10,71 @@
 #include <utility>
 #include <vector>
 
+#include "base/atomic_sequence_num.h"
 #include "base/bind.h"
+#include "base/feature_list.h"
+#include "base/hash/sha1.h"
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/json/json_reader.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/vendor/adblock_rust_ffi/src/wrapper.hpp"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
-#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
-#include "url/origin.h"
 
 using brave_component_updater::BraveComponent;
 using content::BrowserThread;
-using namespace net::registry_controlled_domains;  // NOLINT
+
+namespace brave_shields {
 
 namespace {
 
-std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
-  std::string filter_option = "";
-  switch (resource_type) {
-    // top level page
-    case blink::mojom::ResourceType::kMainFrame:
-      filter_option = "main_frame";
-      break;
-    // frame or iframe
-    case blink::mojom::ResourceType::kSubFrame:
-      filter_option = "sub_frame";
-      break;
-    // a CSS stylesheet
-    case blink::mojom::ResourceType::kStylesheet:
-      filter_option = "stylesheet";
-      break;
-    // an external script
-    case blink::mojom::ResourceType::kScript:
-      filter_option = "script";
-      break;
-    // an image (jpg/gif/png/etc)
-    case blink::mojom::ResourceType::kFavicon:
-    case blink::mojom::ResourceType::kImage:
-      filter_option = "image";
-      break;
-    // a font
-    case blink::mojom::ResourceType::kFontResource:
-      filter_option = "font";
-      break;
-    // an "other" subresource.
-    case blink::mojom::ResourceType::kSubResource:
-      filter_option = "other";
-      break;
-    // an object (or embed) tag for a plugin.
-    case blink::mojom::ResourceType::kObject:
-      filter_option = "object";
-      break;
-    // a media resource.
-    case blink::mojom::ResourceType::kMedia:
-      filter_option = "media";
-      break;
-    // a XMLHttpRequest
-    case blink::mojom::ResourceType::kXhr:
-      filter_option = "xhr";
-      break;
-    // a ping request for <a ping>/sendBeacon.
-    case blink::mojom::ResourceType::kPing:
-      filter_option = "ping";
-      break;
-    // the main resource of a dedicated worker.
-    case blink::mojom::ResourceType::kWorker:
-    // the main resource of a shared worker.
-    case blink::mojom::ResourceType::kSharedWorker:
-    // an explicitly requested prefetch
-    case blink::mojom::ResourceType::kPrefetch:
-    // the main resource of a service worker.
-    case blink::mojom::ResourceType::kServiceWorker:
-    // a report of Content Security Policy violations.
-    case blink::mojom::ResourceType::kCspReport:
-    // a resource that a plugin requested.
-    case blink::mojom::ResourceType::kPluginResource:
-    default:
-      break;
-  }
-  return filter_option;
+// Number of request decisions remembered per engine.
+constexpr size_t kDecisionCacheSize = 1000;
+// Number of hostnames whose cosmetic resources are remembered per engine.
+constexpr size_t kCosmeticResourcesCacheSize = 100;
+
+// Engine generations are unique across all services, so a set of them
+// identifies exactly which engines a result was computed from.
+base::AtomicSequenceNumber g_engine_generations;
+
+std::string GetDecisionCacheKey(const AdBlockRequest& request) {
+  // The tab host is part of the key rather than just its eTLD+1 because
+  // $domain options can target subdomains.
+  return request.resource_type + " " + request.tab_host + " " + request.spec;
 }
 
 }  // namespace
 
-namespace brave_shields {
+AdBlockBaseService::EngineSnapshot::EngineSnapshot() = default;
+
+AdBlockBaseService::EngineSnapshot::EngineSnapshot(
+    const EngineSnapshot& other) = default;
+
+AdBlockBaseService::EngineSnapshot::~EngineSnapshot() = default;
 
 AdBlockBaseService::AdBlockBaseService(BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
       ad_block_client_(new adblock::Engine()),
+      parallel_matching_enabled_(
+          base::FeatureList::IsEnabled(features::kBraveAdblockParallelMatching)),
+      decision_cache_(
+          std::make_shared<ShardedLookupCache<AdBlockMatchResult>>(
+              kDecisionCacheSize)),
+      cosmetic_resources_cache_(std::make_shared<
+          ShardedLookupCache<std::shared_ptr<const base::Value>>>(
+          kCosmeticResourcesCacheSize)),
+      engine_generation_(g_engine_generations.GetNext()),
       weak_factory_(this) {}
 
 AdBlockBaseService::~AdBlockBaseService() {
@@ -114,7 +82,70 @@ AdBlockBaseService::~AdBlockBaseService() {
 }
 
 void AdBlockBaseService::Cleanup() {
-  GetTaskRunner()->DeleteSoon(FROM_HERE, ad_block_client_.release());
+  base::AutoLock lock(ad_block_client_lock_);
+  // Drop our reference on the shields task runner, readers still holding a
+  // snapshot release theirs wherever they are.
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce([](std::shared_ptr<adblock::Engine> ad_block_client) {},
+                     std::move(ad_block_client_)));
+}
+
+bool AdBlockBaseService::IsParallelMatchingEnabled() const {
+  return parallel_matching_enabled_;
+}
+
+std::shared_ptr<adblock::Engine> AdBlockBaseService::GetAdBlockClient() const {
+  base::AutoLock lock(ad_block_client_lock_);
+  return ad_block_client_;
+}
+
+AdBlockBaseService::EngineSnapshot
+AdBlockBaseService::GetEngineSnapshot() const {
+  base::AutoLock lock(ad_block_client_lock_);
+  EngineSnapshot snapshot;
+  snapshot.ad_block_client = ad_block_client_;
+  snapshot.decision_cache = decision_cache_;
+  return snapshot;
+}
+
+LookupCacheStats AdBlockBaseService::GetDecisionCacheStats() const {
+  base::AutoLock lock(ad_block_client_lock_);
+  LookupCacheStats stats = decision_cache_->GetStats();
+  stats.hits += retired_decision_cache_stats_.hits;
+  stats.misses += retired_decision_cache_stats_.misses;
+  return stats;
+}
+
+LookupCacheStats AdBlockBaseService::GetCosmeticResourcesCacheStats() const {
+  base::AutoLock lock(ad_block_client_lock_);
+  LookupCacheStats stats = cosmetic_resources_cache_->GetStats();
+  stats.hits += retired_cosmetic_resources_cache_stats_.hits;
+  stats.misses += retired_cosmetic_resources_cache_stats_.misses;
+  return stats;
+}
+
+int AdBlockBaseService::GetEngineGeneration() const {
+  base::AutoLock lock(ad_block_client_lock_);
+  return engine_generation_;
+}
+
+void AdBlockBaseService::ResetCachesLocked() {
+  ad_block_client_lock_.AssertAcquired();
+  engine_generation_ = g_engine_generations.GetNext();
+  LookupCacheStats stats = decision_cache_->GetStats();
+  retired_decision_cache_stats_.hits += stats.hits;
+  retired_decision_cache_stats_.misses += stats.misses;
+  decision_cache_ =
+      std::make_shared<ShardedLookupCache<AdBlockMatchResult>>(
+          kDecisionCacheSize);
+
+  stats = cosmetic_resources_cache_->GetStats();
+  retired_cosmetic_resources_cache_stats_.hits += stats.hits;
+  retired_cosmetic_resources_cache_stats_.misses += stats.misses;
+  cosmetic_resources_cache_ = std::make_shared<
+      ShardedLookupCache<std::shared_ptr<const base::Value>>>(
+      kCosmeticResourcesCacheSize);
 }
 
 bool AdBlockBaseService::ShouldStartRequest(
@@ -124,40 +155,85 @@ bool AdBlockBaseService::ShouldStartRequest(
     bool* did_match_exception,
     bool* cancel_request_explicitly,
     std::string* mock_data_url) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  return ShouldStartRequest(AdBlockRequest(url, resource_type, tab_host),
+                            did_match_exception, cancel_request_explicitly,
+                            mock_data_url);
+}
 
-  // Determine third-party here so the library doesn't need to figure it out.
-  // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
-  // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url,
-      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
-      INCLUDE_PRIVATE_REGISTRIES);
-  bool explicit_cancel;
-  bool saved_from_exception;
-  if (ad_block_client_->matches(
-          url.spec(), url.host(), tab_host, is_third_party,
-          ResourceTypeToString(resource_type), &explicit_cancel,
-          &saved_from_exception, mock_data_url)) {
-    if (cancel_request_explicitly) {
-      *cancel_request_explicitly = explicit_cancel;
-    }
-    // We'd only possibly match an exception filter if we're returning true.
-    if (did_match_exception) {
-      *did_match_exception = false;
+bool AdBlockBaseService::ShouldStartRequest(const AdBlockRequest& request,
+                                            bool* did_match_exception,
+                                            bool* cancel_request_explicitly,
+                                            std::string* mock_data_url) {
+  return ShouldStartRequest(request, did_match_exception,
+                            cancel_request_explicitly, mock_data_url, nullptr);
+}
+
+bool AdBlockBaseService::ShouldStartRequest(const AdBlockRequest& request,
+                                            bool* did_match_exception,
+                                            bool* cancel_request_explicitly,
+                                            std::string* mock_data_url,
+                                            bool* decision_cache_hit) {
+  DCHECK(parallel_matching_enabled_ ||
+         GetTaskRunner()->RunsTasksInCurrentSequence());
+  return ShouldStartRequest(GetEngineSnapshot(), request, did_match_exception,
+                            cancel_request_explicitly, mock_data_url,
+                            decision_cache_hit);
+}
+
+// static
+bool AdBlockBaseService::ShouldStartRequest(const EngineSnapshot& snapshot,
+                                            const AdBlockRequest& request,
+                                            bool* did_match_exception,
+                                            bool* cancel_request_explicitly,
+                                            std::string* mock_data_url) {
+  return ShouldStartRequest(snapshot, request, did_match_exception,
+                            cancel_request_explicitly, mock_data_url, nullptr);
+}
+
+// static
+bool AdBlockBaseService::ShouldStartRequest(const EngineSnapshot& snapshot,
+                                            const AdBlockRequest& request,
+                                            bool* did_match_exception,
+                                            bool* cancel_request_explicitly,
+                                            std::string* mock_data_url,
+                                            bool* decision_cache_hit) {
+  if (!snapshot.ad_block_client) {
+    return true;
+  }
+
+  const std::string key = GetDecisionCacheKey(request);
+  AdBlockMatchResult result;
+  const bool cache_hit =
+      snapshot.decision_cache->Get(request.tab_host, key, &result);
+  if (decision_cache_hit) {
+    *decision_cache_hit = cache_hit;
+  }
+  if (!cache_hit) {
+    bool explicit_cancel = false;
+    bool saved_from_exception = false;
+    result.should_block = snapshot.ad_block_client->matches(
+        request.spec, request.host, request.tab_host, request.is_third_party,
+        request.resource_type, &explicit_cancel, &saved_from_exception,
+        &result.mock_data_url);
+    if (result.should_block) {
+      result.cancel_request_explicitly = explicit_cancel;
+    } else {
+      // We'd only possibly match an exception filter if we're returning true.
+      result.did_match_exception = saved_from_exception;
     }
-    // LOG(ERROR) << "AdBlockBaseService::ShouldStartRequest(), host: "
-    //  << tab_host
-    //  << ", resource type: " << resource_type
-    //  << ", url.spec(): " << url.spec();
-    return false;
+    snapshot.decision_cache->Put(request.tab_host, key, result);
   }
 
+  if (result.should_block && cancel_request_explicitly) {
+    *cancel_request_explicitly = result.cancel_request_explicitly;
+  }
   if (did_match_exception) {
-    *did_match_exception = saved_from_exception;
+    *did_match_exception = result.did_match_exception;
   }
-
-  return true;
+  if (mock_data_url && !result.mock_data_url.empty()) {
+    *mock_data_url = result.mock_data_url;
+  }
+  return !result.should_block;
 }
 
 void AdBlockBaseService::EnableTag(const std::string& tag, bool enabled) {
@@ -169,16 +245,28 @@ void AdBlockBaseService::EnableTag(const std::string& tag, bool enabled) {
   }
 
   if (enabled) {
-    ad_block_client_->addTag(tag);
+    if (!parallel_matching_enabled_) {
+      base::AutoLock lock(ad_block_client_lock_);
+      ad_block_client_->addTag(tag);
+      ResetCachesLocked();
+    }
     tags_.push_back(tag);
   } else {
-    ad_block_client_->removeTag(tag);
+    if (!parallel_matching_enabled_) {
+      base::AutoLock lock(ad_block_client_lock_);
+      ad_block_client_->removeTag(tag);
+      ResetCachesLocked();
+    }
     std::vector<std::string>::iterator it =
         std::find(tags_.begin(), tags_.end(), tag);
     if (it != tags_.end()) {
       tags_.erase(it);
     }
   }
+
+  if (parallel_matching_enabled_) {
+    RebuildAdBlockClient();
+  }
 }
 
 void AdBlockBaseService::AddResources(const std::string& resources) {
@@ -189,8 +277,14 @@ void AdBlockBaseService::AddResources(const std::string& resources) {
     return;
   }
 
-  ad_block_client_->addResources(resources);
   resources_ = resources;
+  if (parallel_matching_enabled_) {
+    RebuildAdBlockClient();
+    return;
+  }
+  base::AutoLock lock(ad_block_client_lock_);
+  ad_block_client_->addResources(resources);
+  ResetCachesLocked();
 }
 
 bool AdBlockBaseService::TagExists(const std::string& tag) {
@@ -199,59 +293,207 @@ bool AdBlockBaseService::TagExists(const std::string& tag) {
 
 base::Optional<base::Value> AdBlockBaseService::HostnameCosmeticResources(
         const std::string& hostname) {
-  return base::JSONReader::Read(
-          this->ad_block_client_->hostnameCosmeticResources(hostname));
+  std::shared_ptr<adblock::Engine> ad_block_client;
+  std::shared_ptr<ShardedLookupCache<std::shared_ptr<const base::Value>>>
+      cosmetic_resources_cache;
+  {
+    base::AutoLock lock(ad_block_client_lock_);
+    ad_block_client = ad_block_client_;
+    cosmetic_resources_cache = cosmetic_resources_cache_;
+  }
+  if (!ad_block_client) {
+    return base::Optional<base::Value>();
+  }
+
+  // Keyed by the full hostname, hostname-specific filters can target
+  // subdomains of a site.
+  std::shared_ptr<const base::Value> resources;
+  if (!cosmetic_resources_cache->Get(hostname, hostname, &resources)) {
+    base::Optional<base::Value> parsed = base::JSONReader::Read(
+        ad_block_client->hostnameCosmeticResources(hostname));
+    if (!parsed) {
+      return base::Optional<base::Value>();
+    }
+    resources = std::make_shared<const base::Value>(std::move(*parsed));
+    cosmetic_resources_cache->Put(hostname, hostname, resources);
+  }
+  // Callers merge other lists into the result, so hand out a copy.
+  return resources->Clone();
 }
 
 base::Optional<base::Value> AdBlockBaseService::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
+  // Nothing can match, so skip the engine call and the JSON parse of its
+  // empty result.
+  if (classes.empty() && ids.empty()) {
+    return base::Value(base::Value::Type::LIST);
+  }
+  std::shared_ptr<adblock::Engine> ad_block_client = GetAdBlockClient();
+  if (!ad_block_client) {
+    return base::Optional<base::Value>();
+  }
   return base::JSONReader::Read(
-          this->ad_block_client_->hiddenClassIdSelectors(classes,
-                                                         ids,
-                                                         exceptions));
+          ad_block_client->hiddenClassIdSelectors(classes,
+                                                  ids,
+                                                  exceptions));
+}
+
+AdBlockBaseService::DATFileLoadResult::DATFileLoadResult() = default;
+
+AdBlockBaseService::DATFileLoadResult::DATFileLoadResult(
+    DATFileLoadResult&& other) = default;
+
+AdBlockBaseService::DATFileLoadResult::~DATFileLoadResult() = default;
+
+// static
+AdBlockBaseService::DATFileLoadResult AdBlockBaseService::LoadDATFileData(
+    const base::FilePath& dat_file_path,
+    const std::string& current_hash,
+    bool keep_dat_buffer) {
+  DATFileLoadResult result;
+  // Deserialize straight from the mapping rather than reading the whole list
+  // into a heap buffer first.
+  std::unique_ptr<base::MemoryMappedFile> dat_file =
+      brave_component_updater::MapDATFile(dat_file_path);
+  if (!dat_file) {
+    return result;
+  }
+
+  unsigned char hash[base::kSHA1Length];
+  base::SHA1HashBytes(dat_file->data(), dat_file->length(), hash);
+  result.dat_hash.assign(reinterpret_cast<const char*>(hash), sizeof(hash));
+  if (result.dat_hash == current_hash) {
+    // Component updates often bring the same list again, don't pay for
+    // deserializing it and keeping two copies of the engine around.
+    result.unchanged = true;
+    return result;
+  }
+
+  const base::TimeTicks load_start = base::TimeTicks::Now();
+  auto ad_block_client = std::make_unique<adblock::Engine>();
+  if (ad_block_client->deserialize(
+          reinterpret_cast<const char*>(dat_file->data()),
+          dat_file->length())) {
+    result.ad_block_client = std::move(ad_block_client);
+  }
+  result.load_time = base::TimeTicks::Now() - load_start;
+  if (keep_dat_buffer) {
+    result.dat_buffer.assign(dat_file->data(),
+                             dat_file->data() + dat_file->length());
+  }
+  return result;
 }
 
 void AdBlockBaseService::GetDATFileData(const base::FilePath& dat_file_path) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
-      base::BindOnce(&brave_component_updater::LoadDATFileData<adblock::Engine>,
-                     dat_file_path),
+      base::BindOnce(&AdBlockBaseService::LoadDATFileData, dat_file_path,
+                     dat_hash_, parallel_matching_enabled_),
       base::BindOnce(&AdBlockBaseService::OnGetDATFileData,
                      weak_factory_.GetWeakPtr()));
 }
 
-void AdBlockBaseService::OnGetDATFileData(GetDATFileDataResult result) {
-  if (result.second.empty()) {
+void AdBlockBaseService::OnGetDATFileData(DATFileLoadResult result) {
+  if (result.unchanged) {
+    VLOG(1) << "Ad block data is unchanged";
+    return;
+  }
+  if (result.dat_hash.empty()) {
     LOG(ERROR) << "Could not obtain ad block data";
     return;
   }
-  if (!result.first.get()) {
+  if (!result.ad_block_client) {
     LOG(ERROR) << "Failed to deserialize ad block data";
     return;
   }
+  UMA_HISTOGRAM_TIMES("Brave.Shields.AdBlock.EngineLoadTime",
+                      result.load_time);
+  dat_hash_ = std::move(result.dat_hash);
   GetTaskRunner()->PostTask(
       FROM_HERE, base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
                                 base::Unretained(this),
-                                std::move(result.first)));
+                                std::move(result.ad_block_client),
+                                std::move(result.dat_buffer)));
 }
 
 void AdBlockBaseService::UpdateAdBlockClient(
+    std::unique_ptr<adblock::Engine> ad_block_client,
+    brave_component_updater::DATFileDataBuffer dat_buffer) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  if (parallel_matching_enabled_) {
+    dat_buffer_ = std::move(dat_buffer);
+    rules_.clear();
+  }
+  PublishAdBlockClient(std::move(ad_block_client));
+}
+
+void AdBlockBaseService::PublishAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client) {
+  // Finish setting up the engine before anyone else can see it.
+  AddKnownTagsToAdBlockInstance(ad_block_client.get());
+  AddKnownResourcesToAdBlockInstance(ad_block_client.get());
+  std::shared_ptr<adblock::Engine> old_ad_block_client;
+  {
+    base::AutoLock lock(ad_block_client_lock_);
+    old_ad_block_client = std::move(ad_block_client_);
+    ad_block_client_ = std::move(ad_block_client);
+    ResetCachesLocked();
+  }
+  // |old_ad_block_client| goes away here unless a reader still holds it.
+}
+
+std::unique_ptr<adblock::Engine> AdBlockBaseService::CreateAdBlockClient()
+    const {
+  if (!dat_buffer_.empty()) {
+    auto ad_block_client = std::make_unique<adblock::Engine>();
+    if (ad_block_client->deserialize(
+            reinterpret_cast<const char*>(&dat_buffer_.front()),
+            dat_buffer_.size())) {
+      return ad_block_client;
+    }
+    LOG(ERROR) << "Failed to deserialize ad block data";
+  }
+  if (!rules_.empty()) {
+    return std::make_unique<adblock::Engine>(rules_);
+  }
+  return std::make_unique<adblock::Engine>();
+}
+
+void AdBlockBaseService::RebuildAdBlockClient() {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_ = std::move(ad_block_client);
-  AddKnownTagsToAdBlockInstance();
-  AddKnownResourcesToAdBlockInstance();
+  PublishAdBlockClient(CreateAdBlockClient());
+}
+
+void AdBlockBaseService::ResetAdBlockClientWithRules(
+    const std::string& rules) {
+  if (parallel_matching_enabled_) {
+    dat_buffer_.clear();
+    rules_ = rules;
+  }
+  PublishAdBlockClient(std::make_unique<adblock::Engine>(rules));
+}
+
+void AdBlockBaseService::UnloadAdBlockClient() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  dat_hash_.clear();
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::ResetAdBlockClientWithRules,
+                     base::Unretained(this), std::string()));
 }
 
-void AdBlockBaseService::AddKnownTagsToAdBlockInstance() {
+void AdBlockBaseService::AddKnownTagsToAdBlockInstance(
+    adblock::Engine* ad_block_client) {
   std::for_each(tags_.begin(), tags_.end(),
-                [&](const std::string tag) { ad_block_client_->addTag(tag); });
+                [&](const std::string tag) { ad_block_client->addTag(tag); });
 }
 
-void AdBlockBaseService::AddKnownResourcesToAdBlockInstance() {
-  ad_block_client_->addResources(resources_);
+void AdBlockBaseService::AddKnownResourcesToAdBlockInstance(
+    adblock::Engine* ad_block_client) {
+  ad_block_client->addResources(resources_);
 }
 
 bool AdBlockBaseService::Init() {
@@ -263,12 +505,12 @@ void AdBlockBaseService::ResetForTest(const std::string& rules,
   // This is temporary until adblock-rust supports incrementally adding
   // filter rules to an existing instance. At which point the hack below
   // will dissapear.
-  ad_block_client_.reset(new adblock::Engine(rules));
-  AddKnownTagsToAdBlockInstance();
   if (!resources.empty()) {
     resources_ = resources;
   }
-  AddKnownResourcesToAdBlockInstance();
+  // The next component update has to be loaded even if it's the same list.
+  dat_hash_.clear();
+  ResetAdBlockClientWithRules(rules);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -16,8 +16,12 @@
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
 #include "base/values.h"
+#include "brave/components/brave_shields/browser/ad_block_request.h"
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 
@@ -34,9 +38,6 @@ namespace brave_shields {
 // checking and init.
 class AdBlockBaseService : public BaseBraveShieldsService {
  public:
-  using GetDATFileDataResult =
-      brave_component_updater::LoadDATFileDataResult<adblock::Engine>;
-
   explicit AdBlockBaseService(BraveComponent::Delegate* delegate);
   ~AdBlockBaseService() override;
 
@@ -46,10 +47,63 @@ class AdBlockBaseService : public BaseBraveShieldsService {
                           bool* did_match_exception,
                           bool* cancel_request_explicitly,
                           std::string* mock_data_url) override;
+  // Same as above for a request whose matching context was already computed.
+  bool ShouldStartRequest(const AdBlockRequest& request,
+                          bool* did_match_exception,
+                          bool* cancel_request_explicitly,
+                          std::string* mock_data_url);
+  bool ShouldStartRequest(const AdBlockRequest& request,
+                          bool* did_match_exception,
+                          bool* cancel_request_explicitly,
+                          std::string* mock_data_url,
+                          bool* decision_cache_hit);
+  // An engine together with the decisions cached for it, which stays usable
+  // from any thread for as long as it is held.
+  struct EngineSnapshot {
+    EngineSnapshot();
+    EngineSnapshot(const EngineSnapshot& other);
+    ~EngineSnapshot();
+
+    std::shared_ptr<adblock::Engine> ad_block_client;
+    std::shared_ptr<ShardedLookupCache<AdBlockMatchResult>> decision_cache;
+  };
+
+  // Same as above against a snapshot taken with GetEngineSnapshot().
+  static bool ShouldStartRequest(const EngineSnapshot& snapshot,
+                                 const AdBlockRequest& request,
+                                 bool* did_match_exception,
+                                 bool* cancel_request_explicitly,
+                                 std::string* mock_data_url);
+  // Same as above, returning whether the decision came from the cache in
+  // |decision_cache_hit|.
+  static bool ShouldStartRequest(const EngineSnapshot& snapshot,
+                                 const AdBlockRequest& request,
+                                 bool* did_match_exception,
+                                 bool* cancel_request_explicitly,
+                                 std::string* mock_data_url,
+                                 bool* decision_cache_hit);
   void AddResources(const std::string& resources);
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
 
+  // Whether requests may be matched from any thread pool worker rather than
+  // only on the shields task runner.
+  bool IsParallelMatchingEnabled() const;
+
+  // Returns the engine currently published to readers. Engines are never
+  // modified after being published in parallel matching mode, so the
+  // snapshot can be used from any thread for as long as it is held.
+  std::shared_ptr<adblock::Engine> GetAdBlockClient() const;
+  EngineSnapshot GetEngineSnapshot() const;
+
+  // Hits and misses are totals since startup, size and capacity are for the
+  // cache of the current engine.
+  LookupCacheStats GetDecisionCacheStats() const;
+  LookupCacheStats GetCosmeticResourcesCacheStats() const;
+  // Changes whenever the engine, its tags or its resources change, unique
+  // across all services.
+  int GetEngineGeneration() const;
+
   base::Optional<base::Value> HostnameCosmeticResources(
           const std::string& hostname);
   base::Optional<base::Value> HiddenClassIdSelectors(
@@ -63,20 +117,82 @@ class AdBlockBaseService : public BaseBraveShieldsService {
   void Cleanup() override;
 
   void GetDATFileData(const base::FilePath& dat_file_path);
-  void AddKnownTagsToAdBlockInstance();
-  void AddKnownResourcesToAdBlockInstance();
+  void AddKnownTagsToAdBlockInstance(adblock::Engine* ad_block_client);
+  void AddKnownResourcesToAdBlockInstance(adblock::Engine* ad_block_client);
   void ResetForTest(const std::string& rules, const std::string& resources);
-
-  std::unique_ptr<adblock::Engine> ad_block_client_;
+  // Replaces the engine with one built from |rules|. Must be called on the
+  // shields task runner.
+  void ResetAdBlockClientWithRules(const std::string& rules);
+  // Replaces the engine with an empty one to release its memory. The next
+  // DAT file is loaded even if it has the list that was unloaded.
+  void UnloadAdBlockClient();
+
+  // Only replaced on the shields task runner, and always under
+  // |ad_block_client_lock_| so readers on other threads can take a snapshot.
+  // Outside parallel matching mode tags and resources are still applied to
+  // it in place.
+  std::shared_ptr<adblock::Engine> ad_block_client_;
 
  private:
   void UpdateAdBlockClient(
-      std::unique_ptr<adblock::Engine> ad_block_client);
-  void OnGetDATFileData(GetDATFileDataResult result);
+      std::unique_ptr<adblock::Engine> ad_block_client,
+      brave_component_updater::DATFileDataBuffer dat_buffer);
+  void PublishAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client);
+  // Builds a fresh engine from the last loaded list, used instead of
+  // modifying a published engine in place.
+  std::unique_ptr<adblock::Engine> CreateAdBlockClient() const;
+  void RebuildAdBlockClient();
+  // Drops every cached decision and cosmetic resource. Must be called with
+  // |ad_block_client_lock_| held whenever the engine or its tags and
+  // resources change.
+  void ResetCachesLocked();
+  // Result of reading a DAT file. When the file has the contents the current
+  // engine was built from nothing is deserialized and |unchanged| is set.
+  struct DATFileLoadResult {
+    DATFileLoadResult();
+    DATFileLoadResult(DATFileLoadResult&& other);
+    ~DATFileLoadResult();
+
+    std::unique_ptr<adblock::Engine> ad_block_client;
+    // Only kept when it's needed to rebuild the engine.
+    brave_component_updater::DATFileDataBuffer dat_buffer;
+    std::string dat_hash;
+    bool unchanged = false;
+    // Time spent deserializing the engine.
+    base::TimeDelta load_time;
+
+    DISALLOW_COPY_AND_ASSIGN(DATFileLoadResult);
+  };
+  static DATFileLoadResult LoadDATFileData(const base::FilePath& dat_file_path,
+                                           const std::string& current_hash,
+                                           bool keep_dat_buffer);
+  void OnGetDATFileData(DATFileLoadResult result);
   void OnPreferenceChanges(const std::string& pref_name);
 
   std::vector<std::string> tags_;
   std::string resources_;
+  // Hash of the DAT file the current engine was built from, used on the UI
+  // thread to skip component updates that don't change the list.
+  std::string dat_hash_;
+  // Source of the current engine, kept in parallel matching mode so that
+  // tag and resource changes can rebuild it. Only one of them is set.
+  brave_component_updater::DATFileDataBuffer dat_buffer_;
+  std::string rules_;
+  const bool parallel_matching_enabled_;
+  mutable base::Lock ad_block_client_lock_;
+  // Results of ShouldStartRequest() for |ad_block_client_|. It is replaced
+  // together with the engine so that a reader still matching against an old
+  // snapshot can't put a stale decision into the new cache.
+  std::shared_ptr<ShardedLookupCache<AdBlockMatchResult>> decision_cache_;
+  // Parsed HostnameCosmeticResources() results for |ad_block_client_|,
+  // replaced the same way.
+  std::shared_ptr<ShardedLookupCache<std::shared_ptr<const base::Value>>>
+      cosmetic_resources_cache_;
+  // Hits and misses of the caches that were replaced.
+  LookupCacheStats retired_decision_cache_stats_;
+  LookupCacheStats retired_cosmetic_resources_cache_stats_;
+  // Guarded by |ad_block_client_lock_|.
+  int engine_generation_;
   base::WeakPtrFactory<AdBlockBaseService> weak_factory_;
   DISALLOW_COPY_AND_ASSIGN(AdBlockBaseService);
 };
@@ -5,7 +5,13 @@
 
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "base/logging.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -44,19 +50,57 @@ bool AdBlockCustomFiltersService::UpdateCustomFilters(
     return false;
   local_state->SetString(kAdBlockCustomFilters, custom_filters);
 
+  {
+    base::AutoLock lock(pending_custom_filters_lock_);
+    const bool update_posted = pending_custom_filters_.has_value();
+    pending_custom_filters_ = custom_filters;
+    if (update_posted)
+      return true;
+  }
+
   GetTaskRunner()->PostTask(
       FROM_HERE,
       base::BindOnce(
           &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
-          base::Unretained(this), custom_filters));
+          base::Unretained(this)));
 
   return true;
 }
 
-void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
+// static
+std::string AdBlockCustomFiltersService::NormalizeCustomFilters(
     const std::string& custom_filters) {
+  std::vector<std::string> rules = base::SplitString(
+      custom_filters, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  // "!" starts a comment and "[" a list header like "[Adblock Plus 2.0]".
+  rules.erase(std::remove_if(rules.begin(), rules.end(),
+                             [](const std::string& rule) {
+                               return rule[0] == '!' || rule[0] == '[';
+                             }),
+              rules.end());
+  // The engine doesn't depend on the order of the rules.
+  std::sort(rules.begin(), rules.end());
+  rules.erase(std::unique(rules.begin(), rules.end()), rules.end());
+  return base::JoinString(rules, "\n");
+}
+
+void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner() {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  std::string custom_filters;
+  {
+    base::AutoLock lock(pending_custom_filters_lock_);
+    DCHECK(pending_custom_filters_);
+    custom_filters = std::move(*pending_custom_filters_);
+    pending_custom_filters_.reset();
+  }
+
+  // Saving the settings page without edits to the rules shouldn't rebuild
+  // the engine.
+  std::string rules = NormalizeCustomFilters(custom_filters);
+  if (applied_custom_filters_ == rules)
+    return;
+  applied_custom_filters_ = rules;
+  ResetAdBlockClientWithRules(rules);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 
+#include "base/optional.h"
+#include "base/synchronization/lock.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
 
 class AdBlockServiceTest;
@@ -27,12 +29,26 @@ class AdBlockCustomFiltersService : public AdBlockBaseService {
   std::string GetCustomFilters();
   bool UpdateCustomFilters(const std::string& custom_filters);
 
+  // Returns the rules of |custom_filters| the engine is built from, in a
+  // stable order. Blank lines, comments, surrounding whitespace and duplicate
+  // rules don't change it, so edits like these don't rebuild the engine.
+  static std::string NormalizeCustomFilters(const std::string& custom_filters);
+
  protected:
   bool Init() override;
 
  private:
   friend class ::AdBlockServiceTest;
-  void UpdateCustomFiltersOnFileTaskRunner(const std::string& custom_filters);
+  void UpdateCustomFiltersOnFileTaskRunner();
+
+  // Latest filters waiting for the shields task runner. Saves made before
+  // the task runs replace it instead of queueing another rebuild.
+  base::Lock pending_custom_filters_lock_;
+  base::Optional<std::string> pending_custom_filters_;
+
+  // The normalized filters the current engine was built from. Only used on
+  // the shields task runner.
+  base::Optional<std::string> applied_custom_filters_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockCustomFiltersService);
 };
@@ -0,0 +1,32 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::AdBlockCustomFiltersService;
+
+TEST(AdBlockCustomFiltersServiceTest, NormalizeDropsBlankLinesAndComments) {
+  EXPECT_EQ(AdBlockCustomFiltersService::NormalizeCustomFilters(
+                "[Adblock Plus 2.0]\n"
+                "! my rules\n"
+                "\n"
+                "  *ad_banner.png  \r\n"
+                "##.ad\n"),
+            "##.ad\n*ad_banner.png");
+}
+
+TEST(AdBlockCustomFiltersServiceTest, NormalizeIgnoresOrderAndDuplicates) {
+  EXPECT_EQ(AdBlockCustomFiltersService::NormalizeCustomFilters(
+                "b.com\na.com\nb.com"),
+            AdBlockCustomFiltersService::NormalizeCustomFilters(
+                "a.com\nb.com"));
+}
+
+TEST(AdBlockCustomFiltersServiceTest, NormalizeEmpty) {
+  EXPECT_EQ(AdBlockCustomFiltersService::NormalizeCustomFilters(""), "");
+  EXPECT_EQ(AdBlockCustomFiltersService::NormalizeCustomFilters("\n ! x\n"),
+            "");
+}
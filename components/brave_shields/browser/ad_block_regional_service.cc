@@ -11,18 +11,23 @@
 #include <vector>
 
 #include "base/base_paths.h"
+#include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/post_task.h"
 #include "base/threading/thread_restrictions.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/vendor/adblock_rust_ffi/src/wrapper.hpp"
 #include "components/prefs/pref_service.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 
 namespace brave_shields {
 
@@ -34,7 +39,14 @@ AdBlockRegionalService::AdBlockRegionalService(
     const std::string& uuid,
     brave_component_updater::BraveComponent::Delegate* delegate)
     : AdBlockBaseService(delegate),
-      uuid_(uuid) {
+      uuid_(uuid),
+      lazy_loading_enabled_(base::FeatureList::IsEnabled(
+          features::kBraveAdblockLazyRegionalLists)),
+      loaded_(false),
+      load_requested_(false),
+      last_match_time_(0),
+      weak_factory_(this) {
+  weak_ptr_ = weak_factory_.GetWeakPtr();
 }
 
 AdBlockRegionalService::~AdBlockRegionalService() {
@@ -65,10 +77,52 @@ void AdBlockRegionalService::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
     const std::string& manifest) {
-  base::FilePath dat_file_path =
+  dat_file_path_ =
       install_dir.AppendASCII(std::string("rs-") + uuid_)
           .AddExtension(FILE_PATH_LITERAL(".dat"));
-  GetDATFileData(dat_file_path);
+  // Updates of a list that is in use are applied right away.
+  if (!lazy_loading_enabled_ || loaded_ || load_requested_) {
+    LoadOnUIThread();
+  }
+}
+
+void AdBlockRegionalService::LoadIfNeeded() {
+  // Only the first caller has to post the load.
+  if (!lazy_loading_enabled_ || load_requested_.exchange(true))
+    return;
+  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
+                 base::BindOnce(&AdBlockRegionalService::LoadOnUIThread,
+                                weak_ptr_));
+}
+
+void AdBlockRegionalService::LoadOnUIThread() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  // OnComponentReady() loads the list once it's there.
+  if (dat_file_path_.empty())
+    return;
+  loaded_ = true;
+  // Don't unload a list before it had a chance to match anything.
+  RecordMatch();
+  GetDATFileData(dat_file_path_);
+}
+
+void AdBlockRegionalService::RecordMatch() {
+  last_match_time_ = (base::TimeTicks::Now() - base::TimeTicks())
+                         .InMicroseconds();
+}
+
+bool AdBlockRegionalService::UnloadIfIdle(base::TimeDelta idle_time) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!lazy_loading_enabled_ || !loaded_)
+    return false;
+  const base::TimeTicks last_match =
+      base::TimeTicks() + base::TimeDelta::FromMicroseconds(last_match_time_);
+  if (base::TimeTicks::Now() - last_match < idle_time)
+    return false;
+  loaded_ = false;
+  load_requested_ = false;
+  UnloadAdBlockClient();
+  return true;
 }
 
 // static
@@ -8,11 +8,14 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
 
 class AdBlockServiceTest;
@@ -31,6 +34,20 @@ class AdBlockRegionalService : public AdBlockBaseService {
   std::string GetUUID() const { return uuid_; }
   std::string GetTitle() const { return title_; }
 
+  // Whether loading the engine waits until LoadIfNeeded() is called instead
+  // of happening as soon as the component is ready.
+  bool IsLazyLoadingEnabled() const { return lazy_loading_enabled_; }
+  // Starts loading the engine if that was deferred. Can be called from any
+  // thread, the list keeps matching nothing until the load finishes.
+  void LoadIfNeeded();
+  // Marks the list as in use so that it isn't unloaded. Can be called from
+  // any thread.
+  void RecordMatch();
+  // Unloads the engine if the list hasn't matched anything for |idle_time|,
+  // it is loaded again the next time it is needed. Returns whether it was
+  // unloaded.
+  bool UnloadIfIdle(base::TimeDelta idle_time);
+
  protected:
   bool Init() override;
   void OnComponentReady(const std::string& component_id,
@@ -46,8 +63,21 @@ class AdBlockRegionalService : public AdBlockBaseService {
       const std::string& component_id,
       const std::string& component_base64_public_key);
 
+  void LoadOnUIThread();
+
   std::string uuid_;
   std::string title_;
+  const bool lazy_loading_enabled_;
+  // Path of the DAT file from the last component update, only accessed on
+  // the UI thread.
+  base::FilePath dat_file_path_;
+  bool loaded_;
+  std::atomic<bool> load_requested_;
+  // base::TimeTicks of the last match, in microseconds.
+  std::atomic<int64_t> last_match_time_;
+  // Bound on the UI thread so that it can be copied from any thread.
+  base::WeakPtr<AdBlockRegionalService> weak_ptr_;
+  base::WeakPtrFactory<AdBlockRegionalService> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockRegionalService);
 };
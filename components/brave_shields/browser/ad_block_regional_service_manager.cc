@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/feature_list.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_util.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
@@ -17,6 +19,7 @@
 #include "brave/components/brave_shields/browser/ad_block_regional_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/vendor/adblock_rust_ffi/src/wrapper.hpp"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
@@ -27,6 +30,28 @@ using adblock::FilterList;
 
 namespace brave_shields {
 
+namespace {
+
+// How often loaded lists are checked for being idle.
+constexpr base::TimeDelta kIdleCheckInterval = base::TimeDelta::FromHours(1);
+// How long a list stays loaded without matching anything.
+constexpr base::TimeDelta kIdleUnloadTime = base::TimeDelta::FromHours(12);
+
+// Whether cosmetic |resources| for a hostname have anything to apply.
+bool HasCosmeticMatches(const base::Value& resources) {
+  const base::Value* hide_selectors = resources.FindListKey("hide_selectors");
+  if (hide_selectors && !hide_selectors->GetList().empty())
+    return true;
+  const base::Value* style_selectors = resources.FindDictKey("style_selectors");
+  if (style_selectors && !style_selectors->DictEmpty())
+    return true;
+  const std::string* injected_script =
+      resources.FindStringKey("injected_script");
+  return injected_script && !injected_script->empty();
+}
+
+}  // namespace
+
 AdBlockRegionalServiceManager::AdBlockRegionalServiceManager(
     brave_component_updater::BraveComponent::Delegate* delegate)
     : delegate_(delegate),
@@ -68,7 +93,8 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
     EnableFilterList(it->uuid, true);
   }
 
-  // Start all regional services associated with enabled filter lists
+  // Start all regional services associated with enabled filter lists. With
+  // lazy loading only their components are registered here.
   base::AutoLock lock(regional_services_lock_);
   const base::DictionaryValue* regional_filters_dict =
       local_state->GetDictionary(kAdBlockRegionalFilters);
@@ -87,6 +113,30 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
           std::make_pair(uuid, std::move(regional_service)));
     }
   }
+
+  if (base::FeatureList::IsEnabled(features::kBraveAdblockLazyRegionalLists)) {
+    UMA_HISTOGRAM_COUNTS_100("Brave.Shields.AdBlockRegional.DeferredLists",
+                             regional_services_.size());
+    idle_check_timer_.Start(
+        FROM_HERE, kIdleCheckInterval,
+        base::BindRepeating(
+            &AdBlockRegionalServiceManager::UnloadIdleRegionalServices,
+            base::Unretained(this)));
+  }
+}
+
+void AdBlockRegionalServiceManager::UnloadIdleRegionalServices() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  int unloaded = 0;
+  base::AutoLock lock(regional_services_lock_);
+  for (const auto& regional_service : regional_services_) {
+    if (regional_service.second->UnloadIfIdle(kIdleUnloadTime))
+      unloaded++;
+  }
+  if (unloaded > 0) {
+    UMA_HISTOGRAM_COUNTS_100("Brave.Shields.AdBlockRegional.UnloadedLists",
+                             unloaded);
+  }
 }
 
 void AdBlockRegionalServiceManager::UpdateFilterListPrefs(
@@ -130,14 +180,40 @@ bool AdBlockRegionalServiceManager::ShouldStartRequest(
     bool* matching_exception_filter,
     bool* cancel_request_explicitly,
     std::string* mock_data_url) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
-    if (!regional_service.second->ShouldStartRequest(
-            url, resource_type, tab_host, matching_exception_filter,
+  return ShouldStartRequest(AdBlockRequest(url, resource_type, tab_host),
+                            matching_exception_filter,
+                            cancel_request_explicitly, mock_data_url);
+}
+
+bool AdBlockRegionalServiceManager::ShouldStartRequest(
+    const AdBlockRequest& request,
+    bool* matching_exception_filter,
+    bool* cancel_request_explicitly,
+    std::string* mock_data_url) {
+  // Match against snapshots of the engines so that concurrent callers only
+  // contend on the lock while the snapshots are taken.
+  std::vector<std::string> uuids;
+  std::vector<AdBlockBaseService::EngineSnapshot> snapshots;
+  {
+    base::AutoLock lock(regional_services_lock_);
+    uuids.reserve(regional_services_.size());
+    snapshots.reserve(regional_services_.size());
+    for (const auto& regional_service : regional_services_) {
+      regional_service.second->LoadIfNeeded();
+      uuids.push_back(regional_service.first);
+      snapshots.push_back(regional_service.second->GetEngineSnapshot());
+    }
+  }
+
+  for (size_t i = 0; i < snapshots.size(); ++i) {
+    if (!AdBlockBaseService::ShouldStartRequest(
+            snapshots[i], request, matching_exception_filter,
             cancel_request_explicitly, mock_data_url)) {
+      RecordMatch(uuids[i]);
       return false;
     }
     if (matching_exception_filter && *matching_exception_filter) {
+      RecordMatch(uuids[i]);
       return true;
     }
   }
@@ -145,6 +221,14 @@ bool AdBlockRegionalServiceManager::ShouldStartRequest(
   return true;
 }
 
+void AdBlockRegionalServiceManager::RecordMatch(const std::string& uuid) {
+  base::AutoLock lock(regional_services_lock_);
+  auto it = regional_services_.find(uuid);
+  // The list could have been disabled while it was matching.
+  if (it != regional_services_.end())
+    it->second->RecordMatch();
+}
+
 void AdBlockRegionalServiceManager::EnableTag(const std::string& tag,
                                               bool enabled) {
   base::AutoLock lock(regional_services_lock_);
@@ -191,19 +275,66 @@ void AdBlockRegionalServiceManager::EnableFilterList(const std::string& uuid,
                      base::Unretained(this), uuid, enabled));
 }
 
+namespace {
+
+void AddCacheStats(const LookupCacheStats& from, LookupCacheStats* into) {
+  into->hits += from.hits;
+  into->misses += from.misses;
+  into->size += from.size;
+  into->capacity += from.capacity;
+}
+
+}  // namespace
+
+LookupCacheStats AdBlockRegionalServiceManager::GetDecisionCacheStats() {
+  LookupCacheStats stats;
+  base::AutoLock lock(regional_services_lock_);
+  for (const auto& regional_service : regional_services_) {
+    AddCacheStats(regional_service.second->GetDecisionCacheStats(), &stats);
+  }
+  return stats;
+}
+
+LookupCacheStats
+AdBlockRegionalServiceManager::GetCosmeticResourcesCacheStats() {
+  LookupCacheStats stats;
+  base::AutoLock lock(regional_services_lock_);
+  for (const auto& regional_service : regional_services_) {
+    AddCacheStats(regional_service.second->GetCosmeticResourcesCacheStats(),
+                  &stats);
+  }
+  return stats;
+}
+
+void AdBlockRegionalServiceManager::AppendEngineGenerations(
+    std::vector<int>* generations) {
+  base::AutoLock lock(regional_services_lock_);
+  for (const auto& regional_service : regional_services_) {
+    generations->push_back(regional_service.second->GetEngineGeneration());
+  }
+}
+
 base::Optional<base::Value>
 AdBlockRegionalServiceManager::HostnameCosmeticResources(
         const std::string& hostname) {
-  auto it = this->regional_services_.begin();
-  if (it == this->regional_services_.end()) {
+  base::AutoLock lock(regional_services_lock_);
+  auto it = regional_services_.begin();
+  if (it == regional_services_.end()) {
     return base::Optional<base::Value>();
   }
+  it->second->LoadIfNeeded();
   base::Optional<base::Value> first_value =
       it->second->HostnameCosmeticResources(hostname);
+  if (first_value && HasCosmeticMatches(*first_value))
+    it->second->RecordMatch();
 
-  for ( ; it != this->regional_services_.end(); it++) {
+  // The first list was already queried above.
+  for (++it; it != regional_services_.end(); ++it) {
+    it->second->LoadIfNeeded();
     base::Optional<base::Value> next_value =
         it->second->HostnameCosmeticResources(hostname);
+    if (next_value && HasCosmeticMatches(*next_value))
+      it->second->RecordMatch();
     if (first_value) {
       if (next_value) {
         MergeResourcesInto(&*first_value, &*next_value, false);
@@ -221,16 +352,28 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
-  auto it = this->regional_services_.begin();
-  if (it == this->regional_services_.end()) {
+  base::AutoLock lock(regional_services_lock_);
+  auto it = regional_services_.begin();
+  if (it == regional_services_.end()) {
     return base::Optional<base::Value>();
   }
+  it->second->LoadIfNeeded();
   base::Optional<base::Value> first_value =
       it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+  if (first_value && first_value->is_list() &&
+      !first_value->GetList().empty()) {
+    it->second->RecordMatch();
+  }
 
-  for ( ; it != this->regional_services_.end(); it++) {
+  // The first list was already queried above.
+  for (++it; it != regional_services_.end(); ++it) {
+    it->second->LoadIfNeeded();
     base::Optional<base::Value> next_value =
         it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+    if (next_value && next_value->is_list() &&
+        !next_value->GetList().empty()) {
+      it->second->RecordMatch();
+    }
     if (first_value && first_value->is_list()) {
       if (next_value && next_value->is_list()) {
         for (auto i = next_value->GetList().begin();
@@ -15,8 +15,11 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/optional.h"
 #include "base/synchronization/lock.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/brave_component.h"
+#include "brave/components/brave_shields/browser/ad_block_request.h"
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
 
@@ -51,9 +54,18 @@ class AdBlockRegionalServiceManager {
                           bool* matching_exception_filter,
                           bool* cancel_request_explicitly,
                           std::string* mock_data_url);
+  bool ShouldStartRequest(const AdBlockRequest& request,
+                          bool* matching_exception_filter,
+                          bool* cancel_request_explicitly,
+                          std::string* mock_data_url);
   void EnableTag(const std::string& tag, bool enabled);
   void AddResources(const std::string& resources);
   void EnableFilterList(const std::string& uuid, bool enabled);
+  // Summed over the decision caches of all enabled regional lists.
+  LookupCacheStats GetDecisionCacheStats();
+  LookupCacheStats GetCosmeticResourcesCacheStats();
+  // Appends the engine generation of every enabled regional list.
+  void AppendEngineGenerations(std::vector<int>* generations);
 
   base::Optional<base::Value> HostnameCosmeticResources(
           const std::string& hostname);
@@ -66,6 +78,9 @@ class AdBlockRegionalServiceManager {
   friend class ::AdBlockServiceTest;
   bool Init();
   void StartRegionalServices();
+  void UnloadIdleRegionalServices();
+  // Keeps the list with |uuid| loaded after it matched a request.
+  void RecordMatch(const std::string& uuid);
   void UpdateFilterListPrefs(const std::string& uuid, bool enabled);
 
   brave_component_updater::BraveComponent::Delegate* delegate_;  // NOT OWNED
@@ -73,6 +88,9 @@ class AdBlockRegionalServiceManager {
   base::Lock regional_services_lock_;
   std::map<std::string, std::unique_ptr<AdBlockRegionalService>>
       regional_services_;
+  // Periodically unloads the lists that haven't been matching anything when
+  // they are loaded on demand.
+  base::RepeatingTimer idle_check_timer_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockRegionalServiceManager);
 };
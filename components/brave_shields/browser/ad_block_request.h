@@ -0,0 +1,55 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_H_
+
+#include <string>
+
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+// Everything the ad-block engines need to know about a request, computed
+// once so it can be matched against several engines without redoing the
+// string conversions and the third-party check for each of them.
+struct AdBlockRequest {
+  AdBlockRequest(const GURL& url,
+                 blink::mojom::ResourceType resource_type,
+                 const std::string& tab_host);
+  AdBlockRequest(const AdBlockRequest& other);
+  ~AdBlockRequest();
+
+  std::string spec;
+  std::string host;
+  std::string tab_host;
+  bool is_third_party;
+  // The filter option name for the resource type, e.g. "script".
+  std::string resource_type;
+};
+
+struct AdBlockMatchResult {
+  AdBlockMatchResult();
+  AdBlockMatchResult(const AdBlockMatchResult& other);
+  ~AdBlockMatchResult();
+
+  bool should_block = false;
+  bool did_match_exception = false;
+  bool cancel_request_explicitly = false;
+  std::string mock_data_url;
+  // Whether the result came from the decision cache of the default engine.
+  // Only set by AdBlockRequestMatcher.
+  bool decision_cache_hit = false;
+};
+
+// Returns the filter option name the engines use for |resource_type|, or an
+// empty string if there is none.
+std::string ResourceTypeToFilterOption(
+    blink::mojom::ResourceType resource_type);
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_H_
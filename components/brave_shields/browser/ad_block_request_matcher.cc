@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_request_matcher.h"
+
+#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
+#include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+
+namespace brave_shields {
+
+AdBlockRequestMatcher::AdBlockRequestMatcher(
+    AdBlockService* ad_block_service,
+    AdBlockRegionalServiceManager* regional_service_manager,
+    AdBlockCustomFiltersService* custom_filters_service)
+    : ad_block_service_(ad_block_service),
+      regional_service_manager_(regional_service_manager),
+      custom_filters_service_(custom_filters_service) {}
+
+AdBlockRequestMatcher::~AdBlockRequestMatcher() = default;
+
+AdBlockMatchResult AdBlockRequestMatcher::Match(
+    const AdBlockRequest& request) const {
+  AdBlockMatchResult result;
+  if (ad_block_service_ &&
+      !ad_block_service_->ShouldStartRequest(
+          request, &result.did_match_exception,
+          &result.cancel_request_explicitly, &result.mock_data_url,
+          &result.decision_cache_hit)) {
+    result.should_block = true;
+  } else if (!result.did_match_exception && regional_service_manager_ &&
+             !regional_service_manager_->ShouldStartRequest(
+                 request, &result.did_match_exception,
+                 &result.cancel_request_explicitly, &result.mock_data_url)) {
+    result.should_block = true;
+  } else if (!result.did_match_exception && custom_filters_service_ &&
+             !custom_filters_service_->ShouldStartRequest(
+                 request, &result.did_match_exception,
+                 &result.cancel_request_explicitly, &result.mock_data_url)) {
+    result.should_block = true;
+  }
+  return result;
+}
+
+std::vector<AdBlockMatchResult> AdBlockRequestMatcher::MatchAll(
+    const std::vector<AdBlockRequest>& requests) const {
+  std::vector<AdBlockMatchResult> results;
+  results.reserve(requests.size());
+  for (const auto& request : requests) {
+    results.push_back(Match(request));
+  }
+  return results;
+}
+
+std::vector<int> AdBlockRequestMatcher::GetEngineGenerations() const {
+  std::vector<int> generations;
+  if (ad_block_service_) {
+    generations.push_back(ad_block_service_->GetEngineGeneration());
+  }
+  if (custom_filters_service_) {
+    generations.push_back(custom_filters_service_->GetEngineGeneration());
+  }
+  if (regional_service_manager_) {
+    regional_service_manager_->AppendEngineGenerations(&generations);
+  }
+  return generations;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,50 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_MATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_MATCHER_H_
+
+#include <vector>
+
+#include "base/macros.h"
+#include "brave/components/brave_shields/browser/ad_block_request.h"
+
+namespace brave_shields {
+
+class AdBlockCustomFiltersService;
+class AdBlockRegionalServiceManager;
+class AdBlockService;
+
+// Matches requests against the default, regional and custom filter engines
+// in that order, stopping as soon as one of them blocks the request or
+// matches an exception for it. Must be used on the shields task runner unless
+// parallel matching is enabled, in which case any thread pool worker will do.
+class AdBlockRequestMatcher {
+ public:
+  AdBlockRequestMatcher(AdBlockService* ad_block_service,
+                        AdBlockRegionalServiceManager* regional_service_manager,
+                        AdBlockCustomFiltersService* custom_filters_service);
+  ~AdBlockRequestMatcher();
+
+  AdBlockMatchResult Match(const AdBlockRequest& request) const;
+  // Matches several requests at once, e.g. for a batch of preloads, so they
+  // only cost a single hop to the shields task runner.
+  std::vector<AdBlockMatchResult> MatchAll(
+      const std::vector<AdBlockRequest>& requests) const;
+  // Returns the generations of all the engines, which only compare equal to
+  // an earlier result while none of the engines changed.
+  std::vector<int> GetEngineGenerations() const;
+
+ private:
+  AdBlockService* ad_block_service_;  // NOT OWNED
+  AdBlockRegionalServiceManager* regional_service_manager_;  // NOT OWNED
+  AdBlockCustomFiltersService* custom_filters_service_;  // NOT OWNED
+
+  DISALLOW_COPY_AND_ASSIGN(AdBlockRequestMatcher);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_REQUEST_MATCHER_H_
@@ -0,0 +1,27 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_request.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+TEST(AdBlockRequestTest, ComputesMatchingContext) {
+  brave_shields::AdBlockRequest request(
+      GURL("https://cdn.example.com/ad.js"),
+      blink::mojom::ResourceType::kScript, "www.example.com");
+  EXPECT_EQ("https://cdn.example.com/ad.js", request.spec);
+  EXPECT_EQ("cdn.example.com", request.host);
+  EXPECT_EQ("www.example.com", request.tab_host);
+  EXPECT_FALSE(request.is_third_party);
+  EXPECT_EQ("script", request.resource_type);
+}
+
+TEST(AdBlockRequestTest, ThirdParty) {
+  brave_shields::AdBlockRequest request(
+      GURL("https://ads.tracker.net/pixel.png"),
+      blink::mojom::ResourceType::kImage, "www.example.com");
+  EXPECT_TRUE(request.is_third_party);
+  EXPECT_EQ("image", request.resource_type);
+}
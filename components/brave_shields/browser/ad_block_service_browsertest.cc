@@ -4,6 +4,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "base/path_service.h"
+#include "base/run_loop.h"
 #include "base/task/post_task.h"
 #include "base/test/thread_test_helper.h"
 #include "brave/browser/brave_browser_process_impl.h"
@@ -256,6 +257,39 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, AdsGetBlockedByDefaultBlocker) {
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
 }
 
+// Repeated requests for the same resource are answered from the decision
+// cache instead of the engine.
+IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, DecisionCacheHitsRepeatedRequests) {
+  UpdateAdBlockInstanceWithRules("*ad_banner.png");
+  brave_shields::AdBlockService* ad_block_service =
+      g_brave_browser_process->ad_block_service();
+  brave_shields::LookupCacheStats before =
+      ad_block_service->GetDecisionCacheStats();
+
+  base::RunLoop run_loop;
+  ad_block_service->GetTaskRunner()->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(
+          [](brave_shields::AdBlockService* ad_block_service) {
+            for (int i = 0; i < 2; ++i) {
+              bool did_match_exception = false;
+              EXPECT_FALSE(ad_block_service->ShouldStartRequest(
+                  GURL("https://example.com/ad_banner.png"),
+                  blink::mojom::ResourceType::kImage, "example.com",
+                  &did_match_exception, nullptr, nullptr));
+              EXPECT_FALSE(did_match_exception);
+            }
+          },
+          ad_block_service),
+      run_loop.QuitClosure());
+  run_loop.Run();
+
+  brave_shields::LookupCacheStats after =
+      ad_block_service->GetDecisionCacheStats();
+  EXPECT_EQ(before.misses + 1, after.misses);
+  EXPECT_EQ(before.hits + 1, after.hits);
+}
+
 // Load a page with an image which is not an ad, and make sure it is NOT
 // blocked by custom filters.
 IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
@@ -10,6 +10,9 @@
 
 #include "base/strings/string_util.h"
 #include "base/values.h"
+#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
+#include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
 
 using adblock::FilterList;
 
@@ -116,4 +119,72 @@ void MergeResourcesInto(
   }
 }
 
+base::Optional<base::Value> GetHostnameCosmeticResources(
+    AdBlockService* ad_block_service,
+    AdBlockRegionalServiceManager* regional_service_manager,
+    AdBlockCustomFiltersService* custom_filters_service,
+    const std::string& hostname) {
+  base::Optional<base::Value> resources =
+      ad_block_service->HostnameCosmeticResources(hostname);
+
+  if (!resources || !resources->is_dict()) {
+    return base::nullopt;
+  }
+
+  base::Optional<base::Value> regional_resources =
+      regional_service_manager->HostnameCosmeticResources(hostname);
+
+  if (regional_resources && regional_resources->is_dict()) {
+    MergeResourcesInto(&*resources, &*regional_resources, false);
+  }
+
+  base::Optional<base::Value> custom_resources =
+      custom_filters_service->HostnameCosmeticResources(hostname);
+
+  if (custom_resources && custom_resources->is_dict()) {
+    MergeResourcesInto(&*resources, &*custom_resources, true);
+  }
+
+  return resources;
+}
+
+// Same rules as the brave extension builds for chrome.tabs.insertCSS
+std::string CreateCosmeticStylesheet(const base::Value& resources) {
+  std::string stylesheet;
+
+  const base::Value* force_hide_selectors =
+      resources.FindListKey("force_hide_selectors");
+  if (force_hide_selectors && !force_hide_selectors->GetList().empty()) {
+    std::vector<base::StringPiece> selectors;
+    for (const auto& selector : force_hide_selectors->GetList()) {
+      if (selector.is_string())
+        selectors.push_back(selector.GetString());
+    }
+    if (!selectors.empty()) {
+      stylesheet += base::JoinString(selectors, ",");
+      stylesheet += "{display:none!important;}\n";
+    }
+  }
+
+  const base::Value* style_selectors =
+      resources.FindDictKey("style_selectors");
+  if (style_selectors) {
+    for (const auto& item : style_selectors->DictItems()) {
+      if (!item.second.is_list())
+        continue;
+      std::vector<base::StringPiece> styles;
+      for (const auto& style : item.second.GetList()) {
+        if (style.is_string())
+          styles.push_back(style.GetString());
+      }
+      stylesheet += item.first;
+      stylesheet += "{";
+      stylesheet += base::JoinString(styles, ";");
+      stylesheet += ";}\n";
+    }
+  }
+
+  return stylesheet;
+}
+
 }  // namespace brave_shields
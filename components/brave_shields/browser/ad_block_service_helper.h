@@ -9,11 +9,16 @@
 #include <string>
 #include <vector>
 
+#include "base/optional.h"
 #include "base/values.h"
 #include "brave/vendor/adblock_rust_ffi/src/wrapper.hpp"
 
 namespace brave_shields {
 
+class AdBlockCustomFiltersService;
+class AdBlockRegionalServiceManager;
+class AdBlockService;
+
 std::vector<adblock::FilterList>::const_iterator FindAdBlockFilterListByUUID(
     const std::vector<adblock::FilterList>& region_lists,
     const std::string& uuid);
@@ -23,6 +28,18 @@ std::vector<adblock::FilterList>::const_iterator FindAdBlockFilterListByLocale(
 
 void MergeResourcesInto(base::Value* into, base::Value* from, bool force_hide);
 
+// Returns the merged HostnameCosmeticResources of all the ad-block engines, or
+// nullopt if the default engine has none. Safe to call from any sequence.
+base::Optional<base::Value> GetHostnameCosmeticResources(
+    AdBlockService* ad_block_service,
+    AdBlockRegionalServiceManager* regional_service_manager,
+    AdBlockCustomFiltersService* custom_filters_service,
+    const std::string& hostname);
+
+// Returns the user stylesheet for the `force_hide_selectors` and
+// `style_selectors` of merged HostnameCosmeticResources.
+std::string CreateCosmeticStylesheet(const base::Value& resources);
+
 }  // namespace brave_shields
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SERVICE_HELPER_H_
@@ -15,6 +15,7 @@
 #include "brave/components/brave_shields/browser/brave_shields_p3a.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/browser/referrer_whitelist_service.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/components/content_settings/core/common/content_settings_util.h"
@@ -242,14 +243,17 @@ ControlType GetCosmeticFilteringControlType(Profile* profile, const GURL& url) {
 }
 
 bool ShouldDoCosmeticFiltering(Profile* profile, const GURL& url) {
-  return base::FeatureList::IsEnabled(features::kBraveAdblockCosmeticFiltering)
-      && GetBraveShieldsEnabled(profile, url)
-      && (GetCosmeticFilteringControlType(profile, url) != ControlType::ALLOW);
+  if (!base::FeatureList::IsEnabled(features::kBraveAdblockCosmeticFiltering))
+    return false;
+  const ShieldsSettingsSnapshot snapshot =
+      ShieldsSettingsSnapshotCache::Get(profile, url);
+  return snapshot.brave_shields_enabled &&
+         snapshot.cosmetic_filtering_control_type != ControlType::ALLOW;
 }
 
 bool IsFirstPartyCosmeticFilteringEnabled(Profile* profile, const GURL& url) {
-  const ControlType type = GetCosmeticFilteringControlType(profile, url);
-  return type == ControlType::BLOCK;
+  return ShieldsSettingsSnapshotCache::Get(profile, url)
+             .cosmetic_filtering_control_type == ControlType::BLOCK;
 }
 
 // TODO(bridiver) - convert cookie settings to ContentSettingsType::COOKIES
@@ -11,7 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
 #include "brave/common/pref_names.h"
 #include "brave/common/render_messages.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -259,33 +261,93 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
 }
 
 #if !defined(OS_ANDROID)
-// static
-void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
-    const std::string& block_type, const std::string& subresource,
+namespace {
+
+// Blocked resources are sent to the shields panel at most this often, or
+// earlier once kMaxPendingBlockedResources are waiting.
+constexpr base::TimeDelta kFlushBlockedResourcesDelay =
+    base::TimeDelta::FromMilliseconds(250);
+constexpr size_t kMaxPendingBlockedResources = 100;
+
+void DispatchBlockedResources(
+    const std::vector<std::pair<std::string, std::string>>& resources,
     WebContents* web_contents) {
 #if BUILDFLAG(ENABLE_EXTENSIONS)
-  if (!web_contents) {
+  if (!web_contents || resources.empty()) {
     return;
   }
   Profile* profile =
       Profile::FromBrowserContext(web_contents->GetBrowserContext());
   EventRouter* event_router = EventRouter::Get(profile);
   if (profile && event_router) {
-    extensions::api::brave_shields::OnBlocked::Details details;
-    details.tab_id = extensions::ExtensionTabUtil::GetTabId(web_contents);
-    details.block_type = block_type;
-    details.subresource = subresource;
+    const int tab_id = extensions::ExtensionTabUtil::GetTabId(web_contents);
+    std::vector<extensions::api::brave_shields::BlockDetails> details;
+    details.reserve(resources.size());
+    for (const auto& resource : resources) {
+      extensions::api::brave_shields::BlockDetails resource_details;
+      resource_details.tab_id = tab_id;
+      resource_details.block_type = resource.first;
+      resource_details.subresource = resource.second;
+      details.push_back(std::move(resource_details));
+    }
     std::unique_ptr<base::ListValue> args(
-        extensions::api::brave_shields::OnBlocked::Create(details)
+        extensions::api::brave_shields::OnResourcesBlocked::Create(details)
           .release());
     std::unique_ptr<Event> event(
         new Event(extensions::events::BRAVE_AD_BLOCKED,
-          extensions::api::brave_shields::OnBlocked::kEventName,
+          extensions::api::brave_shields::OnResourcesBlocked::kEventName,
           std::move(args)));
     event_router->BroadcastEvent(std::move(event));
   }
 #endif
 }
+
+}  // namespace
+
+void BraveShieldsWebContentsObserver::AddPendingBlockedResource(
+    const std::string& block_type,
+    const std::string& subresource) {
+  BlockedResource resource(block_type, subresource);
+  // The panel only lists each blocked resource once.
+  if (!pending_blocked_resources_set_.insert(resource).second)
+    return;
+  pending_blocked_resources_.push_back(std::move(resource));
+
+  if (pending_blocked_resources_.size() >= kMaxPendingBlockedResources) {
+    FlushBlockedResources();
+    return;
+  }
+  if (!flush_blocked_resources_timer_.IsRunning()) {
+    flush_blocked_resources_timer_.Start(
+        FROM_HERE, kFlushBlockedResourcesDelay,
+        base::BindOnce(&BraveShieldsWebContentsObserver::FlushBlockedResources,
+                       base::Unretained(this)));
+  }
+}
+
+// static
+void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
+    const std::string& block_type, const std::string& subresource,
+    WebContents* web_contents) {
+  if (!web_contents) {
+    return;
+  }
+  BraveShieldsWebContentsObserver* observer =
+      BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+  if (observer) {
+    observer->AddPendingBlockedResource(block_type, subresource);
+    return;
+  }
+  DispatchBlockedResources({{block_type, subresource}}, web_contents);
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedResources() {
+  flush_blocked_resources_timer_.Stop();
+  std::vector<BlockedResource> resources;
+  resources.swap(pending_blocked_resources_);
+  pending_blocked_resources_set_.clear();
+  DispatchBlockedResources(resources, web_contents());
+}
 #endif
 
 bool BraveShieldsWebContentsObserver::OnMessageReceived(
@@ -340,10 +402,14 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
     content::NavigationHandle* navigation_handle) {
   // when the main frame navigate away
   if (navigation_handle->IsInMainFrame() &&
-      !navigation_handle->IsSameDocument() &&
-      navigation_handle->GetReloadType() == content::ReloadType::NONE) {
-    allowed_script_origins_.clear();
-    blocked_url_paths_.clear();
+      !navigation_handle->IsSameDocument()) {
+    // Resources blocked on the previous page must reach the panel before it
+    // resets the tab's stats for the new one.
+    FlushBlockedResources();
+    if (navigation_handle->GetReloadType() == content::ReloadType::NONE) {
+      allowed_script_origins_.clear();
+      blocked_url_paths_.clear();
+    }
   }
 
   navigation_handle->GetWebContents()->SendToAllFrames(
@@ -9,11 +9,13 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
 #include "base/strings/string16.h"
+#include "base/timer/timer.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -48,6 +50,9 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
                         content::WebContents* web_contents);
   bool IsBlockedSubresource(const std::string& subresource);
   void AddBlockedSubresource(const std::string& subresource);
+  // Sends the blocked resources collected since the last flush to the shields
+  // panel.
+  void FlushBlockedResources();
 
  protected:
     // A set of identifiers that uniquely identifies a RenderFrame.
@@ -94,10 +99,21 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
 
  private:
   friend class content::WebContentsUserData<BraveShieldsWebContentsObserver>;
+  // Block type and subresource of a blocked resource.
+  using BlockedResource = std::pair<std::string, std::string>;
+
+  // Blocked resources are coalesced and sent to the shields panel in batches,
+  // so pages blocking hundreds of resources don't fire an event for each.
+  void AddPendingBlockedResource(const std::string& block_type,
+                                 const std::string& subresource);
+
   std::vector<std::string> allowed_script_origins_;
   // We keep a set of the current page's blocked URLs in case the page
   // continually tries to load the same blocked URLs.
   std::set<std::string> blocked_url_paths_;
+  std::vector<BlockedResource> pending_blocked_resources_;
+  std::set<BlockedResource> pending_blocked_resources_set_;
+  base::OneShotTimer flush_blocked_resources_timer_;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
   DISALLOW_COPY_AND_ASSIGN(BraveShieldsWebContentsObserver);
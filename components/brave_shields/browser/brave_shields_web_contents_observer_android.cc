@@ -33,4 +33,9 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
       tabId, block_type, subresource);
 }
 
+void BraveShieldsWebContentsObserver::FlushBlockedResources() {
+  // Blocked events are sent to Java as they happen, nothing is pending.
+  DCHECK(pending_blocked_resources_.empty());
+}
+
 }  // namespace brave_shields
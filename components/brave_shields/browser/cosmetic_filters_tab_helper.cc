@@ -0,0 +1,63 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/cosmetic_filters_tab_helper.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/task/post_task.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/cosmetic_stylesheet_cache.h"
+#include "chrome/browser/profiles/profile.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/web_contents.h"
+
+namespace brave_shields {
+
+CosmeticFiltersTabHelper::CosmeticFiltersTabHelper(
+    content::WebContents* web_contents)
+    : web_contents_(web_contents), receivers_(web_contents, this) {}
+
+CosmeticFiltersTabHelper::~CosmeticFiltersTabHelper() = default;
+
+void CosmeticFiltersTabHelper::GetHostnameStylesheet(
+    const GURL& document_url,
+    GetHostnameStylesheetCallback callback) {
+  if (!document_url.SchemeIsHTTPOrHTTPS()) {
+    std::move(callback).Run(base::ReadOnlySharedMemoryRegion());
+    return;
+  }
+
+  // Shields settings are the ones of the page. The main frame asks before
+  // its commit may have been seen here, so it passes its own url.
+  content::RenderFrameHost* render_frame_host =
+      receivers_.GetCurrentTargetFrame();
+  const GURL tab_url = render_frame_host->GetParent()
+                           ? web_contents_->GetLastCommittedURL()
+                           : document_url;
+  Profile* profile =
+      Profile::FromBrowserContext(web_contents_->GetBrowserContext());
+  if (!ShouldDoCosmeticFiltering(profile, tab_url)) {
+    std::move(callback).Run(base::ReadOnlySharedMemoryRegion());
+    return;
+  }
+
+  // Compiling a stylesheet takes the same lookups as
+  // braveShields.hostnameCosmeticResources.
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&CosmeticStylesheetCache::GetHostnameStylesheet,
+                     base::Unretained(CosmeticStylesheetCache::GetInstance()),
+                     document_url.host()),
+      std::move(callback));
+}
+
+WEB_CONTENTS_USER_DATA_KEY_IMPL(CosmeticFiltersTabHelper)
+
+}  // namespace brave_shields
@@ -0,0 +1,43 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_FILTERS_TAB_HELPER_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_FILTERS_TAB_HELPER_H_
+
+#include "base/macros.h"
+#include "brave/components/brave_shields/common/cosmetic_filters.mojom.h"
+#include "content/public/browser/web_contents_receiver_set.h"
+#include "content/public/browser/web_contents_user_data.h"
+
+namespace brave_shields {
+
+// Serves the hostname specific cosmetic filters to BraveCosmeticFiltersAgent
+// of every frame in the tab.
+class CosmeticFiltersTabHelper
+    : public content::WebContentsUserData<CosmeticFiltersTabHelper>,
+      public mojom::CosmeticFilters {
+ public:
+  ~CosmeticFiltersTabHelper() override;
+
+  // mojom::CosmeticFilters
+  void GetHostnameStylesheet(const GURL& document_url,
+                             GetHostnameStylesheetCallback callback) override;
+
+ private:
+  friend class content::WebContentsUserData<CosmeticFiltersTabHelper>;
+
+  explicit CosmeticFiltersTabHelper(content::WebContents* web_contents);
+
+  content::WebContents* web_contents_;  // NOT OWNED
+  content::WebContentsFrameReceiverSet<mojom::CosmeticFilters> receivers_;
+
+  WEB_CONTENTS_USER_DATA_KEY_DECL();
+
+  DISALLOW_COPY_AND_ASSIGN(CosmeticFiltersTabHelper);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_FILTERS_TAB_HELPER_H_
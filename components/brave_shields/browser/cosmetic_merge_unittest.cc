@@ -171,5 +171,37 @@ TEST_F(CosmeticResourceMergeTest, MergeNonEmptyForceHide) {
   CompareMergeFromStrings(a, b, true, expected);
 }
 
+TEST_F(CosmeticResourceMergeTest, CreateCosmeticStylesheet) {
+  const std::string resources = "{"
+      "\"hide_selectors\": [\"a\"], "
+      "\"style_selectors\": {"
+          "\"c\": [\"color: #fff\", \"display: block\"], "
+          "\"d\": [\"color: #000\"]"
+      "}, "
+      "\"exceptions\": [], "
+      "\"injected_script\": \"\","
+      "\"force_hide_selectors\": [\"h\", \"i\"]"
+  "}";
+
+  base::Optional<base::Value> resources_val =
+      base::JSONReader::Read(resources);
+  ASSERT_TRUE(resources_val);
+
+  // Generic hide selectors are checked by the extension for first party
+  // content, so they are not part of the stylesheet.
+  EXPECT_EQ(
+      "h,i{display:none!important;}\n"
+      "c{color: #fff;display: block;}\n"
+      "d{color: #000;}\n",
+      CreateCosmeticStylesheet(*resources_val));
+}
+
+TEST_F(CosmeticResourceMergeTest, CreateCosmeticStylesheetEmpty) {
+  base::Optional<base::Value> resources_val =
+      base::JSONReader::Read(EMPTY_RESOURCES);
+  ASSERT_TRUE(resources_val);
+
+  EXPECT_EQ("", CreateCosmeticStylesheet(*resources_val));
+}
 
 }  // namespace brave_shields
@@ -0,0 +1,106 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/cosmetic_stylesheet_cache.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "base/no_destructor.h"
+#include "base/optional.h"
+#include "base/values.h"
+#include "brave/browser/brave_browser_process_impl.h"
+#include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
+#include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+
+namespace brave_shields {
+
+namespace {
+
+// Number of hostnames whose stylesheets are kept.
+constexpr size_t kMaxStylesheets = 100;
+
+}  // namespace
+
+CosmeticStylesheetCache::Entry::Entry() = default;
+
+CosmeticStylesheetCache::Entry::Entry(Entry&& other) = default;
+
+CosmeticStylesheetCache::Entry& CosmeticStylesheetCache::Entry::operator=(
+    Entry&& other) = default;
+
+CosmeticStylesheetCache::Entry::~Entry() = default;
+
+CosmeticStylesheetCache::CosmeticStylesheetCache(
+    AdBlockService* ad_block_service,
+    AdBlockRegionalServiceManager* regional_service_manager,
+    AdBlockCustomFiltersService* custom_filters_service)
+    : ad_block_service_(ad_block_service),
+      regional_service_manager_(regional_service_manager),
+      custom_filters_service_(custom_filters_service),
+      entries_(kMaxStylesheets) {}
+
+CosmeticStylesheetCache::~CosmeticStylesheetCache() = default;
+
+// static
+CosmeticStylesheetCache* CosmeticStylesheetCache::GetInstance() {
+  static base::NoDestructor<CosmeticStylesheetCache> instance(
+      g_brave_browser_process->ad_block_service(),
+      g_brave_browser_process->ad_block_regional_service_manager(),
+      g_brave_browser_process->ad_block_custom_filters_service());
+  return instance.get();
+}
+
+base::ReadOnlySharedMemoryRegion CosmeticStylesheetCache::GetHostnameStylesheet(
+    const std::string& hostname) {
+  std::vector<int> engine_generations = GetEngineGenerations();
+  {
+    base::AutoLock lock(lock_);
+    auto it = entries_.Get(hostname);
+    if (it != entries_.end() &&
+        it->second.engine_generations == engine_generations) {
+      return it->second.stylesheet.Duplicate();
+    }
+  }
+
+  // Compiled without holding |lock_|, two threads missing the same hostname
+  // just both compile it.
+  std::string stylesheet;
+  base::Optional<base::Value> resources = GetHostnameCosmeticResources(
+      ad_block_service_, regional_service_manager_, custom_filters_service_,
+      hostname);
+  if (resources)
+    stylesheet = CreateCosmeticStylesheet(*resources);
+
+  Entry entry;
+  entry.engine_generations = std::move(engine_generations);
+  if (!stylesheet.empty()) {
+    base::MappedReadOnlyRegion mapped_region =
+        base::ReadOnlySharedMemoryRegion::Create(stylesheet.size());
+    if (!mapped_region.IsValid())
+      return base::ReadOnlySharedMemoryRegion();
+    memcpy(mapped_region.mapping.memory(), stylesheet.data(),
+           stylesheet.size());
+    entry.stylesheet = std::move(mapped_region.region);
+  }
+
+  base::ReadOnlySharedMemoryRegion result = entry.stylesheet.Duplicate();
+  base::AutoLock lock(lock_);
+  entries_.Put(hostname, std::move(entry));
+  return result;
+}
+
+std::vector<int> CosmeticStylesheetCache::GetEngineGenerations() const {
+  std::vector<int> engine_generations;
+  engine_generations.push_back(ad_block_service_->GetEngineGeneration());
+  engine_generations.push_back(custom_filters_service_->GetEngineGeneration());
+  regional_service_manager_->AppendEngineGenerations(&engine_generations);
+  return engine_generations;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,69 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_STYLESHEET_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_STYLESHEET_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/synchronization/lock.h"
+
+namespace brave_shields {
+
+class AdBlockCustomFiltersService;
+class AdBlockRegionalServiceManager;
+class AdBlockService;
+
+// Compiled hostname stylesheets of the ad-block engines, each kept in a read
+// only shared memory region that every renderer showing the host maps
+// instead of receiving its own copy. An entry is only used as long as none
+// of the engines it was compiled from changed. Safe to use from any
+// sequence.
+class CosmeticStylesheetCache {
+ public:
+  CosmeticStylesheetCache(
+      AdBlockService* ad_block_service,
+      AdBlockRegionalServiceManager* regional_service_manager,
+      AdBlockCustomFiltersService* custom_filters_service);
+  ~CosmeticStylesheetCache();
+
+  // Returns the cache for the ad-block services of the browser process, must
+  // first be called on the UI thread.
+  static CosmeticStylesheetCache* GetInstance();
+
+  // Returns an invalid region if there is nothing to inject for |hostname|.
+  base::ReadOnlySharedMemoryRegion GetHostnameStylesheet(
+      const std::string& hostname);
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(Entry&& other);
+    Entry& operator=(Entry&& other);
+    ~Entry();
+
+    std::vector<int> engine_generations;
+    base::ReadOnlySharedMemoryRegion stylesheet;
+  };
+
+  std::vector<int> GetEngineGenerations() const;
+
+  AdBlockService* ad_block_service_;  // NOT OWNED
+  AdBlockRegionalServiceManager* regional_service_manager_;  // NOT OWNED
+  AdBlockCustomFiltersService* custom_filters_service_;  // NOT OWNED
+
+  base::Lock lock_;
+  base::MRUCache<std::string, Entry> entries_;  // GUARDED_BY(lock_)
+
+  DISALLOW_COPY_AND_ASSIGN(CosmeticStylesheetCache);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_COSMETIC_STYLESHEET_CACHE_H_
@@ -0,0 +1,158 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
+
+#include <utility>
+
+#include "base/json/json_reader.h"
+#include "base/memory/ptr_util.h"
+#include "base/values.h"
+#include "third_party/re2/src/re2/re2.h"
+
+namespace brave_shields {
+
+namespace {
+
+// RE2 doesn't expose its heap usage, so approximate it from the number of
+// program instructions.
+constexpr size_t kEstimatedBytesPerRE2Instruction = 16;
+
+size_t EstimateRE2MemoryUsage(const re2::RE2& re) {
+  return sizeof(re2::RE2) + re.pattern().size() +
+         static_cast<size_t>(re.ProgramSize()) *
+             kEstimatedBytesPerRE2Instruction;
+}
+
+}  // namespace
+
+HTTPSERuleSet::Rule::Rule() = default;
+HTTPSERuleSet::Rule::Rule(Rule&& other) = default;
+HTTPSERuleSet::Rule::~Rule() = default;
+
+HTTPSERuleSet::Target::Target() = default;
+HTTPSERuleSet::Target::Target(Target&& other) = default;
+HTTPSERuleSet::Target::~Target() = default;
+
+HTTPSERuleSet::HTTPSERuleSet() = default;
+HTTPSERuleSet::~HTTPSERuleSet() = default;
+
+// static
+std::unique_ptr<HTTPSERuleSet> HTTPSERuleSet::Parse(base::StringPiece json) {
+  base::Optional<base::Value> json_object = base::JSONReader::Read(json);
+  if (!json_object || !json_object->is_list()) {
+    return nullptr;
+  }
+
+  auto rule_set = base::WrapUnique(new HTTPSERuleSet());
+  size_t memory_usage = sizeof(HTTPSERuleSet);
+
+  for (const base::Value& top_value : json_object->GetList()) {
+    if (!top_value.is_dict()) {
+      continue;
+    }
+
+    Target target;
+    const base::Value* exclusions = top_value.FindListKey("e");
+    if (exclusions) {
+      for (const base::Value& exclusion : exclusions->GetList()) {
+        if (!exclusion.is_dict()) {
+          continue;
+        }
+        const std::string* pattern = exclusion.FindStringKey("p");
+        if (!pattern) {
+          continue;
+        }
+        auto re = std::make_unique<re2::RE2>(CorrectToRuleForRE2(*pattern));
+        if (!re->ok()) {
+          continue;
+        }
+        memory_usage += EstimateRE2MemoryUsage(*re);
+        target.exclusions.push_back(std::move(re));
+      }
+    }
+
+    const base::Value* rules = top_value.FindListKey("r");
+    target.has_rules = rules != nullptr;
+    if (rules) {
+      for (const base::Value& rule_value : rules->GetList()) {
+        if (!rule_value.is_dict()) {
+          continue;
+        }
+        Rule rule;
+        if (rule_value.FindKey("d")) {
+          rule.default_rule = true;
+          target.rules.push_back(std::move(rule));
+          // Nothing after a default rule can be reached.
+          break;
+        }
+        const std::string* from = rule_value.FindStringKey("f");
+        const std::string* to = rule_value.FindStringKey("t");
+        if (!from || !to) {
+          continue;
+        }
+        rule.from = std::make_unique<re2::RE2>(*from);
+        if (!rule.from->ok()) {
+          continue;
+        }
+        rule.to = CorrectToRuleForRE2(*to);
+        memory_usage += EstimateRE2MemoryUsage(*rule.from) + rule.to.size();
+        target.rules.push_back(std::move(rule));
+      }
+    }
+
+    memory_usage += sizeof(Target) + target.rules.size() * sizeof(Rule);
+    const bool stop = !target.has_rules;
+    rule_set->targets_.push_back(std::move(target));
+    // Later targets are never consulted once one without rules is hit.
+    if (stop) {
+      break;
+    }
+  }
+
+  rule_set->estimated_memory_usage_ = memory_usage;
+  return rule_set;
+}
+
+// static
+std::string HTTPSERuleSet::CorrectToRuleForRE2(const std::string& to) {
+  std::string corrected_to(to);
+  size_t pos = corrected_to.find('$');
+  while (std::string::npos != pos) {
+    corrected_to[pos] = '\\';
+    pos = corrected_to.find('$', pos + 1);
+  }
+  return corrected_to;
+}
+
+std::string HTTPSERuleSet::Apply(const std::string& original_url) const {
+  for (const Target& target : targets_) {
+    for (const auto& exclusion : target.exclusions) {
+      if (re2::RE2::FullMatch(original_url, *exclusion)) {
+        return "";
+      }
+    }
+
+    if (!target.has_rules) {
+      return "";
+    }
+
+    for (const Rule& rule : target.rules) {
+      if (rule.default_rule) {
+        std::string new_url(original_url);
+        return new_url.insert(4, "s");
+      }
+
+      std::string new_url(original_url);
+      if (re2::RE2::Replace(&new_url, *rule.from, rule.to) &&
+          new_url != original_url) {
+        return new_url;
+      }
+    }
+  }
+  return "";
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,76 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+namespace re2 {
+class RE2;
+}  // namespace re2
+
+namespace brave_shields {
+
+// A HTTPS Everywhere rule set in its compiled form. The JSON value stored for
+// a domain key is parsed once and every exclusion and "from" pattern is
+// compiled into an RE2 up front, so applying the rule set to a URL doesn't
+// touch the JSON parser or the regex compiler.
+class HTTPSERuleSet {
+ public:
+  ~HTTPSERuleSet();
+
+  // Returns nullptr if |json| isn't a list of rule sets.
+  static std::unique_ptr<HTTPSERuleSet> Parse(base::StringPiece json);
+
+  // Rewrites "$N" backreferences in a "to" value into the "\N" form RE2
+  // expects.
+  static std::string CorrectToRuleForRE2(const std::string& to);
+
+  // Returns the upgraded URL or an empty string if no rule applies.
+  std::string Apply(const std::string& original_url) const;
+
+  // Rough number of bytes held by this rule set, used to bound the cache.
+  size_t EstimatedMemoryUsage() const { return estimated_memory_usage_; }
+
+ private:
+  struct Rule {
+    Rule();
+    Rule(Rule&& other);
+    ~Rule();
+
+    // Set for rules that only upgrade the scheme ("d").
+    bool default_rule = false;
+    std::unique_ptr<re2::RE2> from;
+    std::string to;
+  };
+
+  struct Target {
+    Target();
+    Target(Target&& other);
+    ~Target();
+
+    std::vector<std::unique_ptr<re2::RE2>> exclusions;
+    // Mirrors a missing "r" entry, which stops the lookup.
+    bool has_rules = false;
+    std::vector<Rule> rules;
+  };
+
+  HTTPSERuleSet();
+
+  std::vector<Target> targets_;
+  size_t estimated_memory_usage_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(HTTPSERuleSet);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_SET_H_
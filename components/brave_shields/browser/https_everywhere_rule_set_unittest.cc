@@ -0,0 +1,62 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::HTTPSERuleSet;
+
+TEST(HTTPSERuleSetTest, InvalidJson) {
+  EXPECT_FALSE(HTTPSERuleSet::Parse(""));
+  EXPECT_FALSE(HTTPSERuleSet::Parse("{}"));
+}
+
+TEST(HTTPSERuleSetTest, DefaultRule) {
+  std::unique_ptr<HTTPSERuleSet> rule_set =
+      HTTPSERuleSet::Parse(R"([{"r": [{"d": 1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ("https://example.com/", rule_set->Apply("http://example.com/"));
+}
+
+TEST(HTTPSERuleSetTest, FromToRule) {
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(
+      R"([{"r": [{"f": "^http://(www\\.)?example\\.com/",
+                  "t": "https://$1example.com/"}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ("https://www.example.com/a",
+            rule_set->Apply("http://www.example.com/a"));
+  // Applying the same compiled rule set twice gives the same answer.
+  EXPECT_EQ("https://www.example.com/a",
+            rule_set->Apply("http://www.example.com/a"));
+  EXPECT_EQ("", rule_set->Apply("http://other.com/"));
+  EXPECT_GT(rule_set->EstimatedMemoryUsage(), 0u);
+}
+
+TEST(HTTPSERuleSetTest, Exclusions) {
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(
+      R"([{"e": [{"p": "^http://example\\.com/skip"}],
+           "r": [{"d": 1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ("", rule_set->Apply("http://example.com/skip"));
+  EXPECT_EQ("https://example.com/keep",
+            rule_set->Apply("http://example.com/keep"));
+}
+
+TEST(HTTPSERuleSetTest, MissingRulesStopsLookup) {
+  std::unique_ptr<HTTPSERuleSet> rule_set =
+      HTTPSERuleSet::Parse(R"([{"e": []}, {"r": [{"d": 1}]}])");
+  ASSERT_TRUE(rule_set);
+  EXPECT_EQ("", rule_set->Apply("http://example.com/"));
+}
+
+TEST(HTTPSERuleSetTest, CorrectToRuleForRE2) {
+  EXPECT_EQ("https://\\1example.com/\\2",
+            HTTPSERuleSet::CorrectToRuleForRE2("https://$1example.com/$2"));
+  EXPECT_EQ("https://example.com/",
+            HTTPSERuleSet::CorrectToRuleForRE2("https://example.com/"));
+}
@@ -0,0 +1,223 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/https_everywhere_rule_trie.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/logging.h"
+#include "base/memory/ptr_util.h"
+#include "base/strings/string_split.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kMagic[] = {'H', 'S', 'E', 'T'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderSize = sizeof(kMagic) + 3 * sizeof(uint32_t);
+constexpr size_t kNodeSize = 4 * sizeof(uint32_t);
+constexpr size_t kEdgeSize = 3 * sizeof(uint32_t);
+constexpr char kWildcardLabel[] = "*";
+
+// The file is written little-endian, which matches every platform we ship.
+uint32_t ReadUInt32(base::span<const uint8_t> data, size_t offset) {
+  uint32_t value;
+  memcpy(&value, data.data() + offset, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+HTTPSERuleTrie::HTTPSERuleTrie(base::span<const uint8_t> data)
+    : data_(data) {}
+
+HTTPSERuleTrie::~HTTPSERuleTrie() = default;
+
+// static
+std::unique_ptr<HTTPSERuleTrie> HTTPSERuleTrie::Load(
+    const base::FilePath& path) {
+  auto file = std::make_unique<base::MemoryMappedFile>();
+  if (!file->Initialize(path)) {
+    return nullptr;
+  }
+
+  auto trie = base::WrapUnique(
+      new HTTPSERuleTrie(base::make_span(file->data(), file->length())));
+  trie->file_ = std::move(file);
+  if (!trie->Parse()) {
+    LOG(ERROR) << "Malformed HTTPSE rules file " << path.value().c_str();
+    return nullptr;
+  }
+  return trie;
+}
+
+// static
+std::unique_ptr<HTTPSERuleTrie> HTTPSERuleTrie::CreateForTesting(
+    base::span<const uint8_t> data) {
+  auto trie = base::WrapUnique(new HTTPSERuleTrie(data));
+  if (!trie->Parse()) {
+    return nullptr;
+  }
+  return trie;
+}
+
+bool HTTPSERuleTrie::Parse() {
+  if (data_.size() < kHeaderSize ||
+      memcmp(data_.data(), kMagic, sizeof(kMagic)) != 0 ||
+      ReadUInt32(data_, sizeof(kMagic)) != kVersion) {
+    return false;
+  }
+
+  node_count_ = ReadUInt32(data_, sizeof(kMagic) + sizeof(uint32_t));
+  edge_count_ = ReadUInt32(data_, sizeof(kMagic) + 2 * sizeof(uint32_t));
+  if (node_count_ == 0) {
+    return false;
+  }
+
+  // Only the section sizes are checked up front so loading doesn't fault in
+  // the whole file; individual offsets are bounds checked on access.
+  const uint64_t nodes_size = static_cast<uint64_t>(node_count_) * kNodeSize;
+  const uint64_t edges_size = static_cast<uint64_t>(edge_count_) * kEdgeSize;
+  if (kHeaderSize + nodes_size + edges_size > data_.size()) {
+    return false;
+  }
+
+  nodes_ = data_.subspan(kHeaderSize, static_cast<size_t>(nodes_size));
+  edges_ = data_.subspan(kHeaderSize + static_cast<size_t>(nodes_size),
+                         static_cast<size_t>(edges_size));
+  blob_ = data_.subspan(kHeaderSize + static_cast<size_t>(nodes_size) +
+                        static_cast<size_t>(edges_size));
+  return true;
+}
+
+HTTPSERuleTrie::Node HTTPSERuleTrie::GetNode(uint32_t index) const {
+  DCHECK_LT(index, node_count_);
+  const size_t offset = static_cast<size_t>(index) * kNodeSize;
+  return {ReadUInt32(nodes_, offset),
+          ReadUInt32(nodes_, offset + sizeof(uint32_t)),
+          ReadUInt32(nodes_, offset + 2 * sizeof(uint32_t)),
+          ReadUInt32(nodes_, offset + 3 * sizeof(uint32_t))};
+}
+
+HTTPSERuleTrie::Edge HTTPSERuleTrie::GetEdge(uint32_t index) const {
+  DCHECK_LT(index, edge_count_);
+  const size_t offset = static_cast<size_t>(index) * kEdgeSize;
+  return {ReadUInt32(edges_, offset),
+          ReadUInt32(edges_, offset + sizeof(uint32_t)),
+          ReadUInt32(edges_, offset + 2 * sizeof(uint32_t))};
+}
+
+base::StringPiece HTTPSERuleTrie::GetBlob(uint32_t offset,
+                                          uint32_t size) const {
+  if (static_cast<uint64_t>(offset) + size > blob_.size()) {
+    return base::StringPiece();
+  }
+  return base::StringPiece(
+      reinterpret_cast<const char*>(blob_.data()) + offset, size);
+}
+
+bool HTTPSERuleTrie::FindChild(uint32_t node,
+                               base::StringPiece label,
+                               uint32_t* child) const {
+  const Node parent = GetNode(node);
+  if (static_cast<uint64_t>(parent.first_edge) + parent.edge_count >
+      edge_count_) {
+    return false;
+  }
+
+  uint32_t low = parent.first_edge;
+  uint32_t high = parent.first_edge + parent.edge_count;
+  while (low < high) {
+    const uint32_t middle = low + (high - low) / 2;
+    const Edge edge = GetEdge(middle);
+    const int compare =
+        GetBlob(edge.label_offset, edge.label_size).compare(label);
+    if (compare == 0) {
+      if (edge.child >= node_count_) {
+        return false;
+      }
+      *child = edge.child;
+      return true;
+    }
+    if (compare < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return false;
+}
+
+std::vector<HTTPSERuleTrie::Match> HTTPSERuleTrie::FindRules(
+    const std::string& host) const {
+  std::vector<Match> matches;
+  std::vector<base::StringPiece> labels = base::SplitStringPiece(
+      host, ".", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  // Like the leveldb key expansion, ignore a trailing dot.
+  if (!labels.empty() && labels.back().empty()) {
+    labels.pop_back();
+  }
+  // Top level domains on their own never have rules.
+  if (labels.size() < 2) {
+    return matches;
+  }
+
+  // |path[i]| is the node reached after consuming i + 1 reversed labels.
+  std::vector<uint32_t> path;
+  path.reserve(labels.size());
+  uint32_t node = 0;
+  for (auto it = labels.rbegin(); it != labels.rend(); ++it) {
+    if (!FindChild(node, *it, &node)) {
+      break;
+    }
+    path.push_back(node);
+  }
+
+  auto key_for_depth = [&labels](size_t depth) {
+    std::string key;
+    for (size_t i = 0; i < depth; ++i) {
+      if (i) {
+        key += '.';
+      }
+      labels[labels.size() - 1 - i].AppendToString(&key);
+    }
+    return key;
+  };
+
+  auto add_match = [this, &matches](uint32_t node, std::string key) {
+    const Node rule_node = GetNode(node);
+    if (rule_node.rule_size == 0) {
+      return;
+    }
+    base::StringPiece value =
+        GetBlob(rule_node.rule_offset, rule_node.rule_size);
+    if (!value.empty()) {
+      matches.push_back({std::move(key), value});
+    }
+  };
+
+  if (path.size() == labels.size()) {
+    add_match(path.back(), key_for_depth(labels.size()));
+  }
+
+  // Wildcards replace at least the leftmost label and never stand in for
+  // everything below the top level domain.
+  for (size_t depth = std::min(path.size(), labels.size() - 1); depth >= 2;
+       --depth) {
+    uint32_t wildcard;
+    if (FindChild(path[depth - 1], kWildcardLabel, &wildcard)) {
+      add_match(wildcard, key_for_depth(depth) + ".*");
+    }
+  }
+  return matches;
+}
+
+}  // namespace brave_shields
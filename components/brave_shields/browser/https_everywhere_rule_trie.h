@@ -0,0 +1,97 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_TRIE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_TRIE_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+namespace base {
+class FilePath;
+class MemoryMappedFile;
+}  // namespace base
+
+namespace brave_shields {
+
+// Read-only view over the memory-mapped HTTPS Everywhere rules file. Domains
+// are stored as a trie of reversed labels ("com" -> "example" -> "www"), with
+// "*" children for wildcard entries, so all the rule sets for a host are
+// found with a single walk. The rule set values are the same JSON the leveldb
+// store holds and are handed out as pieces of the mapping without copying.
+//
+// All integers are little-endian uint32. Layout:
+//   Header: magic "HSET", version, node count, edge count
+//   Nodes:  first edge index, edge count, rule offset, rule size
+//   Edges:  label offset, label size, child node index
+//   Blob:   labels and rule values, referenced by offset from the blob start
+// Node 0 is the root. A node's edges are contiguous and sorted by label so
+// they can be binary searched. A rule size of zero means the node has no rule.
+class HTTPSERuleTrie {
+ public:
+  struct Match {
+    // The key the same rule set has in the leveldb store, e.g. "com.foo.*".
+    std::string key;
+    base::StringPiece value;
+  };
+
+  ~HTTPSERuleTrie();
+
+  // Maps and validates |path|. Returns nullptr if the file is missing or
+  // malformed.
+  static std::unique_ptr<HTTPSERuleTrie> Load(const base::FilePath& path);
+  // Same as Load() but over caller-owned memory, which must outlive the trie.
+  static std::unique_ptr<HTTPSERuleTrie> CreateForTesting(
+      base::span<const uint8_t> data);
+
+  // Returns the rule sets that apply to |host|, most specific first, in the
+  // same order the leveldb lookup expands the host into keys.
+  std::vector<Match> FindRules(const std::string& host) const;
+
+ private:
+  struct Node {
+    uint32_t first_edge;
+    uint32_t edge_count;
+    uint32_t rule_offset;
+    uint32_t rule_size;
+  };
+
+  struct Edge {
+    uint32_t label_offset;
+    uint32_t label_size;
+    uint32_t child;
+  };
+
+  explicit HTTPSERuleTrie(base::span<const uint8_t> data);
+
+  bool Parse();
+  Node GetNode(uint32_t index) const;
+  Edge GetEdge(uint32_t index) const;
+  base::StringPiece GetBlob(uint32_t offset, uint32_t size) const;
+  // Returns false if |node| has no edge labelled |label|.
+  bool FindChild(uint32_t node, base::StringPiece label,
+                 uint32_t* child) const;
+
+  std::unique_ptr<base::MemoryMappedFile> file_;
+  base::span<const uint8_t> data_;
+  base::span<const uint8_t> nodes_;
+  base::span<const uint8_t> edges_;
+  base::span<const uint8_t> blob_;
+  uint32_t node_count_ = 0;
+  uint32_t edge_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(HTTPSERuleTrie);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULE_TRIE_H_
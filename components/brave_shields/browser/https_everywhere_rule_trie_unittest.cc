@@ -0,0 +1,123 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "brave/components/brave_shields/browser/https_everywhere_rule_trie.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::HTTPSERuleTrie;
+
+namespace {
+
+struct TestNode {
+  uint32_t first_edge;
+  uint32_t edge_count;
+  std::string rule;
+};
+
+struct TestEdge {
+  std::string label;
+  uint32_t child;
+};
+
+void AppendUInt32(std::vector<uint8_t>* out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+std::vector<uint8_t> BuildTrie(const std::vector<TestNode>& nodes,
+                               const std::vector<TestEdge>& edges) {
+  std::string blob;
+  std::vector<uint8_t> out = {'H', 'S', 'E', 'T'};
+  AppendUInt32(&out, 1);
+  AppendUInt32(&out, nodes.size());
+  AppendUInt32(&out, edges.size());
+  for (const auto& node : nodes) {
+    AppendUInt32(&out, node.first_edge);
+    AppendUInt32(&out, node.edge_count);
+    AppendUInt32(&out, blob.size());
+    AppendUInt32(&out, node.rule.size());
+    blob += node.rule;
+  }
+  for (const auto& edge : edges) {
+    AppendUInt32(&out, blob.size());
+    AppendUInt32(&out, edge.label.size());
+    AppendUInt32(&out, edge.child);
+    blob += edge.label;
+  }
+  out.insert(out.end(), blob.begin(), blob.end());
+  return out;
+}
+
+// com -> example -> {*, www}
+std::vector<uint8_t> BuildExampleTrie() {
+  return BuildTrie(
+      {
+          {0, 1, ""},          // root
+          {1, 1, ""},          // com
+          {2, 2, "example"},   // com.example
+          {0, 0, "wildcard"},  // com.example.*
+          {0, 0, "www"},       // com.example.www
+      },
+      {
+          {"com", 1},
+          {"example", 2},
+          {"*", 3},
+          {"www", 4},
+      });
+}
+
+}  // namespace
+
+TEST(HTTPSERuleTrieTest, RejectsMalformedData) {
+  std::vector<uint8_t> data = {'N', 'O', 'P', 'E'};
+  EXPECT_FALSE(HTTPSERuleTrie::CreateForTesting(data));
+
+  data = BuildExampleTrie();
+  data.resize(20);
+  EXPECT_FALSE(HTTPSERuleTrie::CreateForTesting(data));
+}
+
+TEST(HTTPSERuleTrieTest, FindRulesInLookupOrder) {
+  std::vector<uint8_t> data = BuildExampleTrie();
+  std::unique_ptr<HTTPSERuleTrie> trie =
+      HTTPSERuleTrie::CreateForTesting(data);
+  ASSERT_TRUE(trie);
+
+  std::vector<HTTPSERuleTrie::Match> matches =
+      trie->FindRules("www.example.com");
+  ASSERT_EQ(2u, matches.size());
+  EXPECT_EQ("com.example.www", matches[0].key);
+  EXPECT_EQ("www", matches[0].value);
+  EXPECT_EQ("com.example.*", matches[1].key);
+  EXPECT_EQ("wildcard", matches[1].value);
+
+  matches = trie->FindRules("a.b.example.com");
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ("com.example.*", matches[0].key);
+  EXPECT_EQ("wildcard", matches[0].value);
+
+  matches = trie->FindRules("example.com");
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ("com.example", matches[0].key);
+  EXPECT_EQ("example", matches[0].value);
+}
+
+TEST(HTTPSERuleTrieTest, NoMatches) {
+  std::vector<uint8_t> data = BuildExampleTrie();
+  std::unique_ptr<HTTPSERuleTrie> trie =
+      HTTPSERuleTrie::CreateForTesting(data);
+  ASSERT_TRUE(trie);
+
+  EXPECT_TRUE(trie->FindRules("com").empty());
+  EXPECT_TRUE(trie->FindRules("example.org").empty());
+  EXPECT_TRUE(trie->FindRules("").empty());
+}
@@ -12,21 +12,21 @@
 
 #include "base/base_paths.h"
 #include "base/bind.h"
-#include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/scoped_blocking_call.h"
-#include "base/values.h"
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
+#include "brave/components/brave_shields/browser/https_everywhere_rule_trie.h"
 #include "third_party/leveldatabase/src/include/leveldb/db.h"
-#include "third_party/re2/src/re2/re2.h"
 #include "third_party/zlib/google/zip.h"
 
 #define DAT_FILE "httpse.leveldb.zip"
 #define DAT_FILE_VERSION "6.0"
-#define HTTPSE_URLS_REDIRECTS_COUNT_QUEUE   1
-#define HTTPSE_URL_MAX_REDIRECTS_COUNT      5
+#define TRIE_FILE "httpse.rules.trie"
+#define HTTPSE_RULE_SET_CACHE_MAX_ENTRIES   1000
+#define HTTPSE_RULE_SET_CACHE_MAX_BYTES     (4 * 1024 * 1024)
 
 namespace {
 
@@ -100,7 +100,9 @@ HTTPSEverywhereService::g_https_everywhere_component_base64_public_key_(
 HTTPSEverywhereService::HTTPSEverywhereService(
     BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
-      level_db_(nullptr) {
+      level_db_(nullptr),
+      rule_set_cache_(HTTPSE_RULE_SET_CACHE_MAX_ENTRIES),
+      rule_set_cache_memory_usage_(0) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
@@ -122,8 +124,30 @@ bool HTTPSEverywhereService::Init() {
   return true;
 }
 
+bool HTTPSEverywhereService::InitRuleTrie(
+    const base::FilePath& install_dir) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  base::FilePath trie_file_path =
+      install_dir.AppendASCII(DAT_FILE_VERSION).AppendASCII(TRIE_FILE);
+  std::unique_ptr<HTTPSERuleTrie> rule_trie =
+      HTTPSERuleTrie::Load(trie_file_path);
+  if (!rule_trie) {
+    return false;
+  }
+
+  CloseDatabase();
+  rule_trie_ = std::move(rule_trie);
+  return true;
+}
+
 void HTTPSEverywhereService::InitDB(const base::FilePath& install_dir) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // Components that ship the memory-mapped trie don't need the leveldb
+  // store unzipped at all.
+  if (InitRuleTrie(install_dir)) {
+    return;
+  }
+
   base::FilePath zip_db_file_path =
       install_dir.AppendASCII(DAT_FILE_VERSION).AppendASCII(DAT_FILE);
   base::FilePath unzipped_level_db_path = zip_db_file_path.RemoveExtension();
@@ -164,22 +188,18 @@ void HTTPSEverywhereService::OnComponentReady(
 
 bool HTTPSEverywhereService::GetHTTPSURL(
     const GURL* url,
-    const uint64_t& request_identifier,
     std::string* new_url) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   if (!url->is_valid())
     return false;
 
-  if (!IsInitialized() || !level_db_ || url->scheme() == url::kHttpsScheme) {
-    return false;
-  }
-  if (!ShouldHTTPSERedirect(request_identifier)) {
+  if (!IsInitialized() || !IsDatabaseLoaded() ||
+      url->scheme() == url::kHttpsScheme) {
     return false;
   }
 
-  if (recently_used_cache_.get(url->spec(), new_url)) {
-    AddHTTPSEUrlToRedirectList(request_identifier);
+  if (recently_used_cache_.Get(*url, new_url)) {
     return true;
   }
 
@@ -190,26 +210,51 @@ bool HTTPSEverywhereService::GetHTTPSURL(
     candidate_url = candidate_url.ReplaceComponents(replacements);
   }
 
-  const std::vector<std::string> domains =
-      ExpandDomainForLookup(candidate_url.host());
-  for (auto domain : domains) {
-    std::string value = leveldbGet(level_db_, domain);
-    if (!value.empty()) {
-      *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
-      if (0 != new_url->length()) {
-        recently_used_cache_.add(candidate_url.spec(), *new_url);
-        AddHTTPSEUrlToRedirectList(request_identifier);
+  const std::string candidate_spec = candidate_url.spec();
+  auto apply_rule_set = [&](const HTTPSERuleSet* rule_set) {
+    if (!rule_set) {
+      return false;
+    }
+    *new_url = rule_set->Apply(candidate_spec);
+    if (0 == new_url->length()) {
+      return false;
+    }
+    recently_used_cache_.Put(candidate_url, *new_url);
+    return true;
+  };
+
+  if (rule_trie_) {
+    for (const auto& match : rule_trie_->FindRules(candidate_url.host())) {
+      const HTTPSERuleSet* rule_set = GetCachedRuleSet(match.key);
+      if (!rule_set) {
+        rule_set = CompileRuleSet(match.key, match.value);
+      }
+      if (apply_rule_set(rule_set)) {
+        return true;
+      }
+    }
+  } else {
+    const std::vector<std::string> domains =
+        ExpandDomainForLookup(candidate_url.host());
+    for (const auto& domain : domains) {
+      const HTTPSERuleSet* rule_set = GetCachedRuleSet(domain);
+      if (!rule_set) {
+        std::string value = leveldbGet(level_db_, domain);
+        if (!value.empty()) {
+          rule_set = CompileRuleSet(domain, value);
+        }
+      }
+      if (apply_rule_set(rule_set)) {
         return true;
       }
     }
   }
-  recently_used_cache_.remove(candidate_url.spec());
+  recently_used_cache_.Remove(candidate_url);
   return false;
 }
 
 bool HTTPSEverywhereService::GetHTTPSURLFromCacheOnly(
     const GURL* url,
-    const uint64_t& request_identifier,
     std::string* cached_url) {
   if (!url->is_valid())
     return false;
@@ -217,173 +262,62 @@ bool HTTPSEverywhereService::GetHTTPSURLFromCacheOnly(
   if (!IsInitialized() || url->scheme() == url::kHttpsScheme) {
     return false;
   }
-  if (!ShouldHTTPSERedirect(request_identifier)) {
-    return false;
-  }
 
-  if (recently_used_cache_.get(url->spec(), cached_url)) {
-    AddHTTPSEUrlToRedirectList(request_identifier);
+  if (recently_used_cache_.Get(*url, cached_url)) {
     return true;
   }
   return false;
 }
 
-bool HTTPSEverywhereService::ShouldHTTPSERedirect(
-    const uint64_t& request_identifier) {
-  base::AutoLock auto_lock(httpse_get_urls_redirects_count_mutex_);
-  for (size_t i = 0; i < httpse_urls_redirects_count_.size(); i++) {
-    if (request_identifier ==
-        httpse_urls_redirects_count_[i].request_identifier_ &&
-        httpse_urls_redirects_count_[i].redirects_ >=
-        HTTPSE_URL_MAX_REDIRECTS_COUNT - 1) {
-      return false;
-    }
-  }
-
-  return true;
+LookupCacheStats HTTPSEverywhereService::GetRecentlyUsedCacheStats() const {
+  return recently_used_cache_.GetStats();
 }
 
-void HTTPSEverywhereService::AddHTTPSEUrlToRedirectList(
-    const uint64_t& request_identifier) {
-  // Adding redirects count for the current request
-  base::AutoLock auto_lock(httpse_get_urls_redirects_count_mutex_);
-  bool hostFound = false;
-  for (size_t i = 0; i < httpse_urls_redirects_count_.size(); i++) {
-    if (request_identifier ==
-        httpse_urls_redirects_count_[i].request_identifier_) {
-      // Found the host, just increment the redirects_count
-      httpse_urls_redirects_count_[i].redirects_++;
-      hostFound = true;
-      break;
-    }
-  }
-  if (!hostFound) {
-      // The host is new, adding it to the redirects list
-      if (httpse_urls_redirects_count_.size() >=
-          HTTPSE_URLS_REDIRECTS_COUNT_QUEUE) {
-          // The queue is full, erase the first element
-          httpse_urls_redirects_count_.erase(
-              httpse_urls_redirects_count_.begin());
-      }
-      httpse_urls_redirects_count_.push_back(
-          HTTPSE_REDIRECTS_COUNT_ST(request_identifier, 1));
-  }
+const HTTPSERuleSet* HTTPSEverywhereService::GetCachedRuleSet(
+    const std::string& domain) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = rule_set_cache_.Get(domain);
+  return it != rule_set_cache_.end() ? it->second.get() : nullptr;
 }
 
-std::string HTTPSEverywhereService::ApplyHTTPSRule(
-    const std::string& originalUrl,
-    const std::string& rule) {
-  base::Optional<base::Value> json_object = base::JSONReader::Read(rule);
-  if (base::nullopt == json_object || !json_object->is_list()) {
-    return "";
+const HTTPSERuleSet* HTTPSEverywhereService::CompileRuleSet(
+    const std::string& domain,
+    base::StringPiece value) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  std::unique_ptr<HTTPSERuleSet> rule_set = HTTPSERuleSet::Parse(value);
+  if (!rule_set) {
+    return nullptr;
   }
 
-  base::Value::ConstListView topValues = json_object->GetList();
-  for (auto it = topValues.cbegin(); it != topValues.cend(); ++it) {
-    if (!it->is_dict()) {
-      continue;
-    }
-    const base::DictionaryValue* childTopDictionary = nullptr;
-    it->GetAsDictionary(&childTopDictionary);
-    if (nullptr == childTopDictionary) {
-      continue;
-    }
-
-    const base::Value* exclusion = nullptr;
-    if (childTopDictionary->Get("e", &exclusion)) {
-      const base::ListValue* eValues = nullptr;
-      exclusion->GetAsList(&eValues);
-      if (nullptr != eValues) {
-        for (size_t j = 0; j < eValues->GetSize(); ++j) {
-          const base::Value* pValue = nullptr;
-          if (!eValues->Get(j, &pValue)) {
-            continue;
-          }
-          const base::DictionaryValue* pDictionary = nullptr;
-          pValue->GetAsDictionary(&pDictionary);
-          if (nullptr == pDictionary) {
-            continue;
-          }
-          const base::Value* patternValue = nullptr;
-          if (!pDictionary->Get("p", &patternValue)) {
-            continue;
-          }
-          std::string pattern;
-          if (!patternValue->GetAsString(&pattern)) {
-            continue;
-          }
-          pattern = CorrecttoRuleToRE2Engine(pattern);
-          if (RE2::FullMatch(originalUrl, pattern)) {
-            return "";
-          }
-        }
-      }
-    }
-
-    const base::Value* rules = nullptr;
-    if (!childTopDictionary->Get("r", &rules)) {
-      return "";
-    }
-    const base::ListValue* rValues = nullptr;
-    rules->GetAsList(&rValues);
-    if (nullptr == rValues) {
-      return "";
-    }
-
-    for (size_t j = 0; j < rValues->GetSize(); ++j) {
-      const base::Value* pValue = nullptr;
-      if (!rValues->Get(j, &pValue)) {
-        continue;
-      }
-      const base::DictionaryValue* pDictionary = nullptr;
-      pValue->GetAsDictionary(&pDictionary);
-      if (nullptr == pDictionary) {
-        continue;
-      }
-      const base::Value* patternValue = nullptr;
-      if (pDictionary->Get("d", &patternValue)) {
-        std::string newUrl(originalUrl);
-        return newUrl.insert(4, "s");
-      }
-
-      const base::Value* from_value = nullptr;
-      const base::Value* to_value = nullptr;
-      if (!pDictionary->Get("f", &from_value) ||
-          !pDictionary->Get("t", &to_value)) {
-        continue;
-      }
-      std::string from, to;
-      if (!from_value->GetAsString(&from) ||
-          !to_value->GetAsString(&to)) {
-        continue;
-      }
-
-      to = CorrecttoRuleToRE2Engine(to);
-      std::string newUrl(originalUrl);
-      RE2 regExp(from);
-
-      if (RE2::Replace(&newUrl, regExp, to) && newUrl != originalUrl) {
-        return newUrl;
-      }
-    }
+  const size_t memory_usage = rule_set->EstimatedMemoryUsage();
+  // Evict here rather than letting Put() do it so the memory accounting
+  // stays in sync.
+  while (!rule_set_cache_.empty() &&
+         (rule_set_cache_.size() >= rule_set_cache_.max_size() ||
+          rule_set_cache_memory_usage_ + memory_usage >
+              HTTPSE_RULE_SET_CACHE_MAX_BYTES)) {
+    auto oldest = rule_set_cache_.rbegin();
+    rule_set_cache_memory_usage_ -= oldest->second->EstimatedMemoryUsage();
+    rule_set_cache_.Erase(oldest);
   }
-  return "";
+  rule_set_cache_memory_usage_ += memory_usage;
+  return rule_set_cache_.Put(domain, std::move(rule_set))->second.get();
 }
 
-std::string HTTPSEverywhereService::CorrecttoRuleToRE2Engine(
-    const std::string& to) {
-  std::string correctedto(to);
-  size_t pos = to.find("$");
-  while (std::string::npos != pos) {
-    correctedto[pos] = '\\';
-    pos = correctedto.find("$");
-  }
+void HTTPSEverywhereService::ClearRuleSetCache() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  rule_set_cache_.Clear();
+  rule_set_cache_memory_usage_ = 0;
+}
 
-  return correctedto;
+bool HTTPSEverywhereService::IsDatabaseLoaded() const {
+  return rule_trie_ || level_db_;
 }
 
 void HTTPSEverywhereService::CloseDatabase() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearRuleSetCache();
+  rule_trie_.reset();
   if (level_db_) {
     delete level_db_;
     level_db_ = nullptr;
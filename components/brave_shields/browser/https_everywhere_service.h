@@ -10,12 +10,12 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
-#include "base/synchronization/lock.h"
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
-#include "brave/components/brave_shields/browser/https_everywhere_recently_used_cache.h"
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
 
 namespace leveldb {
 class DB;
@@ -27,33 +27,24 @@ using brave_component_updater::BraveComponent;
 
 namespace brave_shields {
 
+class HTTPSERuleSet;
+class HTTPSERuleTrie;
+
 extern const char kHTTPSEverywhereComponentName[];
 extern const char kHTTPSEverywhereComponentId[];
 extern const char kHTTPSEverywhereComponentBase64PublicKey[];
 
-struct HTTPSE_REDIRECTS_COUNT_ST {
- public:
-  HTTPSE_REDIRECTS_COUNT_ST(uint64_t request_identifier,
-                            unsigned int redirects):
-    request_identifier_(request_identifier),
-    redirects_(redirects) {
-  }
-
-  uint64_t request_identifier_;
-  unsigned int redirects_;
-};
-
 class HTTPSEverywhereService : public BaseBraveShieldsService,
                          public base::SupportsWeakPtr<HTTPSEverywhereService> {
  public:
   explicit HTTPSEverywhereService(BraveComponent::Delegate* delegate);
   ~HTTPSEverywhereService() override;
-  bool GetHTTPSURL(const GURL* url,
-                   const uint64_t& request_id,
-                   std::string* new_url);
-  bool GetHTTPSURLFromCacheOnly(const GURL* url,
-                                const uint64_t& request_id,
-                                std::string* cached_url);
+  // Callers are responsible for guarding against redirect loops, see
+  // BraveRequestInfo::httpse_redirect_count.
+  bool GetHTTPSURL(const GURL* url, std::string* new_url);
+  bool GetHTTPSURLFromCacheOnly(const GURL* url, std::string* cached_url);
+
+  LookupCacheStats GetRecentlyUsedCacheStats() const;
 
  protected:
   bool Init() override;
@@ -62,11 +53,13 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
       const base::FilePath& install_dir,
       const std::string& manifest) override;
 
-  void AddHTTPSEUrlToRedirectList(const uint64_t& request_id);
-  bool ShouldHTTPSERedirect(const uint64_t& request_id);
-  std::string ApplyHTTPSRule(const std::string& originalUrl,
-      const std::string& rule);
-  std::string CorrecttoRuleToRE2Engine(const std::string& to);
+  // Returns the compiled rule set cached for the database key |domain|, or
+  // nullptr if it hasn't been compiled yet.
+  const HTTPSERuleSet* GetCachedRuleSet(const std::string& domain);
+  // Compiles |value| and caches it under |domain|. Returns nullptr if |value|
+  // isn't a valid rule set.
+  const HTTPSERuleSet* CompileRuleSet(const std::string& domain,
+                                      base::StringPiece value);
 
  private:
   friend class ::HTTPSEverywhereServiceTest;
@@ -79,12 +72,19 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
       const std::string& component_base64_public_key);
 
   void CloseDatabase();
+  void ClearRuleSetCache();
 
   void InitDB(const base::FilePath& install_dir);
-
-  base::Lock httpse_get_urls_redirects_count_mutex_;
-  std::vector<HTTPSE_REDIRECTS_COUNT_ST> httpse_urls_redirects_count_;
-  HTTPSERecentlyUsedCache<std::string> recently_used_cache_;
+  bool InitRuleTrie(const base::FilePath& install_dir);
+  bool IsDatabaseLoaded() const;
+
+  ShardedLookupCache<std::string> recently_used_cache_;
+  // Compiled rule sets keyed by database domain key, evicted least recently
+  // used once |rule_set_cache_memory_usage_| goes over budget.
+  base::MRUCache<std::string, std::unique_ptr<HTTPSERuleSet>> rule_set_cache_;
+  size_t rule_set_cache_memory_usage_;
+  // Preferred over |level_db_| when the component ships the trie file.
+  std::unique_ptr<HTTPSERuleTrie> rule_trie_;
   leveldb::DB* level_db_;
 
   SEQUENCE_CHECKER(sequence_checker_);
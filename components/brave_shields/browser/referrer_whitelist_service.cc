@@ -8,9 +8,7 @@
 #include <utility>
 
 #include "base/bind.h"
-#include "base/json/json_reader.h"
 #include "base/task/post_task.h"
-#include "base/task_runner_util.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
@@ -41,21 +39,34 @@ ReferrerWhitelistService::ReferrerWhitelist::~ReferrerWhitelist() = default;
 bool ReferrerWhitelistService::IsWhitelisted(
     const GURL& first_party_origin, const GURL& subresource_url) const {
   if (BrowserThread::CurrentlyOn(BrowserThread::IO)) {
-    return IsWhitelisted(
+    const std::string key =
+        first_party_origin.spec() + " " + subresource_url.spec();
+    bool whitelisted;
+    if (io_thread_cache_.Get(first_party_origin.host_piece(), key,
+                             &whitelisted)) {
+      return whitelisted;
+    }
+    whitelisted = IsWhitelisted(
         referrer_whitelist_io_thread_, first_party_origin, subresource_url);
+    io_thread_cache_.Put(first_party_origin.host_piece(), key, whitelisted);
+    return whitelisted;
   } else {
     return IsWhitelisted(
         referrer_whitelist_, first_party_origin, subresource_url);
   }
 }
 
+LookupCacheStats ReferrerWhitelistService::GetIOThreadCacheStats() const {
+  return io_thread_cache_.GetStats();
+}
+
 bool ReferrerWhitelistService::IsWhitelisted(
     const std::vector<ReferrerWhitelist>& whitelist,
     const GURL& first_party_origin,
     const GURL& subresource_url) const {
-  for (auto rw : whitelist) {
+  for (const auto& rw : whitelist) {
     if (rw.first_party_pattern.MatchesURL(first_party_origin)) {
-      for (auto subresource_pattern : rw.subresource_pattern_list) {
+      for (const auto& subresource_pattern : rw.subresource_pattern_list) {
         if (subresource_pattern.MatchesURL(subresource_url)) {
           return true;
         }
@@ -65,39 +76,42 @@ bool ReferrerWhitelistService::IsWhitelisted(
   return false;
 }
 
-void ReferrerWhitelistService::OnDATFileDataReady(std::string contents) {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  referrer_whitelist_.clear();
-  if (contents.empty()) {
-    LOG(ERROR) << "Could not obtain referrer whitelist data";
-    return;
-  }
-  base::Optional<base::Value> root = base::JSONReader::Read(contents);
-  contents.clear();
-  if (!root) {
+// static
+std::vector<ReferrerWhitelistService::ReferrerWhitelist>
+ReferrerWhitelistService::LoadReferrerWhitelist(
+    const base::FilePath& dat_file_path) {
+  std::vector<ReferrerWhitelist> referrer_whitelist;
+  base::Optional<base::Value> root =
+      brave_component_updater::GetDATFileAsJSON(dat_file_path);
+  if (!root || !root->is_dict()) {
     LOG(ERROR) << "Failed to parse referrer whitelist data";
-    return;
+    return referrer_whitelist;
   }
-  base::DictionaryValue* root_dict = nullptr;
-  root->GetAsDictionary(&root_dict);
-  base::ListValue* whitelist = nullptr;
-  root_dict->GetList("whitelist", &whitelist);
-  for (base::Value& origins : whitelist->GetList()) {
-    base::DictionaryValue* origins_dict = nullptr;
-    origins.GetAsDictionary(&origins_dict);
-    for (const auto& it : origins_dict->DictItems()) {
+  const base::Value* whitelist = root->FindListKey("whitelist");
+  if (!whitelist)
+    return referrer_whitelist;
+  for (const base::Value& origins : whitelist->GetList()) {
+    if (!origins.is_dict())
+      continue;
+    for (const auto& it : origins.DictItems()) {
       ReferrerWhitelist rw;
       rw.first_party_pattern = URLPattern(
         URLPattern::SCHEME_HTTP|URLPattern::SCHEME_HTTPS, it.first);
-      URLPatternList subresource_pattern_list;
-      for (base::Value& subresource_value : it.second.GetList()) {
+      for (const base::Value& subresource_value : it.second.GetList()) {
         rw.subresource_pattern_list.push_back(URLPattern(
           URLPattern::SCHEME_HTTP|URLPattern::SCHEME_HTTPS,
           subresource_value.GetString()));
       }
-      referrer_whitelist_.push_back(rw);
+      referrer_whitelist.push_back(std::move(rw));
     }
   }
+  return referrer_whitelist;
+}
+
+void ReferrerWhitelistService::OnDATFileDataReady(
+    std::vector<ReferrerWhitelist> whitelist) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  referrer_whitelist_ = std::move(whitelist);
 
   base::PostTask(
       FROM_HERE, {BrowserThread::IO},
@@ -110,6 +124,7 @@ void ReferrerWhitelistService::OnDATFileDataReadyOnIOThread(
     std::vector<ReferrerWhitelist> whitelist) {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
   referrer_whitelist_io_thread_ = std::move(whitelist);
+  io_thread_cache_.Clear();
 }
 
 void ReferrerWhitelistService::OnComponentReady(
@@ -120,10 +135,13 @@ void ReferrerWhitelistService::OnComponentReady(
       .AppendASCII(REFERRER_DAT_FILE_VERSION)
       .AppendASCII(REFERRER_DAT_FILE);
 
+  // The whitelist doesn't depend on other local data files, so it is read,
+  // parsed and compiled in parallel with them.
   base::PostTaskAndReplyWithResult(
-      local_data_files_service()->GetTaskRunner().get(),
       FROM_HERE,
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
+      {base::ThreadPool(), base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&ReferrerWhitelistService::LoadReferrerWhitelist,
                      dat_file_path),
       base::BindOnce(&ReferrerWhitelistService::OnDATFileDataReady,
                      weak_factory_.GetWeakPtr()));
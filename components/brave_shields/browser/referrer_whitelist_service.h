@@ -14,6 +14,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
 #include "extensions/common/url_pattern.h"
 #include "url/gurl.h"
 
@@ -37,6 +38,8 @@ class ReferrerWhitelistService : public LocalDataFilesObserver {
   bool IsWhitelisted(const GURL& firstPartyOrigin,
                      const GURL& subresourceUrl) const;
 
+  LookupCacheStats GetIOThreadCacheStats() const;
+
   // implementation of LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
                         const base::FilePath& install_dir,
@@ -56,13 +59,18 @@ class ReferrerWhitelistService : public LocalDataFilesObserver {
   bool IsWhitelisted(const std::vector<ReferrerWhitelist>& whitelist,
                      const GURL& first_party_origin,
                      const GURL& subresource_url) const;
-  void OnDATFileDataReady(std::string contents);
+  // Reads and compiles the whitelist, called on the thread pool.
+  static std::vector<ReferrerWhitelist> LoadReferrerWhitelist(
+      const base::FilePath& dat_file_path);
+  void OnDATFileDataReady(std::vector<ReferrerWhitelist> whitelist);
   void OnDATFileDataReadyOnIOThread(std::vector<ReferrerWhitelist> whitelist);
 
   typedef std::vector<URLPattern> URLPatternList;
 
   std::vector<ReferrerWhitelist> referrer_whitelist_;
   std::vector<ReferrerWhitelist> referrer_whitelist_io_thread_;
+  // Results for |referrer_whitelist_io_thread_|, keyed by the origin pair.
+  mutable ShardedLookupCache<bool> io_thread_cache_;
 
   SEQUENCE_CHECKER(sequence_checker_);
   base::WeakPtrFactory<ReferrerWhitelistService> weak_factory_;
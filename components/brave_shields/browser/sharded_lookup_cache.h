@@ -0,0 +1,162 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_LOOKUP_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_LOOKUP_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/containers/mru_cache.h"
+#include "base/hash/hash.h"
+#include "base/logging.h"
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/lock.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+struct LookupCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t size = 0;
+  size_t capacity = 0;
+};
+
+// A recently-used cache for shields lookups that are made from several
+// threads at once. Entries are spread over independently locked shards by a
+// hash of the host, so lookups for different sites rarely contend and the
+// locks are only held for the MRU bookkeeping.
+template <class T>
+class ShardedLookupCache {
+ public:
+  enum class KeyMode {
+    // Key by the full URL spec.
+    kFullURL,
+    // Key by origin and the first directory of the path, e.g.
+    // "https://example.com/api/" for "https://example.com/api/v1?x=1". Only
+    // use this when the cached value can't depend on the rest of the URL.
+    kHostAndPathPrefix,
+  };
+
+  explicit ShardedLookupCache(size_t capacity = 100,
+                              size_t shard_count = 8,
+                              KeyMode key_mode = KeyMode::kFullURL)
+      : key_mode_(key_mode), capacity_(capacity) {
+    DCHECK_GT(shard_count, 0u);
+    const size_t shard_capacity =
+        std::max<size_t>(1, (capacity + shard_count - 1) / shard_count);
+    for (size_t i = 0; i < shard_count; ++i) {
+      shards_.push_back(std::make_unique<Shard>(shard_capacity));
+    }
+  }
+
+  void Put(const GURL& url, const T& value) {
+    Put(url.host_piece(), MakeKey(url), value);
+  }
+
+  bool Get(const GURL& url, T* value) {
+    return Get(url.host_piece(), MakeKey(url), value);
+  }
+
+  void Remove(const GURL& url) { Remove(url.host_piece(), MakeKey(url)); }
+
+  // Variants for callers that build their own key. |shard_key| picks the
+  // shard and should be the host the entry belongs to.
+  void Put(base::StringPiece shard_key, const std::string& key,
+           const T& value) {
+    Shard* shard = GetShard(shard_key);
+    base::AutoLock lock(shard->lock);
+    shard->data.Put(key, value);
+  }
+
+  bool Get(base::StringPiece shard_key, const std::string& key, T* value) {
+    Shard* shard = GetShard(shard_key);
+    base::AutoLock lock(shard->lock);
+    auto it = shard->data.Get(key);
+    if (it == shard->data.end()) {
+      shard->misses.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    shard->hits.fetch_add(1, std::memory_order_relaxed);
+    *value = it->second;
+    return true;
+  }
+
+  void Remove(base::StringPiece shard_key, const std::string& key) {
+    Shard* shard = GetShard(shard_key);
+    base::AutoLock lock(shard->lock);
+    auto it = shard->data.Peek(key);
+    if (it != shard->data.end())
+      shard->data.Erase(it);
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      base::AutoLock lock(shard->lock);
+      shard->data.Clear();
+    }
+  }
+
+  LookupCacheStats GetStats() const {
+    LookupCacheStats stats;
+    stats.capacity = capacity_;
+    for (const auto& shard : shards_) {
+      stats.hits += shard->hits.load(std::memory_order_relaxed);
+      stats.misses += shard->misses.load(std::memory_order_relaxed);
+      base::AutoLock lock(shard->lock);
+      stats.size += shard->data.size();
+    }
+    return stats;
+  }
+
+  std::string MakeKey(const GURL& url) const {
+    if (key_mode_ == KeyMode::kFullURL || !url.is_valid()) {
+      return url.spec();
+    }
+    std::string key = url.GetOrigin().spec();
+    base::StringPiece path = url.path_piece();
+    // Skip the leading slash the origin spec already ends with.
+    if (!path.empty() && path[0] == '/') {
+      path.remove_prefix(1);
+    }
+    const size_t end = path.find('/');
+    if (end != base::StringPiece::npos) {
+      path.substr(0, end + 1).AppendToString(&key);
+    }
+    return key;
+  }
+
+ private:
+  struct Shard {
+    explicit Shard(size_t capacity) : data(capacity) {}
+
+    base::MRUCache<std::string, T> data;
+    mutable base::Lock lock;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+  };
+
+  Shard* GetShard(base::StringPiece shard_key) {
+    return shards_[base::FastHash(shard_key) % shards_.size()].get();
+  }
+
+  const KeyMode key_mode_;
+  const size_t capacity_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShardedLookupCache);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_LOOKUP_CACHE_H_
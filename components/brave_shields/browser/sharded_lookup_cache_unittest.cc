@@ -0,0 +1,67 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using brave_shields::LookupCacheStats;
+using brave_shields::ShardedLookupCache;
+
+TEST(ShardedLookupCacheTest, Operations) {
+  ShardedLookupCache<std::string> cache(10, 4);
+  const GURL a("http://a.com/path");
+  const GURL b("http://b.com/path");
+
+  std::string v;
+  EXPECT_FALSE(cache.Get(a, &v));
+  cache.Put(a, "vA");
+  cache.Put(b, "vB");
+  ASSERT_TRUE(cache.Get(a, &v));
+  EXPECT_EQ("vA", v);
+  ASSERT_TRUE(cache.Get(b, &v));
+  EXPECT_EQ("vB", v);
+
+  cache.Remove(a);
+  EXPECT_FALSE(cache.Get(a, &v));
+
+  LookupCacheStats stats = cache.GetStats();
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(1u, stats.size);
+  EXPECT_EQ(10u, stats.capacity);
+
+  cache.Clear();
+  EXPECT_FALSE(cache.Get(b, &v));
+}
+
+TEST(ShardedLookupCacheTest, EvictsPerShard) {
+  // A single shard behaves like a plain MRU cache.
+  ShardedLookupCache<int> cache(2, 1);
+  cache.Put(GURL("http://a.com/1"), 1);
+  cache.Put(GURL("http://a.com/2"), 2);
+  cache.Put(GURL("http://a.com/3"), 3);
+  int v;
+  EXPECT_FALSE(cache.Get(GURL("http://a.com/1"), &v));
+  EXPECT_TRUE(cache.Get(GURL("http://a.com/3"), &v));
+  EXPECT_EQ(3, v);
+}
+
+TEST(ShardedLookupCacheTest, HostAndPathPrefixKeys) {
+  using Cache = ShardedLookupCache<int>;
+  Cache cache(10, 2, Cache::KeyMode::kHostAndPathPrefix);
+  EXPECT_EQ("https://example.com/api/",
+            cache.MakeKey(GURL("https://example.com/api/v1?x=1")));
+  EXPECT_EQ("https://example.com/",
+            cache.MakeKey(GURL("https://example.com/index.html")));
+
+  cache.Put(GURL("https://example.com/api/v1"), 1);
+  int v;
+  ASSERT_TRUE(cache.Get(GURL("https://example.com/api/v2"), &v));
+  EXPECT_EQ(1, v);
+  EXPECT_FALSE(cache.Get(GURL("https://example.com/other/v1"), &v));
+}
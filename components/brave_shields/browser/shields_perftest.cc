@@ -0,0 +1,622 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/allocator/buildflags.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/json/json_reader.h"
+#include "base/path_service.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/time/time.h"
+#include "base/values.h"
+#include "brave/common/brave_paths.h"
+#include "brave/components/brave_shields/browser/ad_block_base_service.h"
+#include "brave/components/brave_shields/browser/ad_block_request.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+#include "brave/components/brave_shields/browser/https_everywhere_rule_set.h"
+#include "brave/components/brave_shields/browser/https_everywhere_rule_trie.h"
+#include "brave/components/brave_shields/browser/sharded_lookup_cache.h"
+#include "brave/components/brave_shields/browser/shields_trace.h"
+#include "brave/vendor/adblock_rust_ffi/src/wrapper.hpp"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+#include "base/allocator/allocator_shim.h"
+#endif
+
+// Replays a request trace through the per-request shields work and prints
+// ns/request and allocations/request for every stage, plus p99 latency of the
+// cosmetic filtering queries. The checked in lists are tiny, so pass a
+// production list and a recorded trace to get meaningful numbers:
+//
+// npm run test -- brave_unit_tests --filter=*ShieldsPerfTest* \
+//     --gtest_also_run_disabled_tests \
+//     --shields-perf-dat=/path/to/rs-ABPFilterParserData.dat \
+//     --shields-perf-trace=/path/to/trace.txt \
+//     --shields-perf-httpse-trie=/path/to/httpse.trie
+//
+// Each trace line is "<resource type> <tab url> <request url>", with the
+// resource type as a filter option name, e.g. "script" or "image". Without a
+// trace, a synthetic one of common third-party requests is used.
+//
+// Allocations are only counted in builds with the allocator shim.
+//
+// A trace recorded with --brave-shields-trace can be passed with
+// --shields-perf-recording to print its distributions and replay it through
+// decision caches of several sizes.
+
+namespace brave_shields {
+
+namespace {
+
+const char kDatSwitch[] = "shields-perf-dat";
+const char kTraceSwitch[] = "shields-perf-trace";
+const char kHTTPSETrieSwitch[] = "shields-perf-httpse-trie";
+const char kRecordingSwitch[] = "shields-perf-recording";
+
+const int kSyntheticSites = 500;
+const int kDecisionCacheCapacity = 1000;
+
+const size_t kReplayCacheCapacities[] = {100, 1000, 4000, 16000};
+
+const char* const kThirdPartyUrls[] = {
+  "https://www.googletagmanager.com/gtm.js?id=GTM-XXXX",
+  "https://www.google-analytics.com/analytics.js",
+  "https://securepubads.g.doubleclick.net/tag/js/gpt.js",
+  "https://pagead2.googlesyndication.com/pagead/js/adsbygoogle.js",
+  "https://connect.facebook.net/en_US/fbevents.js",
+  "https://static.criteo.net/js/ld/publishertag.js",
+  "https://cdn.jsdelivr.net/npm/jquery@3.5.1/dist/jquery.min.js",
+  "https://fonts.googleapis.com/css?family=Roboto",
+  "https://fonts.gstatic.com/s/roboto/v20/KFOmCnqEu92Fr1Mu4mxK.woff2",
+  "https://cdnjs.cloudflare.com/ajax/libs/lodash.js/4.17.15/lodash.min.js",
+  "https://platform.twitter.com/widgets.js",
+  "https://www.youtube.com/embed/dQw4w9WgXcQ",
+  "https://sb.scorecardresearch.com/beacon.js",
+  "https://c.amazon-adsystem.com/aax2/apstag.js",
+  "https://tpc.googlesyndication.com/simgad/123456789",
+};
+
+const char* const kFirstPartyPaths[] = {
+  "/",
+  "/static/js/main.js",
+  "/static/css/site.css",
+  "/images/logo.png",
+  "/api/v1/items?page=2",
+  "/ads/banner.gif",
+};
+
+const char* const kClasses[] = {
+  "header", "content", "ad-banner", "sidebar", "sponsored", "footer",
+};
+
+const char* const kIds[] = {
+  "main", "ad_container", "nav", "comments",
+};
+
+struct TraceEntry {
+  blink::mojom::ResourceType resource_type;
+  GURL tab_url;
+  GURL url;
+};
+
+blink::mojom::ResourceType FilterOptionToResourceType(
+    const std::string& filter_option) {
+  if (filter_option == "main_frame")
+    return blink::mojom::ResourceType::kMainFrame;
+  if (filter_option == "sub_frame" || filter_option == "subdocument")
+    return blink::mojom::ResourceType::kSubFrame;
+  if (filter_option == "stylesheet")
+    return blink::mojom::ResourceType::kStylesheet;
+  if (filter_option == "script")
+    return blink::mojom::ResourceType::kScript;
+  if (filter_option == "image")
+    return blink::mojom::ResourceType::kImage;
+  if (filter_option == "font")
+    return blink::mojom::ResourceType::kFontResource;
+  if (filter_option == "media")
+    return blink::mojom::ResourceType::kMedia;
+  if (filter_option == "xhr" || filter_option == "xmlhttprequest")
+    return blink::mojom::ResourceType::kXhr;
+  if (filter_option == "ping")
+    return blink::mojom::ResourceType::kPing;
+  return blink::mojom::ResourceType::kSubResource;
+}
+
+std::vector<TraceEntry> LoadTrace(const base::FilePath& path) {
+  std::vector<TraceEntry> trace;
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return trace;
+
+  for (const auto& line : base::SplitStringPiece(
+           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    const std::vector<std::string> fields = base::SplitString(
+        line, " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    if (fields.size() != 3)
+      continue;
+
+    TraceEntry entry = {FilterOptionToResourceType(fields[0]),
+                        GURL(fields[1]), GURL(fields[2])};
+    if (entry.tab_url.is_valid() && entry.url.is_valid())
+      trace.push_back(std::move(entry));
+  }
+  return trace;
+}
+
+// Every synthetic site loads its own resources plus the third-party ones, so
+// sites share hosts the way real browsing does.
+std::vector<TraceEntry> CreateSyntheticTrace() {
+  std::vector<TraceEntry> trace;
+  for (int i = 0; i < kSyntheticSites; i++) {
+    const GURL tab_url(base::StringPrintf("https://www.site%d.com/", i));
+    for (const char* path : kFirstPartyPaths) {
+      const std::string extension =
+          base::FilePath::FromUTF8Unsafe(path).Extension();
+      blink::mojom::ResourceType resource_type =
+          blink::mojom::ResourceType::kXhr;
+      if (extension == ".js")
+        resource_type = blink::mojom::ResourceType::kScript;
+      else if (extension == ".css")
+        resource_type = blink::mojom::ResourceType::kStylesheet;
+      else if (extension == ".png" || extension == ".gif")
+        resource_type = blink::mojom::ResourceType::kImage;
+      trace.push_back({resource_type, tab_url, tab_url.Resolve(path)});
+    }
+    for (const char* url : kThirdPartyUrls) {
+      trace.push_back(
+          {blink::mojom::ResourceType::kScript, tab_url, GURL(url)});
+    }
+  }
+  return trace;
+}
+
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+
+using base::allocator::AllocatorDispatch;
+
+std::atomic<bool> g_count_allocations(false);
+std::atomic<size_t> g_allocations(0);
+
+void CountAllocation() {
+  if (g_count_allocations.load(std::memory_order_relaxed))
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* CountingAlloc(const AllocatorDispatch* self,
+                    size_t size,
+                    void* context) {
+  CountAllocation();
+  return self->next->alloc_function(self->next, size, context);
+}
+
+void* CountingAllocZeroInitialized(const AllocatorDispatch* self,
+                                   size_t n,
+                                   size_t size,
+                                   void* context) {
+  CountAllocation();
+  return self->next->alloc_zero_initialized_function(self->next, n, size,
+                                                     context);
+}
+
+void* CountingAllocAligned(const AllocatorDispatch* self,
+                           size_t alignment,
+                           size_t size,
+                           void* context) {
+  CountAllocation();
+  return self->next->alloc_aligned_function(self->next, alignment, size,
+                                            context);
+}
+
+void* CountingRealloc(const AllocatorDispatch* self,
+                      void* address,
+                      size_t size,
+                      void* context) {
+  CountAllocation();
+  return self->next->realloc_function(self->next, address, size, context);
+}
+
+void CountingFree(const AllocatorDispatch* self, void* address, void* context) {
+  self->next->free_function(self->next, address, context);
+}
+
+size_t CountingGetSizeEstimate(const AllocatorDispatch* self,
+                               void* address,
+                               void* context) {
+  return self->next->get_size_estimate_function(self->next, address, context);
+}
+
+unsigned CountingBatchMalloc(const AllocatorDispatch* self,
+                             size_t size,
+                             void** results,
+                             unsigned num_requested,
+                             void* context) {
+  const unsigned count = self->next->batch_malloc_function(
+      self->next, size, results, num_requested, context);
+  if (g_count_allocations.load(std::memory_order_relaxed))
+    g_allocations.fetch_add(count, std::memory_order_relaxed);
+  return count;
+}
+
+void CountingBatchFree(const AllocatorDispatch* self,
+                       void** to_be_freed,
+                       unsigned num_to_be_freed,
+                       void* context) {
+  self->next->batch_free_function(self->next, to_be_freed, num_to_be_freed,
+                                  context);
+}
+
+void CountingFreeDefiniteSize(const AllocatorDispatch* self,
+                              void* address,
+                              size_t size,
+                              void* context) {
+  self->next->free_definite_size_function(self->next, address, size, context);
+}
+
+void* CountingAlignedMalloc(const AllocatorDispatch* self,
+                            size_t size,
+                            size_t alignment,
+                            void* context) {
+  CountAllocation();
+  return self->next->aligned_malloc_function(self->next, size, alignment,
+                                             context);
+}
+
+void* CountingAlignedRealloc(const AllocatorDispatch* self,
+                             void* address,
+                             size_t size,
+                             size_t alignment,
+                             void* context) {
+  CountAllocation();
+  return self->next->aligned_realloc_function(self->next, address, size,
+                                              alignment, context);
+}
+
+void CountingAlignedFree(const AllocatorDispatch* self,
+                         void* address,
+                         void* context) {
+  self->next->aligned_free_function(self->next, address, context);
+}
+
+AllocatorDispatch g_counting_dispatch = {
+  &CountingAlloc,
+  &CountingAllocZeroInitialized,
+  &CountingAllocAligned,
+  &CountingRealloc,
+  &CountingFree,
+  &CountingGetSizeEstimate,
+  &CountingBatchMalloc,
+  &CountingBatchFree,
+  &CountingFreeDefiniteSize,
+  &CountingAlignedMalloc,
+  &CountingAlignedRealloc,
+  &CountingAlignedFree,
+  nullptr,
+};
+
+#endif  // BUILDFLAG(USE_ALLOCATOR_SHIM)
+
+// Counts the allocations made on any thread while it is alive, background
+// threads of the test are idle and barely add to it
+class ScopedAllocationCounter {
+ public:
+  ScopedAllocationCounter() {
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+    g_allocations.store(0);
+    g_count_allocations.store(true);
+#endif
+  }
+
+  ~ScopedAllocationCounter() {
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+    g_count_allocations.store(false);
+#endif
+  }
+
+  // Returns -1 if allocations can't be counted
+  int64_t Get() const {
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+    return static_cast<int64_t>(g_allocations.load());
+#else
+    return -1;
+#endif
+  }
+};
+
+// Runs |run| for indexes 0 to |count| - 1 and prints the mean and
+// percentiles of the time per call, and the mean allocation count
+void Measure(const std::string& name,
+             size_t count,
+             const std::function<void(size_t)>& run) {
+  if (count == 0)
+    return;
+
+  std::vector<base::TimeDelta> timings;
+  timings.reserve(count);
+  base::TimeDelta total;
+  int64_t allocations = 0;
+  {
+    ScopedAllocationCounter counter;
+    for (size_t i = 0; i < count; i++) {
+      const base::TimeTicks start = base::TimeTicks::Now();
+      run(i);
+      const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+      timings.push_back(elapsed);
+      total += elapsed;
+    }
+    allocations = counter.Get();
+  }
+
+  std::sort(timings.begin(), timings.end());
+  std::cout << "[ PERF     ] " << name << ": " << count << " calls mean="
+      << total.InNanoseconds() / static_cast<int64_t>(count) << "ns p50="
+      << timings.at(count / 2).InNanoseconds() << "ns p99="
+      << timings.at(count * 99 / 100).InNanoseconds() << "ns";
+  // The vectors above are reserved before counting starts
+  if (allocations >= 0) {
+    std::cout << " allocs="
+        << base::StringPrintf("%.2f",
+                              static_cast<double>(allocations) / count);
+  }
+  std::cout << std::endl;
+}
+
+void PrintDistribution(const std::string& name,
+                       std::vector<uint32_t> values) {
+  if (values.empty())
+    return;
+
+  std::sort(values.begin(), values.end());
+  uint64_t total = 0;
+  for (const uint32_t value : values)
+    total += value;
+  std::cout << "[ TRACE    ] " << name << ": mean=" << total / values.size()
+      << "us p50=" << values.at(values.size() / 2) << "us p99="
+      << values.at(values.size() * 99 / 100) << "us max=" << values.back()
+      << "us" << std::endl;
+}
+
+std::string FormatPercent(size_t count, size_t total) {
+  return base::StringPrintf("%.1f%%", 100.0 * count / total);
+}
+
+}  // namespace
+
+class ShieldsPerfTest : public ::testing::Test {
+ public:
+  static void SetUpTestCase() {
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+    base::allocator::InsertAllocatorDispatch(&g_counting_dispatch);
+#endif
+  }
+
+  static void TearDownTestCase() {
+#if BUILDFLAG(USE_ALLOCATOR_SHIM)
+    base::allocator::RemoveAllocatorDispatchForTesting(&g_counting_dispatch);
+#endif
+  }
+
+ protected:
+  void SetUp() override {
+    const base::CommandLine& command_line =
+        *base::CommandLine::ForCurrentProcess();
+
+    base::FilePath dat_path = command_line.GetSwitchValuePath(kDatSwitch);
+    if (dat_path.empty()) {
+      ASSERT_TRUE(base::PathService::Get(brave::DIR_TEST_DATA, &dat_path));
+      dat_path = dat_path.AppendASCII("adblock-data")
+                     .AppendASCII("adblock-default")
+                     .AppendASCII("rs-ABPFilterParserData.dat");
+      std::cout << "[ PERF     ] no --" << kDatSwitch
+          << ", using the test list" << std::endl;
+    }
+    ASSERT_TRUE(dat_file_.Initialize(dat_path));
+    engine_ = std::make_shared<adblock::Engine>();
+    ASSERT_TRUE(engine_->deserialize(
+        reinterpret_cast<const char*>(dat_file_.data()), dat_file_.length()));
+
+    const base::FilePath trace_path =
+        command_line.GetSwitchValuePath(kTraceSwitch);
+    trace_ = trace_path.empty() ? CreateSyntheticTrace() : LoadTrace(trace_path);
+    ASSERT_FALSE(trace_.empty());
+
+    requests_.reserve(trace_.size());
+    for (const auto& entry : trace_) {
+      requests_.emplace_back(entry.url, entry.resource_type,
+                             entry.tab_url.host());
+    }
+
+    const base::FilePath trie_path =
+        command_line.GetSwitchValuePath(kHTTPSETrieSwitch);
+    if (!trie_path.empty()) {
+      httpse_trie_ = HTTPSERuleTrie::Load(trie_path);
+      ASSERT_TRUE(httpse_trie_);
+    }
+  }
+
+  AdBlockBaseService::EngineSnapshot CreateSnapshot() const {
+    AdBlockBaseService::EngineSnapshot snapshot;
+    snapshot.ad_block_client = engine_;
+    snapshot.decision_cache =
+        std::make_shared<ShardedLookupCache<AdBlockMatchResult>>(
+            kDecisionCacheCapacity);
+    return snapshot;
+  }
+
+  std::vector<std::string> GetTabHosts() const {
+    std::vector<std::string> hosts;
+    for (const auto& entry : trace_)
+      hosts.push_back(entry.tab_url.host());
+    std::sort(hosts.begin(), hosts.end());
+    hosts.erase(std::unique(hosts.begin(), hosts.end()), hosts.end());
+    return hosts;
+  }
+
+  base::MemoryMappedFile dat_file_;
+  std::shared_ptr<adblock::Engine> engine_;
+  std::vector<TraceEntry> trace_;
+  std::vector<AdBlockRequest> requests_;
+  std::unique_ptr<HTTPSERuleTrie> httpse_trie_;
+};
+
+TEST_F(ShieldsPerfTest, DISABLED_RequestPipeline) {
+  Measure("AdBlockRequest", trace_.size(), [this](size_t i) {
+    AdBlockRequest request(trace_[i].url, trace_[i].resource_type,
+                           trace_[i].tab_url.host());
+  });
+
+  // A cache too small to ever hit, so every request reaches the engine
+  AdBlockBaseService::EngineSnapshot uncached = CreateSnapshot();
+  uncached.decision_cache =
+      std::make_shared<ShardedLookupCache<AdBlockMatchResult>>(1, 1);
+  Measure("engine match", requests_.size(), [this, &uncached](size_t i) {
+    bool did_match_exception = false;
+    bool cancel_request_explicitly = false;
+    std::string mock_data_url;
+    AdBlockBaseService::ShouldStartRequest(uncached, requests_[i],
+                                           &did_match_exception,
+                                           &cancel_request_explicitly,
+                                           &mock_data_url);
+  });
+
+  AdBlockBaseService::EngineSnapshot cached = CreateSnapshot();
+  for (const auto& request : requests_) {
+    AdBlockBaseService::ShouldStartRequest(cached, request, nullptr, nullptr,
+                                           nullptr);
+  }
+  Measure("decision cache match", requests_.size(),
+          [this, &cached](size_t i) {
+    bool did_match_exception = false;
+    bool cancel_request_explicitly = false;
+    std::string mock_data_url;
+    AdBlockBaseService::ShouldStartRequest(cached, requests_[i],
+                                           &did_match_exception,
+                                           &cancel_request_explicitly,
+                                           &mock_data_url);
+  });
+
+  if (!httpse_trie_) {
+    std::cout << "[ PERF     ] no --" << kHTTPSETrieSwitch
+        << ", skipping HTTPS Everywhere" << std::endl;
+    return;
+  }
+  Measure("httpse rewrite", trace_.size(), [this](size_t i) {
+    const GURL& url = trace_[i].url;
+    if (!url.SchemeIs(url::kHttpScheme))
+      return;
+    for (const auto& match : httpse_trie_->FindRules(url.host())) {
+      std::unique_ptr<HTTPSERuleSet> rule_set =
+          HTTPSERuleSet::Parse(match.value);
+      if (rule_set && !rule_set->Apply(url.spec()).empty())
+        return;
+    }
+  });
+}
+
+TEST_F(ShieldsPerfTest, DISABLED_CosmeticQueries) {
+  const std::vector<std::string> hosts = GetTabHosts();
+
+  // What the service does on a cosmetic resources cache miss
+  Measure("hostname cosmetic resources", hosts.size(),
+          [this, &hosts](size_t i) {
+    base::Optional<base::Value> resources = base::JSONReader::Read(
+        engine_->hostnameCosmeticResources(hosts[i]));
+    if (resources)
+      CreateCosmeticStylesheet(*resources);
+  });
+
+  const std::vector<std::string> classes(std::begin(kClasses),
+                                         std::end(kClasses));
+  const std::vector<std::string> ids(std::begin(kIds), std::end(kIds));
+  Measure("hidden class id selectors", hosts.size(),
+          [this, &classes, &ids](size_t i) {
+    base::JSONReader::Read(
+        engine_->hiddenClassIdSelectors(classes, ids, {}));
+  });
+}
+
+TEST_F(ShieldsPerfTest, DISABLED_RecordedTrace) {
+  const base::FilePath path =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValuePath(
+          kRecordingSwitch);
+  if (path.empty()) {
+    std::cout << "[ PERF     ] no --" << kRecordingSwitch << ", skipping"
+        << std::endl;
+    return;
+  }
+  const std::vector<ShieldsTraceRecord> records = ReadShieldsTrace(path);
+  ASSERT_FALSE(records.empty());
+
+  size_t blocked = 0;
+  size_t cache_hits = 0;
+  size_t pending = 0;
+  size_t redirected = 0;
+  size_t helper_count = 0;
+  std::vector<uint32_t> totals;
+  for (const auto& record : records) {
+    blocked += !!(record.flags & ShieldsTraceRecord::kBlocked);
+    cache_hits += !!(record.flags & ShieldsTraceRecord::kDecisionCacheHit);
+    pending += !!(record.flags & ShieldsTraceRecord::kPending);
+    redirected += !!(record.flags & ShieldsTraceRecord::kRedirected);
+    helper_count = std::max<size_t>(helper_count, record.helper_count);
+    totals.push_back(record.total_us);
+  }
+  std::cout << "[ TRACE    ] " << records.size() << " requests blocked="
+      << FormatPercent(blocked, records.size()) << " decision cache hits="
+      << FormatPercent(cache_hits, records.size()) << " pending="
+      << FormatPercent(pending, records.size()) << " redirected="
+      << FormatPercent(redirected, records.size()) << std::endl;
+  PrintDistribution("request", std::move(totals));
+  for (size_t i = 0; i < helper_count; i++) {
+    std::vector<uint32_t> helper_times;
+    for (const auto& record : records) {
+      if (i < record.helper_count)
+        helper_times.push_back(record.helper_us[i]);
+    }
+    PrintDistribution(base::StringPrintf("helper %zu", i),
+                      std::move(helper_times));
+  }
+
+  // The decision cache is sharded by tab host and keyed by the request, the
+  // hashes stand in for both
+  std::vector<std::string> shard_keys;
+  std::vector<std::string> keys;
+  for (const auto& record : records) {
+    shard_keys.push_back(base::NumberToString(record.tab_host_hash));
+    keys.push_back(base::StringPrintf("%u %u", record.url_hash,
+                                      record.resource_type));
+  }
+  for (const size_t capacity : kReplayCacheCapacities) {
+    ShardedLookupCache<bool> cache(capacity);
+    Measure(base::StringPrintf("decision cache replay capacity=%zu", capacity),
+            records.size(), [&shard_keys, &keys, &cache](size_t i) {
+      bool value = false;
+      if (!cache.Get(shard_keys[i], keys[i], &value))
+        cache.Put(shard_keys[i], keys[i], true);
+    });
+    const LookupCacheStats stats = cache.GetStats();
+    std::cout << "[ TRACE    ] capacity=" << capacity << " hits="
+        << FormatPercent(stats.hits, stats.hits + stats.misses) << std::endl;
+  }
+}
+
+}  // namespace brave_shields
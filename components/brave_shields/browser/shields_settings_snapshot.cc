@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+
+#include "base/memory/ptr_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave_shields {
+
+namespace {
+
+const char kShieldsSettingsSnapshotCacheKey[] = "brave_shields_settings";
+
+// Number of origins whose settings are remembered per profile.
+constexpr size_t kMaxSnapshots = 100;
+
+}  // namespace
+
+ShieldsSettingsSnapshotCache::ShieldsSettingsSnapshotCache(Profile* profile)
+    : profile_(profile),
+      host_content_settings_map_(
+          HostContentSettingsMapFactory::GetForProfile(profile)),
+      snapshots_(kMaxSnapshots) {
+  host_content_settings_map_->AddObserver(this);
+}
+
+ShieldsSettingsSnapshotCache::~ShieldsSettingsSnapshotCache() {
+  host_content_settings_map_->RemoveObserver(this);
+}
+
+// static
+ShieldsSettingsSnapshot ShieldsSettingsSnapshotCache::Get(
+    Profile* profile,
+    const GURL& tab_origin) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  auto* cache = static_cast<ShieldsSettingsSnapshotCache*>(
+      profile->GetUserData(kShieldsSettingsSnapshotCacheKey));
+  if (!cache) {
+    cache = new ShieldsSettingsSnapshotCache(profile);
+    profile->SetUserData(kShieldsSettingsSnapshotCacheKey,
+                         base::WrapUnique(cache));
+  }
+  // Shields settings never apply to less than a whole origin.
+  return cache->GetForOrigin(tab_origin.GetOrigin());
+}
+
+ShieldsSettingsSnapshot ShieldsSettingsSnapshotCache::GetForOrigin(
+    const GURL& tab_origin) {
+  auto it = snapshots_.Get(tab_origin);
+  if (it != snapshots_.end()) {
+    return it->second;
+  }
+
+  ShieldsSettingsSnapshot snapshot;
+  snapshot.brave_shields_enabled =
+      GetBraveShieldsEnabled(profile_, tab_origin);
+  snapshot.ad_control_type = GetAdControlType(profile_, tab_origin);
+  snapshot.https_everywhere_enabled =
+      GetHTTPSEverywhereEnabled(profile_, tab_origin);
+  snapshot.allow_referrers = AllowReferrers(profile_, tab_origin);
+  snapshot.cosmetic_filtering_control_type =
+      GetCosmeticFilteringControlType(profile_, tab_origin);
+  snapshot.cookie_control_type = GetCookieControlType(profile_, tab_origin);
+  snapshot.fingerprinting_control_type =
+      GetFingerprintingControlType(profile_, tab_origin);
+  snapshots_.Put(tab_origin, snapshot);
+  return snapshot;
+}
+
+void ShieldsSettingsSnapshotCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type,
+    const std::string& resource_identifier) {
+  // All shields settings are stored as plugin settings, DEFAULT stands for
+  // changes to every type.
+  if (content_type == ContentSettingsType::PLUGINS ||
+      content_type == ContentSettingsType::DEFAULT) {
+    snapshots_.Clear();
+  }
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,67 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+
+#include <string>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/supports_user_data.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "url/gurl.h"
+
+class HostContentSettingsMap;
+class Profile;
+
+namespace brave_shields {
+
+// All the shields settings that apply to the pages of one origin.
+struct ShieldsSettingsSnapshot {
+  bool brave_shields_enabled = true;
+  ControlType ad_control_type = ControlType::BLOCK;
+  bool https_everywhere_enabled = true;
+  bool allow_referrers = false;
+  ControlType cosmetic_filtering_control_type = ControlType::BLOCK_THIRD_PARTY;
+  ControlType cookie_control_type = ControlType::BLOCK_THIRD_PARTY;
+  ControlType fingerprinting_control_type = ControlType::DEFAULT;
+};
+
+// Remembers the shields settings of recently visited origins so that the
+// requests of a page share a single set of content settings lookups. Dropped
+// whenever a shields content setting changes. Lives on the UI thread.
+class ShieldsSettingsSnapshotCache : public base::SupportsUserData::Data,
+                                     public content_settings::Observer {
+ public:
+  ~ShieldsSettingsSnapshotCache() override;
+
+  // Returns the settings for pages of |tab_origin| in |profile|. A full URL
+  // may be passed as well.
+  static ShieldsSettingsSnapshot Get(Profile* profile, const GURL& tab_origin);
+
+  // content_settings::Observer overrides:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type,
+                               const std::string& resource_identifier) override;
+
+ private:
+  explicit ShieldsSettingsSnapshotCache(Profile* profile);
+
+  ShieldsSettingsSnapshot GetForOrigin(const GURL& tab_origin);
+
+  Profile* profile_;  // NOT OWNED
+  scoped_refptr<HostContentSettingsMap> host_content_settings_map_;
+  base::MRUCache<GURL, ShieldsSettingsSnapshot> snapshots_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShieldsSettingsSnapshotCache);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+
+#include "base/macros.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "chrome/test/base/testing_profile.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using brave_shields::ControlType;
+using brave_shields::ShieldsSettingsSnapshot;
+using brave_shields::ShieldsSettingsSnapshotCache;
+
+class ShieldsSettingsSnapshotTest : public testing::Test {
+ public:
+  ShieldsSettingsSnapshotTest() = default;
+  ~ShieldsSettingsSnapshotTest() override = default;
+
+  void SetUp() override { profile_ = std::make_unique<TestingProfile>(); }
+
+  TestingProfile* profile() { return profile_.get(); }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShieldsSettingsSnapshotTest);
+};
+
+TEST_F(ShieldsSettingsSnapshotTest, Defaults) {
+  ShieldsSettingsSnapshot snapshot =
+      ShieldsSettingsSnapshotCache::Get(profile(), GURL("https://brave.com"));
+  EXPECT_TRUE(snapshot.brave_shields_enabled);
+  EXPECT_EQ(ControlType::BLOCK, snapshot.ad_control_type);
+  EXPECT_TRUE(snapshot.https_everywhere_enabled);
+  EXPECT_FALSE(snapshot.allow_referrers);
+}
+
+TEST_F(ShieldsSettingsSnapshotTest, InvalidatedBySettingChanges) {
+  GURL url("https://brave.com/path");
+  EXPECT_TRUE(
+      ShieldsSettingsSnapshotCache::Get(profile(), url).brave_shields_enabled);
+
+  brave_shields::SetBraveShieldsEnabled(profile(), false, url);
+  EXPECT_FALSE(
+      ShieldsSettingsSnapshotCache::Get(profile(), url).brave_shields_enabled);
+  // Other pages of the origin share the settings.
+  EXPECT_FALSE(ShieldsSettingsSnapshotCache::Get(
+                   profile(), GURL("https://brave.com/other"))
+                   .brave_shields_enabled);
+  EXPECT_TRUE(ShieldsSettingsSnapshotCache::Get(profile(),
+                                                GURL("https://example.com"))
+                  .brave_shields_enabled);
+
+  brave_shields::SetAdControlType(profile(), ControlType::ALLOW, url);
+  EXPECT_EQ(ControlType::ALLOW,
+            ShieldsSettingsSnapshotCache::Get(profile(), url).ad_control_type);
+}
@@ -0,0 +1,210 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_trace.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/task/post_task.h"
+#include "base/time/time.h"
+
+namespace brave_shields {
+
+namespace {
+
+const char kMagic[4] = {'B', 'S', 'H', 'T'};
+const uint32_t kVersion = 1;
+
+// Records are handed to the file sequence in batches of this size, or
+// younger when requests are few
+const size_t kBatchSize = 256;
+constexpr base::TimeDelta kMaxBatchAge = base::TimeDelta::FromSeconds(1);
+
+struct Header {
+  char magic[4];
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t capacity;
+  uint64_t written;
+  uint64_t reserved;
+};
+
+static_assert(sizeof(Header) == 32, "The header layout is part of the format");
+
+template <typename T>
+T SaturatedMicroseconds(base::TimeDelta delta) {
+  const int64_t microseconds = delta.InMicroseconds();
+  if (microseconds <= 0)
+    return 0;
+  return static_cast<T>(std::min<int64_t>(microseconds,
+                                          std::numeric_limits<T>::max()));
+}
+
+}  // namespace
+
+uint16_t ShieldsTraceMicroseconds16(base::TimeDelta delta) {
+  return SaturatedMicroseconds<uint16_t>(delta);
+}
+
+uint32_t ShieldsTraceMicroseconds32(base::TimeDelta delta) {
+  return SaturatedMicroseconds<uint32_t>(delta);
+}
+
+// Lives on the file sequence
+class ShieldsTraceWriter::File {
+ public:
+  File(const base::FilePath& path, uint32_t capacity)
+      : path_(path), capacity_(capacity) {}
+  ~File() = default;
+
+  void Write(std::vector<ShieldsTraceRecord> records) {
+    if (!file_.IsValid() && !Open())
+      return;
+
+    size_t index = 0;
+    while (index < records.size()) {
+      // Write up to the end of the ring at once
+      const uint32_t slot = static_cast<uint32_t>(written_ % capacity_);
+      const size_t count =
+          std::min<size_t>(records.size() - index, capacity_ - slot);
+      const int size = static_cast<int>(count * sizeof(ShieldsTraceRecord));
+      if (file_.Write(sizeof(Header) + slot * sizeof(ShieldsTraceRecord),
+                      reinterpret_cast<const char*>(&records[index]),
+                      size) != size) {
+        LOG(ERROR) << "Failed to write shields trace " << path_;
+        file_.Close();
+        return;
+      }
+      index += count;
+      written_ += count;
+    }
+    WriteHeader();
+  }
+
+ private:
+  bool Open() {
+    // Only try once, a trace which can't be written isn't worth retrying for
+    // every batch.
+    if (open_failed_)
+      return false;
+
+    file_.Initialize(path_,
+                     base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+    if (!file_.IsValid()) {
+      LOG(ERROR) << "Failed to create shields trace " << path_;
+      open_failed_ = true;
+      return false;
+    }
+    return WriteHeader();
+  }
+
+  bool WriteHeader() {
+    Header header = {};
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.record_size = sizeof(ShieldsTraceRecord);
+    header.capacity = capacity_;
+    header.written = written_;
+    return file_.Write(0, reinterpret_cast<const char*>(&header),
+                       sizeof(header)) == static_cast<int>(sizeof(header));
+  }
+
+  const base::FilePath path_;
+  const uint32_t capacity_;
+  base::File file_;
+  uint64_t written_ = 0;
+  bool open_failed_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(File);
+};
+
+ShieldsTraceWriter::ShieldsTraceWriter(const base::FilePath& path,
+                                       size_t capacity)
+    : task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::MayBlock(),
+           base::TaskPriority::BEST_EFFORT,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      file_(new File(path,
+                     static_cast<uint32_t>(std::max<size_t>(capacity, 1))),
+            base::OnTaskRunnerDeleter(task_runner_)) {
+  batch_.reserve(kBatchSize);
+  last_flush_ = base::TimeTicks::Now();
+}
+
+ShieldsTraceWriter::~ShieldsTraceWriter() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Flush();
+}
+
+void ShieldsTraceWriter::Add(const ShieldsTraceRecord& record) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  batch_.push_back(record);
+  if (batch_.size() >= kBatchSize ||
+      base::TimeTicks::Now() - last_flush_ >= kMaxBatchAge) {
+    Flush();
+  }
+}
+
+void ShieldsTraceWriter::Flush() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  last_flush_ = base::TimeTicks::Now();
+  if (batch_.empty())
+    return;
+
+  std::vector<ShieldsTraceRecord> batch;
+  batch.reserve(kBatchSize);
+  batch.swap(batch_);
+  // |file_| is deleted on |task_runner_| after this task has run
+  task_runner_->PostTask(FROM_HERE,
+                         base::BindOnce(&File::Write,
+                                        base::Unretained(file_.get()),
+                                        std::move(batch)));
+}
+
+std::vector<ShieldsTraceRecord> ReadShieldsTrace(const base::FilePath& path) {
+  std::vector<ShieldsTraceRecord> records;
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents) ||
+      contents.size() < sizeof(Header)) {
+    return records;
+  }
+
+  Header header;
+  memcpy(&header, contents.data(), sizeof(header));
+  if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion ||
+      header.record_size != sizeof(ShieldsTraceRecord) ||
+      header.capacity == 0) {
+    return records;
+  }
+
+  const uint64_t count =
+      std::min<uint64_t>(header.written, header.capacity);
+  if (contents.size() < sizeof(Header) + count * sizeof(ShieldsTraceRecord))
+    return records;
+
+  const char* data = contents.data() + sizeof(Header);
+  const uint64_t first =
+      header.written > header.capacity ? header.written % header.capacity : 0;
+  records.resize(count);
+  for (uint64_t i = 0; i < count; i++) {
+    const uint64_t slot = (first + i) % header.capacity;
+    memcpy(&records[i], data + slot * sizeof(ShieldsTraceRecord),
+           sizeof(ShieldsTraceRecord));
+  }
+  return records;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,93 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_TRACE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/sequence_checker.h"
+#include "base/sequenced_task_runner.h"
+#include "base/time/time.h"
+
+namespace base {
+class FilePath;
+}  // namespace base
+
+namespace brave_shields {
+
+// Helpers past this index are not timed individually.
+constexpr size_t kShieldsTraceMaxHelpers = 8;
+
+// One shields decision for a request. URLs and tab hosts are only kept as
+// hashes. Times are in microseconds and saturate at the maximum of their type.
+struct ShieldsTraceRecord {
+  enum Flags : uint8_t {
+    kBlocked = 1 << 0,
+    kDecisionCacheHit = 1 << 1,
+    // A helper had to wait, e.g. for the shields task runner.
+    kPending = 1 << 2,
+    kRedirected = 1 << 3,
+  };
+
+  uint32_t url_hash = 0;
+  uint32_t tab_host_hash = 0;
+  uint32_t total_us = 0;
+  // Time spent in each helper for the synchronous part of its work.
+  uint16_t helper_us[kShieldsTraceMaxHelpers] = {};
+  uint8_t resource_type = 0;
+  uint8_t flags = 0;
+  uint8_t helper_count = 0;
+  uint8_t reserved = 0;
+};
+
+static_assert(sizeof(ShieldsTraceRecord) == 32,
+              "Changing the record layout needs a new trace file version");
+
+uint16_t ShieldsTraceMicroseconds16(base::TimeDelta delta);
+uint32_t ShieldsTraceMicroseconds32(base::TimeDelta delta);
+
+// Writes records to a ring file holding the last |capacity| of them. Records
+// are batched in memory and written from a background sequence, so Add() only
+// costs a copy on the calling sequence. Batches are written once full or a
+// second old, and when the writer is destroyed.
+//
+// The file is a 32 byte header: "BSHT", version, record size, capacity and
+// the number of records ever written as a uint64; followed by the records,
+// all in host byte order. The oldest record is at index |written| % capacity
+// once the ring has wrapped.
+class ShieldsTraceWriter {
+ public:
+  ShieldsTraceWriter(const base::FilePath& path, size_t capacity);
+  ~ShieldsTraceWriter();
+
+  void Add(const ShieldsTraceRecord& record);
+  void Flush();
+
+ private:
+  class File;
+
+  std::vector<ShieldsTraceRecord> batch_;
+  base::TimeTicks last_flush_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  std::unique_ptr<File, base::OnTaskRunnerDeleter> file_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  DISALLOW_COPY_AND_ASSIGN(ShieldsTraceWriter);
+};
+
+// Returns the records of the ring file at |path| oldest first, or an empty
+// list if the file is missing or malformed. Blocks on file IO.
+std::vector<ShieldsTraceRecord> ReadShieldsTrace(const base::FilePath& path);
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_TRACE_H_
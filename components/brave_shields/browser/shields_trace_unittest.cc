@@ -0,0 +1,110 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_trace.h"
+
+#include <memory>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::ReadShieldsTrace;
+using brave_shields::ShieldsTraceRecord;
+using brave_shields::ShieldsTraceWriter;
+
+namespace {
+
+ShieldsTraceRecord CreateRecord(uint32_t url_hash) {
+  ShieldsTraceRecord record;
+  record.url_hash = url_hash;
+  record.tab_host_hash = 42;
+  record.total_us = 100 + url_hash;
+  record.helper_us[0] = 1;
+  record.helper_us[1] = 2;
+  record.helper_count = 2;
+  record.resource_type = 3;
+  record.flags = ShieldsTraceRecord::kBlocked;
+  return record;
+}
+
+std::vector<uint32_t> GetUrlHashes(
+    const std::vector<ShieldsTraceRecord>& records) {
+  std::vector<uint32_t> hashes;
+  for (const auto& record : records)
+    hashes.push_back(record.url_hash);
+  return hashes;
+}
+
+}  // namespace
+
+class ShieldsTraceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().AppendASCII("shields.trace");
+  }
+
+  void Write(size_t capacity, uint32_t count) {
+    auto writer = std::make_unique<ShieldsTraceWriter>(path_, capacity);
+    for (uint32_t i = 0; i < count; i++) {
+      writer->Add(CreateRecord(i));
+      // Spread the records over several writes
+      if (i % 3 == 2)
+        writer->Flush();
+    }
+    writer.reset();
+    task_environment_.RunUntilIdle();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+TEST_F(ShieldsTraceTest, RoundTrip) {
+  Write(16, 5);
+
+  const std::vector<ShieldsTraceRecord> records = ReadShieldsTrace(path_);
+  ASSERT_EQ(5u, records.size());
+  EXPECT_EQ((std::vector<uint32_t>{0, 1, 2, 3, 4}), GetUrlHashes(records));
+  EXPECT_EQ(42u, records[4].tab_host_hash);
+  EXPECT_EQ(104u, records[4].total_us);
+  EXPECT_EQ(2, records[4].helper_us[1]);
+  EXPECT_EQ(2, records[4].helper_count);
+  EXPECT_EQ(3, records[4].resource_type);
+  EXPECT_EQ(ShieldsTraceRecord::kBlocked, records[4].flags);
+}
+
+TEST_F(ShieldsTraceTest, KeepsLastRecordsOnceFull) {
+  Write(4, 10);
+
+  EXPECT_EQ((std::vector<uint32_t>{6, 7, 8, 9}),
+            GetUrlHashes(ReadShieldsTrace(path_)));
+}
+
+TEST_F(ShieldsTraceTest, MissingOrMalformedFile) {
+  EXPECT_TRUE(ReadShieldsTrace(path_).empty());
+
+  const char contents[] = "not a shields trace, but long enough for a header";
+  ASSERT_EQ(static_cast<int>(sizeof(contents)),
+            base::WriteFile(path_, contents, sizeof(contents)));
+  EXPECT_TRUE(ReadShieldsTrace(path_).empty());
+}
+
+TEST_F(ShieldsTraceTest, SaturatesMicroseconds) {
+  EXPECT_EQ(0, brave_shields::ShieldsTraceMicroseconds16(
+                   base::TimeDelta::FromMicroseconds(-5)));
+  EXPECT_EQ(12, brave_shields::ShieldsTraceMicroseconds16(
+                    base::TimeDelta::FromMicroseconds(12)));
+  EXPECT_EQ(65535, brave_shields::ShieldsTraceMicroseconds16(
+                       base::TimeDelta::FromSeconds(1)));
+  EXPECT_EQ(1000000u, brave_shields::ShieldsTraceMicroseconds32(
+                          base::TimeDelta::FromSeconds(1)));
+}
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_shields/browser/tracking_protection_service.h"
 
+#include <iterator>
 #include <utility>
 
 #include "base/bind.h"
@@ -17,6 +18,7 @@
 #include "content/public/browser/browser_thread.h"
 
 #if BUILDFLAG(BRAVE_STP_ENABLED)
+#include "base/hash/hash.h"
 #include "base/strings/string_split.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/tracking_protection_helper.h"
@@ -76,6 +78,11 @@ bool TrackingProtectionService::RenderFrameIdKey::operator==(
          frame_routing_id == other.frame_routing_id;
 }
 
+size_t TrackingProtectionService::RenderFrameIdKeyHash::operator()(
+    const RenderFrameIdKey& key) const {
+  return base::HashInts(key.render_process_id, key.frame_routing_id);
+}
+
 void TrackingProtectionService::SetStartingSiteForRenderFrame(
     GURL starting_site,
     int render_process_id,
@@ -106,9 +113,10 @@ void TrackingProtectionService::ModifyRenderFrameKey(int old_render_process_id,
   auto iter = render_frame_key_to_starting_site_url.find(old_key);
   if (iter != render_frame_key_to_starting_site_url.end()) {
     const RenderFrameIdKey new_key(new_render_process_id, new_render_frame_id);
-    render_frame_key_to_starting_site_url.insert(
-        std::pair<RenderFrameIdKey, GURL>(new_key, iter->second));
-    render_frame_key_to_starting_site_url.erase(old_key);
+    GURL starting_site = std::move(iter->second);
+    render_frame_key_to_starting_site_url.erase(iter);
+    render_frame_key_to_starting_site_url.emplace(new_key,
+                                                  std::move(starting_site));
   }
 }
 
@@ -181,8 +189,9 @@ void TrackingProtectionService::OnGetSTPDATFileData(std::string contents) {
 
 void TrackingProtectionService::UpdateFirstPartyStorageTrackers(
     std::vector<std::string> storage_trackers) {
-  first_party_storage_trackers_ =
-      base::flat_set<std::string>(std::move(storage_trackers));
+  first_party_storage_trackers_ = std::unordered_set<std::string>(
+      std::make_move_iterator(storage_trackers.begin()),
+      std::make_move_iterator(storage_trackers.end()));
 }
 
 #else  // !BUILDFLAG(BRAVE_STP_ENABLED)
@@ -6,17 +6,16 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_TRACKING_PROTECTION_SERVICE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_TRACKING_PROTECTION_SERVICE_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequenced_task_runner.h"
-#include "base/synchronization/lock.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/brave_shields/browser/buildflags/buildflags.h"  // For STP
@@ -94,18 +93,21 @@ class TrackingProtectionService : public LocalDataFilesObserver {
     bool operator<(const RenderFrameIdKey& other) const;
     bool operator==(const RenderFrameIdKey& other) const;
   };
+
+  struct RenderFrameIdKeyHash {
+    size_t operator()(const RenderFrameIdKey& key) const;
+  };
 #endif
 
  private:
 #if BUILDFLAG(BRAVE_STP_ENABLED)
-  base::flat_set<std::string> first_party_storage_trackers_;
-  std::map<RenderFrameIdKey, GURL> render_frame_key_to_starting_site_url;
+  // Looked up for every storage access, so hashed rather than sorted.
+  std::unordered_set<std::string> first_party_storage_trackers_;
+  // Touched for every frame. Entries go away with their frames.
+  std::unordered_map<RenderFrameIdKey, GURL, RenderFrameIdKeyHash>
+      render_frame_key_to_starting_site_url;
 #endif
 
-  std::vector<std::string> third_party_base_hosts_;
-  std::map<std::string, std::vector<std::string>> third_party_hosts_cache_;
-  base::Lock third_party_hosts_lock_;
-
   base::WeakPtrFactory<TrackingProtectionService> weak_factory_;
   base::WeakPtrFactory<TrackingProtectionService> weak_factory_io_thread_;
   DISALLOW_COPY_AND_ASSIGN(TrackingProtectionService);
@@ -14,6 +14,25 @@ const base::Feature kBraveAdblockCosmeticFiltering{
     "BraveAdblockCosmeticFiltering",
     base::FEATURE_ENABLED_BY_DEFAULT};
 
+// Injects the hostname specific cosmetic filters from the renderer as soon
+// as the document element is created, instead of from the brave extension.
+const base::Feature kBraveAdblockNativeCosmeticFiltering{
+    "BraveAdblockNativeCosmeticFiltering",
+    base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Matches network requests against immutable ad-block engine snapshots on
+// the thread pool instead of the single shields sequence.
+const base::Feature kBraveAdblockParallelMatching{
+    "BraveAdblockParallelMatching",
+    base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Registers regional filter list components at startup but only loads their
+// engines once a request or cosmetic query needs them, and unloads lists
+// that haven't matched anything for a while.
+const base::Feature kBraveAdblockLazyRegionalLists{
+    "BraveAdblockLazyRegionalLists",
+    base::FEATURE_DISABLED_BY_DEFAULT};
+
 const base::Feature kFingerprintingProtectionV2{
     "BraveFingerprintingProtectionV2",
     base::FEATURE_DISABLED_BY_DEFAULT};
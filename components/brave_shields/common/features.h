@@ -13,6 +13,9 @@ struct Feature;
 namespace brave_shields {
 namespace features {
 extern const base::Feature kBraveAdblockCosmeticFiltering;
+extern const base::Feature kBraveAdblockNativeCosmeticFiltering;
+extern const base::Feature kBraveAdblockParallelMatching;
+extern const base::Feature kBraveAdblockLazyRegionalLists;
 extern const base::Feature kFingerprintingProtectionV2;
 }  // namespace features
 }  // namespace brave_shields
@@ -0,0 +1,215 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_sync/bookmark_object_id_index.h"
+
+#include <vector>
+
+#include "base/logging.h"
+#include "components/bookmarks/browser/bookmark_model.h"
+#include "components/bookmarks/browser/bookmark_node.h"
+
+namespace brave_sync {
+
+namespace {
+
+std::string GetObjectId(const bookmarks::BookmarkNode* node) {
+  std::string object_id;
+  node->GetMetaInfo("object_id", &object_id);
+  return object_id;
+}
+
+}  // namespace
+
+BookmarkObjectIdIndex::BookmarkObjectIdIndex(bookmarks::BookmarkModel* model)
+    : model_(model) {
+  DCHECK(model_);
+  DCHECK(model_->loaded());
+  model_->AddObserver(this);
+  Rebuild();
+}
+
+BookmarkObjectIdIndex::~BookmarkObjectIdIndex() {
+  if (model_)
+    model_->RemoveObserver(this);
+}
+
+const bookmarks::BookmarkNode* BookmarkObjectIdIndex::Find(
+    const std::string& object_id) {
+  if (object_id.empty())
+    return nullptr;
+
+  IndexPendingNodes();
+
+  auto it = nodes_by_object_id_.find(object_id);
+  if (it == nodes_by_object_id_.end())
+    return nullptr;
+
+  // The object id could be replaced without notification after the node was
+  // indexed
+  std::vector<const bookmarks::BookmarkNode*> stale_nodes;
+  const bookmarks::BookmarkNode* found = nullptr;
+  for (const auto* node : it->second) {
+    if (GetObjectId(node) == object_id) {
+      found = node;
+      break;
+    }
+    stale_nodes.push_back(node);
+  }
+
+  for (const auto* node : stale_nodes) {
+    UnindexNode(node);
+    if (!IndexNode(node))
+      pending_nodes_.insert(node);
+  }
+
+  return found;
+}
+
+BookmarkObjectIdIndex::NodesSet BookmarkObjectIdIndex::GetDuplicatedNodes() {
+  IndexPendingNodes();
+
+  NodesSet nodes_with_duplicates;
+  for (const auto& item : nodes_by_object_id_) {
+    if (item.second.size() > 1)
+      nodes_with_duplicates.insert(item.second.begin(), item.second.end());
+  }
+  return nodes_with_duplicates;
+}
+
+void BookmarkObjectIdIndex::BookmarkModelLoaded(
+    bookmarks::BookmarkModel* model,
+    bool ids_reassigned) {
+  Rebuild();
+}
+
+void BookmarkObjectIdIndex::BookmarkModelBeingDeleted(
+    bookmarks::BookmarkModel* model) {
+  model_->RemoveObserver(this);
+  model_ = nullptr;
+  nodes_by_object_id_.clear();
+  object_ids_.clear();
+  pending_nodes_.clear();
+}
+
+void BookmarkObjectIdIndex::BookmarkNodeMoved(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* old_parent,
+    size_t old_index,
+    const bookmarks::BookmarkNode* new_parent,
+    size_t new_index) {
+  // Moved nodes are sent again with their object id
+  pending_nodes_.insert(new_parent->children()[new_index].get());
+}
+
+void BookmarkObjectIdIndex::BookmarkNodeAdded(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* parent,
+    size_t index) {
+  AddPendingSubtree(parent->children()[index].get());
+}
+
+void BookmarkObjectIdIndex::BookmarkNodeRemoved(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* parent,
+    size_t old_index,
+    const bookmarks::BookmarkNode* node,
+    const std::set<GURL>& no_longer_bookmarked) {
+  RemoveSubtree(node);
+}
+
+void BookmarkObjectIdIndex::BookmarkNodeChanged(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* node) {
+  pending_nodes_.insert(node);
+}
+
+void BookmarkObjectIdIndex::BookmarkMetaInfoChanged(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* node) {
+  pending_nodes_.insert(node);
+}
+
+void BookmarkObjectIdIndex::BookmarkNodeFaviconChanged(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* node) {}
+
+void BookmarkObjectIdIndex::BookmarkNodeChildrenReordered(
+    bookmarks::BookmarkModel* model,
+    const bookmarks::BookmarkNode* node) {}
+
+void BookmarkObjectIdIndex::BookmarkAllUserNodesRemoved(
+    bookmarks::BookmarkModel* model,
+    const std::set<GURL>& removed_urls) {
+  Rebuild();
+}
+
+void BookmarkObjectIdIndex::Rebuild() {
+  nodes_by_object_id_.clear();
+  object_ids_.clear();
+  pending_nodes_.clear();
+  AddPendingSubtree(model_->root_node());
+  IndexPendingNodes();
+}
+
+void BookmarkObjectIdIndex::AddPendingSubtree(
+    const bookmarks::BookmarkNode* node) {
+  pending_nodes_.insert(node);
+  for (const auto& child : node->children())
+    AddPendingSubtree(child.get());
+}
+
+void BookmarkObjectIdIndex::RemoveSubtree(const bookmarks::BookmarkNode* node) {
+  UnindexNode(node);
+  pending_nodes_.erase(node);
+  for (const auto& child : node->children())
+    RemoveSubtree(child.get());
+}
+
+void BookmarkObjectIdIndex::IndexPendingNodes() {
+  // Object ids of permanent nodes are replaced in place
+  for (const auto& node : model_->root_node()->children())
+    IndexNode(node.get());
+
+  std::unordered_set<const bookmarks::BookmarkNode*> nodes_without_id;
+  for (const auto* node : pending_nodes_) {
+    if (!IndexNode(node))
+      nodes_without_id.insert(node);
+  }
+  // Nodes get their object id when they are sent, keep checking them
+  pending_nodes_.swap(nodes_without_id);
+}
+
+bool BookmarkObjectIdIndex::IndexNode(const bookmarks::BookmarkNode* node) {
+  const std::string object_id = GetObjectId(node);
+  auto it = object_ids_.find(node);
+  if (it != object_ids_.end()) {
+    if (it->second == object_id)
+      return true;
+    UnindexNode(node);
+  }
+
+  if (object_id.empty())
+    return false;
+
+  nodes_by_object_id_[object_id].insert(node);
+  object_ids_[node] = object_id;
+  return true;
+}
+
+void BookmarkObjectIdIndex::UnindexNode(const bookmarks::BookmarkNode* node) {
+  auto it = object_ids_.find(node);
+  if (it == object_ids_.end())
+    return;
+
+  auto nodes_it = nodes_by_object_id_.find(it->second);
+  DCHECK(nodes_it != nodes_by_object_id_.end());
+  nodes_it->second.erase(node);
+  if (nodes_it->second.empty())
+    nodes_by_object_id_.erase(nodes_it);
+  object_ids_.erase(it);
+}
+
+}  // namespace brave_sync
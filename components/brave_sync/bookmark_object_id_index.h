@@ -0,0 +1,94 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SYNC_BOOKMARK_OBJECT_ID_INDEX_H_
+#define BRAVE_COMPONENTS_BRAVE_SYNC_BOOKMARK_OBJECT_ID_INDEX_H_
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "components/bookmarks/browser/bookmark_model_observer.h"
+
+namespace bookmarks {
+class BookmarkModel;
+class BookmarkNode;
+}  // namespace bookmarks
+
+namespace brave_sync {
+
+// Maps "object_id" meta info to bookmark nodes, so that records can be
+// applied without walking the whole bookmark tree.
+// Sync assigns object ids to nodes directly, without notifying the model
+// observers, so nodes which don't have an object id yet or were changed are
+// indexed again at next lookup, and found nodes are checked against their
+// current object id.
+class BookmarkObjectIdIndex : public bookmarks::BookmarkModelObserver {
+ public:
+  using NodesSet = std::set<const bookmarks::BookmarkNode*>;
+
+  // |model| should be loaded.
+  explicit BookmarkObjectIdIndex(bookmarks::BookmarkModel* model);
+  ~BookmarkObjectIdIndex() override;
+
+  BookmarkObjectIdIndex(const BookmarkObjectIdIndex&) = delete;
+  BookmarkObjectIdIndex& operator=(const BookmarkObjectIdIndex&) = delete;
+
+  // Returns null if there is no node with |object_id|.
+  const bookmarks::BookmarkNode* Find(const std::string& object_id);
+  // Returns all nodes which share their object id with another node.
+  NodesSet GetDuplicatedNodes();
+
+  // bookmarks::BookmarkModelObserver implementation
+  void BookmarkModelLoaded(bookmarks::BookmarkModel* model,
+                           bool ids_reassigned) override;
+  void BookmarkModelBeingDeleted(bookmarks::BookmarkModel* model) override;
+  void BookmarkNodeMoved(bookmarks::BookmarkModel* model,
+                         const bookmarks::BookmarkNode* old_parent,
+                         size_t old_index,
+                         const bookmarks::BookmarkNode* new_parent,
+                         size_t new_index) override;
+  void BookmarkNodeAdded(bookmarks::BookmarkModel* model,
+                         const bookmarks::BookmarkNode* parent,
+                         size_t index) override;
+  void BookmarkNodeRemoved(bookmarks::BookmarkModel* model,
+                           const bookmarks::BookmarkNode* parent,
+                           size_t old_index,
+                           const bookmarks::BookmarkNode* node,
+                           const std::set<GURL>& no_longer_bookmarked) override;
+  void BookmarkNodeChanged(bookmarks::BookmarkModel* model,
+                           const bookmarks::BookmarkNode* node) override;
+  void BookmarkMetaInfoChanged(bookmarks::BookmarkModel* model,
+                               const bookmarks::BookmarkNode* node) override;
+  void BookmarkNodeFaviconChanged(bookmarks::BookmarkModel* model,
+                                  const bookmarks::BookmarkNode* node) override;
+  void BookmarkNodeChildrenReordered(
+      bookmarks::BookmarkModel* model,
+      const bookmarks::BookmarkNode* node) override;
+  void BookmarkAllUserNodesRemoved(
+      bookmarks::BookmarkModel* model,
+      const std::set<GURL>& removed_urls) override;
+
+ private:
+  void Rebuild();
+  void AddPendingSubtree(const bookmarks::BookmarkNode* node);
+  void RemoveSubtree(const bookmarks::BookmarkNode* node);
+  void IndexPendingNodes();
+  // Returns false if |node| doesn't have an object id.
+  bool IndexNode(const bookmarks::BookmarkNode* node);
+  void UnindexNode(const bookmarks::BookmarkNode* node);
+
+  bookmarks::BookmarkModel* model_;  // Not owned
+  std::unordered_map<std::string, NodesSet> nodes_by_object_id_;
+  // Object id each indexed node was indexed with
+  std::unordered_map<const bookmarks::BookmarkNode*, std::string> object_ids_;
+  // Nodes which could get their object id without notification
+  std::unordered_set<const bookmarks::BookmarkNode*> pending_nodes_;
+};
+
+}  // namespace brave_sync
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SYNC_BOOKMARK_OBJECT_ID_INDEX_H_
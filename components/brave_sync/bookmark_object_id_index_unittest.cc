@@ -0,0 +1,105 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_sync/bookmark_object_id_index.h"
+
+#include <memory>
+
+#include "base/strings/utf_string_conversions.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_sync/tools.h"
+#include "components/bookmarks/browser/bookmark_model.h"
+#include "components/bookmarks/test/test_bookmark_client.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_sync {
+
+using bookmarks::BookmarkModel;
+using bookmarks::BookmarkNode;
+
+class BookmarkObjectIdIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    model_ = bookmarks::TestBookmarkClient::CreateModel();
+  }
+
+  const BookmarkNode* AddURL(const std::string& title,
+                             const std::string& object_id) {
+    const BookmarkNode* node = model_->AddURL(
+        model_->bookmark_bar_node(), 0, base::ASCIIToUTF16(title),
+        GURL("https://" + title + ".com/"));
+    if (!object_id.empty())
+      model_->SetNodeMetaInfo(node, "object_id", object_id);
+    return node;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  std::unique_ptr<BookmarkModel> model_;
+};
+
+TEST_F(BookmarkObjectIdIndexTest, FindExistingNodes) {
+  const BookmarkNode* node_a = AddURL("a", "1, 2, 3");
+  const BookmarkNode* node_b = AddURL("b", "4, 5, 6");
+
+  BookmarkObjectIdIndex index(model_.get());
+  EXPECT_EQ(node_a, index.Find("1, 2, 3"));
+  EXPECT_EQ(node_b, index.Find("4, 5, 6"));
+  EXPECT_EQ(nullptr, index.Find("7, 8, 9"));
+  EXPECT_EQ(nullptr, index.Find(""));
+}
+
+TEST_F(BookmarkObjectIdIndexTest, FollowsModelChanges) {
+  BookmarkObjectIdIndex index(model_.get());
+
+  const BookmarkNode* folder = model_->AddFolder(
+      model_->bookmark_bar_node(), 0, base::ASCIIToUTF16("folder"));
+  model_->SetNodeMetaInfo(folder, "object_id", "1, 2, 3");
+  const BookmarkNode* node = model_->AddURL(
+      folder, 0, base::ASCIIToUTF16("a"), GURL("https://a.com/"));
+  model_->SetNodeMetaInfo(node, "object_id", "4, 5, 6");
+  EXPECT_EQ(folder, index.Find("1, 2, 3"));
+  EXPECT_EQ(node, index.Find("4, 5, 6"));
+
+  model_->SetNodeMetaInfo(node, "object_id", "7, 8, 9");
+  EXPECT_EQ(nullptr, index.Find("4, 5, 6"));
+  EXPECT_EQ(node, index.Find("7, 8, 9"));
+
+  // Children are removed along with their folder
+  model_->Remove(folder);
+  EXPECT_EQ(nullptr, index.Find("1, 2, 3"));
+  EXPECT_EQ(nullptr, index.Find("7, 8, 9"));
+}
+
+TEST_F(BookmarkObjectIdIndexTest, ObjectIdSetWithoutNotification) {
+  BookmarkObjectIdIndex index(model_.get());
+
+  // Sync assigns object ids right on the node
+  const BookmarkNode* node = AddURL("a", "");
+  EXPECT_EQ(nullptr, index.Find("1, 2, 3"));
+  tools::AsMutable(node)->SetMetaInfo("object_id", "1, 2, 3");
+  EXPECT_EQ(node, index.Find("1, 2, 3"));
+
+  tools::AsMutable(model_->other_node())->SetMetaInfo("object_id", "4, 5, 6");
+  EXPECT_EQ(model_->other_node(), index.Find("4, 5, 6"));
+  tools::AsMutable(model_->other_node())->SetMetaInfo("object_id", "7, 8, 9");
+  EXPECT_EQ(nullptr, index.Find("4, 5, 6"));
+  EXPECT_EQ(model_->other_node(), index.Find("7, 8, 9"));
+}
+
+TEST_F(BookmarkObjectIdIndexTest, GetDuplicatedNodes) {
+  const BookmarkNode* node_a = AddURL("a", "1, 2, 3");
+  const BookmarkNode* node_b = AddURL("b", "1, 2, 3");
+  AddURL("c", "4, 5, 6");
+
+  BookmarkObjectIdIndex index(model_.get());
+  const BookmarkObjectIdIndex::NodesSet duplicated_nodes =
+      index.GetDuplicatedNodes();
+  EXPECT_EQ(2u, duplicated_nodes.size());
+  EXPECT_EQ(1u, duplicated_nodes.count(node_a));
+  EXPECT_EQ(1u, duplicated_nodes.count(node_b));
+}
+
+}  // namespace brave_sync
@@ -7,11 +7,31 @@
 
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
 
 namespace brave_sync {
 
 namespace {
 
+// Pops the next number off the dotted |order| string, empty segments are
+// skipped the same way OrderToIntVect does
+bool PopOrderNumber(base::StringPiece* order, int* number) {
+  while (!order->empty()) {
+    const size_t dot = order->find('.');
+    base::StringPiece segment = order->substr(0, dot);
+    *order = dot == base::StringPiece::npos ? base::StringPiece()
+                                            : order->substr(dot + 1);
+    segment = base::TrimWhitespaceASCII(segment, base::TRIM_ALL);
+    if (segment.empty())
+      continue;
+    bool b = base::StringToInt(segment, number);
+    CHECK(b);
+    CHECK_GE(*number, 0);
+    return true;
+  }
+  return false;
+}
+
 bool CompareOrder(const std::vector<int>& vec_left,
                   const std::vector<int>& vec_right) {
   // Use C++ stdlib
@@ -55,11 +75,31 @@ std::string ToOrderString(const std::vector<int>& vec_int) {
 
 bool CompareOrder(const std::string& left, const std::string& right) {
   // Return: true if left <  right
-  // Split each and compare as int vectors
-  std::vector<int> vec_left = OrderToIntVect(left);
-  std::vector<int> vec_right = OrderToIntVect(right);
+  // Compare as int vectors, numbers are parsed in place to avoid allocations
+  base::StringPiece rest_left(left);
+  base::StringPiece rest_right(right);
+  int number_left = 0;
+  int number_right = 0;
+  while (true) {
+    const bool has_left = PopOrderNumber(&rest_left, &number_left);
+    if (!PopOrderNumber(&rest_right, &number_right))
+      return false;
+    if (!has_left)
+      return true;
+    if (number_left != number_right)
+      return number_left < number_right;
+  }
+}
 
-  return CompareOrder(vec_left, vec_right);
+int CompareOrder(const std::vector<int>& left, base::StringPiece right) {
+  int number_right = 0;
+  for (const int number_left : left) {
+    if (!PopOrderNumber(&right, &number_right))
+      return 1;
+    if (number_left != number_right)
+      return number_left < number_right ? -1 : 1;
+  }
+  return PopOrderNumber(&right, &number_right) ? -1 : 0;
 }
 
 namespace {
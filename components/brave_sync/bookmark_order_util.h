@@ -9,11 +9,16 @@
 #include <string>
 #include <vector>
 
+#include "base/strings/string_piece.h"
+
 namespace brave_sync {
 
   std::vector<int> OrderToIntVect(const std::string& s);
   std::string ToOrderString(const std::vector<int>& vec_int);
   bool CompareOrder(const std::string& left, const std::string& right);
+  // Compares already parsed |left| with |right| without allocating, returns
+  // negative if left < right, 0 if they are equal and positive otherwise
+  int CompareOrder(const std::vector<int>& left, base::StringPiece right);
   std::string GetOrder(const std::string& prev,
                        const std::string& next,
                        const std::string& parent);
@@ -78,6 +78,23 @@ TEST(BookmarkOrderUtilTest, CompareOrder) {
 
   EXPECT_TRUE(CompareOrder("2.0.8.10", "2.0.8.11"));
   EXPECT_TRUE(CompareOrder("2.0.8.11", "2.0.8.11.1"));
+
+  // Empty segments and whitespace are ignored as in OrderToIntVect
+  EXPECT_FALSE(CompareOrder("1..2", "1.2"));
+  EXPECT_FALSE(CompareOrder("1.2", "1. 2"));
+  EXPECT_TRUE(CompareOrder("1.2.", "1.2.1"));
+}
+
+TEST(BookmarkOrderUtilTest, CompareParsedOrder) {
+  EXPECT_EQ(CompareOrder(std::vector<int>(), ""), 0);
+  EXPECT_EQ(CompareOrder(std::vector<int>({1, 0, 1}), "1.0.1"), 0);
+  EXPECT_EQ(CompareOrder(std::vector<int>({1, 0, 1}), "1..0.1"), 0);
+  EXPECT_LT(CompareOrder(std::vector<int>({1, 0, 1}), "1.0.2"), 0);
+  EXPECT_LT(CompareOrder(std::vector<int>({1, 0, 1}), "1.0.1.1"), 0);
+  EXPECT_LT(CompareOrder(std::vector<int>({2, 11}), "2.12"), 0);
+  EXPECT_GT(CompareOrder(std::vector<int>({2, 11}), "2.2"), 0);
+  EXPECT_GT(CompareOrder(std::vector<int>({1, 0, 1, 1}), "1.0.1"), 0);
+  EXPECT_GT(CompareOrder(std::vector<int>({1}), ""), 0);
 }
 
 TEST(BookmarkOrderUtilTest, GetOrder) {
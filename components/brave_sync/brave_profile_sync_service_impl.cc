@@ -6,7 +6,6 @@
 #include "brave/components/brave_sync/brave_profile_sync_service_impl.h"
 
 #include <algorithm>
-#include <map>
 #include <set>
 #include <utility>
 #include <vector>
@@ -16,6 +15,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
+#include "brave/components/brave_sync/bookmark_object_id_index.h"
 #include "brave/components/brave_sync/brave_sync_prefs.h"
 #include "brave/components/brave_sync/brave_sync_service_observer.h"
 #include "brave/components/brave_sync/client/brave_sync_client_impl.h"
@@ -36,7 +36,6 @@
 #include "components/sync/engine_impl/syncer.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/network_interfaces.h"
-#include "ui/base/models/tree_node_iterator.h"
 
 namespace brave_sync {
 
@@ -58,6 +57,10 @@ const int BraveProfileSyncServiceImpl::kMaxSendRetries =
 
 namespace {
 
+// While nothing changes on either side devices are fetched this often instead
+// of on every poll cycle
+constexpr int kIdleFetchDevicesIntervalMinutes = 10;
+
 AccountInfo GetDummyAccountInfo() {
   AccountInfo account_info;
   account_info.account_id = CoreAccountId::FromString("dummy_account_id");
@@ -107,21 +110,6 @@ RecordsListPtr CreateDeviceRecord(const std::string& device_name,
   return records;
 }
 
-const bookmarks::BookmarkNode* FindByObjectId(bookmarks::BookmarkModel* model,
-                                              const std::string& object_id) {
-  ui::TreeNodeIterator<const bookmarks::BookmarkNode> iterator(
-      model->root_node());
-  while (iterator.has_next()) {
-    const bookmarks::BookmarkNode* node = iterator.Next();
-    std::string node_object_id;
-    node->GetMetaInfo("object_id", &node_object_id);
-
-    if (!node_object_id.empty() && object_id == node_object_id)
-      return node;
-  }
-  return nullptr;
-}
-
 std::unique_ptr<SyncRecord> CreateDeleteBookmarkByObjectId(
     const prefs::Prefs* brave_sync_prefs,
     const std::string& object_id) {
@@ -169,23 +157,7 @@ SyncRecordPtr PrepareResolvedDevice(SyncDevice* device,
   return record;
 }
 
-using NodesSet = std::set<const bookmarks::BookmarkNode*>;
-using ObjectIdToNodes = std::map<std::string, NodesSet>;
-
-void FillObjectsMap(const bookmarks::BookmarkNode* parent,
-                    ObjectIdToNodes* object_id_nodes) {
-  for (size_t i = 0; i < parent->children().size(); ++i) {
-    const bookmarks::BookmarkNode* current_child = parent->children()[i].get();
-    std::string object_id;
-    if (current_child->GetMetaInfo("object_id", &object_id) &&
-        !object_id.empty()) {
-      (*object_id_nodes)[object_id].insert(current_child);
-    }
-    if (current_child->is_folder()) {
-      FillObjectsMap(current_child, object_id_nodes);
-    }
-  }
-}
+using NodesSet = BookmarkObjectIdIndex::NodesSet;
 
 void AddDeletedChildren(const BookmarkNode* node, NodesSet* deleted_nodes) {
   for (const auto& child : node->children()) {
@@ -196,18 +168,9 @@ void AddDeletedChildren(const BookmarkNode* node, NodesSet* deleted_nodes) {
   }
 }
 
-void ClearDuplicatedNodes(ObjectIdToNodes* object_id_nodes,
+void ClearDuplicatedNodes(const NodesSet& nodes_with_duplicates,
                           bookmarks::BookmarkModel* model) {
   size_t nodes_recreated = 0;
-  NodesSet nodes_with_duplicates;
-  for (ObjectIdToNodes::iterator it_object_id = object_id_nodes->begin();
-       it_object_id != object_id_nodes->end(); ++it_object_id) {
-    const NodesSet& nodes = it_object_id->second;
-    if (nodes.size() > 1) {
-      nodes_with_duplicates.insert(nodes.begin(), nodes.end());
-    }
-  }
-
   NodesSet deleted_nodes;
   for (const bookmarks::BookmarkNode* node : nodes_with_duplicates) {
     if (deleted_nodes.find(node) != deleted_nodes.end()) {
@@ -638,6 +601,9 @@ void BraveProfileSyncServiceImpl::OnGetExistingObjects(
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   // TODO(bridiver) - what do we do with is_truncated ?
   // It appears to be ignored in b-l
+  if (records && !records->empty())
+    fetched_new_records_ = true;
+
   if (category_name == kBookmarks) {
     DCHECK(model_->loaded());
     if (!IsTimeEmpty(last_record_time_stamp)) {
@@ -687,13 +653,8 @@ void BraveProfileSyncServiceImpl::OnResolvedSyncRecords(
     }
 
     // Send records to syncer
-    if (get_record_cb_) {
-      backend_task_runner_->PostTask(
-          FROM_HERE, base::BindOnce(&DoDispatchGetRecordsCallback,
-                                    std::move(get_record_cb_),
-                                    std::move(pending_received_records_)));
-    }
-    SignalWaitableEvent();
+    if (get_record_cb_)
+      FinishPollSyncCycle(std::move(pending_received_records_));
   } else if (category_name == kHistorySites) {
     NOTIMPLEMENTED();
   }
@@ -762,11 +723,12 @@ bool BraveProfileSyncServiceImpl::IsAuthenticatedAccountPrimary() const {
 void BraveProfileSyncServiceImpl::OnConnectionChanged(
     network::mojom::ConnectionType type) {
   if (type == network::mojom::ConnectionType::CONNECTION_NONE)
-    SignalWaitableEvent();
+    FinishPollSyncCycle(nullptr);
 }
 
 void BraveProfileSyncServiceImpl::Shutdown() {
-  SignalWaitableEvent();
+  FinishPollSyncCycle(nullptr);
+  object_id_index_.reset();
   syncer::ProfileSyncService::Shutdown();
 }
 
@@ -791,7 +753,7 @@ void BraveProfileSyncServiceImpl::NotifyHaveSyncWords(
 }
 
 void BraveProfileSyncServiceImpl::ResetSyncInternal() {
-  SignalWaitableEvent();
+  FinishPollSyncCycle(nullptr);
   brave_sync_prefs_->Clear();
 
   brave_sync_ready_ = false;
@@ -847,9 +809,8 @@ bool BraveProfileSyncServiceImpl::MigrateDuplicatedBookmarksObjectIds(
   // Copying bookmarks through brave://bookmarks page could duplicate brave sync
   // metadata, which caused crash during chromium sync run
   // Go through nodes and re-create those ones who have duplicated object_id
-  ObjectIdToNodes object_id_nodes;
-  FillObjectsMap(model->root_node(), &object_id_nodes);
-  ClearDuplicatedNodes(&object_id_nodes, model);
+  BookmarkObjectIdIndex object_id_index(model);
+  ClearDuplicatedNodes(object_id_index.GetDuplicatedNodes(), model);
 
   profile->GetPrefs()->SetInteger(prefs::kDuplicatedBookmarksMigrateVersion, 2);
   return true;
@@ -904,9 +865,17 @@ BraveProfileSyncServiceImpl::BookmarkNodeToSyncBookmark(
   return record;
 }
 
+const bookmarks::BookmarkNode* BraveProfileSyncServiceImpl::FindByObjectId(
+    const std::string& object_id) {
+  DCHECK(model_);
+  if (!object_id_index_)
+    object_id_index_ = std::make_unique<BookmarkObjectIdIndex>(model_);
+  return object_id_index_->Find(object_id);
+}
+
 void BraveProfileSyncServiceImpl::SaveSyncEntityInfo(
     const jslib::SyncRecord* record) {
-  auto* node = FindByObjectId(model_, record->objectId);
+  auto* node = FindByObjectId(record->objectId);
   // no need to save for DELETE
   if (node) {
     auto& bookmark = record->GetBookmark();
@@ -931,7 +900,7 @@ void BraveProfileSyncServiceImpl::LoadSyncEntityInfo(
   auto* bookmark = record->mutable_bookmark();
   if (!bookmark->metaInfo.empty())
     return;
-  auto* node = FindByObjectId(model_, record->objectId);
+  auto* node = FindByObjectId(record->objectId);
   if (node) {
     AddSyncEntityInfo(bookmark, node, "position_in_parent");
     AddSyncEntityInfo(bookmark, node, "version");
@@ -1081,7 +1050,7 @@ void BraveProfileSyncServiceImpl::CreateResolveList(
     }
     auto resolved_record = std::make_unique<SyncRecordAndExisting>();
     resolved_record->first = SyncRecord::Clone(*record);
-    auto* node = FindByObjectId(model_, record->objectId);
+    auto* node = FindByObjectId(record->objectId);
     if (node) {
       resolved_record->second = BookmarkNodeToSyncBookmark(node);
     }
@@ -1273,10 +1242,19 @@ void BraveProfileSyncServiceImpl::FetchDevices() {
       {brave_sync::jslib_const::kPreferences}, start_at_time, 1000);
 }
 
-void BraveProfileSyncServiceImpl::OnPollSyncCycle(GetRecordsCallback cb,
-                                                  base::WaitableEvent* wevent) {
-  if (!brave_sync_prefs_->GetSyncEnabled())
+void BraveProfileSyncServiceImpl::OnPollSyncCycle(GetRecordsCallback cb) {
+  // A cycle which is still waiting for records is finished without them, the
+  // scheduler only asks again once it got an answer
+  FinishPollSyncCycle(nullptr);
+  get_record_cb_ = std::move(cb);
+
+  if (!brave_sync_prefs_->GetSyncEnabled()) {
+    FinishPollSyncCycle(nullptr);
     return;
+  }
+
+  const bool idle = IsPollSyncCycleIdle();
+  fetched_new_records_ = false;
 
   if (IsTimeEmpty(brave_sync_prefs_->GetLastFetchTime())) {
     SendCreateDevice();
@@ -1292,29 +1270,48 @@ void BraveProfileSyncServiceImpl::OnPollSyncCycle(GetRecordsCallback cb,
     send_device_id_v2_update_ = false;
   }
 
-  FetchDevices();
+  if (!idle || base::Time::Now() - brave_sync_prefs_->GetLastFetchTime() >=
+                   base::TimeDelta::FromMinutes(
+                       kIdleFetchDevicesIntervalMinutes)) {
+    FetchDevices();
+  }
 
   if (!brave_sync_ready_) {
-    wevent->Signal();
+    FinishPollSyncCycle(nullptr);
     return;
   }
 
-  get_record_cb_ = std::move(cb);
-  wevent_ = wevent;
-
   const bool bookmarks = brave_sync_prefs_->GetSyncBookmarksEnabled();
   const bool history = brave_sync_prefs_->GetSyncHistoryEnabled();
   const bool preferences = brave_sync_prefs_->GetSyncSiteSettingsEnabled();
   FetchSyncRecords(bookmarks, history, preferences, 1000);
-  ResendSyncRecords(jslib_const::SyncRecordType_BOOKMARKS);
+  if (!idle)
+    ResendSyncRecords(jslib_const::SyncRecordType_BOOKMARKS);
+}
+
+bool BraveProfileSyncServiceImpl::IsPollSyncCycleIdle() const {
+  return brave_sync_ready_ && !fetched_new_records_ &&
+         !send_device_id_v2_update_ &&
+         !IsTimeEmpty(brave_sync_prefs_->GetLastFetchTime()) &&
+         brave_sync_prefs_->GetRecordsToResend().empty();
 }
 
-void BraveProfileSyncServiceImpl::SignalWaitableEvent() {
-  std::move(get_record_cb_);
-  if (wevent_ && !wevent_->IsSignaled()) {
-    wevent_->Signal();
-    wevent_ = nullptr;
+void BraveProfileSyncServiceImpl::FinishPollSyncCycle(
+    std::unique_ptr<RecordsList> records) {
+  if (!get_record_cb_)
+    return;
+
+  // The syncer resumes the cycle on the sync sequence, without a running
+  // engine there is no cycle to resume
+  if (!backend_task_runner_) {
+    get_record_cb_.Reset();
+    return;
   }
+
+  backend_task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(&DoDispatchGetRecordsCallback, std::move(get_record_cb_),
+                     std::move(records)));
 }
 
 BraveSyncService* BraveProfileSyncServiceImpl::GetSyncService() const {
@@ -1354,7 +1351,7 @@ void BraveProfileSyncServiceImpl::ResendSyncRecords(
     DCHECK(model_->loaded());
 
     for (auto& object_id : records_to_resend) {
-      auto* node = FindByObjectId(model_, object_id);
+      auto* node = FindByObjectId(object_id);
 
       // Check resend interval
       const base::DictionaryValue* meta =
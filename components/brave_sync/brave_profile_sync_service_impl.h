@@ -71,6 +71,8 @@ namespace prefs {
 class Prefs;
 }  // namespace prefs
 
+class BookmarkObjectIdIndex;
+
 using bookmarks::BookmarkModel;
 using bookmarks::BookmarkNode;
 
@@ -182,8 +184,7 @@ class BraveProfileSyncServiceImpl
   syncer::ModelTypeSet GetPreferredDataTypes() const override;
 
   void OnNudgeSyncCycle(brave_sync::RecordsListPtr records_list) override;
-  void OnPollSyncCycle(brave_sync::GetRecordsCallback cb,
-                       base::WaitableEvent* wevent) override;
+  void OnPollSyncCycle(brave_sync::GetRecordsCallback cb) override;
 
   BraveSyncService* GetSyncService() const override;
 
@@ -221,6 +222,8 @@ class BraveProfileSyncServiceImpl
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest, SetSyncDisabled);
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest, IsSyncReadyOnNewProfile);
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest, SetThisDeviceCreatedTime);
+  FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest,
+                           IdlePollSyncCycleSkipsDevices);
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest, InitialFetchesStartWithZero);
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest, DeviceIdV2Migration);
   FRIEND_TEST_ALL_PREFIXES(::BraveSyncServiceTest,
@@ -240,7 +243,11 @@ class BraveProfileSyncServiceImpl
 
   friend class ::BraveSyncServiceTest;
 
-  void SignalWaitableEvent();
+  // True when nothing is waiting to be sent and the last poll cycle fetched
+  // no new records, devices and resends are skipped then
+  bool IsPollSyncCycleIdle() const;
+  // Hands |records| to the syncer waiting for the current poll cycle
+  void FinishPollSyncCycle(std::unique_ptr<RecordsList> records);
   void FetchSyncRecords(const bool bookmarks,
                         const bool history,
                         const bool preferences,
@@ -265,6 +272,8 @@ class BraveProfileSyncServiceImpl
 
   std::unique_ptr<jslib::SyncRecord> BookmarkNodeToSyncBookmark(
       const bookmarks::BookmarkNode* node);
+  // Model should be loaded
+  const bookmarks::BookmarkNode* FindByObjectId(const std::string& object_id);
   // These SyncEntityInfo is for legacy device who doesn't send meta info for
   // sync entity
   void SaveSyncEntityInfo(const jslib::SyncRecord* record);
@@ -322,12 +331,14 @@ class BraveProfileSyncServiceImpl
   Uint8Array seed_;
 
   brave_sync::GetRecordsCallback get_record_cb_;
-  base::WaitableEvent* wevent_ = nullptr;
+  bool fetched_new_records_ = false;
 
   // Registrar used to monitor the brave_profile prefs.
   PrefChangeRegistrar brave_pref_change_registrar_;
 
   bookmarks::BookmarkModel* model_ = nullptr;
+  // Created on first lookup, so that it only observes |model_| while syncing
+  std::unique_ptr<BookmarkObjectIdIndex> object_id_index_;
 
   std::unique_ptr<BraveSyncClient> brave_sync_client_;
 
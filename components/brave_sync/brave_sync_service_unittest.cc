@@ -857,15 +857,40 @@ TEST_F(BraveSyncServiceTest, SetThisDeviceCreatedTime) {
 
   brave_sync::GetRecordsCallback on_get_records =
       base::BindOnce(&OnGetRecordsStub);
-  base::WaitableEvent we;
   EXPECT_CALL(*sync_client(), SendSyncRecords(kPreferences, _));
   EXPECT_CALL(*sync_client(), SendFetchSyncRecords);
-  sync_service()->OnPollSyncCycle(std::move(on_get_records), &we);
+  sync_service()->OnPollSyncCycle(std::move(on_get_records));
 
   EXPECT_FALSE(brave_sync::tools::IsTimeEmpty(
       sync_service()->this_device_created_time_));
 }
 
+TEST_F(BraveSyncServiceTest, IdlePollSyncCycleSkipsDevices) {
+  EXPECT_CALL(*sync_client(), OnSyncEnabledChanged).Times(1);
+  EXPECT_CALL(*observer(), OnSyncStateChanged).Times(AtLeast(1));
+  brave_sync_prefs()->SetSyncEnabled(true);
+  brave_sync_prefs()->SetSyncBookmarksEnabled(true);
+  brave_sync_prefs()->SetThisDeviceId("1");
+  brave_sync_prefs()->SetThisDeviceIdV2("beef01");
+  brave_sync_prefs()->SetLastFetchTime(base::Time::Now());
+  sync_service()->brave_sync_ready_ = true;
+
+  const std::vector<std::string> devices = {kPreferences};
+  const std::vector<std::string> bookmarks = {kBookmarks};
+
+  // Nothing was fetched last time and nothing waits to be resent
+  EXPECT_CALL(*sync_client(), SendCompact(kBookmarks)).Times(AtLeast(1));
+  EXPECT_CALL(*sync_client(), SendFetchSyncRecords(devices, _, _)).Times(0);
+  EXPECT_CALL(*sync_client(), SendFetchSyncRecords(bookmarks, _, _)).Times(1);
+  sync_service()->OnPollSyncCycle(base::BindOnce(&OnGetRecordsStub));
+
+  // Devices are fetched again once a fetch brings new records
+  sync_service()->fetched_new_records_ = true;
+  EXPECT_CALL(*sync_client(), SendFetchSyncRecords(devices, _, _)).Times(1);
+  EXPECT_CALL(*sync_client(), SendFetchSyncRecords(bookmarks, _, _)).Times(1);
+  sync_service()->OnPollSyncCycle(base::BindOnce(&OnGetRecordsStub));
+}
+
 TEST_F(BraveSyncServiceTest, OnSyncReadyNewToSync) {
   sync_prefs()->SetSyncRequested(false);
   EXPECT_CALL(*observer(), OnSyncStateChanged);
@@ -1108,10 +1133,9 @@ TEST_F(BraveSyncServiceTest, GetDevicesWithFetchSyncRecords) {
 
   brave_sync::GetRecordsCallback on_get_records =
       base::BindOnce(&OnGetRecordsStub);
-  base::WaitableEvent we;
   EXPECT_CALL(*sync_client(), SendSyncRecords("PREFERENCES", _));
   EXPECT_CALL(*sync_client(), SendFetchSyncRecords(_, base::Time(), _));
-  sync_service()->OnPollSyncCycle(std::move(on_get_records), &we);
+  sync_service()->OnPollSyncCycle(std::move(on_get_records));
   EXPECT_FALSE(IsTimeEmpty(sync_service()->this_device_created_time_));
 
   // Emulate we received this device
@@ -1263,10 +1287,9 @@ TEST_F(BraveSyncServiceTest, DeviceIdV2Migration) {
                                                    "device0", device_id_v2)))
   .Times(1);
 
-  base::WaitableEvent we;
   brave_sync::GetRecordsCallback on_get_records =
       base::BindOnce(&OnGetRecordsStub);
-  sync_service()->OnPollSyncCycle(std::move(on_get_records), &we);
+  sync_service()->OnPollSyncCycle(std::move(on_get_records));
 }
 
 TEST_F(BraveSyncServiceTest, DeviceIdV2MigrationDupDeviceId) {
@@ -1323,10 +1346,9 @@ TEST_F(BraveSyncServiceTest, DeviceIdV2MigrationDupDeviceId) {
                                                    "device1", device_id_v2)))
   .Times(1);
 
-  base::WaitableEvent we;
   brave_sync::GetRecordsCallback on_get_records =
       base::BindOnce(&OnGetRecordsStub);
-  sync_service()->OnPollSyncCycle(std::move(on_get_records), &we);
+  sync_service()->OnPollSyncCycle(std::move(on_get_records));
 }
 
 TEST_F(BraveSyncServiceTest, IsOtherBookmarksFolder) {
@@ -5,18 +5,28 @@
 
 #include "brave/components/brave_sync/client/brave_sync_client_impl.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/bind.h"
+#include "base/bind_helpers.h"
 #include "base/logging.h"
 #include "base/one_shot_event.h"
+#include "base/sequenced_task_runner.h"
+#include "base/task/post_task.h"
+#include "base/task_runner_util.h"
+#include "base/values.h"
 #include "brave/browser/extensions/api/brave_sync_event_router.h"
 #include "brave/common/extensions/api/brave_sync.h"
 #include "brave/common/extensions/extension_constants.h"
 #include "brave/components/brave_sync/brave_sync_prefs.h"
 #include "brave/components/brave_sync/client/client_ext_impl_data.h"
 #include "brave/components/brave_sync/grit/brave_sync_resources.h"
+#include "brave/components/brave_sync/jslib_messages.h"
 #include "chrome/browser/extensions/component_loader.h"
 #include "chrome/browser/extensions/extension_service.h"
 #include "chrome/browser/profiles/profile.h"
@@ -26,6 +36,48 @@
 
 namespace brave_sync {
 
+namespace {
+
+// Records sent in one event to the extension, the first sync of a large
+// bookmark set would otherwise go out as a single huge message
+const size_t kMaxRecordsPerEvent = 200;
+
+std::unique_ptr<base::ListValue> ConvertResolveSyncRecordsToArgs(
+    const std::string& category_name,
+    std::unique_ptr<SyncRecordAndExistingList> records_and_existing_objects) {
+  std::vector<extensions::api::brave_sync::RecordAndExistingObject>
+      records_and_existing_objects_ext;
+  ConvertResolvedPairs(*records_and_existing_objects,
+                       &records_and_existing_objects_ext);
+
+  return extensions::BraveSyncEventRouter::CreateResolveSyncRecordsArgs(
+      category_name, records_and_existing_objects_ext);
+}
+
+std::vector<std::unique_ptr<base::ListValue>> ConvertSyncRecordsToArgs(
+    const std::string& category_name,
+    std::unique_ptr<RecordsList> records) {
+  std::vector<std::unique_ptr<base::ListValue>> args_list;
+  size_t begin = 0;
+  do {
+    const size_t end = std::min(records->size(), begin + kMaxRecordsPerEvent);
+    const RecordsList chunk(
+        std::make_move_iterator(records->begin() + begin),
+        std::make_move_iterator(records->begin() + end));
+
+    std::vector<extensions::api::brave_sync::SyncRecord> records_ext;
+    ConvertSyncRecordsFromLibToExt(chunk, &records_ext);
+    args_list.push_back(
+        extensions::BraveSyncEventRouter::CreateSendSyncRecordsArgs(
+            category_name, records_ext));
+    begin = end;
+  } while (begin < records->size());
+
+  return args_list;
+}
+
+}  // namespace
+
 BraveSyncClient* brave_sync_client_for_testing_;
 
 // static
@@ -49,7 +101,9 @@ BraveSyncClientImpl::BraveSyncClientImpl(SyncMessageHandler* handler,
       sync_prefs_(new brave_sync::prefs::Prefs(profile->GetPrefs())),
       extension_loaded_(false),
       brave_sync_event_router_(new extensions::BraveSyncEventRouter(profile)),
-      extension_registry_observer_(this) {
+      extension_registry_observer_(this),
+      task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::TaskPriority::USER_VISIBLE})) {
   // Handle when the extension system is ready
   extensions::ExtensionSystem::Get(profile)->ready().Post(
       FROM_HERE, base::Bind(&BraveSyncClientImpl::OnExtensionSystemReady,
@@ -69,8 +123,10 @@ void BraveSyncClientImpl::SendGotInitData(const Uint8Array& seed,
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   extensions::api::brave_sync::Config config_extension;
   ConvertConfig(config, &config_extension);
-  brave_sync_event_router_->GotInitData(seed, device_id, config_extension,
-                                        device_id_v2);
+  DispatchInOrder(base::BindOnce(
+      &extensions::BraveSyncEventRouter::GotInitData,
+      base::Unretained(brave_sync_event_router_.get()), seed, device_id,
+      std::move(config_extension), device_id_v2));
 }
 
 void BraveSyncClientImpl::SendFetchSyncRecords(
@@ -78,31 +134,83 @@ void BraveSyncClientImpl::SendFetchSyncRecords(
     const base::Time& startAt,
     const int max_records) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  brave_sync_event_router_->FetchSyncRecords(category_names, startAt,
-                                             max_records);
+  DispatchInOrder(base::BindOnce(
+      &extensions::BraveSyncEventRouter::FetchSyncRecords,
+      base::Unretained(brave_sync_event_router_.get()), category_names,
+      startAt, max_records));
 }
 
 void BraveSyncClientImpl::SendResolveSyncRecords(
     const std::string& category_name,
     std::unique_ptr<SyncRecordAndExistingList> records_and_existing_objects) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  std::vector<extensions::api::brave_sync::RecordAndExistingObject>
-      records_and_existing_objects_ext;
-
-  ConvertResolvedPairs(*records_and_existing_objects,
-                       &records_and_existing_objects_ext);
-
-  brave_sync_event_router_->ResolveSyncRecords(
-      category_name, records_and_existing_objects_ext);
+  // Resolved records are kept in one event, the service hands each resolved
+  // batch to the syncer as the result of one poll cycle
+  pending_events_++;
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&ConvertResolveSyncRecordsToArgs, category_name,
+                     std::move(records_and_existing_objects)),
+      base::BindOnce(&BraveSyncClientImpl::OnResolveSyncRecordsConverted,
+                     weak_ptr_factory_.GetWeakPtr()));
 }
 
 void BraveSyncClientImpl::SendSyncRecords(const std::string& category_name,
                                           const RecordsList& records) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  std::vector<extensions::api::brave_sync::SyncRecord> records_ext;
-  ConvertSyncRecordsFromLibToExt(records, &records_ext);
+  auto records_copy = std::make_unique<RecordsList>();
+  records_copy->reserve(records.size());
+  for (const auto& record : records) {
+    records_copy->push_back(jslib::SyncRecord::Clone(*record));
+  }
 
-  brave_sync_event_router_->SendSyncRecords(category_name, records_ext);
+  pending_events_++;
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&ConvertSyncRecordsToArgs, category_name,
+                     std::move(records_copy)),
+      base::BindOnce(&BraveSyncClientImpl::OnSyncRecordsConverted,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void BraveSyncClientImpl::DispatchInOrder(base::OnceClosure dispatch) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (pending_events_ == 0) {
+    std::move(dispatch).Run();
+    return;
+  }
+
+  // Replies of |task_runner_| run in the order their tasks were posted
+  pending_events_++;
+  task_runner_->PostTaskAndReply(
+      FROM_HERE, base::DoNothing(),
+      base::BindOnce(&BraveSyncClientImpl::OnDispatchInOrder,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(dispatch)));
+}
+
+void BraveSyncClientImpl::OnDispatchInOrder(base::OnceClosure dispatch) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_GT(pending_events_, 0);
+  pending_events_--;
+  std::move(dispatch).Run();
+}
+
+void BraveSyncClientImpl::OnResolveSyncRecordsConverted(
+    std::unique_ptr<base::ListValue> args) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_GT(pending_events_, 0);
+  pending_events_--;
+  brave_sync_event_router_->ResolveSyncRecords(std::move(args));
+}
+
+void BraveSyncClientImpl::OnSyncRecordsConverted(
+    std::vector<std::unique_ptr<base::ListValue>> args_list) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_GT(pending_events_, 0);
+  pending_events_--;
+  for (auto& args : args_list) {
+    brave_sync_event_router_->SendSyncRecords(std::move(args));
+  }
 }
 
 void BraveSyncClientImpl::SendDeleteSyncUser() {
@@ -118,20 +226,27 @@ void BraveSyncClientImpl::SendGetBookmarksBaseOrder(
     const std::string& device_id,
     const std::string& platform) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  brave_sync_event_router_->SendGetBookmarksBaseOrder(device_id, platform);
+  DispatchInOrder(base::BindOnce(
+      &extensions::BraveSyncEventRouter::SendGetBookmarksBaseOrder,
+      base::Unretained(brave_sync_event_router_.get()), device_id, platform));
 }
 
 void BraveSyncClientImpl::SendCompact(
     const std::string& category_name) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  brave_sync_event_router_->SendCompact(category_name);
+  DispatchInOrder(base::BindOnce(
+      &extensions::BraveSyncEventRouter::SendCompact,
+      base::Unretained(brave_sync_event_router_.get()), category_name));
 }
 
 void BraveSyncClientImpl::OnExtensionInitialized() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK(extension_loaded_);
-  if (extension_loaded_)
-    brave_sync_event_router_->LoadClient();
+  if (extension_loaded_) {
+    DispatchInOrder(base::BindOnce(
+        &extensions::BraveSyncEventRouter::LoadClient,
+        base::Unretained(brave_sync_event_router_.get())));
+  }
 }
 
 void BraveSyncClientImpl::OnSyncEnabledChanged() {
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "brave/components/brave_sync/client/brave_sync_client.h"
+#include "base/callback_forward.h"
 #include "base/macros.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/scoped_observer.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_registry_observer.h"
@@ -20,6 +23,11 @@
 class BraveSyncServiceTest;
 class Profile;
 
+namespace base {
+class ListValue;
+class SequencedTaskRunner;
+}
+
 namespace extensions {
 class BraveSyncEventRouter;
 }
@@ -85,6 +93,14 @@ class BraveSyncClientImpl : public BraveSyncClient,
   void LoadOrUnloadExtension(bool load);
   void OnExtensionSystemReady();
 
+  // Runs |dispatch| after the records events which are still being converted,
+  // so events reach the extension in the order they were sent
+  void DispatchInOrder(base::OnceClosure dispatch);
+  void OnDispatchInOrder(base::OnceClosure dispatch);
+  void OnResolveSyncRecordsConverted(std::unique_ptr<base::ListValue> args);
+  void OnSyncRecordsConverted(
+      std::vector<std::unique_ptr<base::ListValue>> args_list);
+
   SyncMessageHandler* handler_;  // not owned
   Profile* profile_;  // not owned
   std::unique_ptr<brave_sync::prefs::Prefs> sync_prefs_;
@@ -95,6 +111,13 @@ class BraveSyncClientImpl : public BraveSyncClient,
   ScopedObserver<ExtensionRegistry, ExtensionRegistryObserver>
     extension_registry_observer_;
 
+  // Converts records and builds their event arguments off the UI thread
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  // Events posted to |task_runner_| whose reply has not run yet
+  int pending_events_ = 0;
+
+  base::WeakPtrFactory<BraveSyncClientImpl> weak_ptr_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(BraveSyncClientImpl);
 };
 
@@ -11,7 +11,6 @@
 #include <vector>
 
 #include "base/callback.h"
-#include "base/synchronization/waitable_event.h"
 #include "build/build_config.h"
 
 // TODO(darkdh): forward declaration with unique_ptr on Windows
@@ -42,9 +41,7 @@ using Uint8Array = std::vector<unsigned char>;
 using GetRecordsCallback =
     base::OnceCallback<void(std::unique_ptr<RecordsList>)>;
 using NudgeSyncCycleDelegate = base::RepeatingCallback<void(RecordsListPtr)>;
-using PollSyncCycleDelegate =
-    base::RepeatingCallback<void(GetRecordsCallback,
-                                 base::WaitableEvent* wevent)>;
+using PollSyncCycleDelegate = base::RepeatingCallback<void(GetRecordsCallback)>;
 
 }  // namespace brave_sync
 
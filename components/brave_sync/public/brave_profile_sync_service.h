@@ -11,10 +11,6 @@
 #include "brave/components/brave_sync/jslib_messages_fwd.h"
 #include "components/sync/driver/profile_sync_service.h"
 
-namespace base {
-class WaitableEvent;
-}
-
 namespace brave_sync {
 
 class BraveSyncService;
@@ -27,8 +23,7 @@ class BraveProfileSyncService : public syncer::ProfileSyncService {
 
   virtual bool IsBraveSyncEnabled() const = 0;
   virtual void OnNudgeSyncCycle(brave_sync::RecordsListPtr records_list) = 0;
-  virtual void OnPollSyncCycle(brave_sync::GetRecordsCallback cb,
-                               base::WaitableEvent* wevent) = 0;
+  virtual void OnPollSyncCycle(brave_sync::GetRecordsCallback cb) = 0;
 
   virtual BraveSyncService* GetSyncService() const = 0;
 };
@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_sync/syncer_helper.h"
 
+#include <vector>
+
+#include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_sync/bookmark_order_util.h"
 #include "brave/components/brave_sync/tools.h"
@@ -13,6 +16,24 @@
 namespace brave_sync {
 namespace {
 
+// Looks up meta info without copying the value, returns nullptr if absent
+const std::string* FindMetaInfo(const bookmarks::BookmarkNode* node,
+                                const std::string& key) {
+  const bookmarks::BookmarkNode::MetaInfoMap* meta_info_map =
+      node->GetMetaInfoMap();
+  if (!meta_info_map)
+    return nullptr;
+  auto it = meta_info_map->find(key);
+  return it == meta_info_map->end() ? nullptr : &it->second;
+}
+
+const std::string& GetMetaInfoOrEmpty(const bookmarks::BookmarkNode* node,
+                                      const std::string& key) {
+  static const base::NoDestructor<std::string> kEmpty;
+  const std::string* value = node ? FindMetaInfo(node, key) : nullptr;
+  return value ? *value : *kEmpty;
+}
+
 void SetOrder(const bookmarks::BookmarkNode* node,
               const std::string& parent_order) {
   DCHECK(!parent_order.empty());
@@ -25,16 +46,10 @@ void SetOrder(const bookmarks::BookmarkNode* node,
                         ? nullptr
                         : parent->children()[index + 1].get();
 
-  std::string prev_order;
-  std::string next_order;
-  if (prev_node)
-    prev_node->GetMetaInfo("order", &prev_order);
-
-  if (next_node)
-    next_node->GetMetaInfo("order", &next_order);
-
   std::string order =
-      brave_sync::GetOrder(prev_order, next_order, parent_order);
+      brave_sync::GetOrder(GetMetaInfoOrEmpty(prev_node, "order"),
+                           GetMetaInfoOrEmpty(next_node, "order"),
+                           parent_order);
   tools::AsMutable(node)->SetMetaInfo("order", order);
 }
 
@@ -45,21 +60,23 @@ size_t GetIndex(const bookmarks::BookmarkNode* parent,
                 const std::string& object_id) {
   DCHECK(!order.empty());
   DCHECK(!object_id.empty());
+  // Parse the target order once, children orders are compared in place.
+  // Children can't be binary searched because local moves leave them out of
+  // order until the next commit assigns new orders
+  const std::vector<int> parsed_order = brave_sync::OrderToIntVect(order);
   for (size_t i = 0; i < parent->children().size(); ++i) {
     const bookmarks::BookmarkNode* child = parent->children()[i].get();
     // Same order and same object id (case when child is equal to target node)
     // will be skipped
-    std::string child_order;
-    child->GetMetaInfo("order", &child_order);
-    if (!child_order.empty() &&
-        brave_sync::CompareOrder(order, child_order)) {
+    const std::string* child_order = FindMetaInfo(child, "order");
+    if (!child_order || child_order->empty())
+      continue;
+    const int result = brave_sync::CompareOrder(parsed_order, *child_order);
+    if (result < 0) {
+      return i;
+    } else if (result == 0 && order == *child_order &&
+               object_id < GetMetaInfoOrEmpty(child, "object_id")) {
       return i;
-    } else if (order == child_order) {
-      std::string child_object_id;
-      child->GetMetaInfo("object_id", &child_object_id);
-      if (object_id < child_object_id) {
-        return i;
-      }
     }
   }
   return parent->children().size();
@@ -0,0 +1,170 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wayback_machine/wayback_machine_availability_cache.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/json/json_reader.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/time/default_clock.h"
+#include "brave/components/brave_wayback_machine/url_constants.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/storage_partition.h"
+#include "net/base/load_flags.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+
+namespace {
+
+const char kWaybackMachineAvailabilityCacheKey[] =
+    "brave_wayback_machine_availability_cache";
+
+constexpr int kMaxBodySize = 1024 * 1024;
+constexpr size_t kMaxCacheEntries = 100;
+constexpr base::TimeDelta kCacheTTL = base::TimeDelta::FromMinutes(30);
+
+const net::NetworkTrafficAnnotationTag& GetNetworkTrafficAnnotationTag() {
+  static const net::NetworkTrafficAnnotationTag network_traffic_annotation_tag =
+      net::DefineNetworkTrafficAnnotation("wayback_machine_infobar", R"(
+        semantics {
+          sender:
+            "Brave Wayback Machine"
+          description:
+            "Download wayback url"
+          trigger:
+            "When user gets 404 page"
+          data: "current tab's url"
+          destination: WEBSITE
+        }
+        policy {
+          cookies_allowed: NO
+          policy_exception_justification:
+            "Not implemented."
+        })");
+  return network_traffic_annotation_tag;
+}
+
+// Fragments and credentials don't change which page is archived
+GURL NormalizeURL(const GURL& url) {
+  GURL::Replacements replacements;
+  replacements.ClearRef();
+  replacements.ClearUsername();
+  replacements.ClearPassword();
+  return url.ReplaceComponents(replacements);
+}
+
+}  // namespace
+
+WaybackMachineAvailabilityCache::PendingFetch::PendingFetch() = default;
+
+WaybackMachineAvailabilityCache::PendingFetch::PendingFetch(
+    PendingFetch&& other) = default;
+
+WaybackMachineAvailabilityCache::PendingFetch&
+WaybackMachineAvailabilityCache::PendingFetch::operator=(
+    PendingFetch&& other) = default;
+
+WaybackMachineAvailabilityCache::PendingFetch::~PendingFetch() = default;
+
+WaybackMachineAvailabilityCache::WaybackMachineAvailabilityCache(
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
+    : url_loader_factory_(std::move(url_loader_factory)),
+      cache_(kMaxCacheEntries),
+      clock_(base::DefaultClock::GetInstance()) {
+}
+
+WaybackMachineAvailabilityCache::~WaybackMachineAvailabilityCache() {
+}
+
+// static
+WaybackMachineAvailabilityCache*
+WaybackMachineAvailabilityCache::GetForBrowserContext(
+    content::BrowserContext* context) {
+  auto* cache = static_cast<WaybackMachineAvailabilityCache*>(
+      context->GetUserData(kWaybackMachineAvailabilityCacheKey));
+  if (!cache) {
+    // Object cleanup is handled by SupportsUserData
+    context->SetUserData(
+        kWaybackMachineAvailabilityCacheKey,
+        std::make_unique<WaybackMachineAvailabilityCache>(
+            content::BrowserContext::GetDefaultStoragePartition(context)->
+                GetURLLoaderFactoryForBrowserProcess()));
+    cache = static_cast<WaybackMachineAvailabilityCache*>(
+        context->GetUserData(kWaybackMachineAvailabilityCacheKey));
+  }
+  return cache;
+}
+
+void WaybackMachineAvailabilityCache::Fetch(const GURL& url,
+                                            FetchCallback callback) {
+  const GURL normalized_url = NormalizeURL(url);
+  const std::string& cache_key = normalized_url.spec();
+
+  auto cached = cache_.Get(cache_key);
+  if (cached != cache_.end()) {
+    if (clock_->Now() - cached->second.fetch_time < kCacheTTL) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback),
+                                    cached->second.latest_wayback_url));
+      return;
+    }
+    cache_.Erase(cached);
+  }
+
+  auto pending = pending_fetches_.find(cache_key);
+  if (pending != pending_fetches_.end()) {
+    pending->second.callbacks.push_back(std::move(callback));
+    return;
+  }
+
+  auto request = std::make_unique<network::ResourceRequest>();
+  request->url = GURL(std::string(kWaybackQueryURL) + cache_key);
+  request->load_flags =
+      net::LOAD_DO_NOT_SEND_COOKIES | net::LOAD_DO_NOT_SAVE_COOKIES;
+
+  PendingFetch& fetch = pending_fetches_[cache_key];
+  fetch.callbacks.push_back(std::move(callback));
+  fetch.url_loader = network::SimpleURLLoader::Create(
+      std::move(request), GetNetworkTrafficAnnotationTag());
+  // |url_loader| is owned by this, so the callback can't outlive it
+  fetch.url_loader->DownloadToString(
+      url_loader_factory_.get(),
+      base::BindOnce(&WaybackMachineAvailabilityCache::OnWaybackURLFetched,
+                     base::Unretained(this),
+                     cache_key),
+      kMaxBodySize);
+}
+
+void WaybackMachineAvailabilityCache::SetClockForTesting(base::Clock* clock) {
+  clock_ = clock;
+}
+
+void WaybackMachineAvailabilityCache::OnWaybackURLFetched(
+    const std::string& cache_key,
+    std::unique_ptr<std::string> response_body) {
+  auto pending = pending_fetches_.find(cache_key);
+  DCHECK(pending != pending_fetches_.end());
+  std::vector<FetchCallback> callbacks = std::move(pending->second.callbacks);
+  pending_fetches_.erase(pending);
+
+  GURL latest_wayback_url;
+  // Network errors are not cached so the next lookup tries again
+  if (response_body) {
+    const auto result = base::JSONReader::Read(*response_body);
+    const base::Value* closest_url =
+        result ? result->FindPath("archived_snapshots.closest.url") : nullptr;
+    if (closest_url && closest_url->is_string())
+      latest_wayback_url = GURL(closest_url->GetString());
+
+    cache_.Put(cache_key, {latest_wayback_url, clock_->Now()});
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(latest_wayback_url);
+}
@@ -0,0 +1,87 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_AVAILABILITY_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_AVAILABILITY_CACHE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/supports_user_data.h"
+#include "base/time/time.h"
+#include "url/gurl.h"
+
+namespace base {
+class Clock;
+}  // namespace base
+
+namespace content {
+class BrowserContext;
+}  // namespace content
+
+namespace network {
+class SharedURLLoaderFactory;
+class SimpleURLLoader;
+}  // namespace network
+
+// Caches the results of the wayback availability API for the lifetime of a
+// browser context so that reloading a dead page, or opening it in several
+// tabs, doesn't query archive.org again. Lookups of a url which is already
+// being fetched wait for that request instead of starting another one.
+class WaybackMachineAvailabilityCache : public base::SupportsUserData::Data {
+ public:
+  // |latest_wayback_url| is empty if there is no snapshot or the request
+  // failed.
+  using FetchCallback =
+      base::OnceCallback<void(const GURL& latest_wayback_url)>;
+
+  explicit WaybackMachineAvailabilityCache(
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
+  ~WaybackMachineAvailabilityCache() override;
+
+  WaybackMachineAvailabilityCache(const WaybackMachineAvailabilityCache&) =
+      delete;
+  WaybackMachineAvailabilityCache& operator=(
+      const WaybackMachineAvailabilityCache&) = delete;
+
+  static WaybackMachineAvailabilityCache* GetForBrowserContext(
+      content::BrowserContext* context);
+
+  // |callback| is always run asynchronously, even for cached results.
+  void Fetch(const GURL& url, FetchCallback callback);
+
+  void SetClockForTesting(base::Clock* clock);
+
+ private:
+  struct Entry {
+    GURL latest_wayback_url;
+    base::Time fetch_time;
+  };
+
+  struct PendingFetch {
+    PendingFetch();
+    PendingFetch(PendingFetch&& other);
+    PendingFetch& operator=(PendingFetch&& other);
+    ~PendingFetch();
+
+    std::unique_ptr<network::SimpleURLLoader> url_loader;
+    std::vector<FetchCallback> callbacks;
+  };
+
+  void OnWaybackURLFetched(const std::string& cache_key,
+                           std::unique_ptr<std::string> response_body);
+
+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  base::MRUCache<std::string, Entry> cache_;
+  std::map<std::string, PendingFetch> pending_fetches_;
+  base::Clock* clock_;
+};
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_AVAILABILITY_CACHE_H_
@@ -0,0 +1,134 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wayback_machine/wayback_machine_availability_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_wayback_machine/url_constants.h"
+#include "net/http/http_status_code.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+const char kPageURL[] = "https://brave.com/dead.html";
+const char kWaybackURL[] =
+    "http://web.archive.org/web/20200101000000/https://brave.com/dead.html";
+const char kResponse[] =
+    R"({"archived_snapshots": {"closest": {"url": "http://web.archive.org/)"
+    R"(web/20200101000000/https://brave.com/dead.html"}}})";
+
+}  // namespace
+
+class WaybackMachineAvailabilityCacheTest : public testing::Test {
+ public:
+  WaybackMachineAvailabilityCacheTest()
+      : cache_(base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+            &url_loader_factory_)) {
+    clock_.SetNow(base::Time::Now());
+    cache_.SetClockForTesting(&clock_);
+    url_loader_factory_.SetInterceptor(base::BindRepeating(
+        &WaybackMachineAvailabilityCacheTest::OnRequest,
+        base::Unretained(this)));
+  }
+
+  void Fetch(const std::string& url) {
+    cache_.Fetch(GURL(url), base::BindOnce(
+        &WaybackMachineAvailabilityCacheTest::OnFetched,
+        base::Unretained(this)));
+  }
+
+  void RespondWith(const std::string& url, const std::string& response) {
+    url_loader_factory_.AddResponse(std::string(kWaybackQueryURL) + url,
+                                    response);
+    task_environment_.RunUntilIdle();
+  }
+
+ protected:
+  void OnRequest(const network::ResourceRequest& request) {
+    request_count_++;
+  }
+
+  void OnFetched(const GURL& latest_wayback_url) {
+    results_.push_back(latest_wayback_url);
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  base::SimpleTestClock clock_;
+  WaybackMachineAvailabilityCache cache_;
+  int request_count_ = 0;
+  std::vector<GURL> results_;
+};
+
+TEST_F(WaybackMachineAvailabilityCacheTest, CoalescesPendingFetches) {
+  Fetch(kPageURL);
+  Fetch(kPageURL);
+  // Fragments point at the same archived page
+  Fetch(std::string(kPageURL) + "#section");
+  EXPECT_EQ(1, request_count_);
+
+  RespondWith(kPageURL, kResponse);
+  ASSERT_EQ(3u, results_.size());
+  for (const auto& result : results_)
+    EXPECT_EQ(GURL(kWaybackURL), result);
+}
+
+TEST_F(WaybackMachineAvailabilityCacheTest, CachesResults) {
+  Fetch(kPageURL);
+  RespondWith(kPageURL, kResponse);
+
+  Fetch(kPageURL);
+  // Cached results are still delivered asynchronously
+  EXPECT_EQ(1u, results_.size());
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(1, request_count_);
+  ASSERT_EQ(2u, results_.size());
+  EXPECT_EQ(GURL(kWaybackURL), results_[1]);
+}
+
+TEST_F(WaybackMachineAvailabilityCacheTest, CachesMissingSnapshots) {
+  Fetch(kPageURL);
+  RespondWith(kPageURL, R"({"archived_snapshots": {}})");
+
+  Fetch(kPageURL);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(1, request_count_);
+  ASSERT_EQ(2u, results_.size());
+  EXPECT_TRUE(results_[0].is_empty());
+  EXPECT_TRUE(results_[1].is_empty());
+}
+
+TEST_F(WaybackMachineAvailabilityCacheTest, ExpiresResults) {
+  Fetch(kPageURL);
+  RespondWith(kPageURL, kResponse);
+
+  clock_.Advance(base::TimeDelta::FromHours(1));
+  Fetch(kPageURL);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2, request_count_);
+}
+
+TEST_F(WaybackMachineAvailabilityCacheTest, DoesNotCacheNetworkErrors) {
+  Fetch(kPageURL);
+  url_loader_factory_.AddResponse(std::string(kWaybackQueryURL) + kPageURL,
+                                  std::string(), net::HTTP_NOT_FOUND);
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(1u, results_.size());
+  EXPECT_TRUE(results_[0].is_empty());
+
+  Fetch(kPageURL);
+  EXPECT_EQ(2, request_count_);
+}
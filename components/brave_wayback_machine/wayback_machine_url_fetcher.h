@@ -6,21 +6,20 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_URL_FETCHER_H_
 #define BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_URL_FETCHER_H_
 
-#include <memory>
-#include <string>
+#include "base/memory/weak_ptr.h"
 
-#include "base/memory/scoped_refptr.h"
-
-namespace network {
-class SharedURLLoaderFactory;
-class SimpleURLLoader;
-}  // network
+namespace content {
+class BrowserContext;
+}  // namespace content
 
 class GURL;
+class WaybackMachineAvailabilityCache;
 
 // This only tries to fetch one wayback url at once.
 // If client calls Fetch() before OnWaybackURLFetched is called, previous fetch
 // request is dropped.
+// Lookups go through the WaybackMachineAvailabilityCache of the browser
+// context, so they are shared with every other tab.
 class WaybackMachineURLFetcher final {
  public:
   class Client {
@@ -30,9 +29,7 @@ class WaybackMachineURLFetcher final {
     virtual ~Client() = default;
   };
 
-  WaybackMachineURLFetcher(
-      Client* client,
-      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
+  WaybackMachineURLFetcher(Client* client, content::BrowserContext* context);
   virtual ~WaybackMachineURLFetcher();
 
   WaybackMachineURLFetcher(const WaybackMachineURLFetcher&) = delete;
@@ -41,12 +38,11 @@ class WaybackMachineURLFetcher final {
   void Fetch(const GURL& url);
 
  private:
-  void OnWaybackURLFetched(const GURL& orignal_url,
-                           std::unique_ptr<std::string> response_body);
+  void OnWaybackURLFetched(const GURL& latest_wayback_url);
 
   Client* client_;
-  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
-  std::unique_ptr<network::SimpleURLLoader> wayback_url_loader_;
+  WaybackMachineAvailabilityCache* availability_cache_;
+  base::WeakPtrFactory<WaybackMachineURLFetcher> weak_factory_{this};
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_URL_FETCHER_H_
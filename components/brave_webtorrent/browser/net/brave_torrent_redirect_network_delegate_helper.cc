@@ -52,26 +52,25 @@ int OnHeadersReceived_TorrentRedirectWork(
     const brave::ResponseCallback& next_callback,
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
 
-  if (!original_response_headers ||
+  // Checked first, this runs for every response of every profile
+  if (ctx->is_webtorrent_disabled ||
+      !original_response_headers ||
       !IsMainFrameResource(ctx) ||
-      ctx->is_webtorrent_disabled ||
       // download .torrent, do not redirect
       (IsWebtorrentInitiated(ctx) && !IsViewerURL(ctx->request_url)) ||
       !IsTorrentFile(ctx->request_url, original_response_headers)) {
     return net::OK;
   }
 
-  *override_response_headers =
-    new net::HttpResponseHeaders(original_response_headers->raw_headers());
-  (*override_response_headers)
-      ->ReplaceStatusLine("HTTP/1.1 307 Temporary Redirect");
-  (*override_response_headers)->RemoveHeader("Location");
   GURL url(
       base::StrCat({extensions::kExtensionScheme, "://",
       brave_webtorrent_extension_id,
       "/extension/brave_webtorrent2.html?",
       ctx->request_url.spec()}));
-  (*override_response_headers)->AddHeader("Location: " + url.spec());
+  ctx->response_headers_overlay.ReplaceStatusLine(
+      "HTTP/1.1 307 Temporary Redirect");
+  ctx->response_headers_overlay.RemoveHeader("Location");
+  ctx->response_headers_overlay.AddHeader("Location", url.spec());
   *allowed_unsafe_redirect_url = url;
   return net::OK;
 }
@@ -73,6 +73,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   std::string location;
@@ -101,6 +103,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(),
             "HTTP/1.1 307 Temporary Redirect");
@@ -131,6 +135,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(),
             "HTTP/1.1 307 Temporary Redirect");
@@ -167,6 +173,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(),
             "HTTP/1.1 307 Temporary Redirect");
@@ -199,6 +207,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   std::string location;
@@ -225,6 +235,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest, MimeTypeNoRedirect) {
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   std::string location;
@@ -254,6 +266,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   std::string location;
@@ -284,6 +298,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(),
             "HTTP/1.1 307 Temporary Redirect");
@@ -315,6 +331,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   std::string location;
@@ -328,6 +346,8 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
       orig_response_headers.get(), &overwrite_response_headers,
       &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
 
   EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
   EXPECT_FALSE(overwrite_response_headers->EnumerateHeader(nullptr, "Location",
@@ -335,3 +355,54 @@ TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
   EXPECT_EQ(allowed_unsafe_redirect_url, GURL());
   EXPECT_EQ(rc, net::OK);
 }
+
+TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
+       WebtorrentDisabledNoRedirect) {
+  scoped_refptr<net::HttpResponseHeaders> orig_response_headers =
+      new net::HttpResponseHeaders(std::string());
+  orig_response_headers->AddHeader("Content-Type: application/x-bittorrent");
+  scoped_refptr<net::HttpResponseHeaders> overwrite_response_headers =
+      new net::HttpResponseHeaders(std::string());
+  GURL allowed_unsafe_redirect_url;
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(torrent_url());
+  request_info->resource_type = blink::mojom::ResourceType::kMainFrame;
+  request_info->is_webtorrent_disabled = true;
+
+  int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
+      orig_response_headers.get(), &overwrite_response_headers,
+      &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
+
+  EXPECT_EQ(overwrite_response_headers->GetStatusLine(), "HTTP/1.0 200 OK");
+  std::string location;
+  EXPECT_FALSE(overwrite_response_headers->EnumerateHeader(nullptr, "Location",
+                                                           &location));
+  EXPECT_EQ(allowed_unsafe_redirect_url, GURL());
+  EXPECT_EQ(rc, net::OK);
+}
+
+TEST_F(BraveTorrentRedirectNetworkDelegateHelperTest,
+       UpperCaseMimeTypeRedirect) {
+  scoped_refptr<net::HttpResponseHeaders> orig_response_headers =
+      new net::HttpResponseHeaders(std::string());
+  orig_response_headers->AddHeader(
+      "content-type: Application/X-BitTorrent; charset=utf-8");
+  scoped_refptr<net::HttpResponseHeaders> overwrite_response_headers =
+      new net::HttpResponseHeaders(std::string());
+  GURL allowed_unsafe_redirect_url;
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(torrent_url());
+  request_info->resource_type = blink::mojom::ResourceType::kMainFrame;
+
+  int rc = webtorrent::OnHeadersReceived_TorrentRedirectWork(
+      orig_response_headers.get(), &overwrite_response_headers,
+      &allowed_unsafe_redirect_url, ResponseCallback(), request_info);
+  request_info->response_headers_overlay.ApplyTo(orig_response_headers.get(),
+                                                 &overwrite_response_headers);
+
+  std::string location;
+  EXPECT_TRUE(overwrite_response_headers->EnumerateHeader(nullptr, "Location",
+                                                          &location));
+  EXPECT_NE(allowed_unsafe_redirect_url, GURL());
+  EXPECT_EQ(rc, net::OK);
+}
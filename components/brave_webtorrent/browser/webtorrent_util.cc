@@ -7,6 +7,8 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "brave/common/extensions/extension_constants.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/pref_names.h"
@@ -17,6 +19,52 @@
 #include "net/http/http_content_disposition.h"
 #include "net/http/http_response_headers.h"
 
+namespace {
+
+bool ContainsCaseInsensitiveASCII(base::StringPiece haystack,
+                                  base::StringPiece needle) {
+  for (size_t i = 0; i + needle.length() <= haystack.length(); ++i) {
+    if (base::EqualsCaseInsensitiveASCII(haystack.substr(i, needle.length()),
+                                         needle)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Cheap pre-check for IsTorrentFile which is run on every main frame
+// response. Scans the raw headers in place so the common case doesn't copy
+// any header value. Returns true if a Content-Type header mentions one of the
+// mime types IsTorrentFile accepts, the exact check is done by GetMimeType.
+bool MayHaveTorrentMimeType(const net::HttpResponseHeaders* headers) {
+  // Header lines are '\0' separated, starting with the status line
+  base::StringPiece raw_headers(headers->raw_headers());
+  size_t line_end = raw_headers.find('\0');
+  while (line_end != base::StringPiece::npos) {
+    raw_headers.remove_prefix(line_end + 1);
+    line_end = raw_headers.find('\0');
+    const base::StringPiece line = raw_headers.substr(0, line_end);
+
+    const size_t colon = line.find(':');
+    if (colon == base::StringPiece::npos ||
+        !base::EqualsCaseInsensitiveASCII(
+            base::TrimWhitespaceASCII(line.substr(0, colon), base::TRIM_ALL),
+            "content-type")) {
+      continue;
+    }
+
+    const base::StringPiece value = line.substr(colon + 1);
+    if (ContainsCaseInsensitiveASCII(value, kBittorrentMimeType) ||
+        ContainsCaseInsensitiveASCII(value, kOctetStreamMimeType)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 namespace webtorrent {
 
 bool TorrentFileNameMatched(const net::HttpResponseHeaders* headers) {
@@ -57,7 +105,7 @@ void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
 }
 
 bool IsTorrentFile(const GURL& url, const net::HttpResponseHeaders* headers) {
-  if (!headers) {
+  if (!headers || !MayHaveTorrentMimeType(headers)) {
     return false;
   }
 
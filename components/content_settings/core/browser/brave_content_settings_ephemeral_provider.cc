@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_utils.h"
+#include "url/gurl.h"
 
 namespace content_settings {
 
@@ -27,9 +28,65 @@ bool BraveEphemeralProvider::SetWebsiteSetting(
   // Only flash plugin setting can be reached here.
   DCHECK(resource_identifier.empty());
 
-  return EphemeralProvider::SetWebsiteSetting(
-      primary_pattern, secondary_pattern, content_type, resource_identifier,
-      std::move(in_value));
+  if (!EphemeralProvider::SetWebsiteSetting(
+          primary_pattern, secondary_pattern, content_type,
+          resource_identifier, std::move(in_value))) {
+    return false;
+  }
+
+  UpdateRuleIndex(content_type);
+  return true;
+}
+
+void BraveEphemeralProvider::ClearAllContentSettingsRules(
+    ContentSettingsType content_type) {
+  EphemeralProvider::ClearAllContentSettingsRules(content_type);
+  rule_indexes_.erase(content_type);
+}
+
+bool BraveEphemeralProvider::GetIndexedWebsiteSetting(
+    const GURL& primary_url,
+    const GURL& secondary_url,
+    ContentSettingsType content_type,
+    const ResourceIdentifier& resource_identifier,
+    std::unique_ptr<base::Value>* value,
+    ContentSettingsPattern* primary_pattern,
+    ContentSettingsPattern* secondary_pattern) const {
+  const bool is_shields_setting =
+      content_type == ContentSettingsType::PLUGINS &&
+      IsShieldsResourceID(resource_identifier);
+  if (!is_shields_setting && !resource_identifier.empty())
+    return false;
+
+  const Rule* rule = nullptr;
+  if (!is_shields_setting) {
+    auto index = rule_indexes_.find(content_type);
+    if (index != rule_indexes_.end())
+      rule = index->second.Find(primary_url, secondary_url);
+  }
+
+  if (!rule) {
+    value->reset();
+    return true;
+  }
+
+  if (primary_pattern)
+    *primary_pattern = rule->primary_pattern;
+  if (secondary_pattern)
+    *secondary_pattern = rule->secondary_pattern;
+  *value = base::Value::ToUniquePtrValue(rule->value.Clone());
+  return true;
+}
+
+void BraveEphemeralProvider::UpdateRuleIndex(
+    ContentSettingsType content_type) {
+  // Ephemeral rules are the same for incognito and regular lookups
+  auto rule_iterator = EphemeralProvider::GetRuleIterator(
+      content_type, ResourceIdentifier(), false);
+  ContentSettingsRuleIndex& index = rule_indexes_[content_type];
+  index.Reset(rule_iterator.get());
+  if (index.size() == 0)
+    rule_indexes_.erase(content_type);
 }
 
 }  // namespace content_settings
@@ -6,10 +6,14 @@
 #ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_EPHEMERAL_PROVIDER_H_
 #define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_EPHEMERAL_PROVIDER_H_
 
+#include <map>
 #include <memory>
 
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
 #include "components/content_settings/core/browser/content_settings_ephemeral_provider.h"
 
+class GURL;
+
 namespace content_settings {
 
 // See the comments of BravePrefProvider.
@@ -18,7 +22,25 @@ class BraveEphemeralProvider : public EphemeralProvider {
   using EphemeralProvider::EphemeralProvider;
   ~BraveEphemeralProvider() override {}
 
+  // EphemeralProvider overrides:
+  void ClearAllContentSettingsRules(ContentSettingsType content_type) override;
+
+  // Looks up the setting in |rule_indexes_| instead of walking
+  // GetRuleIterator. Returns false if |resource_identifier| isn't indexed,
+  // otherwise |value| is the setting of the matching rule or null if there is
+  // none. Shields settings are never stored here, so they are answered
+  // without any lookup.
+  bool GetIndexedWebsiteSetting(const GURL& primary_url,
+                                const GURL& secondary_url,
+                                ContentSettingsType content_type,
+                                const ResourceIdentifier& resource_identifier,
+                                std::unique_ptr<base::Value>* value,
+                                ContentSettingsPattern* primary_pattern,
+                                ContentSettingsPattern* secondary_pattern) const;
+
  private:
+  friend class BraveEphemeralProviderTest;
+
   // EphemeralProvider overrides:
   bool SetWebsiteSetting(const ContentSettingsPattern& primary_pattern,
                          const ContentSettingsPattern& secondary_pattern,
@@ -26,6 +48,11 @@ class BraveEphemeralProvider : public EphemeralProvider {
                          const ResourceIdentifier& resource_identifier,
                          std::unique_ptr<base::Value>&& value) override;
 
+  void UpdateRuleIndex(ContentSettingsType content_type);
+
+  // Types without an entry don't have any rules
+  std::map<ContentSettingsType, ContentSettingsRuleIndex> rule_indexes_;
+
   DISALLOW_COPY_AND_ASSIGN(BraveEphemeralProvider);
 };
 
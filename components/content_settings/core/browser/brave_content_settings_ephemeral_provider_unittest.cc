@@ -0,0 +1,85 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/content_settings/core/browser/brave_content_settings_ephemeral_provider.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "components/content_settings/core/common/content_settings_utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace content_settings {
+
+class BraveEphemeralProviderTest : public testing::Test {
+ public:
+  BraveEphemeralProviderTest() : provider_(false /* store_last_modified */) {}
+  ~BraveEphemeralProviderTest() override { provider_.ShutdownOnUIThread(); }
+
+ protected:
+  bool SetFlashSetting(const std::string& primary_pattern,
+                       ContentSetting setting) {
+    return provider_.SetWebsiteSetting(
+        ContentSettingsPattern::FromString(primary_pattern),
+        ContentSettingsPattern::Wildcard(), ContentSettingsType::PLUGINS, "",
+        ContentSettingToValue(setting));
+  }
+
+  ContentSetting GetIndexedSetting(const std::string& primary_url,
+                                   const std::string& resource_identifier,
+                                   ContentSettingsPattern* primary_pattern) {
+    std::unique_ptr<base::Value> value;
+    EXPECT_TRUE(provider_.GetIndexedWebsiteSetting(
+        GURL(primary_url), GURL(primary_url), ContentSettingsType::PLUGINS,
+        resource_identifier, &value, primary_pattern, nullptr));
+    return ValueToContentSetting(value.get());
+  }
+
+  BraveEphemeralProvider provider_;
+};
+
+TEST_F(BraveEphemeralProviderTest, IndexedLookup) {
+  EXPECT_TRUE(SetFlashSetting("[*.]brave.com", CONTENT_SETTING_ALLOW));
+  EXPECT_TRUE(SetFlashSetting("https://www.brave.com:443",
+                              CONTENT_SETTING_BLOCK));
+
+  ContentSettingsPattern primary_pattern;
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            GetIndexedSetting("https://www.brave.com", "", &primary_pattern));
+  EXPECT_EQ(ContentSettingsPattern::FromString("https://www.brave.com:443"),
+            primary_pattern);
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            GetIndexedSetting("http://www.brave.com", "", &primary_pattern));
+  EXPECT_EQ(ContentSettingsPattern::FromString("[*.]brave.com"),
+            primary_pattern);
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT,
+            GetIndexedSetting("https://example.com", "", nullptr));
+
+  // Removing a rule updates the index
+  EXPECT_TRUE(SetFlashSetting("https://www.brave.com:443",
+                              CONTENT_SETTING_DEFAULT));
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            GetIndexedSetting("https://www.brave.com", "", nullptr));
+
+  provider_.ClearAllContentSettingsRules(ContentSettingsType::PLUGINS);
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT,
+            GetIndexedSetting("https://www.brave.com", "", nullptr));
+}
+
+TEST_F(BraveEphemeralProviderTest, ShieldsSettingsAreNotStored) {
+  EXPECT_FALSE(provider_.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("[*.]brave.com"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::PLUGINS,
+      brave_shields::kAds, ContentSettingToValue(CONTENT_SETTING_ALLOW)));
+
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT,
+            GetIndexedSetting("https://brave.com", brave_shields::kAds,
+                              nullptr));
+}
+
+}  // namespace content_settings
@@ -5,8 +5,12 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
 #include "base/optional.h"
@@ -23,6 +27,7 @@
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "url/gurl.h"
 
 namespace content_settings {
 
@@ -78,8 +83,62 @@ class BraveShieldsRuleIterator : public RuleIterator {
 };
 
 
+// Shield rules keyed by the host of their primary pattern. A shield rule can
+// only apply to a cookie rule if its host is the host of the cookie rule or
+// one of its parent domains, so a lookup only walks the labels of the cookie
+// host instead of comparing against every shield rule.
+class ShieldRulesIndex {
+ public:
+  explicit ShieldRulesIndex(const std::vector<Rule>& shield_rules)
+      : shield_rules_(shield_rules) {
+    for (size_t i = 0; i < shield_rules_.size(); ++i) {
+      rules_by_host_[shield_rules_[i].primary_pattern.GetHost()].push_back(i);
+    }
+  }
+
+  // Returns the shield rule with the highest precedence that applies to
+  // |pattern|, or nullptr if there is none.
+  const Rule* Find(const ContentSettingsPattern& pattern) const {
+    // |shield_rules_| is sorted by precedence, so the lowest matching index
+    // wins.
+    size_t match = shield_rules_.size();
+    std::string host = pattern.GetHost();
+    while (true) {
+      const auto it = rules_by_host_.find(host);
+      if (it != rules_by_host_.end()) {
+        for (const size_t index : it->second) {
+          if (index >= match)
+            break;
+          auto primary_compare =
+              shield_rules_[index].primary_pattern.Compare(pattern);
+          // TODO(bridiver) - verify that SUCCESSOR is correct and not
+          // PREDECESSOR
+          if (primary_compare == ContentSettingsPattern::IDENTITY ||
+              primary_compare == ContentSettingsPattern::SUCCESSOR) {
+            match = index;
+            break;
+          }
+        }
+      }
+
+      if (host.empty())
+        break;
+      const size_t dot = host.find('.');
+      host = dot == std::string::npos ? std::string() : host.substr(dot + 1);
+    }
+
+    return match < shield_rules_.size() ? &shield_rules_[match] : nullptr;
+  }
+
+ private:
+  const std::vector<Rule>& shield_rules_;
+  std::unordered_map<std::string, std::vector<size_t>> rules_by_host_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShieldRulesIndex);
+};
+
 bool IsActive(const Rule& cookie_rule,
-              const std::vector<Rule>& shield_rules) {
+              const ShieldRulesIndex& shield_rules) {
   // don't include default rules in the iterator
   if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
       (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
@@ -88,20 +147,12 @@ bool IsActive(const Rule& cookie_rule,
     return false;
   }
 
-  bool default_value = true;
-  for (const auto& shield_rule : shield_rules) {
-    auto primary_compare =
-        shield_rule.primary_pattern.Compare(cookie_rule.primary_pattern);
-    // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
-    if (primary_compare == ContentSettingsPattern::IDENTITY ||
-        primary_compare == ContentSettingsPattern::SUCCESSOR) {
-      // TODO(bridiver) - move this logic into shields_util for allow/block
-      return
-          ValueToContentSetting(&shield_rule.value) != CONTENT_SETTING_BLOCK;
-    }
-  }
+  const Rule* shield_rule = shield_rules.Find(cookie_rule.primary_pattern);
+  if (!shield_rule)
+    return true;
 
-  return default_value;
+  // TODO(bridiver) - move this logic into shields_util for allow/block
+  return ValueToContentSetting(&shield_rule->value) != CONTENT_SETTING_BLOCK;
 }
 
 }  // namespace
@@ -136,6 +187,8 @@ BravePrefProvider::BravePrefProvider(PrefService* prefs,
 
   AddObserver(this);
   OnCookieSettingsChanged(ContentSettingsType::PLUGINS);
+  for (const auto& resource_id : GetShieldsResourceIDs())
+    UpdateShieldsRuleIndex(resource_id);
 }
 
 BravePrefProvider::~BravePrefProvider() {}
@@ -293,6 +346,53 @@ std::unique_ptr<RuleIterator> BravePrefProvider::GetRuleIterator(
                                        incognito);
 }
 
+bool BravePrefProvider::GetIndexedWebsiteSetting(
+    const GURL& primary_url,
+    const GURL& secondary_url,
+    ContentSettingsType content_type,
+    const ResourceIdentifier& resource_identifier,
+    bool include_incognito,
+    std::unique_ptr<base::Value>* value,
+    ContentSettingsPattern* primary_pattern,
+    ContentSettingsPattern* secondary_pattern) const {
+  if (content_type != ContentSettingsType::PLUGINS)
+    return false;
+
+  // Same order as HostContentSettingsMap, incognito rules come first
+  for (bool incognito : {true, false}) {
+    if (incognito && !include_incognito)
+      continue;
+
+    const auto& indexes = shields_rule_indexes_.at(incognito);
+    auto index = indexes.find(resource_identifier);
+    if (index == indexes.end())
+      return false;
+
+    const Rule* rule = index->second.Find(primary_url, secondary_url);
+    if (rule) {
+      if (primary_pattern)
+        *primary_pattern = rule->primary_pattern;
+      if (secondary_pattern)
+        *secondary_pattern = rule->secondary_pattern;
+      *value = base::Value::ToUniquePtrValue(rule->value.Clone());
+      return true;
+    }
+  }
+
+  value->reset();
+  return true;
+}
+
+void BravePrefProvider::UpdateShieldsRuleIndex(
+    const ResourceIdentifier& resource_identifier) {
+  for (bool incognito : {true, false}) {
+    auto rule_iterator = PrefProvider::GetRuleIterator(
+        ContentSettingsType::PLUGINS, resource_identifier, incognito);
+    shields_rule_indexes_[incognito][resource_identifier].Reset(
+        rule_iterator.get());
+  }
+}
+
 void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
                                           bool incognito) {
   auto& rules = cookie_rules_[incognito];
@@ -346,9 +446,10 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
       incognito);
 
   // Matching cookie rules against shield rules.
+  const ShieldRulesIndex shield_rules_index(shield_rules);
   while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
     auto rule = brave_cookies_iterator->Next();
-    if (IsActive(rule, shield_rules)) {
+    if (IsActive(rule, shield_rules_index)) {
       rules.push_back(CloneRule(rule, true));
       brave_cookie_rules_[incognito].push_back(CloneRule(rule, true));
     }
@@ -374,45 +475,43 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   }
 
   // get the list of changes
+  using PatternPair = std::pair<ContentSettingsPattern, ContentSettingsPattern>;
+  std::map<PatternPair, ContentSetting> old_settings;
+  for (const auto& old_rule : old_rules) {
+    old_settings.emplace(
+        PatternPair(old_rule.primary_pattern, old_rule.secondary_pattern),
+        ValueToContentSetting(&old_rule.value));
+  }
+
   std::vector<Rule> brave_cookie_updates;
   for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match = std::find_if(
-        old_rules.begin(),
-        old_rules.end(),
-        [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(&new_rule.value) ==
-                    ValueToContentSetting(&old_rule.value);
-        });
-    if (match == old_rules.end()) {
+    auto match = old_settings.find(
+        PatternPair(new_rule.primary_pattern, new_rule.secondary_pattern));
+    if (match == old_settings.end()) {
       brave_cookie_updates.push_back(CloneRule(new_rule));
+      continue;
     }
+
+    // we want an exact match here because any change to the rule
+    // is an update
+    if (match->second != ValueToContentSetting(&new_rule.value))
+      brave_cookie_updates.push_back(CloneRule(new_rule));
+
+    // whatever is left in |old_settings| afterwards has been removed
+    old_settings.erase(match);
   }
 
   // find any removed rules
-  for (const auto& old_rule : old_rules) {
-    auto match = std::find_if(
-        brave_cookie_rules_[incognito].begin(),
-        brave_cookie_rules_[incognito].end(),
-        [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
-      brave_cookie_updates.push_back(
-          Rule(old_rule.primary_pattern,
-               old_rule.secondary_pattern,
-               base::Value()));
-    }
+  for (const auto& old_setting : old_settings) {
+    brave_cookie_updates.push_back(
+        Rule(old_setting.first.first,
+             old_setting.first.second,
+             base::Value()));
   }
 
   // Notify brave cookie changes as ContentSettingsType::COOKIES
-  if (content_type == ContentSettingsType::PLUGINS) {
+  if (content_type == ContentSettingsType::PLUGINS &&
+      !brave_cookie_updates.empty()) {
     // PostTask here to avoid content settings autolock DCHECK
     base::PostTask(
         FROM_HERE,
@@ -449,6 +548,17 @@ void BravePrefProvider::OnContentSettingChanged(
     const ContentSettingsPattern& secondary_pattern,
     ContentSettingsType content_type,
     const std::string& resource_identifier) {
+  if (content_type == ContentSettingsType::PLUGINS) {
+    // Bulk changes like clearing all rules or reloading the pref are notified
+    // without a resource identifier
+    if (resource_identifier.empty()) {
+      for (const auto& resource_id : GetShieldsResourceIDs())
+        UpdateShieldsRuleIndex(resource_id);
+    } else if (IsShieldsResourceID(resource_identifier)) {
+      UpdateShieldsRuleIndex(resource_identifier);
+    }
+  }
+
   if (content_type == ContentSettingsType::COOKIES ||
       (content_type == ContentSettingsType::PLUGINS &&
           (resource_identifier == brave_shields::kCookies ||
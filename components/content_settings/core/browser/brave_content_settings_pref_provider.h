@@ -12,10 +12,13 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
 #include "components/content_settings/core/browser/content_settings_observer.h"
 #include "components/content_settings/core/browser/content_settings_pref_provider.h"
 #include "components/prefs/pref_change_registrar.h"
 
+class GURL;
+
 namespace content_settings {
 
 // With this subclass, shields configuration is persisted across sessions.
@@ -48,6 +51,19 @@ class BravePrefProvider : public PrefProvider,
       const ResourceIdentifier& resource_identifier,
       bool incognito) const override;
 
+  // Looks up one of the brave shields settings in |shields_rule_indexes_|
+  // instead of walking GetRuleIterator. Returns false if |content_type| and
+  // |resource_identifier| aren't indexed, otherwise |value| is the setting of
+  // the matching rule or null if there is none.
+  bool GetIndexedWebsiteSetting(const GURL& primary_url,
+                                const GURL& secondary_url,
+                                ContentSettingsType content_type,
+                                const ResourceIdentifier& resource_identifier,
+                                bool include_incognito,
+                                std::unique_ptr<base::Value>* value,
+                                ContentSettingsPattern* primary_pattern,
+                                ContentSettingsPattern* secondary_pattern) const;
+
  private:
   friend class BravePrefProviderTest;
   FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest, TestShieldsSettingsMigration);
@@ -59,6 +75,7 @@ class BravePrefProvider : public PrefProvider,
                                               const std::string& resource_id);
   void UpdateCookieRules(ContentSettingsType content_type, bool incognito);
   void OnCookieSettingsChanged(ContentSettingsType content_type);
+  void UpdateShieldsRuleIndex(const ResourceIdentifier& resource_identifier);
   void NotifyChanges(const std::vector<Rule>& rules, bool incognito);
 
   // content_settings::Observer overrides:
@@ -73,6 +90,10 @@ class BravePrefProvider : public PrefProvider,
 
   std::map<bool /* is_incognito */, std::vector<Rule>> cookie_rules_;
   std::map<bool /* is_incognito */, std::vector<Rule>> brave_cookie_rules_;
+  // PLUGINS rules of every shields resource identifier
+  std::map<bool /* is_incognito */,
+           std::map<ResourceIdentifier, ContentSettingsRuleIndex>>
+      shields_rule_indexes_;
 
   base::WeakPtrFactory<BravePrefProvider> weak_factory_;
 
@@ -336,4 +336,49 @@ TEST_F(BravePrefProviderTest, TestShieldsSettingsMigrationVersion) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, TestShieldsDownDisablesCookieRules) {
+  BravePrefProvider provider(testing_profile()->GetPrefs(),
+                             false /* incognito */,
+                             true /* store_last_modified */);
+
+  const GURL url("https://example.com");
+  const GURL subdomain_url("https://www.brave.com");
+  const GURL other_url("https://brave2.com");
+
+  // Block all cookies on www.brave.com and brave2.com.
+  for (const auto* site : {"*://www.brave.com/*", "*://brave2.com/*"}) {
+    provider.SetWebsiteSetting(ContentSettingsPattern::FromString(site),
+                               ContentSettingsPattern::Wildcard(),
+                               ContentSettingsType::PLUGINS,
+                               brave_shields::kCookies,
+                               ContentSettingToValue(CONTENT_SETTING_BLOCK));
+  }
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, url, subdomain_url,
+                                         ContentSettingsType::COOKIES, "",
+                                         false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, url, other_url,
+                                         ContentSettingsType::COOKIES, "",
+                                         false));
+
+  // Shields down on the parent domain also overrides the subdomain rule, but
+  // leaves other sites alone.
+  provider.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("*://[*.]brave.com/*"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::PLUGINS,
+      brave_shields::kBraveShields,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK));
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, url, subdomain_url,
+                                         ContentSettingsType::COOKIES, "",
+                                         false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, url, other_url,
+                                         ContentSettingsType::COOKIES, "",
+                                         false));
+
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
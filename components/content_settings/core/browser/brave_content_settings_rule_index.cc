@@ -0,0 +1,107 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
+
+#include <utility>
+
+#include "base/strings/string_piece.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "url/gurl.h"
+
+namespace content_settings {
+
+namespace {
+
+base::StringPiece GetIndexedHost(const GURL& url) {
+  base::StringPiece host = url.host_piece();
+  // Patterns are stored without the trailing dot of fully qualified hosts
+  if (!host.empty() && host.back() == '.')
+    host.remove_suffix(1);
+  return host;
+}
+
+}  // namespace
+
+ContentSettingsRuleIndex::ContentSettingsRuleIndex() = default;
+
+ContentSettingsRuleIndex::~ContentSettingsRuleIndex() = default;
+
+ContentSettingsRuleIndex::ContentSettingsRuleIndex(
+    ContentSettingsRuleIndex&& other) = default;
+
+ContentSettingsRuleIndex& ContentSettingsRuleIndex::operator=(
+    ContentSettingsRuleIndex&& other) = default;
+
+void ContentSettingsRuleIndex::Reset(RuleIterator* rule_iterator) {
+  rules_.clear();
+  exact_hosts_.clear();
+  domain_wildcards_.clear();
+  fallback_.clear();
+
+  while (rule_iterator && rule_iterator->HasNext()) {
+    const size_t index = rules_.size();
+    rules_.push_back(rule_iterator->Next());
+
+    const ContentSettingsPattern& pattern = rules_.back().primary_pattern;
+    const std::string host = pattern.GetHost();
+    // IP literals and hostless patterns are matched the slow way
+    if (pattern.MatchesAllHosts() || host.empty() || host[0] == '[') {
+      fallback_.push_back(index);
+    } else if (pattern.HasDomainWildcard()) {
+      domain_wildcards_[host].push_back(index);
+    } else {
+      exact_hosts_[host].push_back(index);
+    }
+  }
+}
+
+const Rule* ContentSettingsRuleIndex::Find(const GURL& primary_url,
+                                           const GURL& secondary_url) const {
+  size_t match = rules_.size();
+
+  base::StringPiece host = GetIndexedHost(primary_url);
+  if (!host.empty()) {
+    const auto exact = exact_hosts_.find(host.as_string());
+    if (exact != exact_hosts_.end())
+      FindInBucket(exact->second, primary_url, secondary_url, &match);
+
+    // Domain wildcards can match the host itself or any of its parents
+    while (!host.empty()) {
+      const auto domain = domain_wildcards_.find(host.as_string());
+      if (domain != domain_wildcards_.end())
+        FindInBucket(domain->second, primary_url, secondary_url, &match);
+
+      const size_t dot = host.find('.');
+      if (dot == base::StringPiece::npos)
+        break;
+      host.remove_prefix(dot + 1);
+    }
+  }
+
+  FindInBucket(fallback_, primary_url, secondary_url, &match);
+
+  return match < rules_.size() ? &rules_[match] : nullptr;
+}
+
+void ContentSettingsRuleIndex::FindInBucket(const Bucket& bucket,
+                                            const GURL& primary_url,
+                                            const GURL& secondary_url,
+                                            size_t* match) const {
+  for (const size_t index : bucket) {
+    // A rule with higher precedence already matched
+    if (index >= *match)
+      return;
+
+    const Rule& rule = rules_[index];
+    if (rule.primary_pattern.Matches(primary_url) &&
+        rule.secondary_pattern.Matches(secondary_url)) {
+      *match = index;
+      return;
+    }
+  }
+}
+
+}  // namespace content_settings
@@ -0,0 +1,65 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
+#define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "components/content_settings/core/browser/content_settings_rule.h"
+
+class GURL;
+
+namespace content_settings {
+
+// Precedence preserving lookup over the rules of one content settings type.
+// Rules are bucketed by the host of their primary pattern: exact hosts and
+// domain wildcards (e.g. "[*.]brave.com") are hashed by host, everything else
+// (wildcard hosts, file:// patterns, ...) is kept in a fallback list. A lookup
+// only inspects the buckets for the labels of the url host, so it doesn't
+// depend on how many site exceptions there are.
+class ContentSettingsRuleIndex {
+ public:
+  ContentSettingsRuleIndex();
+  ~ContentSettingsRuleIndex();
+
+  ContentSettingsRuleIndex(ContentSettingsRuleIndex&& other);
+  ContentSettingsRuleIndex& operator=(ContentSettingsRuleIndex&& other);
+
+  // Replaces the indexed rules with the ones of |rule_iterator|, which must be
+  // ordered by precedence like every provider RuleIterator.
+  void Reset(RuleIterator* rule_iterator);
+
+  // Returns the rule with the highest precedence that matches both urls, like
+  // walking the RuleIterator would, or nullptr if there is none.
+  const Rule* Find(const GURL& primary_url, const GURL& secondary_url) const;
+
+  size_t size() const { return rules_.size(); }
+
+ private:
+  // Indexes into |rules_|, in ascending (i.e. precedence) order
+  using Bucket = std::vector<size_t>;
+
+  void FindInBucket(const Bucket& bucket,
+                    const GURL& primary_url,
+                    const GURL& secondary_url,
+                    size_t* match) const;
+
+  std::vector<Rule> rules_;
+  std::unordered_map<std::string, Bucket> exact_hosts_;
+  std::unordered_map<std::string, Bucket> domain_wildcards_;
+  Bucket fallback_;
+
+  DISALLOW_COPY_AND_ASSIGN(ContentSettingsRuleIndex);
+};
+
+}  // namespace content_settings
+
+#endif  // BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_RULE_INDEX_H_
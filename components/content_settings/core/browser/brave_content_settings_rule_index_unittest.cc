@@ -0,0 +1,141 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "brave/components/content_settings/core/browser/brave_content_settings_rule_index.h"
+#include "components/content_settings/core/browser/content_settings_rule.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "components/content_settings/core/common/content_settings_utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace content_settings {
+
+namespace {
+
+class TestRuleIterator : public RuleIterator {
+ public:
+  explicit TestRuleIterator(std::vector<Rule> rules)
+      : rules_(std::move(rules)) {}
+
+  bool HasNext() const override { return index_ < rules_.size(); }
+
+  Rule Next() override {
+    const Rule& rule = rules_[index_++];
+    return Rule(rule.primary_pattern, rule.secondary_pattern,
+                rule.value.Clone());
+  }
+
+ private:
+  std::vector<Rule> rules_;
+  size_t index_ = 0;
+};
+
+Rule CreateRule(const std::string& primary_pattern,
+                const std::string& secondary_pattern,
+                ContentSetting setting) {
+  return Rule(ContentSettingsPattern::FromString(primary_pattern),
+              ContentSettingsPattern::FromString(secondary_pattern),
+              ContentSettingToValue(setting)->Clone());
+}
+
+// |rules| have to be in precedence order, like a provider hands them out
+ContentSettingsRuleIndex CreateIndex(std::vector<Rule> rules) {
+  TestRuleIterator iterator(std::move(rules));
+  ContentSettingsRuleIndex index;
+  index.Reset(&iterator);
+  return index;
+}
+
+ContentSetting FindSetting(const ContentSettingsRuleIndex& index,
+                           const std::string& primary_url) {
+  const Rule* rule = index.Find(GURL(primary_url), GURL("https://example.com"));
+  if (!rule)
+    return CONTENT_SETTING_DEFAULT;
+  return ValueToContentSetting(&rule->value);
+}
+
+}  // namespace
+
+TEST(ContentSettingsRuleIndexTest, ExactHost) {
+  auto index = CreateIndex({
+      CreateRule("https://brave.com:443", "*", CONTENT_SETTING_BLOCK)});
+
+  EXPECT_EQ(1u, index.size());
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, FindSetting(index, "https://brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT, FindSetting(index, "http://brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT,
+            FindSetting(index, "https://www.brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT, FindSetting(index, "https://brave2.com"));
+}
+
+TEST(ContentSettingsRuleIndexTest, DomainWildcard) {
+  auto index = CreateIndex({
+      CreateRule("*://[*.]brave.com/*", "*", CONTENT_SETTING_BLOCK)});
+
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, FindSetting(index, "https://brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            FindSetting(index, "http://a.www.brave.com:8080"));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, FindSetting(index, "https://brave.com."));
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT,
+            FindSetting(index, "https://notbrave.com"));
+}
+
+TEST(ContentSettingsRuleIndexTest, WildcardFallback) {
+  auto index = CreateIndex({
+      CreateRule("file:///tmp/*", "*", CONTENT_SETTING_BLOCK),
+      CreateRule("*", "*", CONTENT_SETTING_ALLOW)});
+
+  EXPECT_EQ(CONTENT_SETTING_ALLOW, FindSetting(index, "https://brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, FindSetting(index, "file:///tmp/a.html"));
+}
+
+TEST(ContentSettingsRuleIndexTest, KeepsPrecedence) {
+  auto index = CreateIndex({
+      CreateRule("*://search.brave.com/*", "*", CONTENT_SETTING_BLOCK),
+      CreateRule("*://[*.]www.brave.com/*", "*", CONTENT_SETTING_BLOCK),
+      CreateRule("*://[*.]brave.com/*", "*", CONTENT_SETTING_ALLOW),
+      CreateRule("*", "*", CONTENT_SETTING_BLOCK)});
+
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            FindSetting(index, "https://search.brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            FindSetting(index, "https://a.www.brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            FindSetting(index, "https://community.brave.com"));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, FindSetting(index, "https://example.com"));
+}
+
+TEST(ContentSettingsRuleIndexTest, MatchesSecondaryPattern) {
+  auto index = CreateIndex({
+      CreateRule("*://[*.]brave.com/*", "https://firstParty/*",
+                 CONTENT_SETTING_BLOCK),
+      CreateRule("*://[*.]brave.com/*", "*", CONTENT_SETTING_ALLOW)});
+
+  const Rule* rule = index.Find(GURL("https://brave.com"),
+                                GURL("https://firstParty/"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, ValueToContentSetting(&rule->value));
+
+  rule = index.Find(GURL("https://brave.com"), GURL("https://example.com"));
+  ASSERT_TRUE(rule);
+  EXPECT_EQ(CONTENT_SETTING_ALLOW, ValueToContentSetting(&rule->value));
+}
+
+TEST(ContentSettingsRuleIndexTest, Reset) {
+  auto index = CreateIndex({
+      CreateRule("*://[*.]brave.com/*", "*", CONTENT_SETTING_BLOCK)});
+
+  index.Reset(nullptr);
+
+  EXPECT_EQ(0u, index.size());
+  EXPECT_EQ(CONTENT_SETTING_DEFAULT, FindSetting(index, "https://brave.com"));
+}
+
+}  // namespace content_settings
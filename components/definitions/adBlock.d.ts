@@ -12,6 +12,25 @@ declare namespace AdBlock {
       adsBlockedStat?: number
       numBlocked: number
     }
+    cacheStats?: CacheStats[]
+    requestLatency?: LatencyStats[]
+  }
+
+  export interface CacheStats {
+    name: string
+    hits: number
+    misses: number
+    size: number
+    capacity: number
+  }
+
+  // Times are in microseconds
+  export interface LatencyStats {
+    name: string
+    count: number
+    mean: number
+    p50: number
+    p99: number
   }
 
   export interface FilterList {
@@ -213,9 +213,9 @@ declare namespace chrome.windows {
 }
 
 declare namespace chrome.braveShields {
-  const onBlocked: {
-    addListener: (callback: (detail: BlockDetails) => void) => void
-    emit: (detail: BlockDetails) => void
+  const onResourcesBlocked: {
+    addListener: (callback: (details: BlockDetails[]) => void) => void
+    emit: (details: BlockDetails[]) => void
   }
 
   const allowScriptsOnce: any
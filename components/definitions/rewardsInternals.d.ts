@@ -11,6 +11,7 @@ declare namespace RewardsInternals {
       walletPaymentId: string
       currentReconciles: CurrentReconcile[]
       bootStamp: number
+      performanceCounters: Record<string, number>
     }
     promotions: Promotion[]
   }
@@ -7,6 +7,7 @@
 
 #include <stddef.h>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,12 +17,14 @@
 #include "base/bind_helpers.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/json/json_file_value_serializer.h"
 #include "base/one_shot_event.h"
 #include "base/sequenced_task_runner.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
@@ -47,29 +50,30 @@ using extensions::Manifest;
 
 namespace {
 
-// Wraps a Greaselion rule in a component. The component is stored as an
-// unpacked extension in the system temp dir. Returns a valid extension that the
-// caller should take ownership of, or nullptr.
-//
-// NOTE: This function does file IO and should not be called on the UI thread.
-// NOTE: The caller takes ownership of the directory at extension->path() on the
-// returned object.
-scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
-    greaselion::GreaselionRule* rule,
-    const base::FilePath& extensions_dir) {
-  base::FilePath install_temp_dir =
-      extensions::file_util::GetInstallTempDir(extensions_dir);
-  if (install_temp_dir.empty()) {
-    LOG(ERROR) << "Could not get path to profile temp directory";
-    return nullptr;
-  }
+constexpr char kGreaselionCacheDirName[] = "Greaselion";
+// Number of hash bytes used to name a cached extension directory
+constexpr size_t kRuleHashSize = 16;
 
-  base::ScopedTempDir temp_dir;
-  if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
-    LOG(ERROR) << "Could not create Greaselion temp directory";
-    return nullptr;
+// The public key of a Greaselion extension is derived from this seed
+std::string GetExtensionKeySeed(const std::string& rule_name) {
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(switches::kUseGoUpdateDev) &&
+      !base::FeatureList::IsEnabled(features::kUseDevUpdaterUrl)) {
+    return kBraveUpdatesExtensionsDevEndpoint + rule_name;
   }
+  return kBraveUpdatesExtensionsProdEndpoint + rule_name;
+}
 
+// Writes the manifest and copies the scripts of a Greaselion extension into
+// |dir|.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+bool WriteGreaselionExtension(const std::string& name,
+                              const std::vector<std::string>& url_patterns,
+                              const std::vector<base::FilePath>& scripts,
+                              const std::string& run_at,
+                              const base::FilePath& dir) {
   // Create the manifest
   std::unique_ptr<base::DictionaryValue> root(new base::DictionaryValue);
 
@@ -84,32 +88,21 @@ scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
   // public key.
   char raw[crypto::kSHA256Length] = {0};
   std::string key;
-  std::string script_name = rule->name();
-  const base::CommandLine& command_line =
-      *base::CommandLine::ForCurrentProcess();
-  if (!command_line.HasSwitch(switches::kUseGoUpdateDev) &&
-      !base::FeatureList::IsEnabled(features::kUseDevUpdaterUrl)) {
-    crypto::SHA256HashString(kBraveUpdatesExtensionsDevEndpoint + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  } else {
-    crypto::SHA256HashString(kBraveUpdatesExtensionsProdEndpoint + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  }
+  crypto::SHA256HashString(GetExtensionKeySeed(name), raw,
+                           crypto::kSHA256Length);
   base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
 
-  root->SetStringPath(extensions::manifest_keys::kName, script_name);
+  root->SetStringPath(extensions::manifest_keys::kName, name);
   root->SetStringPath(extensions::manifest_keys::kVersion, "1.0");
   root->SetStringPath(extensions::manifest_keys::kDescription, "");
   root->SetStringPath(extensions::manifest_keys::kPublicKey, key);
 
   auto js_files = std::make_unique<base::ListValue>();
-  for (auto script : rule->scripts())
+  for (auto script : scripts)
     js_files->AppendString(script.BaseName().value());
 
   auto matches = std::make_unique<base::ListValue>();
-  for (auto url_pattern : rule->url_patterns())
+  for (auto url_pattern : url_patterns)
     matches->AppendString(url_pattern);
 
   auto content_script = std::make_unique<base::DictionaryValue>();
@@ -117,7 +110,7 @@ scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
   content_script->Set(extensions::manifest_keys::kJs, std::move(js_files));
   // All Greaselion scripts default to document end.
   content_script->SetStringPath(extensions::manifest_keys::kRunAt,
-      rule->run_at() == extensions::manifest_values::kRunAtDocumentStart
+      run_at == extensions::manifest_values::kRunAtDocumentStart
         ? extensions::manifest_values::kRunAtDocumentStart
         : extensions::manifest_values::kRunAtDocumentEnd);
 
@@ -127,8 +120,7 @@ scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
   root->Set(extensions::manifest_keys::kContentScripts,
             std::move(content_scripts));
 
-  base::FilePath manifest_path =
-      temp_dir.GetPath().Append(extensions::kManifestFilename);
+  base::FilePath manifest_path = dir.Append(extensions::kManifestFilename);
   JSONFileValueSerializer serializer(manifest_path);
   // If you read the header file for this function, it says not to use it
   // outside unit tests because it writes to disk (which blocks the thread). I
@@ -137,34 +129,42 @@ scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
   // files to disk.
   if (!serializer.Serialize(*root)) {
     LOG(ERROR) << "Could not write Greaselion manifest";
-    return nullptr;
+    return false;
   }
 
   // Copy the script files to our extension directory.
-  for (auto script : rule->scripts()) {
-    if (!base::CopyFile(script, temp_dir.GetPath().Append(script.BaseName()))) {
+  for (auto script : scripts) {
+    if (!base::CopyFile(script, dir.Append(script.BaseName()))) {
       LOG(ERROR) << "Could not copy Greaselion script at path: "
           << script.LossyDisplayName();
-      return nullptr;
+      return false;
     }
   }
 
+  return true;
+}
+
+scoped_refptr<Extension> LoadGreaselionExtension(const base::FilePath& dir) {
   std::string error;
   scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
-      temp_dir.GetPath(), Manifest::COMPONENT, Extension::NO_FLAGS, &error);
+      dir, Manifest::COMPONENT, Extension::NO_FLAGS, &error);
   if (!extension.get()) {
     LOG(ERROR) << "Could not load Greaselion extension";
     LOG(ERROR) << error;
-    return nullptr;
   }
-
-  temp_dir.Take();  // The caller takes ownership of the directory.
   return extension;
 }
+
 }  // namespace
 
 namespace greaselion {
 
+GreaselionServiceImpl::RuleInfo::RuleInfo() = default;
+
+GreaselionServiceImpl::RuleInfo::RuleInfo(const RuleInfo& other) = default;
+
+GreaselionServiceImpl::RuleInfo::~RuleInfo() = default;
+
 GreaselionServiceImpl::GreaselionServiceImpl(
     GreaselionDownloadService* download_service,
     const base::FilePath& install_directory,
@@ -173,6 +173,10 @@ GreaselionServiceImpl::GreaselionServiceImpl(
     scoped_refptr<base::SequencedTaskRunner> task_runner)
     : download_service_(download_service),
       install_directory_(install_directory),
+      cache_directory_(install_directory.empty()
+                           ? base::FilePath()
+                           : install_directory.DirName().AppendASCII(
+                                 kGreaselionCacheDirName)),
       extension_system_(extension_system),
       extension_service_(extension_system->extension_service()),
       extension_registry_(extension_registry),
@@ -190,62 +194,201 @@ GreaselionServiceImpl::~GreaselionServiceImpl() {
   extension_registry_->RemoveObserver(this);
 }
 
+// static
+std::vector<GreaselionServiceImpl::RuleInfo>
+GreaselionServiceImpl::HashRulesOnTaskRunner(std::vector<RuleInfo> rules,
+                                             const base::FilePath& cache_dir) {
+  std::set<std::string> hashes;
+  for (RuleInfo& rule : rules) {
+    std::string data = GetExtensionKeySeed(rule.name);
+    data += '\n' + rule.run_at;
+    for (const std::string& url_pattern : rule.url_patterns)
+      data += '\n' + url_pattern;
+    // Scripts can be edited in place in dev mode, so their sizes and
+    // modification times are part of the hash
+    for (const base::FilePath& script : rule.scripts) {
+      base::File::Info info;
+      base::GetFileInfo(script, &info);
+      data += '\n' + script.AsUTF8Unsafe() + '\n' +
+              base::NumberToString(info.size) + '\n' +
+              base::NumberToString(info.last_modified.ToInternalValue());
+    }
+
+    char raw[crypto::kSHA256Length] = {0};
+    crypto::SHA256HashString(data, raw, crypto::kSHA256Length);
+    rule.hash = base::ToLowerASCII(base::HexEncode(raw, kRuleHashSize));
+    hashes.insert(rule.hash);
+  }
+
+  // Drop cached extensions of rules which no longer exist
+  if (!cache_dir.empty()) {
+    base::FileEnumerator enumerator(cache_dir, false,
+                                    base::FileEnumerator::DIRECTORIES);
+    for (base::FilePath dir = enumerator.Next(); !dir.empty();
+         dir = enumerator.Next()) {
+      if (!hashes.count(dir.BaseName().AsUTF8Unsafe()))
+        base::DeleteFileRecursively(dir);
+    }
+  }
+
+  return rules;
+}
+
+// Wraps a Greaselion rule in a component. The component is stored as an
+// unpacked extension in the Greaselion cache dir, named after the rule hash,
+// so unchanged rules are only loaded on later runs. Returns a valid extension
+// or nullptr.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+// static
+scoped_refptr<Extension> GreaselionServiceImpl::ConvertRuleOnTaskRunner(
+    const RuleInfo& rule,
+    const base::FilePath& extensions_dir,
+    const base::FilePath& cache_dir) {
+  base::FilePath cached_extension_dir;
+  if (!cache_dir.empty()) {
+    cached_extension_dir = cache_dir.AppendASCII(rule.hash);
+    if (base::PathExists(
+            cached_extension_dir.Append(extensions::kManifestFilename))) {
+      scoped_refptr<Extension> extension =
+          LoadGreaselionExtension(cached_extension_dir);
+      if (extension)
+        return extension;
+    }
+    base::DeleteFileRecursively(cached_extension_dir);
+  }
+
+  base::FilePath install_temp_dir =
+      extensions::file_util::GetInstallTempDir(extensions_dir);
+  if (install_temp_dir.empty()) {
+    LOG(ERROR) << "Could not get path to profile temp directory";
+    return nullptr;
+  }
+
+  base::ScopedTempDir temp_dir;
+  if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
+    LOG(ERROR) << "Could not create Greaselion temp directory";
+    return nullptr;
+  }
+
+  if (!WriteGreaselionExtension(rule.name, rule.url_patterns, rule.scripts,
+                                rule.run_at, temp_dir.GetPath())) {
+    return nullptr;
+  }
+
+  base::FilePath extension_dir = temp_dir.GetPath();
+  if (!cached_extension_dir.empty() &&
+      base::CreateDirectory(cache_dir) &&
+      base::Move(temp_dir.GetPath(), cached_extension_dir)) {
+    extension_dir = cached_extension_dir;
+  }
+
+  scoped_refptr<Extension> extension = LoadGreaselionExtension(extension_dir);
+  if (!extension.get())
+    return nullptr;
+
+  // The extension keeps using its directory, cached or not
+  temp_dir.Take();
+  return extension;
+}
+
 void GreaselionServiceImpl::UpdateInstalledExtensions() {
   if (update_in_progress_)
     return;
   update_in_progress_ = true;
-  if (greaselion_extensions_.empty()) {
-    // No Greaselion extensions are currently installed, so we can move on to
-    // the install phase immediately.
+
+  std::vector<RuleInfo> rules;
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    RuleInfo rule_info;
+    rule_info.name = rule->name();
+    rule_info.url_patterns = rule->url_patterns();
+    rule_info.scripts = rule->scripts();
+    rule_info.run_at = rule->run_at();
+    rule_info.enabled =
+        rule->Matches(state_) && rule->has_unknown_preconditions() == false;
+    rules.push_back(std::move(rule_info));
+  }
+
+  // Hashing reads the scripts' file info, so it runs on the extension file
+  // task runner
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&GreaselionServiceImpl::HashRulesOnTaskRunner,
+                     std::move(rules), cache_directory_),
+      base::BindOnce(&GreaselionServiceImpl::OnRulesHashed,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void GreaselionServiceImpl::OnRulesHashed(std::vector<RuleInfo> rules) {
+  DCHECK(update_in_progress_);
+  std::set<std::string> installed_hashes;
+  for (const auto& extension_rule_hash : extension_rule_hashes_)
+    installed_hashes.insert(extension_rule_hash.second);
+
+  // Only rules which were enabled or changed since the last update are
+  // converted and installed again
+  std::set<std::string> enabled_hashes;
+  rules_to_install_.clear();
+  for (RuleInfo& rule : rules) {
+    if (!rule.enabled)
+      continue;
+    enabled_hashes.insert(rule.hash);
+    if (!installed_hashes.count(rule.hash))
+      rules_to_install_.push_back(std::move(rule));
+  }
+
+  DCHECK(unloading_extensions_.empty());
+  for (const auto& extension_rule_hash : extension_rule_hashes_) {
+    if (!enabled_hashes.count(extension_rule_hash.second))
+      unloading_extensions_.insert(extension_rule_hash.first);
+  }
+
+  if (unloading_extensions_.empty()) {
+    // No Greaselion extensions need to go away, so we can move on to the
+    // install phase immediately.
     CreateAndInstallExtensions();
     return;
   }
 
-  // Make a copy of greaselion_extensions_ to iterate while the original vector
+  // Make a copy of unloading_extensions_ to iterate while the original set
   // changes.
-  std::vector<extensions::ExtensionId> extensions = greaselion_extensions_;
+  std::set<extensions::ExtensionId> extensions = unloading_extensions_;
   for (auto id : extensions) {
-    // We need to unload all the Greaselion extensions that are already
-    // installed. OnExtensionUnloaded will be called on each extension, where we
-    // will update the greaselion_extensions_ set. Once it's empty, that
-    // callback will call CreateAndInstallExtensions().
+    // OnExtensionUnloaded will be called on each extension, where we will
+    // update the unloading_extensions_ set. Once it's empty, that callback
+    // will call CreateAndInstallExtensions().
     extension_service_->UnloadExtension(
         id, extensions::UnloadedExtensionReason::UPDATE);
   }
 }
 
 void GreaselionServiceImpl::CreateAndInstallExtensions() {
-  DCHECK(greaselion_extensions_.empty());
+  DCHECK(unloading_extensions_.empty());
   DCHECK(update_in_progress_);
   all_rules_installed_successfully_ = true;
-  pending_installs_ = 0;
-  std::vector<std::unique_ptr<GreaselionRule>>* rules =
-      download_service_->rules();
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_) && rule->has_unknown_preconditions() == false) {
-      pending_installs_ += 1;
-    }
-  }
+  pending_installs_ = rules_to_install_.size();
   if (!pending_installs_) {
-    // no rules match, nothing else to do
+    // no rules need to be installed, nothing else to do
     MaybeNotifyObservers();
     return;
   }
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_) && rule->has_unknown_preconditions() == false) {
-      // Convert script file to component extension. This must run on extension
-      // file task runner, which was passed in in the constructor.
-      base::PostTaskAndReplyWithResult(
-          task_runner_.get(), FROM_HERE,
-          base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
-                         rule.get(), install_directory_),
-          base::BindOnce(&GreaselionServiceImpl::PostConvert,
-                         weak_factory_.GetWeakPtr()));
-    }
+  std::vector<RuleInfo> rules = std::move(rules_to_install_);
+  rules_to_install_.clear();
+  for (const RuleInfo& rule : rules) {
+    // Convert script file to component extension. This must run on extension
+    // file task runner, which was passed in in the constructor.
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&GreaselionServiceImpl::ConvertRuleOnTaskRunner, rule,
+                       install_directory_, cache_directory_),
+        base::BindOnce(&GreaselionServiceImpl::PostConvert,
+                       weak_factory_.GetWeakPtr(), rule.hash));
   }
 }
 
 void GreaselionServiceImpl::PostConvert(
+    const std::string& rule_hash,
     scoped_refptr<extensions::Extension> extension) {
   if (!extension.get()) {
     all_rules_installed_successfully_ = false;
@@ -254,6 +397,7 @@ void GreaselionServiceImpl::PostConvert(
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
     greaselion_extensions_.push_back(extension->id());
+    extension_rule_hashes_[extension->id()] = rule_hash;
     extension_system_->ready().Post(
         FROM_HERE,
         base::BindOnce(&GreaselionServiceImpl::Install,
@@ -291,7 +435,9 @@ void GreaselionServiceImpl::OnExtensionUnloaded(
     return;
   }
   greaselion_extensions_.erase(index);
-  if (update_in_progress_ && greaselion_extensions_.empty()) {
+  extension_rule_hashes_.erase(extension->id());
+  if (unloading_extensions_.erase(extension->id()) && update_in_progress_ &&
+      unloading_extensions_.empty()) {
     // It's time!
     CreateAndInstallExtensions();
   }
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_SERVICE_IMPL_H_
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -57,14 +58,43 @@ class GreaselionServiceImpl : public GreaselionService {
                            extensions::UnloadedExtensionReason reason) override;
 
  private:
+  // Copy of the rule fields needed to build its extension, so conversions
+  // don't depend on the lifetime of the download service rules
+  struct RuleInfo {
+    RuleInfo();
+    RuleInfo(const RuleInfo& other);
+    ~RuleInfo();
+
+    std::string name;
+    std::vector<std::string> url_patterns;
+    std::vector<base::FilePath> scripts;
+    std::string run_at;
+    bool enabled = false;
+    // Identifies the rule and its scripts' contents, filled in on the task
+    // runner
+    std::string hash;
+  };
+
+  static std::vector<RuleInfo> HashRulesOnTaskRunner(
+      std::vector<RuleInfo> rules,
+      const base::FilePath& cache_dir);
+  static scoped_refptr<extensions::Extension> ConvertRuleOnTaskRunner(
+      const RuleInfo& rule,
+      const base::FilePath& extensions_dir,
+      const base::FilePath& cache_dir);
+
+  void OnRulesHashed(std::vector<RuleInfo> rules);
   void CreateAndInstallExtensions();
-  void PostConvert(scoped_refptr<extensions::Extension> extension);
+  void PostConvert(const std::string& rule_hash,
+                   scoped_refptr<extensions::Extension> extension);
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
 
   GreaselionDownloadService* download_service_;  // NOT OWNED
   GreaselionFeatures state_;
   const base::FilePath install_directory_;
+  // Converted extensions are kept here by rule hash across restarts
+  const base::FilePath cache_directory_;
   extensions::ExtensionSystem* extension_system_;      // NOT OWNED
   extensions::ExtensionService* extension_service_;    // NOT OWNED
   extensions::ExtensionRegistry* extension_registry_;  // NOT OWNED
@@ -74,6 +104,13 @@ class GreaselionServiceImpl : public GreaselionService {
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<Observer> observers_;
   std::vector<extensions::ExtensionId> greaselion_extensions_;
+  // Hash of the rule each of greaselion_extensions_ was built from
+  std::map<extensions::ExtensionId, std::string> extension_rule_hashes_;
+  // Extensions of rules which were disabled or changed
+  std::set<extensions::ExtensionId> unloading_extensions_;
+  // Enabled rules without an up to date extension, installed once
+  // unloading_extensions_ is empty
+  std::vector<RuleInfo> rules_to_install_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(GreaselionServiceImpl);
@@ -9,6 +9,7 @@
 #include <vector>
 #include "base/strings/string_util.h"
 #include "base/strings/string_split.h"
+#include "brave/components/l10n/common/locale_util.h"
 
 namespace brave_l10n {
 
@@ -27,9 +28,54 @@ void LocaleHelper::set_for_testing(
 }
 
 std::string LocaleHelper::GetLocale() const {
+  base::AutoLock auto_lock(lock_);
+  if (!locale_) {
+    locale_ = GetPlatformLocale();
+  }
+
+  return *locale_;
+}
+
+std::string LocaleHelper::GetLanguageCode() const {
+  const std::string locale = GetLocale();
+
+  base::AutoLock auto_lock(lock_);
+  MaybeParseLocale(locale);
+  return language_code_;
+}
+
+std::string LocaleHelper::GetCountryCode() const {
+  const std::string locale = GetLocale();
+
+  base::AutoLock auto_lock(lock_);
+  MaybeParseLocale(locale);
+  return country_code_;
+}
+
+void LocaleHelper::OnLocaleChanged() {
+  base::AutoLock auto_lock(lock_);
+  locale_.reset();
+}
+
+std::string LocaleHelper::GetPlatformLocale() const {
   return kDefaultLocale;
 }
 
+void LocaleHelper::MaybeParseLocale(
+    const std::string& locale) const {
+  lock_.AssertAcquired();
+
+  // |GetLocale()| can be overridden, e.g. for testing, so compare with the
+  // locale which was parsed rather than relying on |OnLocaleChanged()|
+  if (parsed_locale_ && *parsed_locale_ == locale) {
+    return;
+  }
+
+  language_code_ = brave_l10n::GetLanguageCode(locale);
+  country_code_ = GetCountryCode(locale);
+  parsed_locale_ = locale;
+}
+
 std::string LocaleHelper::GetCountryCode(
     const std::string& locale) {
   std::vector<std::string> locale_components = base::SplitString(locale, ".",
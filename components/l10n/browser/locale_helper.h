@@ -10,6 +10,8 @@
 
 #include "base/macros.h"
 #include "base/memory/singleton.h"
+#include "base/optional.h"
+#include "base/synchronization/lock.h"
 #include "build/build_config.h"
 
 namespace brave_l10n {
@@ -27,12 +29,21 @@ class LocaleHelper {
   void set_for_testing(
       LocaleHelper* locale_helper);
 
-  // Should return the language based upon the tagging conventions of RFC 4646
+  // Should return the language based upon the tagging conventions of RFC 4646.
+  // The platform locale is cached until |OnLocaleChanged()| is called
   virtual std::string GetLocale() const;
 
+  // Language and country codes of |GetLocale()|, only parsed again when the
+  // locale changes
+  std::string GetLanguageCode() const;
+  std::string GetCountryCode() const;
+
   static std::string GetCountryCode(
       const std::string& locale);
 
+  // Drops the cached locale, called when the platform locale changed
+  void OnLocaleChanged();
+
  protected:
   friend struct base::DefaultSingletonTraits<LocaleHelper>;
 
@@ -40,6 +51,19 @@ class LocaleHelper {
   virtual ~LocaleHelper();
 
   static LocaleHelper* GetInstanceImpl();
+
+  // Queries the platform for the locale
+  virtual std::string GetPlatformLocale() const;
+
+ private:
+  void MaybeParseLocale(
+      const std::string& locale) const;
+
+  mutable base::Lock lock_;
+  mutable base::Optional<std::string> locale_;  // GUARDED_BY(lock_)
+  mutable base::Optional<std::string> parsed_locale_;  // GUARDED_BY(lock_)
+  mutable std::string language_code_;  // GUARDED_BY(lock_)
+  mutable std::string country_code_;  // GUARDED_BY(lock_)
 };
 
 }  // namespace brave_l10n
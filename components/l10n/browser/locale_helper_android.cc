@@ -9,7 +9,7 @@
 
 namespace brave_l10n {
 
-std::string LocaleHelperAndroid::GetLocale() const {
+std::string LocaleHelperAndroid::GetPlatformLocale() const {
   return base::android::GetDefaultLocaleString();
 }
 
@@ -26,7 +26,7 @@ class LocaleHelperAndroid : public LocaleHelper {
   ~LocaleHelperAndroid() override = default;
 
   // LocaleHelper impl
-  std::string GetLocale() const override;
+  std::string GetPlatformLocale() const override;
 };
 
 }  // namespace brave_l10n
@@ -26,7 +26,7 @@ class LocaleHelperIos : public LocaleHelper {
   ~LocaleHelperIos() override;
 
   // LocaleHelper impl
-  std::string GetLocale() const override;
+  std::string GetPlatformLocale() const override;
 };
 
 }  // namespace brave_l10n
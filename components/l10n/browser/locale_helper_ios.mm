@@ -9,17 +9,27 @@
 
 namespace brave_l10n {
 
-LocaleHelperIos::LocaleHelperIos() = default;
+LocaleHelperIos::LocaleHelperIos() {
+  [[NSNotificationCenter defaultCenter]
+      addObserverForName:NSCurrentLocaleDidChangeNotification
+                  object:nil
+                   queue:nil
+              usingBlock:^(NSNotification* notification) {
+                OnLocaleChanged();
+              }];
+}
 
 LocaleHelperIos::~LocaleHelperIos() = default;
 
-std::string LocaleHelperIos::GetLocale() const {
+std::string LocaleHelperIos::GetPlatformLocale() const {
   NSString *locale = [[NSLocale preferredLanguages] firstObject];
   return std::string([locale UTF8String]);
 }
 
 LocaleHelperIos* LocaleHelperIos::GetInstanceImpl() {
-  return base::Singleton<LocaleHelperIos>::get();
+  // Leaky as the locale change observer is never removed
+  return base::Singleton<LocaleHelperIos,
+      base::LeakySingletonTraits<LocaleHelperIos>>::get();
 }
 
 LocaleHelper* LocaleHelper::GetInstanceImpl() {
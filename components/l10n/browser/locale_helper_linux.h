@@ -26,7 +26,7 @@ class LocaleHelperLinux : public LocaleHelper {
   ~LocaleHelperLinux() override;
 
   // LocaleHelper impl
-  std::string GetLocale() const override;
+  std::string GetPlatformLocale() const override;
 };
 
 }  // namespace brave_l10n
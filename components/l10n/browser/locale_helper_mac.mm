@@ -9,17 +9,27 @@
 
 namespace brave_l10n {
 
-LocaleHelperMac::LocaleHelperMac() = default;
+LocaleHelperMac::LocaleHelperMac() {
+  [[NSNotificationCenter defaultCenter]
+      addObserverForName:NSCurrentLocaleDidChangeNotification
+                  object:nil
+                   queue:nil
+              usingBlock:^(NSNotification* notification) {
+                OnLocaleChanged();
+              }];
+}
 
 LocaleHelperMac::~LocaleHelperMac() = default;
 
-std::string LocaleHelperMac::GetLocale() const {
+std::string LocaleHelperMac::GetPlatformLocale() const {
   NSString *locale = [[NSLocale preferredLanguages] firstObject];
   return std::string([locale UTF8String]);
 }
 
 LocaleHelperMac* LocaleHelperMac::GetInstanceImpl() {
-  return base::Singleton<LocaleHelperMac>::get();
+  // Leaky as the locale change observer is never removed
+  return base::Singleton<LocaleHelperMac,
+      base::LeakySingletonTraits<LocaleHelperMac>>::get();
 }
 
 LocaleHelper* LocaleHelper::GetInstanceImpl() {
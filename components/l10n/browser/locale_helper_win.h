@@ -27,7 +27,7 @@ class LocaleHelperWin : public LocaleHelper {
   ~LocaleHelperWin() override;
 
   // LocaleHelper impl
-  std::string GetLocale() const override;
+  std::string GetPlatformLocale() const override;
 };
 
 }  // namespace brave_l10n
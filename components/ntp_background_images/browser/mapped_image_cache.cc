@@ -0,0 +1,130 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/mapped_image_cache.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/task/post_task.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+// Enough for the logo and the wallpapers of both super referral and
+// sponsored images, which are only a few per campaign.
+constexpr size_t kMaxMappedImageCount = 8;
+
+constexpr size_t kPageSize = 4096;
+
+// Serves the image data straight from the mapped file.
+class MappedImageFile : public base::RefCountedMemory {
+ public:
+  explicit MappedImageFile(std::unique_ptr<base::MemoryMappedFile> file)
+      : file_(std::move(file)) {}
+
+  MappedImageFile(const MappedImageFile&) = delete;
+  MappedImageFile& operator=(const MappedImageFile&) = delete;
+
+  // base::RefCountedMemory overrides:
+  const unsigned char* front() const override { return file_->data(); }
+  size_t size() const override { return file_->length(); }
+
+ private:
+  ~MappedImageFile() override {
+    // The last reference is usually released on the UI thread, but closing
+    // the file may block.
+    base::PostTask(
+        FROM_HERE,
+        {base::ThreadPool(), base::MayBlock(),
+         base::TaskPriority::BEST_EFFORT},
+        base::BindOnce([](std::unique_ptr<base::MemoryMappedFile> file) {},
+                       std::move(file_)));
+  }
+
+  std::unique_ptr<base::MemoryMappedFile> file_;
+};
+
+scoped_refptr<base::RefCountedMemory> MapImageFile(
+    const base::FilePath& path) {
+  auto file = std::make_unique<base::MemoryMappedFile>();
+  if (!file->Initialize(path) || !file->IsValid())
+    return nullptr;
+
+  // Fault the pages in here instead of when the data is copied for the
+  // renderer.
+  const volatile uint8_t* data = file->data();
+  for (size_t offset = 0; offset < file->length(); offset += kPageSize)
+    static_cast<void>(data[offset]);
+
+  return base::MakeRefCounted<MappedImageFile>(std::move(file));
+}
+
+}  // namespace
+
+MappedImageCache::MappedImageCache() : images_(kMaxMappedImageCount) {}
+
+MappedImageCache::~MappedImageCache() = default;
+
+void MappedImageCache::GetImage(const base::FilePath& image_file_path,
+                                GetImageCallback callback) {
+  auto it = images_.Get(image_file_path);
+  if (it != images_.end()) {
+    std::move(callback).Run(it->second);
+    return;
+  }
+
+  // The image may be already being mapped for another request.
+  auto result = pending_requests_.emplace(image_file_path,
+                                          std::vector<GetImageCallback>());
+  result.first->second.push_back(std::move(callback));
+  if (result.second)
+    MapImage(image_file_path);
+}
+
+void MappedImageCache::Prefetch(const base::FilePath& image_file_path) {
+  if (image_file_path.empty() ||
+      images_.Peek(image_file_path) != images_.end())
+    return;
+
+  if (pending_requests_.emplace(image_file_path,
+                                std::vector<GetImageCallback>()).second)
+    MapImage(image_file_path);
+}
+
+void MappedImageCache::Clear() {
+  images_.Clear();
+}
+
+void MappedImageCache::MapImage(const base::FilePath& image_file_path) {
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::ThreadPool(), base::MayBlock()},
+      base::BindOnce(&MapImageFile, image_file_path),
+      base::BindOnce(&MappedImageCache::OnMappedImage,
+                     weak_factory_.GetWeakPtr(),
+                     image_file_path));
+}
+
+void MappedImageCache::OnMappedImage(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> data) {
+  if (data)
+    images_.Put(image_file_path, data);
+
+  auto it = pending_requests_.find(image_file_path);
+  if (it == pending_requests_.end())
+    return;
+
+  std::vector<GetImageCallback> callbacks = std::move(it->second);
+  pending_requests_.erase(it);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(data);
+}
+
+}  // namespace ntp_background_images
@@ -0,0 +1,67 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_MAPPED_IMAGE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_MAPPED_IMAGE_CACHE_H_
+
+#include <map>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
+#include "base/files/file_path.h"
+#include "base/gtest_prod_util.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/weak_ptr.h"
+
+namespace base {
+class RefCountedMemory;
+}  // namespace base
+
+namespace ntp_background_images {
+
+// Keeps the recently used wallpapers and logos memory mapped. They come from
+// the read-only component folder, so they are served without copying and
+// repeated new tab pages don't need any file I/O.
+class MappedImageCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  MappedImageCache();
+  ~MappedImageCache();
+
+  MappedImageCache(const MappedImageCache&) = delete;
+  MappedImageCache& operator=(const MappedImageCache&) = delete;
+
+  // Runs |callback| with the data of |image_file_path|, or null if the file
+  // can't be mapped.
+  void GetImage(const base::FilePath& image_file_path,
+                GetImageCallback callback);
+  // Maps |image_file_path| and faults its pages in ahead of the next
+  // |GetImage()|, so the new tab page doesn't wait for the disk.
+  void Prefetch(const base::FilePath& image_file_path);
+  // Should be called when the component data is updated, so that the old
+  // component folder is not kept mapped.
+  void Clear();
+
+ private:
+  FRIEND_TEST_ALL_PREFIXES(MappedImageCacheTest, GetImage);
+  FRIEND_TEST_ALL_PREFIXES(MappedImageCacheTest, Prefetch);
+
+  void MapImage(const base::FilePath& image_file_path);
+  void OnMappedImage(const base::FilePath& image_file_path,
+                     scoped_refptr<base::RefCountedMemory> data);
+
+  base::MRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      images_;
+  // Requests waiting for an image which is being mapped.
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_requests_;
+  base::WeakPtrFactory<MappedImageCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_MAPPED_IMAGE_CACHE_H_
@@ -0,0 +1,95 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/test/task_environment.h"
+#include "brave/components/ntp_background_images/browser/mapped_image_cache.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+void OnGetImage(scoped_refptr<base::RefCountedMemory>* result,
+                scoped_refptr<base::RefCountedMemory> data) {
+  *result = std::move(data);
+}
+
+}  // namespace
+
+class MappedImageCacheTest : public testing::Test {
+ public:
+  MappedImageCacheTest() {}
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    image_path_ = temp_dir_.GetPath().AppendASCII("background-1.jpg");
+    ASSERT_EQ(static_cast<int>(image_data_.size()),
+              base::WriteFile(image_path_, image_data_.data(),
+                              image_data_.size()));
+    cache_ = std::make_unique<MappedImageCache>();
+  }
+
+  void TearDown() override {
+    // Unmap before |temp_dir_| is deleted.
+    cache_.reset();
+    task_environment_.RunUntilIdle();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath image_path_;
+  const std::string image_data_ = "wallpaper";
+  std::unique_ptr<MappedImageCache> cache_;
+};
+
+TEST_F(MappedImageCacheTest, GetImage) {
+  scoped_refptr<base::RefCountedMemory> first;
+  cache_->GetImage(image_path_, base::BindOnce(&OnGetImage, &first));
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(first);
+  EXPECT_EQ(image_data_, std::string(first->front_as<char>(), first->size()));
+
+  // The mapped image is served again without posting a task.
+  scoped_refptr<base::RefCountedMemory> second;
+  cache_->GetImage(image_path_, base::BindOnce(&OnGetImage, &second));
+  EXPECT_EQ(first, second);
+
+  // Missing files are not cached.
+  scoped_refptr<base::RefCountedMemory> missing = first;
+  cache_->GetImage(temp_dir_.GetPath().AppendASCII("background-2.jpg"),
+                   base::BindOnce(&OnGetImage, &missing));
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(missing);
+  EXPECT_EQ(1u, cache_->images_.size());
+
+  first = second = nullptr;
+  cache_->Clear();
+  EXPECT_EQ(0u, cache_->images_.size());
+}
+
+TEST_F(MappedImageCacheTest, Prefetch) {
+  cache_->Prefetch(image_path_);
+
+  // Requests made while prefetching wait for the same mapping.
+  scoped_refptr<base::RefCountedMemory> data;
+  cache_->GetImage(image_path_, base::BindOnce(&OnGetImage, &data));
+  EXPECT_EQ(1u, cache_->pending_requests_.size());
+  EXPECT_FALSE(data);
+
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(data);
+  EXPECT_EQ(image_data_, std::string(data->front_as<char>(), data->size()));
+  EXPECT_TRUE(cache_->pending_requests_.empty());
+  EXPECT_EQ(1u, cache_->images_.size());
+}
+
+}  // namespace ntp_background_images
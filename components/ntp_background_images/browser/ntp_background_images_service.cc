@@ -56,12 +56,9 @@ std::string GetMappingTableData(const base::FilePath& installed_dir) {
   return contents;
 }
 
-void CacheSuperReferralData(const std::string& data_json,
+void CacheSuperReferralData(const NTPBackgroundImagesData& data,
                             const base::FilePath& installed_dir,
                             const base::FilePath& super_referral_cache_dir) {
-  NTPBackgroundImagesData data(data_json,
-                               super_referral_cache_dir);
-
   base::CreateDirectory(super_referral_cache_dir);
   // Cache logo image
   base::CopyFile(installed_dir.Append(data.logo_image_file.BaseName()),
@@ -78,37 +75,55 @@ void CacheSuperReferralData(const std::string& data_json,
   }
 }
 
+}  // namespace
+
+struct NTPBackgroundImagesService::ComponentData {
+  std::string json_string;
+  std::unique_ptr<NTPBackgroundImagesData> images_data;
+  // Super referral data is the same as the one restored from prefs.
+  bool unchanged = false;
+};
+
 // If registered component is for sponsored images wallpaper, it has photo.json
 // in |installed_dir|. Otherwise, it has data.json for super referral.
-// This methods cache super referral's favicon data because that favicon images
-// could be used after campaign ends.
-// And return manifest json string.
-std::string HandleComponentData(
+// This methods parses the manifest and caches super referral's favicon data
+// because that favicon images could be used after campaign ends.
+// |cached_json_string| is the super referral manifest already cached in
+// prefs, it isn't parsed again at every launch.
+// static
+std::unique_ptr<NTPBackgroundImagesService::ComponentData>
+NTPBackgroundImagesService::HandleComponentData(
     const base::FilePath& installed_dir,
     const base::FilePath& super_referral_cache_dir,
-    bool is_super_referral) {
+    bool is_super_referral,
+    const std::string& cached_json_string) {
+  auto data = std::make_unique<ComponentData>();
   base::FilePath json_path = installed_dir.AppendASCII(kNTPManifestFile);
-  std::string contents;
 
   if (json_path.empty()) {
     NOTREACHED() << __func__ << ": Can't find valid manifest file in "
                              << installed_dir;
-    return contents;
-  }
-
-  bool success = base::ReadFileToString(json_path, &contents);
-  if (!success || contents.empty()) {
+  } else if (!base::ReadFileToString(json_path, &data->json_string) ||
+             data->json_string.empty()) {
     DVLOG(2) << __func__ << ": cannot read json file " << json_path;
-    return contents;
+    data->json_string.clear();
+  } else if (is_super_referral && data->json_string == cached_json_string) {
+    // Images were cached when this manifest was cached.
+    data->unchanged = true;
+    return data;
   }
 
-  if (is_super_referral)
-    CacheSuperReferralData(contents, installed_dir, super_referral_cache_dir);
+  data->images_data = std::make_unique<NTPBackgroundImagesData>(
+      data->json_string,
+      is_super_referral ? super_referral_cache_dir : installed_dir);
 
-  return contents;
-}
+  if (is_super_referral && !data->json_string.empty()) {
+    CacheSuperReferralData(*data->images_data, installed_dir,
+                           super_referral_cache_dir);
+  }
 
-}  // namespace
+  return data;
+}
 
 // static
 void NTPBackgroundImagesService::RegisterLocalStatePrefs(
@@ -183,7 +198,7 @@ void NTPBackgroundImagesService::RegisterSponsoredImagesComponent() {
   const std::string locale =
       brave_l10n::LocaleHelper::GetInstance()->GetLocale();
   const auto& data = GetSponsoredImagesComponentData(
-      brave_l10n::LocaleHelper::GetCountryCode(locale));
+      brave_l10n::LocaleHelper::GetInstance()->GetCountryCode());
   if (!data) {
     DVLOG(2) << __func__ << ": Not support NTP SI component for " << locale;
     return;
@@ -468,11 +483,20 @@ void NTPBackgroundImagesService::OnComponentReady(
   DVLOG(2) << __func__ << (is_super_referral ? ": NPT SR Component is ready"
                                              : ": NTP SI Component is ready");
 
+  const std::string cached_json_string =
+      is_super_referral && sr_images_data_
+          ? local_pref_->GetString(
+                prefs::kNewTabPageCachedSuperReferralComponentData)
+          : std::string();
+
+  // Reading and parsing are done on the thread pool, only the ready data
+  // is handed over.
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
-      base::BindOnce(&HandleComponentData, installed_dir,
-                     super_referral_cache_dir_, is_super_referral),
-      base::BindOnce(&NTPBackgroundImagesService::OnGetComponentJsonData,
+      base::BindOnce(&NTPBackgroundImagesService::HandleComponentData,
+                     installed_dir, super_referral_cache_dir_,
+                     is_super_referral, cached_json_string),
+      base::BindOnce(&NTPBackgroundImagesService::OnGetComponentData,
                      weak_factory_.GetWeakPtr(),
                      is_super_referral));
 }
@@ -480,13 +504,40 @@ void NTPBackgroundImagesService::OnComponentReady(
 void NTPBackgroundImagesService::OnGetComponentJsonData(
     bool is_super_referral,
     const std::string& json_string) {
+  auto data = std::make_unique<ComponentData>();
+  data->json_string = json_string;
+  data->images_data = std::make_unique<NTPBackgroundImagesData>(
+      json_string, is_super_referral ? super_referral_cache_dir_
+                                     : si_installed_dir_);
+  OnGetComponentData(is_super_referral, std::move(data));
+}
+
+void NTPBackgroundImagesService::OnGetComponentData(
+    bool is_super_referral,
+    std::unique_ptr<ComponentData> data) {
+  DCHECK(data);
+  const std::string& json_string = data->json_string;
+
+  if (data->unchanged) {
+    local_pref_->SetBoolean(prefs::kNewTabPageGetInitialSRComponentInProgress,
+                            false);
+    // The data restored from prefs could be dropped meanwhile.
+    if (sr_images_data_) {
+      DVLOG(2) << __func__ << ": NTP SR data is not changed.";
+      return;
+    }
+    data->images_data = std::make_unique<NTPBackgroundImagesData>(
+        json_string, super_referral_cache_dir_);
+  }
+
+  // Images of the previous component version are not used anymore.
+  mapped_image_cache_.Clear();
+
   if (is_super_referral) {
     local_pref_->SetBoolean(
           prefs::kNewTabPageGetInitialSRComponentInProgress,
           false);
-    sr_images_data_.reset(
-        new NTPBackgroundImagesData(json_string,
-                                    super_referral_cache_dir_));
+    sr_images_data_ = std::move(data->images_data);
     // |initial_sr_component_info_| has proper data only for initial component
     // downloading. After that, it's empty. In test, it's also empty.
     if (initial_sr_component_info_.is_dict()) {
@@ -504,8 +555,7 @@ void NTPBackgroundImagesService::OnGetComponentJsonData(
     local_pref_->SetString(prefs::kNewTabPageCachedSuperReferralComponentData,
                            json_string);
   } else {
-    si_images_data_.reset(new NTPBackgroundImagesData(json_string,
-                                                      si_installed_dir_));
+    si_images_data_ = std::move(data->images_data);
   }
 
   bool sr_ended = false;
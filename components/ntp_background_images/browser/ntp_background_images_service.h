@@ -16,6 +16,7 @@
 #include "base/observer_list.h"
 #include "base/timer/timer.h"
 #include "base/values.h"
+#include "brave/components/ntp_background_images/browser/mapped_image_cache.h"
 #include "components/prefs/pref_change_registrar.h"
 
 namespace component_updater {
@@ -69,6 +70,8 @@ class NTPBackgroundImagesService {
 
   std::vector<std::string> GetCachedTopSitesFaviconList() const;
 
+  MappedImageCache* mapped_image_cache() { return &mapped_image_cache_; }
+
  private:
   friend class TestNTPBackgroundImagesService;
   friend class NTPBackgroundImagesServiceTest;
@@ -83,6 +86,8 @@ class NTPBackgroundImagesService {
                            WithSuperReferralCodeTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesServiceTest,
                            BasicSuperReferralTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesServiceTest,
+                           UnchangedSuperReferralComponentTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesServiceTest,
                            CheckReferralServiceInitStatusTest);
   FRIEND_TEST_ALL_PREFIXES(
@@ -108,10 +113,21 @@ class NTPBackgroundImagesService {
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
 
+  struct ComponentData;
+
+  static std::unique_ptr<ComponentData> HandleComponentData(
+      const base::FilePath& installed_dir,
+      const base::FilePath& super_referral_cache_dir,
+      bool is_super_referral,
+      const std::string& cached_json_string);
+
   void OnComponentReady(bool is_super_referral,
                         const base::FilePath& installed_dir);
+  // Parses |json_string| on the calling thread, only used by tests.
   void OnGetComponentJsonData(bool is_super_referral,
                               const std::string& json_string);
+  void OnGetComponentData(bool is_super_referral,
+                          std::unique_ptr<ComponentData> data);
   void OnMappingTableComponentReady(const base::FilePath& installed_dir);
   void OnPreferenceChanged(const std::string& pref_name);
   void OnGetMappingTableData(const std::string& json_string);
@@ -157,6 +173,7 @@ class NTPBackgroundImagesService {
   // not show SI images until user chooses Brave default images. So, we should
   // know the exact timing whether SR assets is ready to use or not.
   base::Value initial_sr_component_info_;
+  MappedImageCache mapped_image_cache_;
   base::WeakPtrFactory<NTPBackgroundImagesService> weak_factory_;
 };
 
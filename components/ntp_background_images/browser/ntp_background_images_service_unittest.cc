@@ -6,6 +6,8 @@
 #include <memory>
 #include <string>
 
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/test/task_environment.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -320,6 +322,34 @@ TEST_F(NTPBackgroundImagesServiceTest, BasicSuperReferralTest) {
   service_->RemoveObserver(&observer);
 }
 
+TEST_F(NTPBackgroundImagesServiceTest, UnchangedSuperReferralComponentTest) {
+  Init();
+  TestObserver observer;
+  service_->AddObserver(&observer);
+
+  base::ScopedTempDir installed_dir;
+  ASSERT_TRUE(installed_dir.CreateUniqueTempDir());
+  const std::string json_string(kTestSuperReferral);
+  ASSERT_EQ(static_cast<int>(json_string.size()),
+            base::WriteFile(installed_dir.GetPath().AppendASCII("photo.json"),
+                            json_string.data(), json_string.size()));
+
+  // Simulate SR data restored from prefs at startup.
+  pref_service_.SetString(prefs::kNewTabPageCachedSuperReferralComponentData,
+                          json_string);
+  service_->sr_images_data_ = std::make_unique<NTPBackgroundImagesData>(
+      json_string, service_->super_referral_cache_dir_);
+  auto* restored_data = service_->sr_images_data_.get();
+
+  // The same component data is not parsed again.
+  service_->OnComponentReady(true, installed_dir.GetPath());
+  env_.RunUntilIdle();
+  EXPECT_FALSE(observer.on_updated_);
+  EXPECT_EQ(restored_data, service_->sr_images_data_.get());
+
+  service_->RemoveObserver(&observer);
+}
+
 // Test default referral code and first run.
 // Sponsored Images component will be run after promo code set to pref.
 TEST_F(NTPBackgroundImagesServiceTest, WithDefaultReferralCodeTest1) {
@@ -14,6 +14,7 @@
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/post_task.h"
+#include "brave/components/ntp_background_images/browser/mapped_image_cache.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
@@ -85,7 +86,8 @@ void NTPBackgroundImagesSource::StartDataRequest(
         images_data->backgrounds[GetWallpaperIndexFromPath(path)].image_file;
   }
 
-  GetImageFile(image_file_path, std::move(callback));
+  service_->mapped_image_cache()->GetImage(image_file_path,
+                                          std::move(callback));
 }
 
 void NTPBackgroundImagesSource::GetImageFile(
@@ -20,7 +20,8 @@ namespace ntp_background_images {
 
 class NTPBackgroundImagesService;
 
-// This serves background image data.
+// This serves background image data. Wallpapers and logos are served from
+// the service's MappedImageCache.
 class NTPBackgroundImagesSource : public content::URLDataSource {
  public:
   explicit NTPBackgroundImagesSource(NTPBackgroundImagesService* service);
@@ -22,6 +22,23 @@ bool ViewCounterModel::ShouldShowBrandedWallpaper() const {
   return count_to_branded_wallpaper_ == 0;
 }
 
+bool ViewCounterModel::ShouldShowBrandedWallpaperAfterNextPageView() const {
+  if (ignore_count_to_branded_wallpaper_)
+    return true;
+
+  return count_to_branded_wallpaper_ == 1;
+}
+
+int ViewCounterModel::GetNextWallpaperImageIndex() const {
+  if (total_image_count_ <= 0)
+    return current_wallpaper_image_index_;
+
+  if (ignore_count_to_branded_wallpaper_ || count_to_branded_wallpaper_ == 0)
+    return (current_wallpaper_image_index_ + 1) % total_image_count_;
+
+  return current_wallpaper_image_index_;
+}
+
 void ViewCounterModel::ResetCurrentWallpaperImageIndex() {
   current_wallpaper_image_index_ = 0;
 }
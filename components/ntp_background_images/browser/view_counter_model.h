@@ -28,6 +28,10 @@ class ViewCounterModel {
   }
 
   bool ShouldShowBrandedWallpaper() const;
+  // Tells what the next |RegisterPageView()| will select, so that the image
+  // can be loaded ahead of the next new tab page.
+  bool ShouldShowBrandedWallpaperAfterNextPageView() const;
+  int GetNextWallpaperImageIndex() const;
   void RegisterPageView();
   void ResetCurrentWallpaperImageIndex();
 
@@ -80,4 +80,26 @@ TEST(ViewCounterModelTest, NTPSuperReferralTest) {
   }
 }
 
+TEST(ViewCounterModelTest, NextPageViewTest) {
+  ViewCounterModel model;
+  model.set_total_image_count(kTestImageCount);
+
+  // The next page view matches what |RegisterPageView()| selects.
+  for (int i = 0; i < 20; ++i) {
+    const bool should_show =
+        model.ShouldShowBrandedWallpaperAfterNextPageView();
+    const int next_index = model.GetNextWallpaperImageIndex();
+    model.RegisterPageView();
+    EXPECT_EQ(should_show, model.ShouldShowBrandedWallpaper());
+    if (should_show)
+      EXPECT_EQ(next_index, model.current_wallpaper_image_index());
+  }
+
+  model.set_ignore_count_to_branded_wallpaper(true);
+  EXPECT_TRUE(model.ShouldShowBrandedWallpaperAfterNextPageView());
+  const int next_index = model.GetNextWallpaperImageIndex();
+  model.RegisterPageView();
+  EXPECT_EQ(next_index, model.current_wallpaper_image_index());
+}
+
 }  // namespace ntp_background_images
@@ -137,6 +137,7 @@ void ViewCounterService::OnUpdated(NTPBackgroundImagesData* data) {
     model_.ResetCurrentWallpaperImageIndex();
     model_.set_total_image_count(data->backgrounds.size());
     model_.set_ignore_count_to_branded_wallpaper(data->IsSuperReferral());
+    PrefetchNextBrandedWallpaper();
   }
 }
 
@@ -175,9 +176,25 @@ void ViewCounterService::RegisterPageView() {
   // or the user opt-in status changing.
   if (IsBrandedWallpaperActive()) {
     model_.RegisterPageView();
+    PrefetchNextBrandedWallpaper();
   }
 }
 
+void ViewCounterService::PrefetchNextBrandedWallpaper() {
+  if (!IsBrandedWallpaperActive() ||
+      !model_.ShouldShowBrandedWallpaperAfterNextPageView())
+    return;
+
+  auto* data = GetCurrentBrandedWallpaperData();
+  const size_t index = model_.GetNextWallpaperImageIndex();
+  if (index >= data->backgrounds.size())
+    return;
+
+  MappedImageCache* cache = service_->mapped_image_cache();
+  cache->Prefetch(data->backgrounds[index].image_file);
+  cache->Prefetch(data->logo_image_file);
+}
+
 bool ViewCounterService::ShouldShowBrandedWallpaper() const {
   return IsBrandedWallpaperActive() && model_.ShouldShowBrandedWallpaper();
 }
@@ -107,6 +107,9 @@ class ViewCounterService : public KeyedService,
   bool ShouldShowBrandedWallpaper() const;
 
   void ResetModel();
+  // Warms the images of the next new tab page if it shows the branded
+  // wallpaper.
+  void PrefetchNextBrandedWallpaper();
 
   NTPBackgroundImagesService* service_ = nullptr;  // not owned
   PrefService* prefs_ = nullptr;  // not owned
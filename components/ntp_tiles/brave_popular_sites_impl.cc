@@ -5,11 +5,9 @@
 
 #include "brave/components/ntp_tiles/brave_popular_sites_impl.h"
 
-namespace {
+#include <utility>
 
-// static global variable is used because |sections()| returns const ref value.
-std::map<ntp_tiles::SectionType, ntp_tiles::PopularSites::SitesVector>
-    g_filtered_sections;
+namespace {
 
 bool ShouldHideSiteFromPopularSites(const ntp_tiles::PopularSites::Site& site) {
   if (site.url == "https://m.youtube.com/")
@@ -26,19 +24,35 @@ namespace ntp_tiles {
 // See PopularSitesImpl::ParseVersion6OrAbove() or ParseVersion5().
 const std::map<SectionType, PopularSitesImpl::SitesVector>&
 BravePopularSitesImpl::sections() const {
-  PopularSites::SitesVector filtered_sites;
   const auto iter =
       PopularSitesImpl::sections().find(SectionType::PERSONALIZED);
-  if (iter != PopularSitesImpl::sections().end()) {
-    const PopularSites::SitesVector& popular_sites = iter->second;
-    for (const auto& site : popular_sites) {
-      if (ShouldHideSiteFromPopularSites(site))
-        continue;
-      filtered_sites.push_back(site);
-    }
+  if (iter == PopularSitesImpl::sections().end()) {
+    filtered_sections_[SectionType::PERSONALIZED].clear();
+    filtered_sites_source_ = nullptr;
+    filtered_sites_source_size_ = 0;
+    return filtered_sections_;
+  }
+
+  // Parsing replaces the sites wholesale, so the same storage and size means
+  // the same sites.
+  const PopularSites::SitesVector& popular_sites = iter->second;
+  if (filtered_sites_source_ &&
+      filtered_sites_source_ == popular_sites.data() &&
+      filtered_sites_source_size_ == popular_sites.size()) {
+    return filtered_sections_;
+  }
+
+  PopularSites::SitesVector filtered_sites;
+  filtered_sites.reserve(popular_sites.size());
+  for (const auto& site : popular_sites) {
+    if (ShouldHideSiteFromPopularSites(site))
+      continue;
+    filtered_sites.push_back(site);
   }
-  g_filtered_sections[SectionType::PERSONALIZED] = filtered_sites;
-  return g_filtered_sections;
+  filtered_sections_[SectionType::PERSONALIZED] = std::move(filtered_sites);
+  filtered_sites_source_ = popular_sites.data();
+  filtered_sites_source_size_ = popular_sites.size();
+  return filtered_sections_;
 }
 
 }  // namespace ntp_tiles
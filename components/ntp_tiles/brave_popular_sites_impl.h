@@ -20,6 +20,12 @@ class BravePopularSitesImpl : public PopularSitesImpl {
   const std::map<SectionType, SitesVector>& sections() const override;
 
  private:
+  // |sections()| is called whenever the NTP tiles are built, so the filtered
+  // sites are only rebuilt when the parsed sites they come from are replaced.
+  mutable std::map<SectionType, SitesVector> filtered_sections_;
+  mutable const Site* filtered_sites_source_ = nullptr;
+  mutable size_t filtered_sites_source_size_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(BravePopularSitesImpl);
 };
 
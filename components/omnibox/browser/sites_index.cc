@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/sites_index.h"
+
+#include <algorithm>
+
+#include "base/strings/string_util.h"
+
+namespace {
+
+const size_t kMaxNGramLength = 3;
+
+}  // namespace
+
+SitesIndex::SitesIndex(const std::vector<std::string>& sites)
+    : sites_(sites) {
+  for (size_t index = 0; index < sites_.size(); ++index) {
+    const std::string& site = sites_[index];
+    for (size_t start = 0; start < site.length(); ++start) {
+      for (size_t length = 1;
+           length <= kMaxNGramLength && start + length <= site.length();
+           ++length) {
+        auto& postings = ngrams_[site.substr(start, length)];
+        // A site can contain the same n-gram more than once
+        if (postings.empty() || postings.back() != index)
+          postings.push_back(index);
+      }
+    }
+  }
+
+  sorted_sites_.resize(sites_.size());
+  for (size_t index = 0; index < sites_.size(); ++index)
+    sorted_sites_[index] = index;
+  std::stable_sort(sorted_sites_.begin(), sorted_sites_.end(),
+                   [this](size_t a, size_t b) {
+                     return sites_[a] < sites_[b];
+                   });
+}
+
+SitesIndex::~SitesIndex() = default;
+
+std::vector<SitesIndex::Match> SitesIndex::FindSubstring(
+    const std::string& text,
+    size_t max_matches) const {
+  std::vector<Match> matches;
+  if (text.empty()) {
+    for (size_t index = 0;
+         index < sites_.size() && matches.size() < max_matches; ++index) {
+      matches.push_back({index, 0});
+    }
+    return matches;
+  }
+
+  const std::vector<size_t>* candidates = GetCandidates(text);
+  if (!candidates)
+    return matches;
+
+  for (const size_t index : *candidates) {
+    if (matches.size() >= max_matches)
+      break;
+
+    const size_t position = sites_[index].find(text);
+    if (position != std::string::npos)
+      matches.push_back({index, position});
+  }
+
+  return matches;
+}
+
+std::vector<SitesIndex::Match> SitesIndex::FindPrefix(
+    const std::string& text) const {
+  auto it = std::lower_bound(sorted_sites_.begin(), sorted_sites_.end(), text,
+                             [this](size_t index, const std::string& prefix) {
+                               return sites_[index] < prefix;
+                             });
+
+  std::vector<Match> matches;
+  for (; it != sorted_sites_.end() &&
+         base::StartsWith(sites_[*it], text, base::CompareCase::SENSITIVE);
+       ++it) {
+    matches.push_back({*it, 0});
+  }
+
+  std::sort(matches.begin(), matches.end(),
+            [](const Match& a, const Match& b) { return a.index < b.index; });
+  return matches;
+}
+
+const std::vector<size_t>* SitesIndex::GetCandidates(
+    const std::string& text) const {
+  // Any site containing |text| contains all of its n-grams, so the shortest
+  // posting list is enough
+  const std::vector<size_t>* candidates = nullptr;
+  const size_t length = std::min(text.length(), kMaxNGramLength);
+  for (size_t start = 0; start + length <= text.length(); ++start) {
+    const auto it = ngrams_.find(text.substr(start, length));
+    if (it == ngrams_.end())
+      return nullptr;
+
+    if (!candidates || it->second.size() < candidates->size())
+      candidates = &it->second;
+  }
+
+  return candidates;
+}
@@ -0,0 +1,51 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITES_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITES_INDEX_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+
+// Lookup index over the static site lists of the omnibox providers, built
+// once so keystrokes don't scan the whole list. Every 1 to 3 byte n-gram of a
+// site points at it, so a substring lookup only verifies the sites sharing the
+// rarest n-gram of the input. Prefix lookups binary search the sorted sites.
+// Results are always returned in list order, like a linear scan would.
+class SitesIndex {
+ public:
+  struct Match {
+    size_t index;
+    // Position of the first occurrence of the input in the site
+    size_t position;
+  };
+
+  explicit SitesIndex(const std::vector<std::string>& sites);
+  ~SitesIndex();
+
+  // Returns up to |max_matches| sites which contain |text|
+  std::vector<Match> FindSubstring(const std::string& text,
+                                   size_t max_matches) const;
+  // Returns the sites which start with |text|
+  std::vector<Match> FindPrefix(const std::string& text) const;
+
+ private:
+  const std::vector<size_t>* GetCandidates(const std::string& text) const;
+
+  std::vector<std::string> sites_;
+  // Indexes of |sites_| containing the n-gram, in ascending order
+  std::unordered_map<std::string, std::vector<size_t>> ngrams_;
+  // Indexes of |sites_| sorted by site
+  std::vector<size_t> sorted_sites_;
+
+  DISALLOW_COPY_AND_ASSIGN(SitesIndex);
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITES_INDEX_H_
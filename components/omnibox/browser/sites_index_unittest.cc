@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/sites_index.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+std::vector<size_t> GetIndexes(const std::vector<SitesIndex::Match>& matches) {
+  std::vector<size_t> indexes;
+  for (const auto& match : matches)
+    indexes.push_back(match.index);
+  return indexes;
+}
+
+}  // namespace
+
+TEST(SitesIndexTest, FindSubstring) {
+  SitesIndex index({"google.com", "youtube.com", "duckduckgo.com", "go.com"});
+
+  auto matches = index.FindSubstring("go", 10);
+  EXPECT_EQ(std::vector<size_t>({0, 2, 3}), GetIndexes(matches));
+  EXPECT_EQ(0u, matches[0].position);
+  EXPECT_EQ(8u, matches[1].position);
+  EXPECT_EQ(0u, matches[2].position);
+
+  EXPECT_EQ(std::vector<size_t>({1}),
+            GetIndexes(index.FindSubstring("tube.c", 10)));
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3}),
+            GetIndexes(index.FindSubstring(".com", 10)));
+  EXPECT_TRUE(index.FindSubstring("bing", 10).empty());
+  // All n-grams are there but not contiguously
+  EXPECT_TRUE(index.FindSubstring("gooube", 10).empty());
+}
+
+TEST(SitesIndexTest, FindSubstringMaxMatches) {
+  SitesIndex index({"a.com", "b.com", "c.com"});
+
+  EXPECT_EQ(std::vector<size_t>({0, 1}),
+            GetIndexes(index.FindSubstring(".com", 2)));
+  EXPECT_EQ(std::vector<size_t>({0, 1}),
+            GetIndexes(index.FindSubstring("", 2)));
+}
+
+TEST(SitesIndexTest, FindPrefix) {
+  SitesIndex index({"bitcoin", "btc", "binance.com", "ethereum", "bit"});
+
+  EXPECT_EQ(std::vector<size_t>({0, 4}),
+            GetIndexes(index.FindPrefix("bit")));
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2, 4}),
+            GetIndexes(index.FindPrefix("b")));
+  EXPECT_TRUE(index.FindPrefix("coin").empty());
+  EXPECT_TRUE(index.FindPrefix("bitcoins").empty());
+}
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
 #include "components/omnibox/browser/autocomplete_input.h"
@@ -47,35 +48,47 @@ void SuggestedSitesProvider::Start(const AutocompleteInput& input,
         match.match_string_.length() != input_text.length()) {
       return;
     }
-    size_t foundPos = match.match_string_.find(input_text);
-    // We'd normally check for npos here but we want only people that
-    // really want these suggestions. Example don't suggest bitcoin and
-    // litecoin for just a coin search.
-    if (foundPos == 0) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text,
-              base::UTF16ToASCII(match.display_));
-      AddMatch(match, styles);
-      if (match.allow_default_ &&
-          match.match_string_.length() == input_text.length()) {
-        // It's guaranteed that matches_ has at least 1 item
-        // here because of the previous AddMatch call.
-        size_t last_index = matches_.size() - 1;
-        matches_[last_index].SetAllowedToBeDefault(input);
-        // As from autocomplete_provider.h:
-        // Search Primary Provider (what you typed) | 1300
-        matches_[last_index].relevance = 1301;
-      }
+    ACMatchClassifications styles =
+        StylesForSingleMatch(input_text,
+            base::UTF16ToASCII(match.display_));
+    AddMatch(match, styles);
+    if (match.allow_default_ &&
+        match.match_string_.length() == input_text.length()) {
+      // It's guaranteed that matches_ has at least 1 item
+      // here because of the previous AddMatch call.
+      size_t last_index = matches_.size() - 1;
+      matches_[last_index].SetAllowedToBeDefault(input);
+      // As from autocomplete_provider.h:
+      // Search Primary Provider (what you typed) | 1300
+      matches_[last_index].relevance = 1301;
     }
   };
 
+  // We'd normally look for the input anywhere in the match string but we
+  // want only people that really want these suggestions. Example don't
+  // suggest bitcoin and litecoin for just a coin search.
+  if (!minimal_changes || input_text != last_input_text_) {
+    last_input_text_ = input_text;
+    last_results_ = GetSuggestedSitesIndex().FindPrefix(input_text);
+  }
+
   const auto& suggested_sites = GetSuggestedSites();
-  std::for_each(suggested_sites.begin(), suggested_sites.end(),
-      check_add_match);
+  for (const auto& result : last_results_)
+    check_add_match(suggested_sites[result.index]);
 }
 
 SuggestedSitesProvider::~SuggestedSitesProvider() {}
 
+const SitesIndex& SuggestedSitesProvider::GetSuggestedSitesIndex() {
+  static base::NoDestructor<SitesIndex> suggested_sites_index([this]() {
+    std::vector<std::string> match_strings;
+    for (const auto& match : GetSuggestedSites())
+      match_strings.push_back(match.match_string_);
+    return match_strings;
+  }());
+  return *suggested_sites_index;
+}
+
 // static
 ACMatchClassifications SuggestedSitesProvider::StylesForSingleMatch(
     const std::string &input_text,
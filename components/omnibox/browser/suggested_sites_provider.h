@@ -12,6 +12,7 @@
 #include "base/compiler_specific.h"
 #include "base/macros.h"
 #include "base/strings/string16.h"
+#include "brave/components/omnibox/browser/sites_index.h"
 #include "brave/components/omnibox/browser/suggested_sites_match.h"
 #include "components/omnibox/browser/autocomplete_match.h"
 #include "components/omnibox/browser/autocomplete_provider.h"
@@ -32,6 +33,8 @@ class SuggestedSitesProvider : public AutocompleteProvider {
   static const int kRelevance;
 
   const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
+  // Index over the |match_string_| of GetSuggestedSites()
+  const SitesIndex& GetSuggestedSitesIndex();
   void AddMatch(const SuggestedSitesMatch& match,
                 const ACMatchClassifications& styles);
 
@@ -40,6 +43,10 @@ class SuggestedSitesProvider : public AutocompleteProvider {
       const std::string &site);
 
   AutocompleteProviderClient* client_;
+  // Lookup results for |last_input_text_|, reused when only minimal changes
+  // were made to the input
+  std::string last_input_text_;
+  std::vector<SitesIndex::Match> last_results_;
   DISALLOW_COPY_AND_ASSIGN(SuggestedSitesProvider);
 };
 
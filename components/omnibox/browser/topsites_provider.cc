@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <string>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
@@ -42,16 +43,17 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
 
-  for (std::vector<std::string>::const_iterator i = top_sites_.begin();
-       (i != top_sites_.end()) && (matches_.size() < provider_max_matches());
-       ++i) {
-    const std::string &current_site = *i;
-    size_t foundPos = current_site.find(input_text);
-    if (std::string::npos != foundPos) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text, current_site, foundPos);
-      AddMatch(base::ASCIIToUTF16(current_site), styles);
-    }
+  if (!minimal_changes || input_text != last_input_text_) {
+    last_input_text_ = input_text;
+    last_results_ = GetTopSitesIndex().FindSubstring(input_text,
+                                                     provider_max_matches());
+  }
+
+  for (const auto& result : last_results_) {
+    const std::string& current_site = top_sites_[result.index];
+    ACMatchClassifications styles =
+        StylesForSingleMatch(input_text, current_site, result.position);
+    AddMatch(base::ASCIIToUTF16(current_site), styles);
   }
 
   for (size_t i = 0; i < matches_.size(); ++i) {
@@ -70,6 +72,12 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
 
 TopSitesProvider::~TopSitesProvider() {}
 
+// static
+const SitesIndex& TopSitesProvider::GetTopSitesIndex() {
+  static base::NoDestructor<SitesIndex> top_sites_index(top_sites_);
+  return *top_sites_index;
+}
+
 // static
 ACMatchClassifications TopSitesProvider::StylesForSingleMatch(
     const std::string &input_text,
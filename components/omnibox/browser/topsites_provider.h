@@ -12,6 +12,7 @@
 #include "base/compiler_specific.h"
 #include "base/macros.h"
 #include "base/strings/string16.h"
+#include "brave/components/omnibox/browser/sites_index.h"
 #include "components/omnibox/browser/autocomplete_match.h"
 #include "components/omnibox/browser/autocomplete_provider.h"
 
@@ -32,6 +33,8 @@ class TopSitesProvider : public AutocompleteProvider {
 
   static std::vector<std::string> top_sites_;
 
+  static const SitesIndex& GetTopSitesIndex();
+
   void AddMatch(const base::string16& match_string,
                 const ACMatchClassifications& styles);
 
@@ -41,6 +44,10 @@ class TopSitesProvider : public AutocompleteProvider {
       const size_t &foundPos);
 
   AutocompleteProviderClient* client_;
+  // Lookup results for |last_input_text_|, reused when only minimal changes
+  // were made to the input
+  std::string last_input_text_;
+  std::vector<SitesIndex::Match> last_results_;
   DISALLOW_COPY_AND_ASSIGN(TopSitesProvider);
 };
 
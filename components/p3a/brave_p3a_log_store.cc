@@ -5,21 +5,62 @@
 
 #include "brave/components/p3a/brave_p3a_log_store.h"
 
+#include <string.h>
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
+#include "base/values.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
-#include "components/prefs/scoped_user_pref_update.h"
 
 namespace brave {
 
 namespace {
+// Only read to migrate the logs persisted before the dedicated file.
 constexpr char kPrefName[] = "p3a.logs";
 constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
 
+// The file is a header followed by one fixed-size record per metric. It is
+// only read by the same installation, so the native byte order is used.
+constexpr uint32_t kFileMagic = 0x4c413350;  // "P3AL"
+constexpr uint32_t kFileVersion = 1;
+constexpr size_t kMaxNameLength = 63;
+
+struct FileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t count;
+  uint32_t reserved;
+};
+
+struct FileRecord {
+  char name[kMaxNameLength + 1];
+  uint64_t value;
+  double sent_timestamp;
+  uint8_t sent;
+  uint8_t reserved[7];
+};
+
+static_assert(sizeof(FileHeader) == 16, "Unexpected P3A file header size");
+static_assert(sizeof(FileRecord) == 88, "Unexpected P3A file record size");
+
+base::Optional<std::string> ReadLogsFile(const base::FilePath& file_path) {
+  std::string data;
+  if (!base::ReadFileToString(file_path, &data)) {
+    return base::nullopt;
+  }
+  return data;
+}
+
 void RecordP3A(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -35,13 +76,23 @@ void RecordP3A(uint64_t answers_count) {
 }  // namespace
 
 BraveP3ALogStore::BraveP3ALogStore(Delegate* delegate,
-                                   PrefService* local_state)
-    : delegate_(delegate), local_state_(local_state) {
+                                   PrefService* local_state,
+                                   const base::FilePath& file_path)
+    : delegate_(delegate),
+      local_state_(local_state),
+      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      writer_(file_path, task_runner_) {
   DCHECK(delegate_);
   DCHECK(local_state);
 }
 
-BraveP3ALogStore::~BraveP3ALogStore() = default;
+BraveP3ALogStore::~BraveP3ALogStore() {
+  if (writer_.HasPendingWrite()) {
+    writer_.DoScheduledWrite();
+  }
+}
 
 void BraveP3ALogStore::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kPrefName);
@@ -56,29 +107,34 @@ void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({histogram_name, kLogValueKey},
-                  base::Value(base::NumberToString(value)));
-  update->SetPath({histogram_name, kLogSentKey}, base::Value(entry.sent));
+  has_pending_values_ = true;
+}
+
+void BraveP3ALogStore::FlushPendingValues() {
+  if (!has_pending_values_) {
+    return;
+  }
+
+  ScheduleWrite();
 }
 
 void BraveP3ALogStore::ResetUploadStamps() {
+  // Sent flags of the persisted logs are not known yet.
+  if (!loaded_) {
+    reset_upload_stamps_on_load_ = true;
+    return;
+  }
+
   // Clear log entries flags.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
   for (auto& pair : log_) {
     if (pair.second.sent) {
       DCHECK(!pair.second.sent_timestamp.is_null());
       DCHECK(!unsent_entries_.contains(pair.first));
 
       pair.second.ResetSentState();
-
-      // Update persistent values.
-      update->SetPath({pair.first, kLogSentKey}, base::Value(pair.second.sent));
-      update->SetPath({pair.first, kLogTimestampKey},
-                      base::Value(pair.second.sent_timestamp.ToDoubleT()));
     }
   }
+  ScheduleWrite();
 
   RecordP3A(log_.size() - unsent_entries_.size());
 
@@ -139,11 +195,7 @@ void BraveP3ALogStore::DiscardStagedLog() {
   log_iter->second.MarkAsSent();
 
   // Update the persistent value.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({log_iter->first, kLogSentKey},
-                  base::Value(log_iter->second.sent));
-  update->SetPath({log_iter->first, kLogTimestampKey},
-                  base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
+  ScheduleWrite();
 
   // Erase the entry from the unsent queue.
   auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
@@ -159,18 +211,130 @@ void BraveP3ALogStore::PersistUnsentLogs() const {
 }
 
 void BraveP3ALogStore::LoadPersistedUnsentLogs() {
-  DCHECK(log_.empty());
-  DCHECK(unsent_entries_.empty());
+  DCHECK(!loaded_);
+
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&ReadLogsFile, writer_.path()),
+      base::BindOnce(&BraveP3ALogStore::OnLoadPersistedLogs,
+                     weak_factory_.GetWeakPtr()));
+}
+
+bool BraveP3ALogStore::SerializeData(std::string* data) {
+  DCHECK(data);
+
+  FileHeader header = {};
+  header.magic = kFileMagic;
+  header.version = kFileVersion;
+
+  std::string records;
+  for (const auto& pair : log_) {
+    if (pair.first.size() > kMaxNameLength) {
+      NOTREACHED() << "P3A metric name is too long: " << pair.first;
+      continue;
+    }
+
+    FileRecord record = {};
+    memcpy(record.name, pair.first.data(), pair.first.size());
+    record.value = pair.second.value;
+    record.sent_timestamp = pair.second.sent_timestamp.ToDoubleT();
+    record.sent = pair.second.sent ? 1 : 0;
+    records.append(reinterpret_cast<const char*>(&record), sizeof(record));
+    header.count++;
+  }
+
+  data->assign(reinterpret_cast<const char*>(&header), sizeof(header));
+  data->append(records);
+  has_pending_values_ = false;
+  return true;
+}
+
+void BraveP3ALogStore::OnLoadPersistedLogs(base::Optional<std::string> data) {
+  LogEntries entries;
+  if (data) {
+    if (!ParseLogs(*data, &entries)) {
+      LOG(ERROR) << "Malformed P3A logs file, dropping it";
+      entries.clear();
+    }
+  } else {
+    LoadLegacyLogs(&entries);
+  }
+
+  // The logs persisted in prefs are not used anymore.
+  local_state_->ClearPref(kPrefName);
+
+  for (const auto& pair : entries) {
+    AddPersistedEntry(pair.first, pair.second);
+  }
+
+  loaded_ = true;
+  if (reset_upload_stamps_on_load_) {
+    reset_upload_stamps_on_load_ = false;
+    ResetUploadStamps();
+  }
 
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  base::DictionaryValue* list = update.Get();
-  for (auto dict_item : list->DictItems()) {
+  if (!data || has_pending_values_) {
+    ScheduleWrite();
+  }
+}
+
+bool BraveP3ALogStore::ParseLogs(const std::string& data,
+                                 LogEntries* entries) const {
+  DCHECK(entries);
+
+  if (data.size() < sizeof(FileHeader)) {
+    return false;
+  }
+
+  FileHeader header;
+  memcpy(&header, data.data(), sizeof(header));
+  if (header.magic != kFileMagic || header.version != kFileVersion ||
+      data.size() != sizeof(header) + header.count * sizeof(FileRecord)) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < header.count; i++) {
+    FileRecord record;
+    memcpy(&record, data.data() + sizeof(header) + i * sizeof(record),
+           sizeof(record));
+
+    // Names are always terminated, the last byte is never written.
+    if (record.name[kMaxNameLength] != '\0') {
+      return false;
+    }
+    const std::string name(record.name);
+
+    // Check if the metric is obsolete.
+    if (!delegate_->IsActualMetric(name)) {
+      continue;
+    }
+
+    LogEntry entry(record.value);
+    entry.sent = record.sent != 0;
+    entry.sent_timestamp = base::Time::FromDoubleT(record.sent_timestamp);
+    if (entry.sent == entry.sent_timestamp.is_null()) {
+      return false;
+    }
+
+    (*entries)[name] = entry;
+  }
+
+  return true;
+}
+
+void BraveP3ALogStore::LoadLegacyLogs(LogEntries* entries) {
+  DCHECK(entries);
+
+  const base::DictionaryValue* list = local_state_->GetDictionary(kPrefName);
+  if (!list) {
+    return;
+  }
+
+  for (const auto dict_item : list->DictItems()) {
     LogEntry entry;
     const std::string name = dict_item.first;
     // Check if the metric is obsolete.
     if (!delegate_->IsActualMetric(name)) {
-      // Drop it from the local state.
-      list->RemoveKey(name);
       continue;
     }
     const base::Value& dict = dict_item.second;
@@ -204,11 +368,38 @@ void BraveP3ALogStore::LoadPersistedUnsentLogs() {
       // Sometimes we do not persist empty timestamps, so it is ok.
     }
 
+    (*entries)[name] = entry;
+  }
+}
+
+void BraveP3ALogStore::AddPersistedEntry(const std::string& name,
+                                         const LogEntry& entry) {
+  auto iter = log_.find(name);
+  if (iter == log_.end()) {
     log_[name] = entry;
     if (!entry.sent) {
       unsent_entries_.insert(name);
     }
+    return;
   }
+
+  // The value was updated before the logs were loaded, only the sent state
+  // is taken from the persisted entry.
+  if (entry.sent && !iter->second.sent) {
+    iter->second.sent = true;
+    iter->second.sent_timestamp = entry.sent_timestamp;
+    unsent_entries_.erase(name);
+  }
+  has_pending_values_ = true;
+}
+
+void BraveP3ALogStore::ScheduleWrite() {
+  has_pending_values_ = true;
+  if (!loaded_) {
+    return;
+  }
+
+  writer_.ScheduleWrite(this);
 }
 
 }  // namespace brave
@@ -6,24 +6,36 @@
 #ifndef BRAVE_COMPONENTS_P3A_BRAVE_P3A_LOG_STORE_H_
 #define BRAVE_COMPONENTS_P3A_BRAVE_P3A_LOG_STORE_H_
 
+#include <memory>
 #include <string>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
+#include "base/files/file_path.h"
+#include "base/files/important_file_writer.h"
+#include "base/memory/weak_ptr.h"
+#include "base/optional.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
 #include "components/metrics/log_store.h"
 
+namespace base {
+class SequencedTaskRunner;
+}  // namespace base
+
 class PrefService;
 class PrefRegistrySimple;
 
 namespace brave {
 
-// Stores all given values in memory and persists in prefs on the fly.
+// Stores all given values in memory and persists them in a dedicated file
+// with a fixed-size record per metric, so that metric updates don't rewrite
+// local state. The file is replaced atomically on a background sequence.
 // All logs (not only unsent are persistent), and all logs could be loaded
 // using |LoadPersistedUnsentLogs()|. We should fix this at some point since
 // for now persisted entries never expire.
-class BraveP3ALogStore : public metrics::LogStore {
+class BraveP3ALogStore : public metrics::LogStore,
+                         public base::ImportantFileWriter::DataSerializer {
  public:
   class Delegate {
    public:
@@ -35,15 +47,22 @@ class BraveP3ALogStore : public metrics::LogStore {
     virtual ~Delegate() {}
   };
 
-  explicit BraveP3ALogStore(Delegate* delegate,
-                            PrefService* local_state);
+  // |local_state| is only read to migrate the logs persisted in prefs.
+  BraveP3ALogStore(Delegate* delegate,
+                   PrefService* local_state,
+                   const base::FilePath& file_path);
 
   // TODO(iefremov): Make parent destructor virtual?
   virtual ~BraveP3ALogStore();
 
   static void RegisterPrefs(PrefRegistrySimple* registry);
 
+  // Only updates the value in memory, |FlushPendingValues| persists it.
   void UpdateValue(const std::string& histogram_name, uint64_t value);
+
+  // Schedules a write of the values updated since the last flush.
+  void FlushPendingValues();
+  bool has_pending_values() const { return has_pending_values_; }
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
@@ -59,9 +78,13 @@ class BraveP3ALogStore : public metrics::LogStore {
   // |PersistUnsentLogs| should not be used, since we persist everything
   // on the fly.
   void PersistUnsentLogs() const override;
-  // Returns early if founds malformed persisted values.
+  // Reads the logs on a background sequence, values updated meanwhile are
+  // kept. Falls back to migrating the logs persisted in prefs.
   void LoadPersistedUnsentLogs() override;
 
+  // base::ImportantFileWriter::DataSerializer:
+  bool SerializeData(std::string* data) override;
+
  private:
   struct LogEntry {
     LogEntry() {}
@@ -80,11 +103,29 @@ class BraveP3ALogStore : public metrics::LogStore {
     base::Time sent_timestamp;  // At the moment only for debugging purposes.
   };
 
+  using LogEntries = base::flat_map<std::string, LogEntry>;
+
+  void OnLoadPersistedLogs(base::Optional<std::string> data);
+  // Returns false if |data| is malformed.
+  bool ParseLogs(const std::string& data, LogEntries* entries) const;
+  // Returns early if founds malformed persisted values.
+  void LoadLegacyLogs(LogEntries* entries);
+  void AddPersistedEntry(const std::string& name, const LogEntry& entry);
+  void ScheduleWrite();
+
   const Delegate* const delegate_ = nullptr;  // Weak.
   PrefService* const local_state_ = nullptr;
 
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  base::ImportantFileWriter writer_;
+  // Nothing is written until the persisted logs are loaded.
+  bool loaded_ = false;
+  // |ResetUploadStamps| was called before the logs were loaded.
+  bool reset_upload_stamps_on_load_ = false;
+  bool has_pending_values_ = false;
+
   // TODO(iefremov): Try to replace with base::StringPiece?
-  base::flat_map<std::string, LogEntry> log_;
+  LogEntries log_;
   base::flat_set<std::string> unsent_entries_;
 
   std::string staged_entry_key_;
@@ -93,6 +134,8 @@ class BraveP3ALogStore : public metrics::LogStore {
   // Not used for now.
   std::string staged_log_hash_;
   std::string staged_log_signature_;
+
+  base::WeakPtrFactory<BraveP3ALogStore> weak_factory_{this};
 };
 
 }  // namespace brave
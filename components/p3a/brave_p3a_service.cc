@@ -10,9 +10,11 @@
 
 #include "base/command_line.h"
 #include "base/i18n/timezone.h"
+#include "base/files/file_path.h"
 #include "base/metrics/histogram_samples.h"
 #include "base/metrics/metrics_hashes.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/path_service.h"
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/post_task.h"
@@ -28,6 +30,7 @@
 #include "brave/components/p3a/brave_p3a_uploader.h"
 #include "brave/components/p3a/pref_names.h"
 #include "brave/vendor/brave_base/random.h"
+#include "chrome/common/chrome_paths.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -44,6 +47,8 @@ constexpr char kDefaultUploadServerUrl[] = "https://p3a.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+constexpr uint64_t kFlushPendingValuesIntervalSeconds = 60;  // 1 minute.
+
 // TODO(iefremov): Provide moar histograms!
 // Whitelist for histograms that we collect. Will be replaced with something
 // updating on the fly.
@@ -143,13 +148,17 @@ void BraveP3AService::Init(
   InitPyxisMeta();
 
   // Init log store.
-  log_store_.reset(new BraveP3ALogStore(this, local_state_));
+  base::FilePath user_data_dir;
+  base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir);
+  log_store_.reset(new BraveP3ALogStore(
+      this, local_state_, user_data_dir.Append(FILE_PATH_LITERAL("P3ALogs"))));
   log_store_->LoadPersistedUnsentLogs();
   // Store values that were recorded between calling constructor and |Init()|.
   for (const auto& entry : histogram_values_) {
     log_store_->UpdateValue(entry.first.as_string(), entry.second);
   }
   histogram_values_ = {};
+  FlushPendingValues();
   // Do rotation if needed.
   const base::Time last_rotation =
       local_state_->GetTime(kLastRotationTimeStampPref);
@@ -198,7 +207,7 @@ std::string BraveP3AService::Serialize(base::StringPiece histogram_name,
   //                                  &message);
 
   brave_pyxis::RawP3AValue message;
-  prochlo::GenerateP3AMessage(histogram_name_hash, value, pyxis_meta_,
+  prochlo::GenerateP3AMessage(histogram_name_hash, value, pyxis_metastring_,
                               &message);
   return message.SerializeAsString();
 }
@@ -265,6 +274,7 @@ void BraveP3AService::InitPyxisMeta() {
       base::ToUpperASCII(base::CountryCodeForCurrentTimezone());
   pyxis_meta_.refcode = local_state_->GetString(kReferralPromoCode);
   MaybeStripRefcodeAndCountry(&pyxis_meta_);
+  pyxis_metastring_ = prochlo::GenerateMessageMetastring(pyxis_meta_);
 
   VLOG(2) << "Pyxis meta: " << pyxis_meta_.platform << " "
           << pyxis_meta_.channel << " " << pyxis_meta_.version << " "
@@ -311,21 +321,52 @@ void BraveP3AService::OnHistogramChanged(base::StringPiece histogram_name,
     return;
   }
 
+  VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
+          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
+
+  // Only the latest bucket matters, so samples recorded before the UI task
+  // runs just overwrite each other.
+  {
+    base::AutoLock lock(pending_buckets_lock_);
+    pending_buckets_[histogram_name] = bucket;
+    if (pending_buckets_task_posted_) {
+      return;
+    }
+    pending_buckets_task_posted_ = true;
+  }
+
   base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+                 base::BindOnce(&BraveP3AService::OnHistogramsChangedOnUI,
+                                this));
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(base::StringPiece histogram_name,
-                                             base::HistogramBase::Sample sample,
-                                             size_t bucket) {
-  VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
-  if (!initialized_) {
-    histogram_values_[histogram_name] = bucket;
-  } else {
-    log_store_->UpdateValue(histogram_name.as_string(), bucket);
+void BraveP3AService::OnHistogramsChangedOnUI() {
+  base::flat_map<base::StringPiece, size_t> buckets;
+  {
+    base::AutoLock lock(pending_buckets_lock_);
+    buckets.swap(pending_buckets_);
+    pending_buckets_task_posted_ = false;
+  }
+
+  for (const auto& entry : buckets) {
+    if (!initialized_) {
+      histogram_values_[entry.first] = entry.second;
+    } else {
+      log_store_->UpdateValue(entry.first.as_string(), entry.second);
+    }
   }
+
+  if (initialized_ && !flush_timer_.IsRunning()) {
+    flush_timer_.Start(
+        FROM_HERE,
+        base::TimeDelta::FromSeconds(kFlushPendingValuesIntervalSeconds),
+        this, &BraveP3AService::FlushPendingValues);
+  }
+}
+
+void BraveP3AService::FlushPendingValues() {
+  flush_timer_.Stop();
+  log_store_->FlushPendingValues();
 }
 
 void BraveP3AService::OnLogUploadComplete(int response_code,
@@ -347,6 +388,7 @@ void BraveP3AService::OnLogUploadComplete(int response_code,
 
 void BraveP3AService::DoRotation() {
   VLOG(2) << "BraveP3AService doing rotation at " << base::Time::Now();
+  FlushPendingValues();
   log_store_->ResetUploadStamps();
   UpdateRotationTimer();
 
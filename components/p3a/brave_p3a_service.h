@@ -12,6 +12,8 @@
 #include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/timer/timer.h"
 #include "brave/components/brave_prochlo/brave_prochlo_message.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
@@ -64,13 +66,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   void StartScheduledUpload();
 
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
+  // can fire on any thread, this method keeps the latest bucket of each
+  // histogram and posts a single task to UI thread for all of them.
   void OnHistogramChanged(base::StringPiece histogram_name,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(base::StringPiece histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  void OnHistogramsChangedOnUI();
+
+  // Persists the values updated since the last flush.
+  void FlushPendingValues();
 
   void OnLogUploadComplete(int response_code, int error_code, bool was_https);
 
@@ -91,6 +95,8 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   GURL upload_server_url_;
 
   prochlo::MessageMetainfo pyxis_meta_;
+  // |pyxis_meta_| formatted for messages.
+  std::string pyxis_metastring_;
 
   // Components:
   std::unique_ptr<BraveP3ALogStore> log_store_;
@@ -101,6 +107,16 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Latest buckets recorded on any thread and not yet handled on UI thread.
+  base::Lock pending_buckets_lock_;
+  base::flat_map<base::StringPiece, size_t> pending_buckets_
+      GUARDED_BY(pending_buckets_lock_);
+  bool pending_buckets_task_posted_ GUARDED_BY(pending_buckets_lock_) = false;
+
+  // Values are written to local state at most once per interval instead of
+  // on every sample.
+  base::OneShotTimer flush_timer_;
+
   // Once fired we restart the overall uploading process.
   base::OneShotTimer rotation_timer_;
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <utility>
 
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
 #include "base/containers/flat_map.h"
@@ -333,7 +334,7 @@ void BatAdsClientMojoBridge::SaveBundleState(
     return;
   }
 
-  bat_ads_client_->SaveBundleState(bundle_state->ToJson(),
+  bat_ads_client_->SaveBundleState(ToMojomBundleState(*bundle_state),
       base::BindOnce(&OnSaveBundleState, std::move(callback)));
 }
 
@@ -341,20 +342,9 @@ void OnGetCreativeAdNotifications(
     const ads::GetCreativeAdNotificationsCallback& callback,
     const int32_t result,
     const std::vector<std::string>& categories,
-    const std::vector<std::string>& json_list) {
-  ads::CreativeAdNotificationList ads;
-
-  for (const auto& json : json_list) {
-    ads::CreativeAdNotificationInfo ad;
-    if (ad.FromJson(json) != ads::Result::SUCCESS) {
-      callback(ads::Result::FAILED, categories, {});
-      return;
-    }
-
-    ads.push_back(ad);
-  }
-
-  callback(ToAdsResult(result), categories, ads);
+    std::vector<mojom::CreativeAdNotificationPtr> ads) {
+  callback(ToAdsResult(result), categories,
+      ToAdsCreativeAdNotifications(std::move(ads)));
 }
 
 void BatAdsClientMojoBridge::GetCreativeAdNotifications(
@@ -372,20 +362,9 @@ void BatAdsClientMojoBridge::GetCreativeAdNotifications(
 void OnGetAdConversions(
     const ads::GetAdConversionsCallback& callback,
     const int32_t result,
-    const std::vector<std::string>& json_list) {
-  ads::AdConversionList ad_conversions;
-
-  for (const auto& json : json_list) {
-    ads::AdConversionInfo ad_conversion;
-    if (ad_conversion.FromJson(json) != ads::Result::SUCCESS) {
-      callback(ads::Result::FAILED, {});
-      return;
-    }
-
-    ad_conversions.push_back(ad_conversion);
-  }
-
-  callback(ToAdsResult(result), ad_conversions);
+    std::vector<mojom::AdConversionPtr> ad_conversions) {
+  callback(ToAdsResult(result),
+      ToAdsAdConversions(std::move(ad_conversions)));
 }
 
 void BatAdsClientMojoBridge::GetAdConversions(
@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -95,6 +96,11 @@ void BatAdsImpl::OnBackground() {
   ads_->OnBackground();
 }
 
+void BatAdsImpl::OnMemoryPressure(
+    const ads::MemoryPressureLevel level) {
+  ads_->OnMemoryPressure(level);
+}
+
 void BatAdsImpl::OnMediaPlaying(
     const int32_t tab_id) {
   ads_->OnMediaPlaying(tab_id);
@@ -149,7 +155,7 @@ void BatAdsImpl::GetAdsHistory(
   ads::AdsHistory history = ads_->GetAdsHistory(
       ads::AdsHistory::FilterType::kConfirmationType,
           ads::AdsHistory::SortType::kDescendingOrder, from_timestamp,
-              to_timestamp);
+              to_timestamp, 0, std::numeric_limits<uint64_t>::max());
 
   std::move(callback).Run(history.ToJson());
 }
@@ -57,6 +57,9 @@ class BatAdsImpl :
   void OnForeground() override;
   void OnBackground() override;
 
+  void OnMemoryPressure(
+      const ads::MemoryPressureLevel level) override;
+
   void OnMediaPlaying(
       const int32_t tab_id) override;
   void OnMediaStopped(
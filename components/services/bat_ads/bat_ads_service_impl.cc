@@ -47,4 +47,11 @@ void BatAdsServiceImpl::SetDebug(
   std::move(callback).Run();
 }
 
+void BatAdsServiceImpl::SetLogCategories(
+    const std::string& categories,
+    SetLogCategoriesCallback callback) {
+  ads::SetLogCategories(categories);
+  std::move(callback).Run();
+}
+
 }  // namespace bat_ads
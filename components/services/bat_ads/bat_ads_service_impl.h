@@ -43,6 +43,10 @@ class BatAdsServiceImpl : public mojom::BatAdsService {
       const bool is_debug,
       SetDebugCallback callback) override;
 
+  void SetLogCategories(
+      const std::string& categories,
+      SetLogCategoriesCallback callback) override;
+
  private:
   const std::unique_ptr<service_manager::ServiceContextRef> service_ref_;
   bool is_initialized_;
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "bat/ads/ads.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
 #include "base/bind.h"
 #include "base/callback.h"
 #include "base/containers/flat_map.h"
@@ -394,23 +395,13 @@ void AdsClientMojoBridge::OnSaveBundleState(
 }
 
 void AdsClientMojoBridge::SaveBundleState(
-    const std::string& bundle_state_json,
+    mojom::BundleStatePtr bundle_state,
     SaveBundleStateCallback callback) {
   // this gets deleted in OnSaveBundleState
   auto* holder = new CallbackHolder<SaveBundleStateCallback>(
       AsWeakPtr(), std::move(callback));
 
-  auto bundle_state = std::make_unique<ads::BundleState>();
-
-  auto schema = ads_client_->LoadJsonSchema(ads::_bundle_schema_resource_name);
-
-  if (bundle_state->FromJson(bundle_state_json, schema) !=
-      ads::Result::SUCCESS) {
-    std::move(holder->get()).Run(ToMojomResult(ads::Result::FAILED));
-    return;
-  }
-
-  ads_client_->SaveBundleState(std::move(bundle_state),
+  ads_client_->SaveBundleState(ToAdsBundleState(std::move(bundle_state)),
       std::bind(AdsClientMojoBridge::OnSaveBundleState, holder, _1));
 }
 
@@ -423,13 +414,8 @@ void AdsClientMojoBridge::OnGetCreativeAdNotifications(
   DCHECK(holder);
 
   if (holder->is_valid()) {
-    std::vector<std::string> json_list;
-
-    for (const auto& ad : ads) {
-      json_list.push_back(ad.ToJson());
-    }
-
-    std::move(holder->get()).Run(ToMojomResult(result), categories, json_list);
+    std::move(holder->get()).Run(ToMojomResult(result), categories,
+        ToMojomCreativeAdNotifications(ads));
   }
 
   delete holder;
@@ -455,13 +441,8 @@ void AdsClientMojoBridge::OnGetAdConversions(
   DCHECK(holder);
 
   if (holder->is_valid()) {
-    std::vector<std::string> json_list;
-
-    for (const auto& ad_conversion : ad_conversions) {
-      json_list.push_back(ad_conversion.ToJson());
-    }
-
-    std::move(holder->get()).Run(ToMojomResult(result), json_list);
+    std::move(holder->get()).Run(ToMojomResult(result),
+        ToMojomAdConversions(ad_conversions));
   }
 
   delete holder;
@@ -120,7 +120,7 @@ class AdsClientMojoBridge
       const std::string& creative_set_id,
       const std::string& confirmation_type) override;
   void SaveBundleState(
-      const std::string& bundle_state,
+      mojom::BundleStatePtr bundle_state,
       SaveBundleStateCallback callback) override;
   void GetCreativeAdNotifications(
       const std::vector<std::string>& categories,
@@ -0,0 +1,170 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
+
+#include <string>
+#include <utility>
+
+#include "base/logging.h"
+
+namespace bat_ads {
+
+namespace {
+
+mojom::CreativeAdNotificationPtr ToMojomCreativeAdNotification(
+    const ads::CreativeAdNotificationInfo& info) {
+  auto ad = mojom::CreativeAdNotification::New();
+  ad->creative_instance_id = info.creative_instance_id;
+  ad->creative_set_id = info.creative_set_id;
+  ad->campaign_id = info.campaign_id;
+  ad->start_at_timestamp = info.start_at_timestamp;
+  ad->end_at_timestamp = info.end_at_timestamp;
+  ad->daily_cap = info.daily_cap;
+  ad->advertiser_id = info.advertiser_id;
+  ad->per_day = info.per_day;
+  ad->total_max = info.total_max;
+  ad->category = info.category;
+  ad->geo_targets = info.geo_targets;
+  ad->target_url = info.target_url;
+  ad->title = info.title;
+  ad->body = info.body;
+  return ad;
+}
+
+ads::CreativeAdNotificationInfo ToAdsCreativeAdNotification(
+    mojom::CreativeAdNotificationPtr ad) {
+  DCHECK(ad);
+
+  ads::CreativeAdNotificationInfo info;
+  info.creative_instance_id = std::move(ad->creative_instance_id);
+  info.creative_set_id = std::move(ad->creative_set_id);
+  info.campaign_id = std::move(ad->campaign_id);
+  info.start_at_timestamp = std::move(ad->start_at_timestamp);
+  info.end_at_timestamp = std::move(ad->end_at_timestamp);
+  info.daily_cap = ad->daily_cap;
+  info.advertiser_id = std::move(ad->advertiser_id);
+  info.per_day = ad->per_day;
+  info.total_max = ad->total_max;
+  info.category = std::move(ad->category);
+  info.geo_targets = std::move(ad->geo_targets);
+  info.target_url = std::move(ad->target_url);
+  info.title = std::move(ad->title);
+  info.body = std::move(ad->body);
+  return info;
+}
+
+}  // namespace
+
+std::vector<mojom::CreativeAdNotificationPtr> ToMojomCreativeAdNotifications(
+    const ads::CreativeAdNotificationList& ads) {
+  std::vector<mojom::CreativeAdNotificationPtr> mojom_ads;
+  mojom_ads.reserve(ads.size());
+
+  for (const auto& ad : ads) {
+    mojom_ads.push_back(ToMojomCreativeAdNotification(ad));
+  }
+
+  return mojom_ads;
+}
+
+ads::CreativeAdNotificationList ToAdsCreativeAdNotifications(
+    std::vector<mojom::CreativeAdNotificationPtr> ads) {
+  ads::CreativeAdNotificationList ads_list;
+  ads_list.reserve(ads.size());
+
+  for (auto& ad : ads) {
+    ads_list.push_back(ToAdsCreativeAdNotification(std::move(ad)));
+  }
+
+  return ads_list;
+}
+
+std::vector<mojom::AdConversionPtr> ToMojomAdConversions(
+    const ads::AdConversionList& ad_conversions) {
+  std::vector<mojom::AdConversionPtr> mojom_ad_conversions;
+  mojom_ad_conversions.reserve(ad_conversions.size());
+
+  for (const auto& info : ad_conversions) {
+    auto ad_conversion = mojom::AdConversion::New();
+    ad_conversion->creative_set_id = info.creative_set_id;
+    ad_conversion->type = info.type;
+    ad_conversion->url_pattern = info.url_pattern;
+    ad_conversion->observation_window = info.observation_window;
+
+    mojom_ad_conversions.push_back(std::move(ad_conversion));
+  }
+
+  return mojom_ad_conversions;
+}
+
+ads::AdConversionList ToAdsAdConversions(
+    std::vector<mojom::AdConversionPtr> ad_conversions) {
+  ads::AdConversionList ad_conversions_list;
+  ad_conversions_list.reserve(ad_conversions.size());
+
+  for (auto& ad_conversion : ad_conversions) {
+    DCHECK(ad_conversion);
+
+    ads::AdConversionInfo info;
+    info.creative_set_id = std::move(ad_conversion->creative_set_id);
+    info.type = std::move(ad_conversion->type);
+    info.url_pattern = std::move(ad_conversion->url_pattern);
+    info.observation_window = ad_conversion->observation_window;
+
+    ad_conversions_list.push_back(std::move(info));
+  }
+
+  return ad_conversions_list;
+}
+
+mojom::BundleStatePtr ToMojomBundleState(
+    const ads::BundleState& bundle_state) {
+  auto mojom_bundle_state = mojom::BundleState::New();
+  mojom_bundle_state->catalog_id = bundle_state.catalog_id;
+  mojom_bundle_state->catalog_version = bundle_state.catalog_version;
+  mojom_bundle_state->catalog_ping = bundle_state.catalog_ping;
+  mojom_bundle_state->catalog_last_updated_timestamp_in_seconds =
+      bundle_state.catalog_last_updated_timestamp_in_seconds;
+
+  for (const auto& creative_ad_notifications :
+      bundle_state.creative_ad_notifications) {
+    mojom_bundle_state->creative_ad_notifications.emplace(
+        creative_ad_notifications.first,
+        ToMojomCreativeAdNotifications(creative_ad_notifications.second));
+  }
+
+  mojom_bundle_state->ad_conversions =
+      ToMojomAdConversions(bundle_state.ad_conversions);
+
+  return mojom_bundle_state;
+}
+
+std::unique_ptr<ads::BundleState> ToAdsBundleState(
+    mojom::BundleStatePtr bundle_state) {
+  DCHECK(bundle_state);
+
+  auto ads_bundle_state = std::make_unique<ads::BundleState>();
+  ads_bundle_state->catalog_id = std::move(bundle_state->catalog_id);
+  ads_bundle_state->catalog_version = bundle_state->catalog_version;
+  ads_bundle_state->catalog_ping = bundle_state->catalog_ping;
+  ads_bundle_state->catalog_last_updated_timestamp_in_seconds =
+      bundle_state->catalog_last_updated_timestamp_in_seconds;
+
+  for (auto& creative_ad_notifications :
+      bundle_state->creative_ad_notifications) {
+    ads_bundle_state->creative_ad_notifications.emplace(
+        creative_ad_notifications.first,
+        ToAdsCreativeAdNotifications(
+            std::move(creative_ad_notifications.second)));
+  }
+
+  ads_bundle_state->ad_conversions =
+      ToAdsAdConversions(std::move(bundle_state->ad_conversions));
+
+  return ads_bundle_state;
+}
+
+}  // namespace bat_ads
@@ -0,0 +1,40 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
+#define BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
+
+#include <memory>
+#include <vector>
+
+#include "bat/ads/ad_conversion_info.h"
+#include "bat/ads/bundle_state.h"
+#include "bat/ads/creative_ad_notification_info.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+
+namespace bat_ads {
+
+// Conversions between the ads library types and the structs used to pass
+// them between the browser and the bat_ads service. The ToAds functions take
+// ownership so that strings are moved instead of copied.
+
+std::vector<mojom::CreativeAdNotificationPtr> ToMojomCreativeAdNotifications(
+    const ads::CreativeAdNotificationList& ads);
+ads::CreativeAdNotificationList ToAdsCreativeAdNotifications(
+    std::vector<mojom::CreativeAdNotificationPtr> ads);
+
+std::vector<mojom::AdConversionPtr> ToMojomAdConversions(
+    const ads::AdConversionList& ad_conversions);
+ads::AdConversionList ToAdsAdConversions(
+    std::vector<mojom::AdConversionPtr> ad_conversions);
+
+mojom::BundleStatePtr ToMojomBundleState(
+    const ads::BundleState& bundle_state);
+std::unique_ptr<ads::BundleState> ToAdsBundleState(
+    mojom::BundleStatePtr bundle_state);
+
+}  // namespace bat_ads
+
+#endif  // BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
@@ -128,24 +128,26 @@ void BatLedgerImpl::OnLoad(ledger::VisitDataPtr visit_data,
   ledger_->OnLoad(std::move(visit_data), current_time);
 }
 
-void BatLedgerImpl::OnUnload(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnUnload(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnShow(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnShow(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnHide(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnHide(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnForeground(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnForeground(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnBackground(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnBackground(tab_id, current_time);
+void BatLedgerImpl::OnTabEvents(std::vector<mojom::TabEventPtr> events) {
+  for (const auto& event : events) {
+    switch (event->type) {
+      case mojom::TabEventType::UNLOAD:
+        ledger_->OnUnload(event->tab_id, event->current_time);
+        break;
+      case mojom::TabEventType::SHOW:
+        ledger_->OnShow(event->tab_id, event->current_time);
+        break;
+      case mojom::TabEventType::HIDE:
+        ledger_->OnHide(event->tab_id, event->current_time);
+        break;
+      case mojom::TabEventType::FOREGROUND:
+        ledger_->OnForeground(event->tab_id, event->current_time);
+        break;
+      case mojom::TabEventType::BACKGROUND:
+        ledger_->OnBackground(event->tab_id, event->current_time);
+        break;
+    }
+  }
 }
 
 void BatLedgerImpl::OnPostData(const std::string& url,
@@ -340,6 +342,10 @@ void BatLedgerImpl::OnTimer(uint32_t timer_id) {
   ledger_->OnTimer(timer_id);
 }
 
+void BatLedgerImpl::OnMemoryPressure(ledger::MemoryPressureLevel level) {
+  ledger_->OnMemoryPressure(level);
+}
+
 // static
 void BatLedgerImpl::OnGetBalanceReport(
     CallbackHolder<GetBalanceReportCallback>* holder,
@@ -1033,6 +1039,32 @@ void BatLedgerImpl::GetMonthlyReport(
           _2));
 }
 
+// static
+void BatLedgerImpl::OnGetMonthlyReports(
+    CallbackHolder<GetMonthlyReportsCallback>* holder,
+    const ledger::Result result,
+    ledger::MonthlyReportInfoList reports) {
+  DCHECK(holder);
+  if (holder->is_valid())
+    std::move(holder->get()).Run(result, std::move(reports));
+
+  delete holder;
+}
+
+void BatLedgerImpl::GetMonthlyReports(
+    const std::vector<std::string>& report_ids,
+    GetMonthlyReportsCallback callback) {
+  auto* holder = new CallbackHolder<GetMonthlyReportsCallback>(
+      AsWeakPtr(), std::move(callback));
+
+  ledger_->GetMonthlyReports(
+      report_ids,
+      std::bind(BatLedgerImpl::OnGetMonthlyReports,
+          holder,
+          _1,
+          _2));
+}
+
 // static
 void BatLedgerImpl::OnGetAllMonthlyReportIds(
     CallbackHolder<GetAllMonthlyReportIdsCallback>* holder,
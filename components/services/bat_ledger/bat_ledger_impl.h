@@ -49,11 +49,7 @@ class BatLedgerImpl : public mojom::BatLedger,
   void GetReconcileStamp(GetReconcileStampCallback callback) override;
 
   void OnLoad(ledger::VisitDataPtr visit_data, uint64_t current_time) override;
-  void OnUnload(uint32_t tab_id, uint64_t current_time) override;
-  void OnShow(uint32_t tab_id, uint64_t current_time) override;
-  void OnHide(uint32_t tab_id, uint64_t current_time) override;
-  void OnForeground(uint32_t tab_id, uint64_t current_time) override;
-  void OnBackground(uint32_t tab_id, uint64_t current_time) override;
+  void OnTabEvents(std::vector<mojom::TabEventPtr> events) override;
 
   void OnPostData(const std::string& url,
       const std::string& first_party_url, const std::string& referrer,
@@ -94,6 +90,7 @@ class BatLedgerImpl : public mojom::BatLedger,
   void UpdateAdsRewards() override;
 
   void OnTimer(uint32_t timer_id) override;
+  void OnMemoryPressure(ledger::MemoryPressureLevel level) override;
 
   void GetBalanceReport(ledger::ActivityMonth month, int32_t year,
       GetBalanceReportCallback callback) override;
@@ -215,6 +212,10 @@ class BatLedgerImpl : public mojom::BatLedger,
       const int year,
       GetMonthlyReportCallback callback) override;
 
+  void GetMonthlyReports(
+      const std::vector<std::string>& report_ids,
+      GetMonthlyReportsCallback callback) override;
+
   void GetAllMonthlyReportIds(
       GetAllMonthlyReportIdsCallback callback) override;
 
@@ -407,6 +408,11 @@ class BatLedgerImpl : public mojom::BatLedger,
       const ledger::Result result,
       ledger::MonthlyReportInfoPtr info);
 
+  static void OnGetMonthlyReports(
+      CallbackHolder<GetMonthlyReportsCallback>* holder,
+      const ledger::Result result,
+      ledger::MonthlyReportInfoList reports);
+
   static void OnGetAllMonthlyReportIds(
       CallbackHolder<GetAllMonthlyReportIdsCallback>* holder,
       const std::vector<std::string>& ids);
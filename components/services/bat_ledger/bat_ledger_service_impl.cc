@@ -31,7 +31,13 @@ BatLedgerServiceImpl::~BatLedgerServiceImpl() {
 
 void BatLedgerServiceImpl::Create(
     mojom::BatLedgerClientAssociatedPtrInfo client_info,
-    mojom::BatLedgerAssociatedRequest bat_ledger) {
+    mojom::BatLedgerAssociatedRequest bat_ledger,
+    mojom::BatLedgerOptionsPtr options) {
+  SetEnvironment(options->environment);
+  SetDebug(options->is_debug);
+  SetReconcileTime(options->reconcile_time);
+  SetShortRetries(options->short_retries);
+
   mojo::MakeStrongAssociatedBinding(
       std::make_unique<BatLedgerImpl>(std::move(client_info)),
                                       std::move(bat_ledger));
@@ -22,7 +22,8 @@ class BatLedgerServiceImpl : public mojom::BatLedgerService {
 
   // bat_ledger::mojom::BatLedgerService
   void Create(mojom::BatLedgerClientAssociatedPtrInfo client_info,
-              mojom::BatLedgerAssociatedRequest bat_ledger) override;
+              mojom::BatLedgerAssociatedRequest bat_ledger,
+              mojom::BatLedgerOptionsPtr options) override;
 
   void SetEnvironment(ledger::Environment environment) override;
   void SetDebug(bool isDebug) override;
@@ -14,6 +14,7 @@
 #include <sys/wait.h>
 #endif
 
+#include <string>
 #include <utility>
 
 #include "base/command_line.h"
@@ -21,6 +22,8 @@
 #include "base/process/kill.h"
 #include "base/process/launch.h"
 #include "base/single_thread_task_runner.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/task/post_task.h"
 #include "base/threading/thread.h"
 #include "base/threading/thread_task_runner_handle.h"
@@ -75,6 +78,40 @@ static void TearDownPipeHack() {
 
 namespace tor {
 
+namespace {
+
+constexpr char kBootstrappedPrefix[] = "Bootstrapped ";
+constexpr size_t kMaxTorLogSize = 1024 * 1024;
+constexpr base::TimeDelta kBootstrapProgressInterval =
+    base::TimeDelta::FromMilliseconds(500);
+
+// Returns the latest bootstrap percentage from lines like
+// "[notice] Bootstrapped 45% (requesting_descriptors): Asking for relay
+// descriptors", 0 if tor hasn't reported any progress yet
+int ReadBootstrapProgress(const base::FilePath& log_path) {
+  std::string log;
+  // A partial read is fine, bootstrap lines come first in a fresh log
+  base::ReadFileToStringWithMaxSize(log_path, &log, kMaxTorLogSize);
+
+  const size_t pos = log.rfind(kBootstrappedPrefix);
+  if (pos == std::string::npos)
+    return 0;
+
+  const size_t begin = pos + sizeof(kBootstrappedPrefix) - 1;
+  const size_t end = log.find('%', begin);
+  if (end == std::string::npos)
+    return 0;
+
+  int progress = 0;
+  if (!base::StringToInt(base::StringPiece(log).substr(begin, end - begin),
+                         &progress)) {
+    return 0;
+  }
+  return progress;
+}
+
+}  // namespace
+
 TorLauncherImpl::TorLauncherImpl(
     std::unique_ptr<service_manager::ServiceContextRef> service_ref)
     : service_ref_(std::move(service_ref)) {
@@ -152,6 +189,9 @@ void TorLauncherImpl::Launch(const TorConfig& config,
   // TODO(darkdh): return success when tor connected to tor network
   bool result = tor_process_.IsValid();
 
+  if (result && !tor_data_path.empty())
+    StartBootstrapProgressWatch(tor_data_path.AppendASCII("tor.log"));
+
   if (callback)
     std::move(callback).Run(result, tor_process_.Pid());
 
@@ -171,8 +211,17 @@ void TorLauncherImpl::SetCrashHandler(SetCrashHandlerCallback callback) {
   crash_handler_callback_ = std::move(callback);
 }
 
+void TorLauncherImpl::SetObserver(
+    mojo::PendingRemote<tor::mojom::TorLauncherObserver> observer) {
+  observer_.reset();
+  observer_.Bind(std::move(observer));
+  if (bootstrap_progress_ > 0)
+    observer_->OnBootstrapProgress(bootstrap_progress_);
+}
+
 void TorLauncherImpl::ReLaunch(const TorConfig& config,
                                ReLaunchCallback callback) {
+  bootstrap_progress_timer_.Stop();
   if (tor_process_.IsValid())
     tor_process_.Terminate(0, true);
 
@@ -220,6 +269,53 @@ void TorLauncherImpl::MonitorChild() {
 #endif
 }
 
+void TorLauncherImpl::StartBootstrapProgressWatch(
+    const base::FilePath& log_path) {
+  // Drop pending reads of the previous log
+  weak_ptr_factory_.InvalidateWeakPtrs();
+  reading_bootstrap_progress_ = false;
+  tor_log_path_ = log_path;
+  bootstrap_progress_ = 0;
+  bootstrap_progress_timer_.Start(
+      FROM_HERE, kBootstrapProgressInterval,
+      base::BindRepeating(&TorLauncherImpl::CheckBootstrapProgress,
+                          base::Unretained(this)));
+}
+
+void TorLauncherImpl::CheckBootstrapProgress() {
+  if (!tor_process_.IsValid()) {
+    bootstrap_progress_timer_.Stop();
+    return;
+  }
+
+  if (reading_bootstrap_progress_)
+    return;
+
+  reading_bootstrap_progress_ = true;
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(),
+       base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadBootstrapProgress, tor_log_path_),
+      base::BindOnce(&TorLauncherImpl::OnBootstrapProgressRead,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void TorLauncherImpl::OnBootstrapProgressRead(int progress) {
+  reading_bootstrap_progress_ = false;
+  if (!bootstrap_progress_timer_.IsRunning() ||
+      progress <= bootstrap_progress_) {
+    return;
+  }
+
+  bootstrap_progress_ = progress;
+  if (observer_)
+    observer_->OnBootstrapProgress(progress);
+
+  if (progress >= 100)
+    bootstrap_progress_timer_.Stop();
+}
+
 void TorLauncherImpl::SetDisconnected() {
   connected_ = false;
 }
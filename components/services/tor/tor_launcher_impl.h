@@ -10,10 +10,15 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/macros.h"
+#include "base/memory/weak_ptr.h"
 #include "base/process/process.h"
+#include "base/timer/timer.h"
 #include "brave/components/services/tor/public/interfaces/tor.mojom.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/remote.h"
 #include "services/service_manager/public/cpp/service_context_ref.h"
 
 namespace tor {
@@ -30,15 +35,29 @@ class TorLauncherImpl : public tor::mojom::TorLauncher {
   void SetCrashHandler(SetCrashHandlerCallback callback) override;
   void ReLaunch(const TorConfig& config,
               ReLaunchCallback callback) override;
+  void SetObserver(
+      mojo::PendingRemote<tor::mojom::TorLauncherObserver> observer) override;
   void SetDisconnected();
  private:
   void MonitorChild();
 
+  // Tor reports its bootstrap progress in the notice log, which is truncated
+  // on every launch, so it is polled until tor is connected
+  void StartBootstrapProgressWatch(const base::FilePath& log_path);
+  void CheckBootstrapProgress();
+  void OnBootstrapProgressRead(int progress);
+
   SetCrashHandlerCallback crash_handler_callback_;
+  mojo::Remote<tor::mojom::TorLauncherObserver> observer_;
+  base::RepeatingTimer bootstrap_progress_timer_;
+  base::FilePath tor_log_path_;
+  int bootstrap_progress_ = 0;
+  bool reading_bootstrap_progress_ = false;
   std::unique_ptr<base::Thread> child_monitor_thread_;
   base::Process tor_process_;
   const std::unique_ptr<service_manager::ServiceContextRef> service_ref_;
   bool connected_ = true;
+  base::WeakPtrFactory<TorLauncherImpl> weak_ptr_factory_{this};
 
   DISALLOW_COPY_AND_ASSIGN(TorLauncherImpl);
 };
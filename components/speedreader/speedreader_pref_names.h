@@ -9,6 +9,9 @@
 namespace speedreader {
 
 constexpr char kSpeedreaderPrefEnabled[] = "brave.speedreader.enabled";
+// Maps page path templates to whether Speedreader could distill them.
+constexpr char kSpeedreaderPrefReadabilityCache[] =
+    "brave.speedreader.readability_cache";
 
 }  // namespace speedreader
 
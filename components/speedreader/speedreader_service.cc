@@ -5,14 +5,29 @@
 
 #include "brave/components/speedreader/speedreader_service.h"
 
+#include <vector>
+
 #include "base/feature_list.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/values.h"
 #include "brave/components/speedreader/features.h"
 #include "brave/components/speedreader/speedreader_pref_names.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
+#include "url/gurl.h"
 
 namespace speedreader {
 
+namespace {
+
+// Number of path templates whose readability is remembered.
+constexpr size_t kMaxReadabilityCacheSize = 1000;
+
+}  // namespace
+
 SpeedreaderService::SpeedreaderService(PrefService* prefs) : prefs_(prefs) {}
 
 SpeedreaderService::~SpeedreaderService() {}
@@ -20,6 +35,7 @@ SpeedreaderService::~SpeedreaderService() {}
 // static
 void SpeedreaderService::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterBooleanPref(kSpeedreaderPrefEnabled, false);
+  registry->RegisterDictionaryPref(kSpeedreaderPrefReadabilityCache);
 }
 
 void SpeedreaderService::ToggleSpeedreader() {
@@ -35,4 +51,42 @@ bool SpeedreaderService::IsEnabled() {
   return prefs_->GetBoolean(kSpeedreaderPrefEnabled);
 }
 
+bool SpeedreaderService::IsKnownUnreadable(const GURL& url) {
+  const base::Value* readable =
+      prefs_->GetDictionary(kSpeedreaderPrefReadabilityCache)
+          ->FindKeyOfType(GetPathTemplate(url), base::Value::Type::BOOLEAN);
+  return readable && !readable->GetBool();
+}
+
+void SpeedreaderService::SetReadability(const GURL& url, bool readable) {
+  DictionaryPrefUpdate update(prefs_, kSpeedreaderPrefReadabilityCache);
+  base::Value* cache = update.Get();
+  const std::string path_template = GetPathTemplate(url);
+  if (!cache->FindKey(path_template) &&
+      cache->DictSize() >= kMaxReadabilityCacheSize) {
+    // The cache is only an optimization, start over rather than track age.
+    cache->DictClear();
+  }
+  cache->SetBoolKey(path_template, readable);
+}
+
+// static
+std::string SpeedreaderService::GetPathTemplate(const GURL& url) {
+  std::vector<base::StringPiece> segments = base::SplitStringPiece(
+      url.path_piece(), "/", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const bool is_last = i + 1 == segments.size();
+    if ((is_last && !segments[i].empty()) ||
+        segments[i].find_first_of("0123456789") != base::StringPiece::npos) {
+      segments[i] = "*";
+    }
+  }
+  std::string path = base::JoinString(segments, "/");
+  if (!path.empty() && path[0] == '/') {
+    // The origin already ends with a slash.
+    path.erase(0, 1);
+  }
+  return url.GetOrigin().spec() + path;
+}
+
 }  // namespace speedreader
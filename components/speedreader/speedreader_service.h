@@ -7,9 +7,11 @@
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_SERVICE_H_
 
 #include <memory>
+#include <string>
 
 #include "components/keyed_service/core/keyed_service.h"
 
+class GURL;
 class PrefRegistrySimple;
 class PrefService;
 
@@ -25,6 +27,17 @@ class SpeedreaderService : public KeyedService {
   void ToggleSpeedreader();
   bool IsEnabled();
 
+  // Whether distilling a page like |url| has already failed, in which case
+  // there is no point in holding the page back for another attempt.
+  bool IsKnownUnreadable(const GURL& url);
+  // Remembers whether pages like |url| could be distilled.
+  void SetReadability(const GURL& url, bool readable);
+
+  // Returns the key under which the readability of |url| is remembered: its
+  // origin and path, with the last path segment and segments that contain
+  // digits (ids, dates and such) replaced by "*".
+  static std::string GetPathTemplate(const GURL& url);
+
   SpeedreaderService(const SpeedreaderService&) = delete;
   SpeedreaderService& operator=(const SpeedreaderService&) = delete;
 
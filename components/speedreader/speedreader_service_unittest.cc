@@ -0,0 +1,49 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/speedreader/speedreader_service.h"
+
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace speedreader {
+
+TEST(SpeedreaderServiceTest, GetPathTemplate) {
+  EXPECT_EQ("https://brave.com/",
+            SpeedreaderService::GetPathTemplate(GURL("https://brave.com")));
+  EXPECT_EQ("https://brave.com/news/", SpeedreaderService::GetPathTemplate(
+                                           GURL("https://brave.com/news/")));
+  EXPECT_EQ("https://brave.com/news/*",
+            SpeedreaderService::GetPathTemplate(
+                GURL("https://brave.com/news/some-article?page=2")));
+  EXPECT_EQ("https://brave.com/*/*/news/*",
+            SpeedreaderService::GetPathTemplate(
+                GURL("https://brave.com/2020/06/news/some-article")));
+  EXPECT_EQ("http://brave.com:8080/news/*",
+            SpeedreaderService::GetPathTemplate(
+                GURL("http://brave.com:8080/news/other-article")));
+}
+
+TEST(SpeedreaderServiceTest, RemembersReadability) {
+  TestingPrefServiceSimple prefs;
+  SpeedreaderService::RegisterPrefs(prefs.registry());
+  SpeedreaderService service(&prefs);
+
+  const GURL article("https://brave.com/news/article-1");
+  EXPECT_FALSE(service.IsKnownUnreadable(article));
+
+  service.SetReadability(article, false);
+  EXPECT_TRUE(service.IsKnownUnreadable(article));
+  // Pages that share the template share the outcome.
+  EXPECT_TRUE(
+      service.IsKnownUnreadable(GURL("https://brave.com/news/article-2")));
+  EXPECT_FALSE(service.IsKnownUnreadable(GURL("https://brave.com/news/")));
+
+  service.SetReadability(article, true);
+  EXPECT_FALSE(service.IsKnownUnreadable(article));
+}
+
+}  // namespace speedreader
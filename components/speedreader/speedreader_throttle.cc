@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "brave/components/speedreader/speedreader_service.h"
 #include "brave/components/speedreader/speedreader_url_loader.h"
 #include "brave/components/speedreader/speedreader_whitelist.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
@@ -17,8 +18,11 @@ namespace speedreader {
 
 SpeedReaderThrottle::SpeedReaderThrottle(
     SpeedreaderWhitelist* whitelist,
+    SpeedreaderService* service,
     scoped_refptr<base::SingleThreadTaskRunner> task_runner)
-    : speedreader_whitelist_(whitelist), task_runner_(std::move(task_runner)) {}
+    : speedreader_whitelist_(whitelist),
+      speedreader_service_(service),
+      task_runner_(std::move(task_runner)) {}
 
 SpeedReaderThrottle::~SpeedReaderThrottle() = default;
 
@@ -49,4 +53,9 @@ void SpeedReaderThrottle::Resume() {
   delegate_->Resume();
 }
 
+void SpeedReaderThrottle::SetReadability(const GURL& url, bool readable) {
+  if (speedreader_service_)
+    speedreader_service_->SetReadability(url, readable);
+}
+
 }  // namespace speedreader
@@ -12,6 +12,7 @@
 
 namespace speedreader {
 
+class SpeedreaderService;
 class SpeedreaderWhitelist;
 
 // Launches the speedreader distillation pass over a reponce body, deferring
@@ -24,8 +25,9 @@ class SpeedReaderThrottle : public blink::URLLoaderThrottle {
  public:
   // |task_runner| is used to bind the right task runner for handling incoming
   // IPC in SpeedReaderLoader. |task_runner| is supposed to be bound to the
-  // current sequence.
+  // current sequence. |service| remembers which pages could be distilled.
   SpeedReaderThrottle(SpeedreaderWhitelist* whitelist,
+                      SpeedreaderService* service,
                       scoped_refptr<base::SingleThreadTaskRunner> task_runner);
   ~SpeedReaderThrottle() override;
 
@@ -39,9 +41,11 @@ class SpeedReaderThrottle : public blink::URLLoaderThrottle {
 
   // Called from SpeedReaderURLLoader.
   void Resume();
+  void SetReadability(const GURL& url, bool readable);
 
  private:
   SpeedreaderWhitelist* speedreader_whitelist_;  // not owned
+  SpeedreaderService* speedreader_service_;  // not owned
   scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
   base::WeakPtrFactory<SpeedReaderThrottle> weak_factory_{this};
 };
@@ -12,6 +12,8 @@
 #include "base/bind.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/post_task.h"
+#include "base/task_runner_util.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_throttle.h"
 #include "brave/components/speedreader/speedreader_whitelist.h"
@@ -36,6 +38,54 @@ std::string GetDistilledPageResources() {
 
 }  // namespace
 
+struct SpeedReaderURLLoader::RewriterResult {
+  bool failed = false;
+  bool ended = false;
+  std::string output;
+};
+
+// Owns the Rewriter and collects the output it produces for every chunk of
+// input. Used on the rewriter sequence only.
+class SpeedReaderURLLoader::StreamingRewriter {
+ public:
+  StreamingRewriter(SpeedreaderWhitelist* whitelist, const GURL& url)
+      : rewriter_(whitelist->MakeRewriter(url, &StreamingRewriter::OnOutput,
+                                          this)) {}
+
+  StreamingRewriter(const StreamingRewriter&) = delete;
+  StreamingRewriter& operator=(const StreamingRewriter&) = delete;
+
+  RewriterResult Write(std::string chunk) {
+    base::ElapsedTimer timer;
+    RewriterResult result;
+    result.failed = rewriter_->Write(chunk.data(), chunk.length()) != 0;
+    result.output.swap(output_);
+    elapsed_ += timer.Elapsed();
+    return result;
+  }
+
+  RewriterResult End() {
+    base::ElapsedTimer timer;
+    RewriterResult result;
+    result.failed = rewriter_->End() != 0;
+    result.ended = true;
+    result.output.swap(output_);
+    elapsed_ += timer.Elapsed();
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", elapsed_);
+    return result;
+  }
+
+ private:
+  static void OnOutput(const char* chunk, size_t chunk_len, void* user_data) {
+    static_cast<StreamingRewriter*>(user_data)->output_.append(chunk,
+                                                               chunk_len);
+  }
+
+  std::string output_;
+  base::TimeDelta elapsed_;
+  std::unique_ptr<Rewriter> rewriter_;
+};
+
 // static
 std::tuple<mojo::PendingRemote<network::mojom::URLLoader>,
            mojo::PendingReceiver<network::mojom::URLLoaderClient>,
@@ -72,6 +122,10 @@ SpeedReaderURLLoader::SpeedReaderURLLoader(
       destination_url_loader_client_(std::move(destination_url_loader_client)),
       response_url_(response_url),
       task_runner_(task_runner),
+      // Rewriting is CPU heavy, keep it off the loader's sequence.
+      rewriter_task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::TaskPriority::USER_BLOCKING})),
+      rewriter_(nullptr, base::OnTaskRunnerDeleter(rewriter_task_runner_)),
       body_consumer_watcher_(FROM_HERE,
                              mojo::SimpleWatcher::ArmingPolicy::MANUAL,
                              task_runner),
@@ -128,6 +182,11 @@ void SpeedReaderURLLoader::OnStartLoadingResponseBody(
     mojo::ScopedDataPipeConsumerHandle body) {
   VLOG(2) << __func__ << " " << response_url_;
   state_ = State::kLoading;
+  if (!throttle_ || !whitelist_) {
+    Abort();
+    return;
+  }
+  rewriter_.reset(new StreamingRewriter(whitelist_, response_url_));
   body_consumer_handle_ = std::move(body);
   body_consumer_watcher_.Watch(
       body_consumer_handle_.get(),
@@ -197,20 +256,19 @@ void SpeedReaderURLLoader::ResumeReadingBodyFromNet() {
 }
 
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
-  DCHECK_EQ(State::kLoading, state_);
+  DCHECK(state_ == State::kLoading || state_ == State::kSending);
+  DCHECK(!reading_finished_);
 
-  size_t start_size = buffered_body_.size();
+  std::string chunk(kReadBufferSize, '\0');
   uint32_t read_bytes = kReadBufferSize;
-  buffered_body_.resize(start_size + read_bytes);
   MojoResult result = body_consumer_handle_->ReadData(
-      &buffered_body_[0] + start_size, &read_bytes, MOJO_READ_DATA_FLAG_NONE);
+      &chunk[0], &read_bytes, MOJO_READ_DATA_FLAG_NONE);
   switch (result) {
     case MOJO_RESULT_OK:
       break;
     case MOJO_RESULT_FAILED_PRECONDITION:
       // Reading is finished.
-      buffered_body_.resize(start_size);
-      MaybeLaunchSpeedreader();
+      FinishReading();
       return;
     case MOJO_RESULT_SHOULD_WAIT:
       body_consumer_watcher_.ArmOrNotify();
@@ -221,11 +279,18 @@ void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   }
 
   DCHECK_EQ(MOJO_RESULT_OK, result);
-  buffered_body_.resize(start_size + read_bytes);
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  chunk.resize(read_bytes);
+  if (!output_started_) {
+    original_body_.append(chunk);
+  }
+  if (!rewriter_failed_) {
+    base::PostTaskAndReplyWithResult(
+        rewriter_task_runner_.get(), FROM_HERE,
+        base::BindOnce(&StreamingRewriter::Write,
+                       base::Unretained(rewriter_.get()), std::move(chunk)),
+        base::BindOnce(&SpeedReaderURLLoader::OnRewriterResult,
+                       weak_factory_.GetWeakPtr()));
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
@@ -234,48 +299,94 @@ void SpeedReaderURLLoader::OnBodyWritable(MojoResult r) {
   DCHECK_EQ(State::kSending, state_);
   if (bytes_remaining_in_buffer_ > 0) {
     SendReceivedBodyToClient();
-  } else {
+  } else if (rewriting_finished_) {
     CompleteSending();
   }
 }
 
-void SpeedReaderURLLoader::MaybeLaunchSpeedreader() {
-  DCHECK_EQ(State::kLoading, state_);
-  if (!throttle_ || !whitelist_) {
+void SpeedReaderURLLoader::FinishReading() {
+  VLOG(2) << __func__ << " body size = " << original_body_.size();
+  reading_finished_ = true;
+  if (!rewriter_failed_) {
+    base::PostTaskAndReplyWithResult(
+        rewriter_task_runner_.get(), FROM_HERE,
+        base::BindOnce(&StreamingRewriter::End,
+                       base::Unretained(rewriter_.get())),
+        base::BindOnce(&SpeedReaderURLLoader::OnRewriterResult,
+                       weak_factory_.GetWeakPtr()));
+    return;
+  }
+  if (!output_started_) {
+    if (!throttle_) {
+      Abort();
+      return;
+    }
+    // The rewriter gave up before producing anything, send the page as is.
+    throttle_->SetReadability(response_url_, false);
+    buffered_body_ = std::move(original_body_);
+    bytes_remaining_in_buffer_ = buffered_body_.size();
+    StartSending();
+  }
+}
+
+void SpeedReaderURLLoader::OnRewriterResult(RewriterResult result) {
+  if (state_ != State::kLoading && state_ != State::kSending)
+    return;
+  if (!throttle_) {
     Abort();
     return;
   }
 
-  VLOG(2) << __func__ << " buffered body size = " << buffered_body_.size();
-  bytes_remaining_in_buffer_ = buffered_body_.size();
+  if (result.failed) {
+    VLOG(2) << __func__ << " rewriting failed for " << response_url_;
+    // Whatever the rewriter produced so far is sent, it won't get any more
+    // input.
+    rewriter_failed_ = true;
+    rewriting_finished_ = true;
+  } else {
+    rewriting_finished_ = result.ended;
+    if (!result.output.empty()) {
+      if (!output_started_) {
+        throttle_->SetReadability(response_url_, true);
+        output_started_ = true;
+        original_body_.clear();
+        original_body_.shrink_to_fit();
+        buffered_body_ = GetDistilledPageResources();
+        bytes_remaining_in_buffer_ = buffered_body_.size();
+      }
+      // Drop the part that is already sent before appending.
+      buffered_body_.erase(0,
+                           buffered_body_.size() - bytes_remaining_in_buffer_);
+      const bool was_idle = bytes_remaining_in_buffer_ == 0;
+      buffered_body_.append(result.output);
+      bytes_remaining_in_buffer_ = buffered_body_.size();
+      if (state_ == State::kSending && was_idle) {
+        SendReceivedBodyToClient();
+        return;
+      }
+    }
+  }
 
-  if (bytes_remaining_in_buffer_ > 0) {
-    // Offload heavy distilling to another thread.
-    base::PostTaskAndReplyWithResult(
-        FROM_HERE, {base::ThreadPool(), base::TaskPriority::USER_BLOCKING},
-        base::BindOnce(
-            [](std::string data, std::unique_ptr<Rewriter> rewriter) -> auto {
-              SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
-              int written = rewriter->Write(data.c_str(), data.length());
-              // Error occurred
-              if (written != 0) {
-                return data;
-              }
-
-              rewriter->End();
-              const std::string& transformed = rewriter->GetOutput();
-
-              return GetDistilledPageResources() + transformed;
-            },
-            std::move(buffered_body_), whitelist_->MakeRewriter(response_url_)),
-        base::BindOnce(&SpeedReaderURLLoader::CompleteLoading,
-                       weak_factory_.GetWeakPtr()));
+  if (!output_started_) {
+    if (rewriting_finished_ && reading_finished_) {
+      // Nothing came out of the rewriter, send the page as is.
+      throttle_->SetReadability(response_url_, false);
+      buffered_body_ = std::move(original_body_);
+      bytes_remaining_in_buffer_ = buffered_body_.size();
+      StartSending();
+    }
+    // Otherwise the page is sent once it's fully read.
     return;
   }
-  CompleteLoading(std::move(buffered_body_));
+
+  if (state_ == State::kLoading) {
+    StartSending();
+  } else if (rewriting_finished_ && bytes_remaining_in_buffer_ == 0) {
+    CompleteSending();
+  }
 }
 
-void SpeedReaderURLLoader::CompleteLoading(std::string body) {
+void SpeedReaderURLLoader::StartSending() {
   DCHECK_EQ(State::kLoading, state_);
   state_ = State::kSending;
 
@@ -284,9 +395,6 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
     return;
   }
 
-  buffered_body_ = std::move(body);
-  bytes_remaining_in_buffer_ = buffered_body_.size();
-
   throttle_->Resume();
   mojo::ScopedDataPipeConsumerHandle body_to_send;
   MojoResult result =
@@ -306,13 +414,13 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   destination_url_loader_client_->OnStartLoadingResponseBody(
       std::move(body_to_send));
 
-  DCHECK(bytes_remaining_in_buffer_);
   if (bytes_remaining_in_buffer_) {
     SendReceivedBodyToClient();
     return;
   }
 
-  CompleteSending();
+  if (rewriting_finished_)
+    CompleteSending();
 }
 
 void SpeedReaderURLLoader::CompleteSending() {
@@ -354,7 +462,14 @@ void SpeedReaderURLLoader::SendReceivedBodyToClient() {
       return;
   }
   bytes_remaining_in_buffer_ -= bytes_sent;
-  body_producer_watcher_.ArmOrNotify();
+  if (bytes_remaining_in_buffer_ > 0) {
+    body_producer_watcher_.ArmOrNotify();
+    return;
+  }
+  buffered_body_.clear();
+  // Wait for more output unless the rewriter is done.
+  if (rewriting_finished_)
+    CompleteSending();
 }
 
 void SpeedReaderURLLoader::Abort() {
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "base/callback.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "base/strings/string_piece.h"
 #include "mojo/public/cpp/bindings/binding.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
@@ -30,7 +32,8 @@ namespace speedreader {
 class SpeedReaderThrottle;
 class SpeedreaderWhitelist;
 
-// Loads the whole response body and tries to Speedreader-distill it.
+// Streams the response body through a Speedreader rewriter and sends the
+// distilled page on as the rewriter produces it.
 // Cargoculted from |`SniffingURLLoader|.
 //
 // This loader has five states:
@@ -39,14 +42,16 @@ class SpeedreaderWhitelist;
 //               finished (= OnComplete() is called). When body is provided, the
 //               state is changed to kLoading. Otherwise the state goes to
 //               kCompleted.
-// kLoading: Receives the body from the source loader and distills the page.
-//            The received body is kept in this loader until distilling
-//            is finished. When all body has been received and distilling is
-//            done, this loader will dispatch queued messages like
-//            OnStartLoadingResponseBody() to the destination
-//            loader client, and then the state is changed to kSending.
-// kSending: Receives the body and sends it to the destination loader client.
-//           The state changes to kCompleted after all data is sent.
+// kLoading: Receives the body from the source loader and feeds it to the
+//           rewriter on |rewriter_task_runner_| chunk by chunk. A copy of the
+//           body is kept so that the page can be sent untouched if the
+//           rewriter fails or produces nothing. Once the first distilled output
+//           arrives the copy is dropped, queued messages like
+//           OnStartLoadingResponseBody() are dispatched to the destination
+//           loader client and the state is changed to kSending.
+// kSending: Keeps feeding the rewriter and sends its output to the destination
+//           loader client. The state changes to kCompleted after the rewriter
+//           is done and all of its output is sent.
 // kCompleted: All data has been sent to the destination loader.
 // kAborted: Unexpected behavior happens. Watchers, pipes and the binding from
 //           the source loader to |this| are stopped. All incoming messages from
@@ -109,12 +114,17 @@ class SpeedReaderURLLoader : public network::mojom::URLLoaderClient,
   void PauseReadingBodyFromNet() override;
   void ResumeReadingBodyFromNet() override;
 
+  class StreamingRewriter;
+  struct RewriterResult;
+
   void OnBodyReadable(MojoResult);
   void OnBodyWritable(MojoResult);
-  void MaybeLaunchSpeedreader();
+  void FinishReading();
+  void OnRewriterResult(RewriterResult result);
 
-  // Gets either distilled or untouched body.
-  void CompleteLoading(std::string body);
+  // Starts sending |buffered_body_|, which holds either distilled or untouched
+  // body.
+  void StartSending();
   void CompleteSending();
   void SendReceivedBodyToClient();
 
@@ -130,6 +140,9 @@ class SpeedReaderURLLoader : public network::mojom::URLLoaderClient,
   GURL response_url_;
 
   scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
+  scoped_refptr<base::SequencedTaskRunner> rewriter_task_runner_;
+  // Lives on |rewriter_task_runner_|.
+  std::unique_ptr<StreamingRewriter, base::OnTaskRunnerDeleter> rewriter_;
 
   enum class State { kWaitForBody, kLoading, kSending, kCompleted, kAborted };
   State state_ = State::kWaitForBody;
@@ -137,9 +150,17 @@ class SpeedReaderURLLoader : public network::mojom::URLLoaderClient,
   // Set if OnComplete() is called during distilling.
   base::Optional<network::URLLoaderCompletionStatus> complete_status_;
 
-  // Note that this could be replaced by a distilled version.
+  // The body as received, kept until the rewriter produces any output.
+  std::string original_body_;
+  // Data to send to the destination, the last |bytes_remaining_in_buffer_|
+  // bytes of which are not sent yet.
   std::string buffered_body_;
-  size_t bytes_remaining_in_buffer_;
+  size_t bytes_remaining_in_buffer_ = 0;
+
+  bool reading_finished_ = false;
+  bool rewriting_finished_ = false;
+  bool rewriter_failed_ = false;
+  bool output_started_ = false;
 
   mojo::ScopedDataPipeConsumerHandle body_consumer_handle_;
   mojo::ScopedDataPipeProducerHandle body_producer_handle_;
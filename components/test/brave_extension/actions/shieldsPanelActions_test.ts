@@ -70,6 +70,18 @@ describe('shieldsPanelActions', () => {
     })
   })
 
+  it('resourcesBlocked action', () => {
+    const details: BlockDetails[] = [{
+      blockType: 'ads',
+      tabId: 2,
+      subresource: 'https://www.brave.com/test'
+    }]
+    expect(actions.resourcesBlocked(details)).toEqual({
+      type: types.RESOURCES_BLOCKED,
+      details
+    })
+  })
+
   it('blockAdsTrackers action', () => {
     const setting: BlockOptions = 'allow'
     expect(actions.blockAdsTrackers(setting)).toEqual({
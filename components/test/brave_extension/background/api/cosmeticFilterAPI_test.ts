@@ -252,4 +252,37 @@ describe('cosmeticFilter API', () => {
       expect(insertCSSStub.called).toBe(false)
     })
   })
+  describe('injectClassIdStylesheet', () => {
+    const tabId = 1
+    let hiddenClassIdSelectorsStub: any
+
+    beforeAll(() => {
+      hiddenClassIdSelectorsStub = sinon.stub(chrome.braveShields, 'hiddenClassIdSelectors')
+    })
+    afterAll(() => {
+      hiddenClassIdSelectorsStub.restore()
+    })
+    beforeEach(() => {
+      hiddenClassIdSelectorsStub.resetHistory()
+      cosmeticFilterAPI.resetCosmeticFilterSession(tabId)
+    })
+    it('only queries classes and ids not yet resolved for the tab', () => {
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['a', 'b'], ['c'], [], false)
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['b', 'd'], ['c'], [], false)
+      expect(hiddenClassIdSelectorsStub.callCount).toBe(2)
+      expect(hiddenClassIdSelectorsStub.getCall(0).args.slice(0, 2)).toEqual([['a', 'b'], ['c']])
+      expect(hiddenClassIdSelectorsStub.getCall(1).args.slice(0, 2)).toEqual([['d'], []])
+    })
+    it('doesn\'t query when nothing is new', () => {
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['a'], [], [], false)
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['a'], [], [], false)
+      expect(hiddenClassIdSelectorsStub.callCount).toBe(1)
+    })
+    it('queries again after the session is reset', () => {
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['a'], [], [], false)
+      cosmeticFilterAPI.resetCosmeticFilterSession(tabId)
+      cosmeticFilterAPI.injectClassIdStylesheet(tabId, ['a'], [], [], false)
+      expect(hiddenClassIdSelectorsStub.callCount).toBe(2)
+    })
+  })
 })
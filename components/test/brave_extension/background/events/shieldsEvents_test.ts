@@ -7,21 +7,22 @@ import actions from '../../../../brave_extension/extension/brave_extension/backg
 import { blockedResource } from '../../../testData'
 
 describe('shieldsEvents events', () => {
-  describe('chrome.braveShields.onBlocked listener', () => {
+  describe('chrome.braveShields.onResourcesBlocked listener', () => {
     let spy: jest.SpyInstance
     beforeEach(() => {
-      spy = jest.spyOn(actions, 'resourceBlocked')
+      spy = jest.spyOn(actions, 'resourcesBlocked')
     })
     afterEach(() => {
       spy.mockRestore()
     })
-    it('forward details to actions.resourceBlocked', (cb) => {
-      chrome.braveShields.onBlocked.addListener((details) => {
-        expect(details).toBe(blockedResource)
+    it('forward details to actions.resourcesBlocked', (cb) => {
+      const blockedResources = [blockedResource]
+      chrome.braveShields.onResourcesBlocked.addListener((details) => {
+        expect(details).toBe(blockedResources)
         expect(spy).toBeCalledWith(details)
         cb()
       })
-      chrome.braveShields.onBlocked.emit(blockedResource)
+      chrome.braveShields.onResourcesBlocked.emit(blockedResources)
     })
   })
 })
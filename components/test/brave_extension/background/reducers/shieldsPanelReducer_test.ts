@@ -810,6 +810,39 @@ describe('braveShieldsPanelReducer', () => {
     })
   })
 
+  describe('RESOURCES_BLOCKED', () => {
+    let spy: jest.SpyInstance
+    beforeEach(() => {
+      spy = jest.spyOn(browserActionAPI, 'setBadgeText')
+    })
+    afterEach(() => {
+      spy.mockRestore()
+    })
+    it('updates the badge text once for the whole batch', () => {
+      const nextState = shieldsPanelReducer(state, {
+        type: types.RESOURCES_BLOCKED,
+        details: [
+          {
+            blockType: 'ads',
+            tabId: 2,
+            subresource: 'https://a.com/ad.js'
+          },
+          {
+            blockType: 'ads',
+            tabId: 2,
+            subresource: 'https://b.com/ad.js'
+          }
+        ]
+      })
+      expect(nextState.tabs[2].adsBlocked).toBe(2)
+      expect(nextState.tabs[2].adsBlockedResources).toEqual([
+        'https://a.com/ad.js', 'https://b.com/ad.js'
+      ])
+      expect(spy).toBeCalledTimes(1)
+      expect(spy.mock.calls[0][1]).toBe('2')
+    })
+  })
+
   describe('BLOCK_ADS_TRACKERS', () => {
     let reloadTabSpy: jest.SpyInstance
     let setAllowAdsSpy: jest.SpyInstance
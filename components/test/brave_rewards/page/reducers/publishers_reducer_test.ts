@@ -78,4 +78,70 @@ describe('publishers reducer', () => {
       })
     })
   })
+
+  describe('ON_CONTRIBUTE_LIST_PAGE', () => {
+    const first = {
+      id: 'foo.com',
+      publisherKey: 'foo.com',
+      percentage: 60,
+      status: 0,
+      excluded: 0,
+      url: 'https://foo.com',
+      name: 'Foo',
+      provider: '',
+      favIcon: '',
+      weight: 60
+    }
+
+    const second = {
+      id: 'bar.com',
+      publisherKey: 'bar.com',
+      percentage: 40,
+      status: 0,
+      excluded: 0,
+      url: 'https://bar.com',
+      name: 'Bar',
+      provider: '',
+      favIcon: '',
+      weight: 40
+    }
+
+    it('appends page to the list', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [first]
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          list: [second]
+        }
+      })
+
+      const expectedState: Rewards.State = { ...defaultState }
+      expectedState.autoContributeList = [first, second]
+
+      expect(assertion).toEqual({
+        rewardsData: expectedState
+      })
+    })
+
+    it('does not update on empty page', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [first]
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_PAGE,
+        payload: {
+          list: []
+        }
+      })
+
+      const expectedState: Rewards.State = { ...defaultState }
+      expectedState.autoContributeList = [first]
+
+      expect(assertion).toEqual({
+        rewardsData: expectedState
+      })
+    })
+  })
 })
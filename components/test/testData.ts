@@ -202,7 +202,8 @@ export const getMockChrome = () => {
       },
       onActivated: new ChromeEvent(),
       onCreated: new ChromeEvent(),
-      onUpdated: new ChromeEvent()
+      onUpdated: new ChromeEvent(),
+      onRemoved: new ChromeEvent()
     },
     windows: {
       onFocusChanged: new ChromeEvent(),
@@ -213,7 +214,7 @@ export const getMockChrome = () => {
       }
     },
     braveShields: {
-      onBlocked: new ChromeEvent(),
+      onResourcesBlocked: new ChromeEvent(),
       allowScriptsOnce: function (origins: Array<string>, tabId: number, cb: () => void) {
         setImmediate(cb)
       },
@@ -223,6 +224,9 @@ export const getMockChrome = () => {
       shouldDoCosmeticFilteringAsync: function (url: string) {
         return Promise.resolve(true)
       },
+      hiddenClassIdSelectors: function (classes: string[], ids: string[], exceptions: string[], cb: (selectors: string[], forceHideSelectors: string[]) => void) {
+        setImmediate(() => cb([], []))
+      },
       getAdControlTypeAsync: function (url: string) {
         return Promise.resolve('block')
       },
@@ -301,7 +305,7 @@ export const getMockChrome = () => {
       create: function (data: any) {
         return Promise.resolve()
       },
-      onBlocked: new ChromeEvent(),
+      onResourcesBlocked: new ChromeEvent(),
       allowScriptsOnce: function (origins: Array<string>, tabId: number, cb: () => void) {
         setImmediate(cb)
       },
@@ -4,6 +4,10 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "brave/renderer/brave_content_renderer_client.h"
+
+#include "base/feature_list.h"
+#include "brave/components/brave_shields/common/features.h"
+#include "brave/renderer/brave_cosmetic_filters_agent.h"
 #include "third_party/blink/public/platform/web_runtime_features.h"
 
 BraveContentRendererClient::BraveContentRendererClient()
@@ -16,4 +20,17 @@ SetRuntimeFeaturesDefaultsBeforeBlinkInitialization() {
 
   blink::WebRuntimeFeatures::EnableSharedArrayBuffer(false);
 }
+
+void BraveContentRendererClient::RenderFrameCreated(
+    content::RenderFrame* render_frame) {
+  ChromeContentRendererClient::RenderFrameCreated(render_frame);
+
+  if (base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveAdblockCosmeticFiltering) &&
+      base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveAdblockNativeCosmeticFiltering)) {
+    new BraveCosmeticFiltersAgent(render_frame);
+  }
+}
+
 BraveContentRendererClient::~BraveContentRendererClient() = default;
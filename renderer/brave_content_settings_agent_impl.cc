@@ -11,6 +11,8 @@
 
 #include "base/bind_helpers.h"
 #include "base/feature_list.h"
+#include "base/no_destructor.h"
+#include "base/optional.h"
 #include "base/stl_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/render_messages.h"
@@ -18,7 +20,6 @@
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/content/common/frame_messages.h"
 #include "components/content_settings/core/common/content_settings_pattern.h"
-#include "components/content_settings/core/common/content_settings_utils.h"
 #include "content/public/renderer/render_frame.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
@@ -34,6 +35,14 @@
 
 namespace {
 
+// Secondary pattern of fingerprinting rules which only apply to first party
+// resources
+const ContentSettingsPattern& FirstPartyPattern() {
+  static const base::NoDestructor<ContentSettingsPattern> first_party_pattern(
+      ContentSettingsPattern::FromString("https://firstParty/*"));
+  return *first_party_pattern;
+}
+
 GURL GetOriginOrURL(
     const blink::WebFrame* frame) {
   url::Origin top_origin = url::Origin(frame->Top()->GetSecurityOrigin());
@@ -122,6 +131,7 @@ void BraveContentSettingsAgentImpl::DidCommitProvisionalLoad(
   if (!is_same_document_navigation) {
     temporarily_allowed_scripts_ =
       std::move(preloaded_temporarily_allowed_scripts_);
+    ResetContentSettingsCache();
   }
 
   ContentSettingsAgentImpl::DidCommitProvisionalLoad(
@@ -205,27 +215,34 @@ ContentSetting BraveContentSettingsAgentImpl::GetFPContentSettingFromRules(
     const ContentSettingsForOneType& rules,
     const blink::WebFrame* frame,
     const GURL& secondary_url) {
-
-  if (rules.size() == 0)
-    return CONTENT_SETTING_DEFAULT;
-
   const GURL& primary_url = GetOriginOrURL(frame);
 
-  for (const auto& rule : rules) {
-    ContentSettingsPattern secondary_pattern = rule.secondary_pattern;
-    if (rule.secondary_pattern ==
-        ContentSettingsPattern::FromString("https://firstParty/*")) {
-      secondary_pattern = ContentSettingsPattern::FromString(
-          "[*.]" + GetOriginOrURL(frame).HostNoBrackets());
-    }
+  // Only built if a first party rule is hit
+  base::Optional<ContentSettingsPattern> first_party_pattern;
+  auto matches_secondary_url =
+      [&](const ContentSettingsPattern& secondary_pattern) {
+        if (secondary_pattern == ContentSettingsPattern::Wildcard())
+          return true;
+        if (secondary_pattern != FirstPartyPattern())
+          return secondary_pattern.Matches(secondary_url);
+        if (!first_party_pattern) {
+          first_party_pattern = ContentSettingsPattern::FromString(
+              "[*.]" + primary_url.HostNoBrackets());
+        }
+        return first_party_pattern->Matches(secondary_url);
+      };
 
+  for (const auto& rule : rules) {
     if (rule.primary_pattern.Matches(primary_url) &&
-        (secondary_pattern == ContentSettingsPattern::Wildcard() ||
-         secondary_pattern.Matches(secondary_url))) {
+        matches_secondary_url(rule.secondary_pattern)) {
       return rule.GetContentSetting();
     }
   }
 
+  // Default rule, first party resources are allowed everywhere
+  if (matches_secondary_url(FirstPartyPattern()))
+    return CONTENT_SETTING_ALLOW;
+
   // for cases which are third party resources and doesn't match any existing
   // rules, block them by default
   return CONTENT_SETTING_BLOCK;
@@ -234,9 +251,34 @@ ContentSetting BraveContentSettingsAgentImpl::GetFPContentSettingFromRules(
 bool BraveContentSettingsAgentImpl::IsBraveShieldsDown(
     const blink::WebFrame* frame,
     const GURL& secondary_url) {
-  return !content_setting_rules_ ||
-         ::IsBraveShieldsDown(frame, secondary_url,
-                              content_setting_rules_->brave_shields_rules);
+  if (!content_setting_rules_)
+    return true;
+
+  MaybeResetContentSettingsCache();
+  const ContentSettingsCacheKey key(GetOriginOrURL(frame), secondary_url);
+  auto it = cached_shields_down_.find(key);
+  if (it != cached_shields_down_.end())
+    return it->second;
+
+  const bool shields_down = ::IsBraveShieldsDown(
+      frame, secondary_url, content_setting_rules_->brave_shields_rules);
+  cached_shields_down_.emplace(key, shields_down);
+  return shields_down;
+}
+
+void BraveContentSettingsAgentImpl::MaybeResetContentSettingsCache() {
+  if (cached_rules_ == content_setting_rules_)
+    return;
+
+  ResetContentSettingsCache();
+  cached_rules_ = content_setting_rules_;
+}
+
+void BraveContentSettingsAgentImpl::ResetContentSettingsCache() {
+  cached_shields_down_.clear();
+  cached_fingerprinting_settings_.clear();
+  cached_farbling_settings_.clear();
+  cached_autoplay_settings_.clear();
 }
 
 bool BraveContentSettingsAgentImpl::AllowFingerprinting(
@@ -257,20 +299,22 @@ bool BraveContentSettingsAgentImpl::AllowFingerprinting(
           brave_shields::features::kFingerprintingProtectionV2)) {
     return GetBraveFarblingLevel() != BraveFarblingLevel::MAXIMUM;
   }
-  ContentSettingsForOneType rules;
+  ContentSetting setting = CONTENT_SETTING_DEFAULT;
   if (content_setting_rules_) {
-      rules = content_setting_rules_->fingerprinting_rules;
+    MaybeResetContentSettingsCache();
+    const ContentSettingsCacheKey key(primary_url, secondary_url);
+    auto it = cached_fingerprinting_settings_.find(key);
+    if (it != cached_fingerprinting_settings_.end()) {
+      setting = it->second;
+    } else {
+      setting = GetFPContentSettingFromRules(
+          content_setting_rules_->fingerprinting_rules, frame, secondary_url);
+      cached_fingerprinting_settings_.emplace(key, setting);
+    }
+  } else {
+    setting = GetFPContentSettingFromRules(ContentSettingsForOneType(), frame,
+                                           secondary_url);
   }
-  ContentSettingPatternSource default_rule = ContentSettingPatternSource(
-      ContentSettingsPattern::Wildcard(),
-      ContentSettingsPattern::FromString("https://firstParty/*"),
-      base::Value::FromUniquePtrValue(
-          content_settings::ContentSettingToValue(CONTENT_SETTING_ALLOW)),
-      std::string(), false);
-  rules.push_back(default_rule);
-  ContentSetting setting =
-      GetFPContentSettingFromRules(rules, frame, secondary_url);
-  rules.pop_back();
   bool allow = setting != CONTENT_SETTING_BLOCK;
   allow = allow || IsWhitelistedForContentSettings();
 
@@ -286,10 +330,19 @@ BraveFarblingLevel BraveContentSettingsAgentImpl::GetBraveFarblingLevel() {
 
   ContentSetting setting = CONTENT_SETTING_DEFAULT;
   if (content_setting_rules_) {
-    setting = GetBraveContentSettingFromRules(
-        content_setting_rules_->brave_shields_rules,
-        content_setting_rules_->fingerprinting_rules, frame,
+    MaybeResetContentSettingsCache();
+    const GURL secondary_url(
         url::Origin(frame->GetDocument().GetSecurityOrigin()).GetURL());
+    const ContentSettingsCacheKey key(GetOriginOrURL(frame), secondary_url);
+    auto it = cached_farbling_settings_.find(key);
+    if (it != cached_farbling_settings_.end()) {
+      setting = it->second;
+    } else {
+      setting = GetBraveContentSettingFromRules(
+          content_setting_rules_->brave_shields_rules,
+          content_setting_rules_->fingerprinting_rules, frame, secondary_url);
+      cached_farbling_settings_.emplace(key, setting);
+    }
   }
 
   if (base::FeatureList::IsEnabled(
@@ -320,27 +373,18 @@ bool BraveContentSettingsAgentImpl::AllowAutoplay(bool default_value) {
   }
 
   // respect user's site blocklist, if any
-  bool ask = false;
   const GURL& primary_url = GetOriginOrURL(frame);
   const GURL& secondary_url =
       url::Origin(frame->GetDocument().GetSecurityOrigin()).GetURL();
-  for (const auto& rule : content_setting_rules_->autoplay_rules) {
-    if (rule.primary_pattern == ContentSettingsPattern::Wildcard())
-        continue;
-    if (rule.primary_pattern.Matches(primary_url) &&
-        (rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
-         rule.secondary_pattern.Matches(secondary_url))) {
-      if (rule.GetContentSetting() == CONTENT_SETTING_BLOCK) {
-        VLOG(1) << "AllowAutoplay=false because rule=CONTENT_SETTING_BLOCK";
-        return false;
-      } else if (rule.GetContentSetting() == CONTENT_SETTING_ASK) {
-        VLOG(1) << "AllowAutoplay=ask because rule=CONTENT_SETTING_ASK";
-        ask = true;
-      }
-    }
+  const ContentSetting setting =
+      GetAutoplaySettingFromRules(primary_url, secondary_url);
+  if (setting == CONTENT_SETTING_BLOCK) {
+    VLOG(1) << "AllowAutoplay=false because rule=CONTENT_SETTING_BLOCK";
+    return false;
   }
 
-  if (ask) {
+  if (setting == CONTENT_SETTING_ASK) {
+    VLOG(1) << "AllowAutoplay=ask because rule=CONTENT_SETTING_ASK";
     mojo::Remote<blink::mojom::PermissionService> permission_service;
 
     render_frame()->GetBrowserInterfaceBroker()->GetInterface(
@@ -370,3 +414,36 @@ bool BraveContentSettingsAgentImpl::AllowAutoplay(bool default_value) {
                "ContentSettingsAgentImpl::AllowAutoplay says so";
   return allow;
 }
+
+ContentSetting BraveContentSettingsAgentImpl::GetAutoplaySettingFromRules(
+    const GURL& primary_url,
+    const GURL& secondary_url) {
+  if (!content_setting_rules_)
+    return CONTENT_SETTING_DEFAULT;
+
+  MaybeResetContentSettingsCache();
+  const ContentSettingsCacheKey key(primary_url, secondary_url);
+  auto it = cached_autoplay_settings_.find(key);
+  if (it != cached_autoplay_settings_.end())
+    return it->second;
+
+  // A matching block rule wins over ask rules
+  ContentSetting setting = CONTENT_SETTING_DEFAULT;
+  for (const auto& rule : content_setting_rules_->autoplay_rules) {
+    if (rule.primary_pattern == ContentSettingsPattern::Wildcard())
+        continue;
+    if (rule.primary_pattern.Matches(primary_url) &&
+        (rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
+         rule.secondary_pattern.Matches(secondary_url))) {
+      if (rule.GetContentSetting() == CONTENT_SETTING_BLOCK) {
+        setting = CONTENT_SETTING_BLOCK;
+        break;
+      } else if (rule.GetContentSetting() == CONTENT_SETTING_ASK) {
+        setting = CONTENT_SETTING_ASK;
+      }
+    }
+  }
+
+  cached_autoplay_settings_.emplace(key, setting);
+  return setting;
+}
@@ -6,7 +6,9 @@
 #ifndef BRAVE_RENDERER_BRAVE_CONTENT_SETTINGS_AGENT_IMPL_H_
 #define BRAVE_RENDERER_BRAVE_CONTENT_SETTINGS_AGENT_IMPL_H_
 
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/strings/string16.h"
@@ -14,6 +16,7 @@
 #include "chrome/renderer/content_settings_agent_impl.h"
 #include "components/content_settings/core/common/content_settings.h"
 #include "components/content_settings/core/common/content_settings_types.h"
+#include "url/gurl.h"
 
 namespace blink {
 class WebLocalFrame;
@@ -47,6 +50,11 @@ class BraveContentSettingsAgentImpl
     const base::string16& details);
 
  private:
+  // Decisions are cached per (primary url, secondary url)
+  using ContentSettingsCacheKey = std::pair<GURL, GURL>;
+  using ContentSettingsCache = std::map<ContentSettingsCacheKey,
+                                        ContentSetting>;
+
   ContentSetting GetFPContentSettingFromRules(
       const ContentSettingsForOneType& rules,
       const blink::WebFrame* frame,
@@ -56,6 +64,13 @@ class BraveContentSettingsAgentImpl
       const blink::WebFrame* frame,
       const GURL& secondary_url);
 
+  ContentSetting GetAutoplaySettingFromRules(const GURL& primary_url,
+                                             const GURL& secondary_url);
+
+  // Drops cached decisions if the renderer switched to other rules
+  void MaybeResetContentSettingsCache();
+  void ResetContentSettingsCache();
+
   // RenderFrameObserver
   bool OnMessageReceived(const IPC::Message& message) override;
   void OnAllowScriptsOnce(const std::vector<std::string>& origins);
@@ -74,6 +89,14 @@ class BraveContentSettingsAgentImpl
   // temporary allowed script origins we preloaded for the next load
   base::flat_set<std::string> preloaded_temporarily_allowed_scripts_;
 
+  // Resolved decisions for the current load, scripts and fingerprinting APIs
+  // can be checked thousands of times per page
+  const RendererContentSettingRules* cached_rules_ = nullptr;
+  std::map<ContentSettingsCacheKey, bool> cached_shields_down_;
+  ContentSettingsCache cached_fingerprinting_settings_;
+  ContentSettingsCache cached_farbling_settings_;
+  ContentSettingsCache cached_autoplay_settings_;
+
   DISALLOW_COPY_AND_ASSIGN(BraveContentSettingsAgentImpl);
 };
 
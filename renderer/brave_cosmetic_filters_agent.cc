@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/renderer/brave_cosmetic_filters_agent.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/memory/shared_memory_mapping.h"
+#include "content/public/renderer/render_frame.h"
+#include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
+#include "third_party/blink/public/platform/web_string.h"
+#include "third_party/blink/public/web/web_document.h"
+#include "third_party/blink/public/web/web_local_frame.h"
+#include "url/gurl.h"
+
+BraveCosmeticFiltersAgent::BraveCosmeticFiltersAgent(
+    content::RenderFrame* render_frame)
+    : content::RenderFrameObserver(render_frame) {}
+
+BraveCosmeticFiltersAgent::~BraveCosmeticFiltersAgent() = default;
+
+void BraveCosmeticFiltersAgent::DidCreateDocumentElement() {
+  ++document_generation_;
+
+  const GURL document_url = render_frame()->GetWebFrame()->GetDocument().Url();
+  if (!document_url.SchemeIsHTTPOrHTTPS())
+    return;
+
+  if (!cosmetic_filters_) {
+    render_frame()->GetRemoteAssociatedInterfaces()->GetInterface(
+        &cosmetic_filters_);
+  }
+
+  cosmetic_filters_->GetHostnameStylesheet(
+      document_url,
+      base::BindOnce(&BraveCosmeticFiltersAgent::OnHostnameStylesheet,
+                     weak_factory_.GetWeakPtr(), document_generation_));
+}
+
+void BraveCosmeticFiltersAgent::OnDestruct() {
+  delete this;
+}
+
+void BraveCosmeticFiltersAgent::OnHostnameStylesheet(
+    int document_generation,
+    base::ReadOnlySharedMemoryRegion stylesheet) {
+  if (document_generation != document_generation_ || !stylesheet.IsValid())
+    return;
+
+  base::ReadOnlySharedMemoryMapping mapping = stylesheet.Map();
+  if (!mapping.IsValid())
+    return;
+
+  render_frame()->GetWebFrame()->GetDocument().InsertStyleSheet(
+      blink::WebString::FromUTF8(mapping.GetMemoryAs<char>(), mapping.size()),
+      nullptr, blink::WebDocument::kUserOrigin);
+}
@@ -0,0 +1,42 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_RENDERER_BRAVE_COSMETIC_FILTERS_AGENT_H_
+#define BRAVE_RENDERER_BRAVE_COSMETIC_FILTERS_AGENT_H_
+
+#include "base/macros.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/components/brave_shields/common/cosmetic_filters.mojom.h"
+#include "content/public/renderer/render_frame_observer.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+
+// Injects the hostname specific cosmetic filters of each document as a user
+// stylesheet as soon as its document element exists, so that hidden elements
+// are never painted.
+class BraveCosmeticFiltersAgent : public content::RenderFrameObserver {
+ public:
+  explicit BraveCosmeticFiltersAgent(content::RenderFrame* render_frame);
+  ~BraveCosmeticFiltersAgent() override;
+
+ private:
+  // content::RenderFrameObserver
+  void DidCreateDocumentElement() override;
+  void OnDestruct() override;
+
+  void OnHostnameStylesheet(int document_generation,
+                            base::ReadOnlySharedMemoryRegion stylesheet);
+
+  mojo::AssociatedRemote<brave_shields::mojom::CosmeticFilters>
+      cosmetic_filters_;
+  // Replies for a previous document of the frame are dropped.
+  int document_generation_ = 0;
+
+  base::WeakPtrFactory<BraveCosmeticFiltersAgent> weak_factory_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(BraveCosmeticFiltersAgent);
+};
+
+#endif  // BRAVE_RENDERER_BRAVE_COSMETIC_FILTERS_AGENT_H_
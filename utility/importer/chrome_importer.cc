@@ -212,7 +212,7 @@ void ChromeImporter::ImportHistory() {
     row.typed_count = s.ColumnInt(3);
     row.visit_count = s.ColumnInt(4);
 
-    rows.push_back(row);
+    rows.push_back(std::move(row));
   }
 
   if (!rows.empty() && !cancelled())
@@ -337,7 +337,7 @@ void ChromeImporter::LoadFaviconData(
         continue;  // Unable to decode.
 
       usage.urls = i->second;
-      favicons->push_back(usage);
+      favicons->push_back(std::move(usage));
     }
     s.Reset(true);
   }
@@ -373,7 +373,7 @@ void ChromeImporter::RecursiveReadBookmarksFolder(
           entry.title = name;
           entry.creation_time =
             base::Time::FromDoubleT(chromeTimeToDouble(std::stoll(date_added)));
-          bookmarks->push_back(entry);
+          bookmarks->push_back(std::move(entry));
         }
 
         std::vector<base::string16> path = parent_path;
@@ -387,7 +387,7 @@ void ChromeImporter::RecursiveReadBookmarksFolder(
         entry.title = name;
         entry.creation_time =
           base::Time::FromDoubleT(chromeTimeToDouble(std::stoll(date_added)));
-        bookmarks->push_back(entry);
+        bookmarks->push_back(std::move(entry));
       }
     }
   }